@@ -43,8 +43,15 @@ def create_interface_file(args):
               "    entry [reductiontarget] void reduction_action(Arg arg);\n" \
               "\n" \
               "    entry void perform_algorithm();\n" \
+              "\n" \
+              "    entry void perform_algorithm(bool);\n" \
               "\n" % (args['algorithm_name'], args['algorithm_name'])
 
+    # Only array elements can be migrated by the load balancer
+    if args['algorithm_type'] == "array":
+        ci_str += "    entry void at_sync();\n" \
+            "\n"
+
     if (args['algorithm_type'] == "nodegroup"):
         ci_str += "    template <typename Action, typenameLDOTLDOTLDOT Args>\n" \
             "    entry void threaded_action(\n" \
@@ -167,8 +174,31 @@ def create_header_file(args):
         "                                OrderedActionsList,\n" \
         "                                SpectreArrayIndex,\n" \
         "                                InitialDataBox>::AlgorithmImpl;\n" \
-        "};\n\n" % (args['algorithm_name'], args['algorithm_name'],
-                    args['algorithm_name'], args['algorithm_name'])
+        % (args['algorithm_name'], args['algorithm_name'],
+           args['algorithm_name'], args['algorithm_name'])
+    # Array elements are migrated by the load balancer, which needs to
+    # serialize them and to know their cost
+    if args['algorithm_type'] == "array":
+        header_str += \
+            "\n" \
+            "  // clang-tidy: google-runtime-references\n" \
+            "  void pup(PUP::er& p) override {  // NOLINT\n" \
+            "    CBase_Algorithm%s<ParallelComponent, Metavariables,\n" \
+            "                      OrderedActionsList, SpectreArrayIndex,\n" \
+            "                      InitialDataBox>::pup(p);\n" \
+            "    Parallel::AlgorithmImpl<ParallelComponent, algorithm,\n" \
+            "                            Metavariables, OrderedActionsList,\n" \
+            "                            SpectreArrayIndex,\n" \
+            "                            InitialDataBox>::pup(p);\n" \
+            "  }\n" \
+            "\n" \
+            "  void UserSetLBLoad() override {\n" \
+            "    this->setObjTime(this->take_measured_cost());\n" \
+            "  }\n" \
+            "\n" \
+            "  void ResumeFromSync() override { this->resume_from_sync(); }\n" \
+            % args['algorithm_name']
+    header_str += "};\n\n"
     # Write include of the def file, but including only the template definitions
     header_str += "#define CK_TEMPLATES_ONLY\n" \
                   "#include \"Algorithms/Algorithm%s.def.h\"\n" \
@@ -613,7 +613,10 @@ no parallel components are performing or need to perform any more tasks, and
 then exits. An example where this approach is important is if we are done
 evolving a system but still need to write data to disk. We do not want to exit
 the simulation until all data has been written to disk, even though we've
-reached the final time of the evolution.
+reached the final time of the evolution. The `execute_next_phase` function of
+the parallel components is also called for the `Exit` phase, so that they can
+finish such work, and the executable exits once they are done. Charm++ does not
+call the destructors of the parallel components when it exits.
 
 ### The Algorithm
 
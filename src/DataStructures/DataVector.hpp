@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "ErrorHandling/Assert.hpp"
+#include "Utilities/AlignedAllocator.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
@@ -134,7 +135,7 @@ class DataVector
   /// \endcond
  public:
   using value_type = double;
-  using allocator_type = std::allocator<value_type>;
+  using allocator_type = AlignedAllocator<value_type>;
   using size_type = size_t;
   using difference_type = std::ptrdiff_t;
   using BaseType = PointerVector<double, blaze::unaligned, blaze::unpadded,
@@ -0,0 +1,60 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/TempBuffer.hpp"
+
+#include <algorithm>
+
+namespace TempBuffer_detail {
+namespace {
+// Round sizes up so every pointer handed out stays aligned
+constexpr size_t alignment_in_doubles =
+    spectre_storage_alignment / sizeof(double);
+
+size_t padded_size(const size_t size) noexcept {
+  return (size + alignment_in_doubles - 1) / alignment_in_doubles *
+         alignment_in_doubles;
+}
+}  // namespace
+
+double* Arena::allocate(const size_t size) noexcept {
+  const size_t padded = padded_size(size);
+  size_in_use_ += padded;
+  largest_size_in_use_ = std::max(largest_size_in_use_, size_in_use_);
+  if (overflow_.empty() and block_offset_ + padded <= block_.size()) {
+    double* const result = block_.data() + block_offset_;  // NOLINT
+    block_offset_ += padded;
+    return result;
+  }
+  overflow_.emplace_back(padded);
+  return overflow_.back().data();
+}
+
+void Arena::deallocate(double* const data, const size_t size) noexcept {
+  const size_t padded = padded_size(size);
+  ASSERT(size_in_use_ >= padded,
+         "Returning more memory to the arena than was handed out");
+  size_in_use_ -= padded;
+  if (not overflow_.empty()) {
+    ASSERT(data == overflow_.back().data(),
+           "Memory must be returned to the arena in the reverse order it was "
+           "handed out in");
+    overflow_.pop_back();
+  } else {
+    ASSERT(block_offset_ >= padded and
+               data == block_.data() + (block_offset_ - padded),  // NOLINT
+           "Memory must be returned to the arena in the reverse order it was "
+           "handed out in");
+    block_offset_ -= padded;
+  }
+  if (size_in_use_ == 0 and largest_size_in_use_ > block_.size()) {
+    // Grow the block so the largest set of buffers seen so far fits in it
+    block_ = Storage(largest_size_in_use_);
+  }
+}
+
+Arena& thread_local_arena() noexcept {
+  static thread_local Arena arena{};
+  return arena;
+}
+}  // namespace TempBuffer_detail
@@ -0,0 +1,185 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class TempBuffer
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/AlignedAllocator.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+template <typename TagsList>
+class TempBuffer;
+/// \endcond
+
+namespace Tags {
+/// \ingroup DataStructuresGroup
+/// \brief A tag for a temporary `Tensor` of type `TensorType` held in a
+/// `TempBuffer`. Different temporaries of the same type are distinguished by
+/// `N`.
+template <size_t N, typename TensorType>
+struct TempTensor : db::SimpleTag {
+  using type = TensorType;
+  static std::string name() noexcept {
+    return "TempTensor" + std::to_string(N);
+  }
+};
+}  // namespace Tags
+
+namespace TempBuffer_detail {
+/*!
+ * \brief A stack of memory that `TempBuffer`s on one thread are carved out
+ * of.
+ *
+ * \details Memory is handed out by bumping an offset into a single block and
+ * must be returned in the reverse order it was handed out in, which scoped
+ * `TempBuffer`s guarantee. If a request does not fit in the block it is served
+ * by a separate heap allocation, and the block is grown to the largest size
+ * used once all memory has been returned. After the first few calls of a
+ * kernel the arena therefore no longer touches the heap.
+ */
+class Arena {
+ public:
+  /// Returns a pointer to `size` doubles aligned to
+  /// `spectre_storage_alignment`
+  double* allocate(size_t size) noexcept;
+
+  /// Returns memory obtained from the last call to `allocate` that has not
+  /// been returned yet
+  void deallocate(double* data, size_t size) noexcept;
+
+  /// The number of doubles currently handed out
+  size_t size_in_use() const noexcept { return size_in_use_; }
+
+  /// The number of doubles that can be handed out without allocating
+  size_t capacity() const noexcept { return block_.size(); }
+
+ private:
+  using Storage = std::vector<double, AlignedAllocator<double>>;
+
+  Storage block_{};
+  size_t block_offset_ = 0;
+  std::vector<Storage> overflow_{};
+  size_t size_in_use_ = 0;
+  size_t largest_size_in_use_ = 0;
+};
+
+/// The `Arena` of the calling thread
+Arena& thread_local_arena() noexcept;
+
+template <typename State, typename Element>
+struct number_of_independent_components_helper {
+  using type = tmpl::size_t<State::value + Element::type::size()>;
+};
+}  // namespace TempBuffer_detail
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief A scoped set of temporary `Tensor`s sharing one contiguous block of
+ * memory.
+ *
+ * \details Like a `Variables`, a `TempBuffer` holds the `Tensor`s of each of
+ * the `Tags`, with all components in one contiguous block. The block is taken
+ * from a thread-local arena rather than the heap and returned to it when the
+ * `TempBuffer` goes out of scope, so a kernel that keeps all of its
+ * intermediate results in a `TempBuffer` does not allocate on each call. The
+ * `Tags` are typically `Tags::TempTensor`s:
+ *
+ * \snippet Test_TempBuffer.cpp temp_buffer_example
+ *
+ * A `TempBuffer` cannot be copied or moved, and `TempBuffer`s on the same
+ * thread must be destroyed in the reverse order of their construction, which
+ * holds automatically for local variables. The components are non-owning
+ * `DataVector`s; an owning `DataVector` or a `Variables` still allocates
+ * from the heap.
+ */
+template <typename... Tags>
+class TempBuffer<tmpl::list<Tags...>> {
+ public:
+  using tags_list = tmpl::list<Tags...>;
+
+  /// The total number of independent components of all the temporaries
+  static constexpr size_t number_of_independent_components =
+      tmpl::fold<tmpl::list<Tags...>, tmpl::size_t<0>,
+                 TempBuffer_detail::number_of_independent_components_helper<
+                     tmpl::_state, tmpl::_element>>::value;
+
+  /// Take memory for all the temporaries from the thread-local arena and set
+  /// all components to `value`.
+  explicit TempBuffer(
+      size_t number_of_grid_points,
+      double value = std::numeric_limits<double>::signaling_NaN()) noexcept;
+
+  TempBuffer(const TempBuffer&) = delete;
+  TempBuffer(TempBuffer&&) = delete;
+  TempBuffer& operator=(const TempBuffer&) = delete;
+  TempBuffer& operator=(TempBuffer&&) = delete;
+  ~TempBuffer() noexcept;
+
+  size_t number_of_grid_points() const noexcept {
+    return number_of_grid_points_;
+  }
+
+  template <typename Tag, typename TagList>
+  friend typename Tag::type& get(TempBuffer<TagList>& buffer) noexcept;
+
+ private:
+  size_t number_of_grid_points_;
+  double* data_;
+  tuples::TaggedTuple<Tags...> tensors_{};
+};
+
+template <typename... Tags>
+TempBuffer<tmpl::list<Tags...>>::TempBuffer(const size_t number_of_grid_points,
+                                            const double value) noexcept
+    : number_of_grid_points_(number_of_grid_points),
+      data_(TempBuffer_detail::thread_local_arena().allocate(
+          number_of_independent_components * number_of_grid_points)) {
+  size_t offset = 0;
+  const auto set_refs = [this, &offset](auto& tensor) noexcept {
+    for (auto& component : tensor) {
+      // clang-tidy: do not use pointer arithmetic
+      component.set_data_ref(data_ + offset,  // NOLINT
+                             number_of_grid_points_);
+      offset += number_of_grid_points_;
+    }
+    return 0;
+  };
+  (void)set_refs;
+  expand_pack(set_refs(tuples::get<Tags>(tensors_))...);
+  // clang-tidy: do not use pointer arithmetic
+  std::fill(data_, data_ + offset, value);  // NOLINT
+}
+
+template <typename... Tags>
+TempBuffer<tmpl::list<Tags...>>::~TempBuffer() noexcept {
+  TempBuffer_detail::thread_local_arena().deallocate(
+      data_, number_of_independent_components * number_of_grid_points_);
+}
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Return the temporary `Tag::type` held in `buffer`
+ */
+template <typename Tag, typename TagList>
+typename Tag::type& get(TempBuffer<TagList>& buffer) noexcept {
+  static_assert(tmpl::list_contains_v<TagList, Tag>,
+                "Could not retrieve Tag from TempBuffer. See the first "
+                "template parameter of the instantiation for what Tag is "
+                "being retrieved and the second template parameter for "
+                "what Tags are available.");
+  return tuples::get<Tag>(buffer.tensors_);
+}
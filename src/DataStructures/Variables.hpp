@@ -6,12 +6,15 @@
 
 #pragma once
 
+#include <pup.h>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "ErrorHandling/Assert.hpp"
+#include "Utilities/AlignedAllocator.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Requires.hpp"
@@ -75,7 +78,7 @@ template <typename... Tags>
 class Variables<tmpl::list<Tags...>> {
  public:
   using value_type = double;
-  using allocator_type = std::allocator<value_type>;
+  using allocator_type = AlignedAllocator<value_type>;
   using size_type = size_t;
   using difference_type = std::ptrdiff_t;
 
@@ -366,8 +369,10 @@ class Variables<tmpl::list<Tags...>> {
   friend class Variables;
 
   std::vector<double, allocator_type> variable_data_impl_;
-  // variable_data_ is only used to plug into the Blaze expression templates
-  PointerVector<double, blaze::unaligned, blaze::unpadded,
+  // variable_data_ is only used to plug into the Blaze expression templates.
+  // It always points to the start of variable_data_impl_, whose allocator
+  // aligns the data, so Blaze can use aligned SIMD loads and stores on it.
+  PointerVector<double, blaze::aligned, blaze::unpadded,
                 blaze::defaultTransposeFlag,
                 blaze::DynamicVector<double, blaze::defaultTransposeFlag>>
       variable_data_;
@@ -502,14 +507,17 @@ Variables<tmpl::list<Tags...>>& Variables<tmpl::list<Tags...>>::operator=(
 
 template <typename... Tags>
 void Variables<tmpl::list<Tags...>>::pup(PUP::er& p) noexcept {
-  p | variable_data_impl_;
   p | size_;
   p | number_of_grid_points_;
   if (p.isUnpacking()) {
+    variable_data_impl_.resize(size_);
     variable_data_.reset(variable_data_impl_.data(),
                          variable_data_impl_.size());
     add_reference_variable_data(tmpl::list<Tags...>{});
   }
+  if (size_ > 0) {
+    PUParray(p, variable_data_impl_.data(), size_);
+  }
 }
 /// \endcond
 
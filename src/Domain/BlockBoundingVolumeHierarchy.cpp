@@ -0,0 +1,272 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockBoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/Domain.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// The largest number of blocks in a leaf of the tree
+constexpr size_t maximum_blocks_per_leaf = 2;
+
+template <size_t Dim, typename PointType>
+bool box_contains(const std::array<double, Dim>& lower,
+                  const std::array<double, Dim>& upper,
+                  const PointType& point) noexcept {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (point(d) < gsl::at(lower, d) or point(d) > gsl::at(upper, d)) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+template <size_t Dim, typename TargetFrame>
+BlockBoundingVolumeHierarchy<Dim, TargetFrame>::BlockBoundingVolumeHierarchy(
+    const Domain<Dim, TargetFrame>& domain, const size_t samples_per_dimension,
+    const double padding) noexcept {
+  ASSERT(samples_per_dimension >= 2,
+         "Need at least 2 samples per dimension to bound a block, not "
+             << samples_per_dimension);
+  size_t number_of_samples = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    number_of_samples *= samples_per_dimension;
+  }
+  tnsr::I<DataVector, Dim, Frame::Logical> logical_samples(number_of_samples);
+  for (size_t s = 0; s < number_of_samples; ++s) {
+    size_t index = s;
+    for (size_t d = 0; d < Dim; ++d) {
+      logical_samples.get(d)[s] =
+          -1.0 + 2.0 * static_cast<double>(index % samples_per_dimension) /
+                     static_cast<double>(samples_per_dimension - 1);
+      index /= samples_per_dimension;
+    }
+  }
+
+  const size_t number_of_blocks = domain.blocks().size();
+  block_lower_.resize(number_of_blocks);
+  block_upper_.resize(number_of_blocks);
+  for (const auto& block : domain.blocks()) {
+    const auto samples = block.coordinate_map()(logical_samples);
+    for (size_t d = 0; d < Dim; ++d) {
+      const auto bounds =
+          std::minmax_element(samples.get(d).begin(), samples.get(d).end());
+      const double pad = padding * (*bounds.second - *bounds.first);
+      gsl::at(block_lower_[block.id()], d) = *bounds.first - pad;
+      gsl::at(block_upper_[block.id()], d) = *bounds.second + pad;
+    }
+  }
+
+  ordered_blocks_.resize(number_of_blocks);
+  for (size_t i = 0; i < number_of_blocks; ++i) {
+    ordered_blocks_[i] = i;
+  }
+  if (number_of_blocks > 0) {
+    build(0, number_of_blocks);
+  }
+}
+
+template <size_t Dim, typename TargetFrame>
+size_t BlockBoundingVolumeHierarchy<Dim, TargetFrame>::build(
+    const size_t first_block, const size_t end_block) noexcept {
+  const size_t node_index = nodes_.size();
+  nodes_.emplace_back();
+  Node node{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(node.lower, d) = std::numeric_limits<double>::max();
+    gsl::at(node.upper, d) = std::numeric_limits<double>::lowest();
+    for (size_t i = first_block; i < end_block; ++i) {
+      gsl::at(node.lower, d) = std::min(
+          gsl::at(node.lower, d), gsl::at(block_lower_[ordered_blocks_[i]], d));
+      gsl::at(node.upper, d) = std::max(
+          gsl::at(node.upper, d), gsl::at(block_upper_[ordered_blocks_[i]], d));
+    }
+  }
+  if (end_block - first_block <= maximum_blocks_per_leaf) {
+    node.second_child_or_first_block = first_block;
+    node.number_of_blocks = end_block - first_block;
+    nodes_[node_index] = node;
+    return node_index;
+  }
+
+  // Split at the median of the box centers (up to a factor of 2) along the
+  // dimension in which they are most spread
+  const auto center = [this](const size_t block_id, const size_t d) noexcept {
+    return gsl::at(block_lower_[block_id], d) +
+           gsl::at(block_upper_[block_id], d);
+  };
+  size_t split_dim = 0;
+  double largest_spread = -1.0;
+  for (size_t d = 0; d < Dim; ++d) {
+    double lowest_center = std::numeric_limits<double>::max();
+    double highest_center = std::numeric_limits<double>::lowest();
+    for (size_t i = first_block; i < end_block; ++i) {
+      lowest_center = std::min(lowest_center, center(ordered_blocks_[i], d));
+      highest_center = std::max(highest_center, center(ordered_blocks_[i], d));
+    }
+    if (highest_center - lowest_center > largest_spread) {
+      largest_spread = highest_center - lowest_center;
+      split_dim = d;
+    }
+  }
+  const size_t middle_block = first_block + (end_block - first_block) / 2;
+  const auto ordered_begin = ordered_blocks_.begin();
+  std::nth_element(
+      std::next(ordered_begin, static_cast<std::ptrdiff_t>(first_block)),
+      std::next(ordered_begin, static_cast<std::ptrdiff_t>(middle_block)),
+      std::next(ordered_begin, static_cast<std::ptrdiff_t>(end_block)),
+      [&center, &split_dim ](const size_t lhs, const size_t rhs) noexcept {
+        return center(lhs, split_dim) < center(rhs, split_dim);
+      });
+
+  build(first_block, middle_block);
+  node.second_child_or_first_block = build(middle_block, end_block);
+  nodes_[node_index] = node;
+  return node_index;
+}
+
+template <size_t Dim, typename TargetFrame>
+void BlockBoundingVolumeHierarchy<Dim, TargetFrame>::candidate_blocks(
+    const gsl::not_null<std::vector<size_t>*> candidates,
+    const tnsr::I<double, Dim, TargetFrame>& x) const noexcept {
+  candidates->clear();
+  if (nodes_.empty()) {
+    return;
+  }
+  const auto point = [&x](const size_t d) noexcept { return x.get(d); };
+  std::vector<size_t> nodes_to_visit{0};
+  while (not nodes_to_visit.empty()) {
+    const Node& node = nodes_[nodes_to_visit.back()];
+    const size_t node_index = nodes_to_visit.back();
+    nodes_to_visit.pop_back();
+    if (not box_contains(node.lower, node.upper, point)) {
+      continue;
+    }
+    if (node.number_of_blocks == 0) {
+      nodes_to_visit.push_back(node.second_child_or_first_block);
+      nodes_to_visit.push_back(node_index + 1);
+      continue;
+    }
+    for (size_t i = node.second_child_or_first_block;
+         i < node.second_child_or_first_block + node.number_of_blocks; ++i) {
+      const size_t block_id = ordered_blocks_[i];
+      if (box_contains(block_lower_[block_id], block_upper_[block_id],
+                       point)) {
+        candidates->push_back(block_id);
+      }
+    }
+  }
+  std::sort(candidates->begin(), candidates->end());
+}
+
+template <size_t Dim, typename TargetFrame>
+void BlockBoundingVolumeHierarchy<Dim, TargetFrame>::candidate_blocks(
+    const gsl::not_null<std::vector<size_t>*> offsets,
+    const gsl::not_null<std::vector<size_t>*> candidates,
+    const tnsr::I<DataVector, Dim, TargetFrame>& x) const noexcept {
+  const size_t number_of_points = get<0>(x).size();
+  offsets->assign(number_of_points + 1, 0);
+  candidates->clear();
+  if (nodes_.empty() or number_of_points == 0) {
+    return;
+  }
+
+  // Test all points against the root box with contiguous loops
+  std::vector<char> in_root(number_of_points, 1);
+  for (size_t d = 0; d < Dim; ++d) {
+    const DataVector& x_d = x.get(d);
+    const double lower = gsl::at(nodes_[0].lower, d);
+    const double upper = gsl::at(nodes_[0].upper, d);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      in_root[s] = static_cast<char>(in_root[s] != 0 and x_d[s] >= lower and
+                                     x_d[s] <= upper);
+    }
+  }
+  std::vector<size_t> root_points{};
+  root_points.reserve(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    if (in_root[s] != 0) {
+      root_points.push_back(s);
+    }
+  }
+
+  // Each node is visited once with all the points inside its box
+  std::vector<std::pair<size_t, std::vector<size_t>>> nodes_to_visit{};
+  nodes_to_visit.emplace_back(0, std::move(root_points));
+  std::vector<std::pair<size_t, size_t>> point_and_block{};
+  while (not nodes_to_visit.empty()) {
+    const size_t node_index = nodes_to_visit.back().first;
+    const std::vector<size_t> points = std::move(nodes_to_visit.back().second);
+    nodes_to_visit.pop_back();
+    const Node& node = nodes_[node_index];
+    if (node.number_of_blocks == 0) {
+      for (const size_t child :
+           {node.second_child_or_first_block, node_index + 1}) {
+        std::vector<size_t> child_points{};
+        for (const size_t s : points) {
+          if (box_contains(nodes_[child].lower, nodes_[child].upper,
+                           [&x, &s](const size_t d) noexcept {
+                             return x.get(d)[s];
+                           })) {
+            child_points.push_back(s);
+          }
+        }
+        if (not child_points.empty()) {
+          nodes_to_visit.emplace_back(child, std::move(child_points));
+        }
+      }
+      continue;
+    }
+    for (size_t i = node.second_child_or_first_block;
+         i < node.second_child_or_first_block + node.number_of_blocks; ++i) {
+      const size_t block_id = ordered_blocks_[i];
+      for (const size_t s : points) {
+        if (box_contains(block_lower_[block_id], block_upper_[block_id],
+                         [&x, &s](const size_t d) noexcept {
+                           return x.get(d)[s];
+                         })) {
+          point_and_block.emplace_back(s, block_id);
+        }
+      }
+    }
+  }
+
+  // Sort the candidates by point and then by block id
+  std::sort(point_and_block.begin(), point_and_block.end());
+  candidates->reserve(point_and_block.size());
+  for (const auto& candidate : point_and_block) {
+    ++(*offsets)[candidate.first + 1];
+    candidates->push_back(candidate.second);
+  }
+  for (size_t s = 0; s < number_of_points; ++s) {
+    (*offsets)[s + 1] += (*offsets)[s];
+  }
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE(_, data) \
+  template class BlockBoundingVolumeHierarchy<DIM(data), FRAME(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (Frame::Distorted, Frame::Grid, Frame::Inertial))
+
+#undef DIM
+#undef FRAME
+#undef INSTANTIATE
+/// \endcond
@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class template BlockBoundingVolumeHierarchy.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+
+/// \cond
+class DataVector;
+template <size_t VolumeDim, typename TargetFrame>
+class Domain;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+/// \ingroup ComputationalDomainGroup
+/// \brief A bounding volume hierarchy over the `Block`s of a `Domain`, used to
+/// find the blocks that may contain a point without inverting every block's
+/// map.
+///
+/// \details The bounding box of each block in the `TargetFrame` is estimated
+/// by mapping a grid of `samples_per_dimension` points per dimension on the
+/// logical cube, and is padded by `padding` times its size in each dimension
+/// to account for the curvature of the map between the samples.  The boxes
+/// are organized in a binary tree, built by splitting the blocks at the median
+/// of their box centers along the dimension in which the centers are most
+/// spread, so a query only visits the subtrees whose boxes contain the point.
+///
+/// The boxes are estimates: a block whose map bulges beyond the padded box
+/// may be missed, so users must fall back to the remaining blocks when no
+/// candidate contains a point, as `block_logical_coordinates` does.
+template <size_t Dim, typename TargetFrame>
+class BlockBoundingVolumeHierarchy {
+ public:
+  explicit BlockBoundingVolumeHierarchy(
+      const Domain<Dim, TargetFrame>& domain,
+      size_t samples_per_dimension = 9, double padding = 0.05) noexcept;
+
+  BlockBoundingVolumeHierarchy() = default;
+
+  size_t number_of_blocks() const noexcept { return block_lower_.size(); }
+
+  /// The lower and upper corners of the padded bounding box of block
+  /// `block_id`
+  // @{
+  const std::array<double, Dim>& lower_corner(const size_t block_id) const
+      noexcept {
+    return block_lower_[block_id];
+  }
+  const std::array<double, Dim>& upper_corner(const size_t block_id) const
+      noexcept {
+    return block_upper_[block_id];
+  }
+  // @}
+
+  /// The ids, in increasing order, of the blocks whose bounding box
+  /// contains the point `x`.
+  void candidate_blocks(gsl::not_null<std::vector<size_t>*> candidates,
+                        const tnsr::I<double, Dim, TargetFrame>& x) const
+      noexcept;
+
+  /// The candidate blocks of all points `x` at once.
+  ///
+  /// The ids, in increasing order, of the blocks whose bounding box contains
+  /// point `s` are `candidates[offsets[s]]` through
+  /// `candidates[offsets[s + 1] - 1]`.  All points are filtered through each
+  /// node of the tree together, with the test against the root box done with
+  /// contiguous loops over the components of `x`.
+  void candidate_blocks(gsl::not_null<std::vector<size_t>*> offsets,
+                        gsl::not_null<std::vector<size_t>*> candidates,
+                        const tnsr::I<DataVector, Dim, TargetFrame>& x) const
+      noexcept;
+
+ private:
+  // Nodes are stored depth-first, so the first child of an interior node
+  // directly follows it.  For an interior node `second_child_or_first_block`
+  // is the index of the second child and `number_of_blocks` is zero; for a
+  // leaf they delimit the leaf's range in `ordered_blocks_`.
+  struct Node {
+    std::array<double, Dim> lower{};
+    std::array<double, Dim> upper{};
+    size_t second_child_or_first_block{0};
+    size_t number_of_blocks{0};
+  };
+
+  size_t build(size_t first_block, size_t end_block) noexcept;
+
+  std::vector<std::array<double, Dim>> block_lower_{};
+  std::vector<std::array<double, Dim>> block_upper_{};
+  std::vector<size_t> ordered_blocks_{};
+  std::vector<Node> nodes_{};
+};
@@ -3,29 +3,93 @@
 
 #include "BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <iterator>
 #include <vector>
 
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/BlockBoundingVolumeHierarchy.hpp"
 #include "Domain/BlockId.hpp"
 #include "Domain/Domain.hpp"  // IWYU pragma: keep
+#include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 // Define this alias so we don't need to keep typing this monster.
 template <size_t Dim>
 using block_logical_coord_holder =
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>;
-}  // namespace
 
+// Building a BlockBoundingVolumeHierarchy maps a few hundred points per block,
+// which pays off only if there are several points per block to look up.
+constexpr size_t minimum_points_per_block_for_hierarchy = 8;
+
+// Blocks only overlap on their shared boundaries, but the inverse maps of
+// neighboring blocks may disagree by roundoff about where a boundary is.
+constexpr double block_boundary_tolerance = 1.0e-10;
+
+// Sets `x_logical` and returns true if `x_frame` is in `block`.
 template <size_t Dim, typename Frame>
-std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
-    const Domain<Dim, Frame>& domain,
-    const tnsr::I<DataVector, Dim, Frame>& x) noexcept {
+bool is_in_block(
+    const gsl::not_null<tnsr::I<double, Dim, typename ::Frame::Logical>*>
+        x_logical,
+    const Block<Dim, Frame>& block,
+    const tnsr::I<double, Dim, Frame>& x_frame) noexcept {
+  const auto inv = block.coordinate_map().inverse(x_frame);
+  if (not inv) {
+    return false;
+  }
+  *x_logical = inv.get();
+  for (size_t d = 0; d < Dim; ++d) {
+    // Assumes that logical coordinates go from -1 to +1 in each
+    // dimension.
+    if (x_logical->get(d) < -1.0 or x_logical->get(d) > 1.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Dim>
+bool is_near_block_boundary(
+    const tnsr::I<double, Dim, typename ::Frame::Logical>& x_logical) noexcept {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (std::abs(x_logical.get(d)) > 1.0 - block_boundary_tolerance) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Looks up the points in the candidate blocks of each point, which are
+// sorted by block id, and then in all other blocks. Without a hierarchy, all
+// blocks are tried in order. Either way a point is assigned to the block with
+// the smallest id that contains it.
+template <size_t Dim, typename Frame>
+std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates_impl(
+    const Domain<Dim, Frame>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const BlockBoundingVolumeHierarchy<Dim, Frame>* const hierarchy) noexcept {
   const size_t num_pts = get<0>(x).size();
+  std::vector<size_t> candidate_offsets{};
+  std::vector<size_t> candidates{};
+  if (hierarchy != nullptr) {
+    ASSERT(hierarchy->number_of_blocks() == domain.blocks().size(),
+           "The hierarchy has " << hierarchy->number_of_blocks()
+                                << " blocks, but the domain has "
+                                << domain.blocks().size());
+    hierarchy->candidate_blocks(make_not_null(&candidate_offsets),
+                                make_not_null(&candidates), x);
+  } else {
+    candidate_offsets.assign(num_pts + 1, 0);
+  }
+
   std::vector<block_logical_coord_holder<Dim>> block_coord_holders(num_pts);
   std::vector<tnsr::I<double, Dim, Frame>> points_with_no_block;
   for (size_t s = 0; s < num_pts; ++s) {
@@ -36,31 +100,55 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
     auto& x_logical = block_coord_holders[s].data;
     // Check which block this point is in. Each point will be in one
     // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
+    // case, choose the matching block with the smallest block_id.
     bool found_block = false;
-    for (const auto& block : domain.blocks()) {
-      const auto inv = block.coordinate_map().inverse(x_frame);
-      if(inv) {
-        x_logical = inv.get();
-      } else {
-        continue; // Not in this block
-      }
-      bool is_contained = true;
-      for (size_t d = 0; d < Dim; ++d) {
-        // Assumes that logical coordinates go from -1 to +1 in each
-        // dimension.
-        is_contained = is_contained and x_logical.get(d) >= -1.0 and
-                       x_logical.get(d) <= 1.0;
-      }
-      if (is_contained) {
-        // Point is in this block.  Don't bother checking subsequent
-        // blocks.
-        block_coord_holders[s].id = domain::BlockId(block.id());
+    const auto candidates_begin = std::next(
+        candidates.begin(),
+        static_cast<std::ptrdiff_t>(candidate_offsets[s]));
+    const auto candidates_end = std::next(
+        candidates.begin(),
+        static_cast<std::ptrdiff_t>(candidate_offsets[s + 1]));
+    for (auto candidate = candidates_begin; candidate != candidates_end;
+         ++candidate) {
+      if (is_in_block(make_not_null(&x_logical), domain.blocks()[*candidate],
+                      x_frame)) {
+        block_coord_holders[s].id = domain::BlockId(*candidate);
         found_block = true;
         break;
       }
     }
+    if (found_block and is_near_block_boundary(x_logical)) {
+      // The bounding boxes are only estimates, so a block with a smaller id
+      // that is not a candidate may share the boundary the point is on.
+      const size_t matching_id = block_coord_holders[s].id.get_index();
+      tnsr::I<double, Dim, typename ::Frame::Logical> other_x_logical{};
+      for (size_t id = 0; id < matching_id; ++id) {
+        if (std::binary_search(candidates_begin, candidates_end, id)) {
+          continue;
+        }
+        if (is_in_block(make_not_null(&other_x_logical), domain.blocks()[id],
+                        x_frame)) {
+          x_logical = other_x_logical;
+          block_coord_holders[s].id = domain::BlockId(id);
+          break;
+        }
+      }
+    }
+    if (not found_block) {
+      // The bounding boxes are only estimates, so check the other blocks
+      for (const auto& block : domain.blocks()) {
+        if (std::binary_search(candidates_begin, candidates_end, block.id())) {
+          continue;
+        }
+        if (is_in_block(make_not_null(&x_logical), block, x_frame)) {
+          // Point is in this block.  Don't bother checking subsequent
+          // blocks.
+          block_coord_holders[s].id = domain::BlockId(block.id());
+          found_block = true;
+          break;
+        }
+      }
+    }
     if (not found_block) {
       points_with_no_block.emplace_back(std::move(x_frame));
     }
@@ -71,17 +159,43 @@ std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
   }
   return block_coord_holders;
 }
+}  // namespace
+
+template <size_t Dim, typename Frame>
+std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
+    const Domain<Dim, Frame>& domain,
+    const tnsr::I<DataVector, Dim, Frame>& x) noexcept {
+  if (get<0>(x).size() >=
+      minimum_points_per_block_for_hierarchy * domain.blocks().size()) {
+    const BlockBoundingVolumeHierarchy<Dim, Frame> hierarchy(domain);
+    return block_logical_coordinates_impl(domain, x, &hierarchy);
+  }
+  return block_logical_coordinates_impl<Dim, Frame>(domain, x, nullptr);
+}
+
+template <size_t Dim, typename Frame>
+std::vector<block_logical_coord_holder<Dim>> block_logical_coordinates(
+    const Domain<Dim, Frame>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const BlockBoundingVolumeHierarchy<Dim, Frame>& hierarchy) noexcept {
+  return block_logical_coordinates_impl(domain, x, &hierarchy);
+}
 
 // Explicit instantiations
 /// \cond
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
 
-#define INSTANTIATE(_, data)                                  \
-  template std::vector<block_logical_coord_holder<DIM(data)>> \
-  block_logical_coordinates(                                  \
-      const Domain<DIM(data), FRAME(data)>& domain,           \
-      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x) noexcept;
+#define INSTANTIATE(_, data)                                           \
+  template std::vector<block_logical_coord_holder<DIM(data)>>          \
+  block_logical_coordinates(                                           \
+      const Domain<DIM(data), FRAME(data)>& domain,                    \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x) noexcept;  \
+  template std::vector<block_logical_coord_holder<DIM(data)>>          \
+  block_logical_coordinates(                                           \
+      const Domain<DIM(data), FRAME(data)>& domain,                    \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x,            \
+      const BlockBoundingVolumeHierarchy<DIM(data), FRAME(data)>&      \
+          hierarchy) noexcept;
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
                         (Frame::Distorted, Frame::Grid, Frame::Inertial))
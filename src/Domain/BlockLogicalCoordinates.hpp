@@ -9,6 +9,8 @@
 #include "DataStructures/Tensor/TypeAliases.hpp"
 
 /// \cond
+template <size_t Dim, typename TargetFrame>
+class BlockBoundingVolumeHierarchy;
 namespace domain {
 class BlockId;
 }  // namespace domain
@@ -32,8 +34,24 @@ class IdPair;
 /// If a point is on a shared boundary of two or more `Block`s, it is
 /// returned only once, and is considered to belong to the `Block`
 /// with the smaller `BlockId`.
+///
+/// Only the blocks whose bounding box in the `BlockBoundingVolumeHierarchy`
+/// contains a point have their map inverted, unless none of them contains the
+/// point, in which case the remaining blocks are tried.  The overload without
+/// a hierarchy builds one if there are enough points for it to pay off;
+/// callers that look up points repeatedly on the same domain should build the
+/// hierarchy once and pass it in.
+// @{
 template <size_t Dim, typename Frame>
 std::vector<
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>>
 block_logical_coordinates(const Domain<Dim, Frame>& domain,
                           const tnsr::I<DataVector, Dim, Frame>& x) noexcept;
+
+template <size_t Dim, typename Frame>
+std::vector<
+    IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>>
+block_logical_coordinates(
+    const Domain<Dim, Frame>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const BlockBoundingVolumeHierarchy<Dim, Frame>& hierarchy) noexcept;
+// @}
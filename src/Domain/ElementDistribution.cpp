@@ -0,0 +1,160 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/ElementDistribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/BlockNeighbor.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/InitialElementIds.hpp"
+#include "Domain/SegmentId.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// The blocks in breadth-first order through their neighbors
+template <size_t Dim>
+std::vector<size_t> block_ordering(
+    const Domain<Dim, Frame::Inertial>& domain) noexcept {
+  const size_t number_of_blocks = domain.blocks().size();
+  std::vector<size_t> result{};
+  result.reserve(number_of_blocks);
+  std::vector<bool> visited(number_of_blocks, false);
+  std::deque<size_t> blocks_to_visit{};
+  std::vector<size_t> neighbor_ids{};
+  // Loop over all blocks in case the domain is not connected
+  for (size_t first_block = 0; first_block < number_of_blocks;
+       ++first_block) {
+    if (visited[first_block]) {
+      continue;
+    }
+    visited[first_block] = true;
+    blocks_to_visit.push_back(first_block);
+    while (not blocks_to_visit.empty()) {
+      const size_t block_id = blocks_to_visit.front();
+      blocks_to_visit.pop_front();
+      result.push_back(block_id);
+      neighbor_ids.clear();
+      for (const auto& direction_and_neighbor :
+           domain.blocks()[block_id].neighbors()) {
+        neighbor_ids.push_back(direction_and_neighbor.second.id());
+      }
+      std::sort(neighbor_ids.begin(), neighbor_ids.end());
+      for (const size_t neighbor_id : neighbor_ids) {
+        if (not visited[neighbor_id]) {
+          visited[neighbor_id] = true;
+          blocks_to_visit.push_back(neighbor_id);
+        }
+      }
+    }
+  }
+  return result;
+}
+
+// The index of the element along the Z-order curve through its block
+template <size_t Dim>
+uint64_t z_curve_index(const ElementId<Dim>& element_id) noexcept {
+  size_t max_refinement_level = 0;
+  size_t total_refinement_level = 0;
+  for (const auto& segment_id : element_id.segment_ids()) {
+    max_refinement_level =
+        std::max(max_refinement_level, segment_id.refinement_level());
+    total_refinement_level += segment_id.refinement_level();
+  }
+  if (UNLIKELY(total_refinement_level > 64)) {
+    ERROR("Cannot order elements with a total refinement level of "
+          << total_refinement_level << " along a 64-bit Z-order curve");
+  }
+  uint64_t result = 0;
+  for (size_t level = 0; level < max_refinement_level; ++level) {
+    for (const auto& segment_id : element_id.segment_ids()) {
+      if (level < segment_id.refinement_level()) {
+        result = (result << 1) |
+                 ((segment_id.index() >>
+                   (segment_id.refinement_level() - 1 - level)) &
+                  1);
+      }
+    }
+  }
+  return result;
+}
+}  // namespace
+
+template <size_t Dim>
+BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
+    const size_t number_of_procs, const Domain<Dim, Frame::Inertial>& domain,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents) noexcept {
+  ASSERT(number_of_procs > 0, "Need at least one processor");
+  ASSERT(initial_refinement_levels.size() == domain.blocks().size() and
+             initial_extents.size() == domain.blocks().size(),
+         "Need the refinement levels and extents of all "
+             << domain.blocks().size() << " blocks, not "
+             << initial_refinement_levels.size() << " and "
+             << initial_extents.size());
+
+  std::vector<size_t> grid_points_per_element{};
+  size_t total_grid_points = 0;
+  for (const size_t block_id : block_ordering(domain)) {
+    auto element_ids =
+        initial_element_ids(block_id, initial_refinement_levels[block_id]);
+    std::sort(
+        element_ids.begin(), element_ids.end(),
+        [](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) noexcept {
+          return z_curve_index(lhs) < z_curve_index(rhs);
+        });
+    size_t grid_points = 1;
+    for (const size_t extent : initial_extents[block_id]) {
+      grid_points *= extent;
+    }
+    ordered_element_ids_.insert(ordered_element_ids_.end(),
+                                element_ids.begin(), element_ids.end());
+    grid_points_per_element.insert(grid_points_per_element.end(),
+                                   element_ids.size(), grid_points);
+    total_grid_points += element_ids.size() * grid_points;
+  }
+
+  // Each element goes to the chunk containing the middle of its grid points
+  // along the curve
+  proc_of_element_.reserve(ordered_element_ids_.size());
+  size_t grid_points_before = 0;
+  for (size_t i = 0; i < ordered_element_ids_.size(); ++i) {
+    const double middle = static_cast<double>(grid_points_before) +
+                          0.5 * static_cast<double>(grid_points_per_element[i]);
+    proc_of_element_.emplace(
+        ordered_element_ids_[i],
+        std::min(number_of_procs - 1,
+                 static_cast<size_t>(std::floor(
+                     middle * static_cast<double>(number_of_procs) /
+                     static_cast<double>(total_grid_points)))));
+    grid_points_before += grid_points_per_element[i];
+  }
+}
+
+template <size_t Dim>
+size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
+    const ElementId<Dim>& element_id) const noexcept {
+  const auto proc = proc_of_element_.find(element_id);
+  ASSERT(proc != proc_of_element_.end(),
+         "Element " << element_id << " is not in the domain");
+  return proc->second;
+}
+
+/// \cond
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data) \
+  template class BlockZCurveProcDistribution<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
+/// \endcond
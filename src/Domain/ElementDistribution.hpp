@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class BlockZCurveProcDistribution.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include "Domain/ElementId.hpp"
+
+/// \cond
+namespace Frame {
+struct Inertial;
+}  // namespace Frame
+template <size_t VolumeDim, typename TargetFrame>
+class Domain;
+/// \endcond
+
+/// \ingroup ComputationalDomainGroup
+/// \brief Distributes the initial `Element`s of a `Domain` over processors
+/// along a space-filling curve, so that neighboring elements tend to share a
+/// processor and the number of grid points per processor is balanced.
+///
+/// \details The blocks are visited in breadth-first order through their
+/// neighbors, starting from block 0, so consecutive blocks are usually
+/// neighbors.  The elements of each block are ordered along a Z-order (Morton)
+/// curve, whose index interleaves the bits of the `SegmentId` indices from
+/// the coarsest to the finest refinement level, so anisotropically refined
+/// blocks are handled as well.  The ordered elements are then split into
+/// contiguous chunks with about the same number of grid points, which are
+/// assigned to consecutive processors.  Because Charm++ numbers the
+/// processors of a node consecutively, this also keeps most of the
+/// neighbors of an element on its node.
+template <size_t Dim>
+class BlockZCurveProcDistribution {
+ public:
+  BlockZCurveProcDistribution(
+      size_t number_of_procs, const Domain<Dim, Frame::Inertial>& domain,
+      const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+      const std::vector<std::array<size_t, Dim>>& initial_extents) noexcept;
+
+  BlockZCurveProcDistribution() = default;
+
+  /// The ids of all elements, in the order of the curve
+  const std::vector<ElementId<Dim>>& ordered_element_ids() const noexcept {
+    return ordered_element_ids_;
+  }
+
+  /// The processor the element `element_id` is placed on
+  size_t get_proc_for_element(const ElementId<Dim>& element_id) const
+      noexcept;
+
+ private:
+  std::vector<ElementId<Dim>> ordered_element_ids_{};
+  std::unordered_map<ElementId<Dim>, size_t> proc_of_element_{};
+};
@@ -3,12 +3,16 @@
 
 #include "ElementLogicalCoordinates.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -24,6 +28,152 @@ namespace {
 template <size_t Dim>
 using block_logical_coord_holder =
     IdPair<domain::BlockId, tnsr::I<double, Dim, typename ::Frame::Logical>>;
+
+constexpr size_t no_element = std::numeric_limits<size_t>::max();
+
+// The extent of an element in the logical coordinates of its block
+template <size_t Dim>
+struct ElementBox {
+  std::array<double, Dim> lower;
+  std::array<double, Dim> upper;
+};
+
+// A binary tree over the elements of one block.  Each node bisects its
+// region of the block along the dimension in which the most of its elements
+// are finer than the node, so for the usual case of elements that do not
+// overlap, the depth of the tree is the sum of the refinement levels.  An
+// element spanning both halves of a node is placed in both children, so the
+// tree is correct for any list of elements.
+template <size_t Dim>
+class ElementSearchTree {
+ public:
+  ElementSearchTree(const std::vector<ElementBox<Dim>>& boxes,
+                    const std::vector<size_t>& elements) noexcept {
+    if (not elements.empty()) {
+      build(boxes, make_array<Dim>(-1.0), make_array<Dim>(1.0), elements);
+    }
+  }
+
+  // The smallest index of the elements containing `x_block_logical`, or
+  // `no_element`.
+  size_t find(const std::vector<ElementBox<Dim>>& boxes,
+              const tnsr::I<double, Dim, Frame::Logical>& x_block_logical) const
+      noexcept {
+    size_t result = no_element;
+    if (not nodes_.empty()) {
+      find(make_not_null(&result), boxes, x_block_logical, 0);
+    }
+    return result;
+  }
+
+ private:
+  // For an interior node, the lower child directly follows the node and
+  // `upper_child_or_first_element` is the index of the upper child.  For a
+  // leaf, `upper_child_or_first_element` and `number_of_elements` delimit
+  // the leaf's range in `leaf_elements_`.
+  struct Node {
+    bool is_leaf;
+    size_t split_dim;
+    double split;
+    size_t upper_child_or_first_element;
+    size_t number_of_elements;
+  };
+
+  void build(const std::vector<ElementBox<Dim>>& boxes,
+             const std::array<double, Dim>& lower,
+             const std::array<double, Dim>& upper,
+             const std::vector<size_t>& elements) noexcept {
+    const size_t node_index = nodes_.size();
+    nodes_.emplace_back();
+    size_t split_dim = 0;
+    size_t most_finer_elements = 0;
+    if (elements.size() > 1) {
+      for (size_t d = 0; d < Dim; ++d) {
+        const size_t finer_elements = static_cast<size_t>(std::count_if(
+            elements.begin(), elements.end(),
+            [&boxes, &lower, &upper, &d ](const size_t element) noexcept {
+              return gsl::at(boxes[element].upper, d) -
+                         gsl::at(boxes[element].lower, d) <
+                     gsl::at(upper, d) - gsl::at(lower, d);
+            }));
+        if (finer_elements > most_finer_elements) {
+          most_finer_elements = finer_elements;
+          split_dim = d;
+        }
+      }
+    }
+    if (most_finer_elements == 0) {
+      nodes_[node_index] = Node{true, 0, 0.0, leaf_elements_.size(),
+                                elements.size()};
+      leaf_elements_.insert(leaf_elements_.end(), elements.begin(),
+                            elements.end());
+      return;
+    }
+
+    const double split =
+        0.5 * (gsl::at(lower, split_dim) + gsl::at(upper, split_dim));
+    std::vector<size_t> lower_elements{};
+    std::vector<size_t> upper_elements{};
+    for (const size_t element : elements) {
+      if (gsl::at(boxes[element].lower, split_dim) < split) {
+        lower_elements.push_back(element);
+      }
+      if (gsl::at(boxes[element].upper, split_dim) > split) {
+        upper_elements.push_back(element);
+      }
+    }
+    auto split_upper = upper;
+    gsl::at(split_upper, split_dim) = split;
+    build(boxes, lower, split_upper, lower_elements);
+    const size_t upper_child = nodes_.size();
+    auto split_lower = lower;
+    gsl::at(split_lower, split_dim) = split;
+    build(boxes, split_lower, upper, upper_elements);
+    nodes_[node_index] = Node{false, split_dim, split, upper_child, 0};
+  }
+
+  void find(const gsl::not_null<size_t*> result,
+            const std::vector<ElementBox<Dim>>& boxes,
+            const tnsr::I<double, Dim, Frame::Logical>& x_block_logical,
+            const size_t node_index) const noexcept {
+    const Node& node = nodes_[node_index];
+    if (not node.is_leaf) {
+      // A point on the split is in both children
+      const double x = x_block_logical.get(node.split_dim);
+      if (x <= node.split) {
+        find(result, boxes, x_block_logical, node_index + 1);
+      }
+      if (x >= node.split) {
+        find(result, boxes, x_block_logical,
+             node.upper_child_or_first_element);
+      }
+      return;
+    }
+    for (size_t i = node.upper_child_or_first_element;
+         i < node.upper_child_or_first_element + node.number_of_elements;
+         ++i) {
+      const size_t element = leaf_elements_[i];
+      if (element >= *result) {
+        continue;
+      }
+      bool is_contained = true;
+      for (size_t d = 0; d < Dim; ++d) {
+        const double x = x_block_logical.get(d);
+        if (x < gsl::at(boxes[element].lower, d) or
+            x > gsl::at(boxes[element].upper, d)) {
+          is_contained = false;
+          break;
+        }
+      }
+      if (is_contained) {
+        *result = element;
+      }
+    }
+  }
+
+  std::vector<Node> nodes_{};
+  std::vector<size_t> leaf_elements_{};
+};
 }  // namespace
 
 template <size_t Dim>
@@ -31,68 +181,74 @@ std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
 element_logical_coordinates(const std::vector<ElementId<Dim>>& element_ids,
                             const std::vector<block_logical_coord_holder<Dim>>&
                                 block_coord_holders) noexcept {
-  // Temporarily put results here in data structures that allow
-  // push_back, because we don't know the sizes of the output
-  // DataVectors ahead of time.
-  std::vector<std::array<std::vector<double>, Dim>> x_element_logical(
-      element_ids.size());
-  std::vector<std::vector<size_t>> offsets(element_ids.size());
-
-  // Loop over points
+  // Sort the elements into a search tree for each block
+  std::vector<ElementBox<Dim>> boxes(element_ids.size());
+  std::vector<std::vector<size_t>> elements_in_block{};
+  for (size_t index = 0; index < element_ids.size(); ++index) {
+    const auto& element_id = element_ids[index];
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(boxes[index].lower, d) =
+          gsl::at(element_id.segment_ids(), d).endpoint(Side::Lower);
+      gsl::at(boxes[index].upper, d) =
+          gsl::at(element_id.segment_ids(), d).endpoint(Side::Upper);
+    }
+    if (element_id.block_id() >= elements_in_block.size()) {
+      elements_in_block.resize(element_id.block_id() + 1);
+    }
+    elements_in_block[element_id.block_id()].push_back(index);
+  }
+  std::vector<ElementSearchTree<Dim>> trees{};
+  trees.reserve(elements_in_block.size());
+  for (const auto& elements : elements_in_block) {
+    trees.emplace_back(boxes, elements);
+  }
+
+  // Find the element containing each point, so we know the sizes of the
+  // output DataVectors ahead of time.
+  std::vector<size_t> containing_element(block_coord_holders.size(),
+                                         no_element);
+  std::vector<size_t> points_in_element(element_ids.size(), 0);
   for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
-    const auto& block_id = block_coord_holders[offset].id;
-    const auto& x_block_logical = block_coord_holders[offset].data;
-    // Need to loop over elements, because the block doesn't know
-    // things like the refinement_level of each element.
-    for (size_t index = 0; index < element_ids.size(); ++index) {
-      const auto& element_id = element_ids[index];
-      if (element_id.block_id() == block_id.get_index()) {
-        // This element is in this block; now check if the point is in
-        // this element.
-        bool is_contained = true;
-        auto x_elem = make_array<Dim>(0.0);
-        for (size_t d = 0; d < Dim; ++d) {
-          const double up =
-              gsl::at(element_id.segment_ids(), d).endpoint(Side::Upper);
-          const double lo =
-              gsl::at(element_id.segment_ids(), d).endpoint(Side::Lower);
-          const double x_block_log = x_block_logical.get(d);
-          if (x_block_log < lo or x_block_log > up) {
-            is_contained = false;
-            break;
-          }
-          // Map to element coords
-          gsl::at(x_elem, d) = (2.0 * x_block_log - up - lo) / (up - lo);
-        }
-        if (is_contained) {
-          for (size_t d = 0; d < Dim; ++d) {
-            gsl::at(x_element_logical[index], d).push_back(gsl::at(x_elem, d));
-          }
-          offsets[index].push_back(offset);
-          // Found a matching element, so we don't need to check other
-          // elements.
-          break;
-        }
-      }
+    const size_t block_id = block_coord_holders[offset].id.get_index();
+    if (block_id >= trees.size()) {
+      continue;
+    }
+    const size_t index =
+        trees[block_id].find(boxes, block_coord_holders[offset].data);
+    if (index != no_element) {
+      containing_element[offset] = index;
+      ++points_in_element[index];
     }
   }
 
-  // Now we know how many points are in each element, so we can
-  // put the intermediate results into the final data structure.
   std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>> result;
+  std::vector<ElementLogicalCoordHolder<Dim>*> holders(element_ids.size(),
+                                                       nullptr);
   for (size_t index = 0; index < element_ids.size(); ++index) {
-    const size_t num_grid_pts = x_element_logical[index][0].size();
+    const size_t num_grid_pts = points_in_element[index];
     if (num_grid_pts > 0) {
-      tnsr::I<DataVector, Dim, Frame::Logical> tmp(num_grid_pts);
-      std::vector<size_t> off(num_grid_pts);
-      for (size_t s = 0; s < num_grid_pts; ++s) {
-        for (size_t d = 0; d < Dim; ++d) {
-          tmp.get(d)[s] = gsl::at(x_element_logical[index], d)[s];
-        }
-        off[s] = offsets[index][s];
-      }
-      result.emplace(element_ids[index], ElementLogicalCoordHolder<Dim>{
-                                             std::move(tmp), std::move(off)});
+      auto& holder = result[element_ids[index]];
+      holder.element_logical_coords =
+          tnsr::I<DataVector, Dim, Frame::Logical>(num_grid_pts);
+      holder.offsets.reserve(num_grid_pts);
+      holders[index] = &holder;
+    }
+  }
+  for (size_t offset = 0; offset < block_coord_holders.size(); ++offset) {
+    const size_t index = containing_element[offset];
+    if (index == no_element) {
+      continue;
+    }
+    auto& holder = *holders[index];
+    const size_t s = holder.offsets.size();
+    holder.offsets.push_back(offset);
+    for (size_t d = 0; d < Dim; ++d) {
+      const double up = gsl::at(boxes[index].upper, d);
+      const double lo = gsl::at(boxes[index].lower, d);
+      // Map to element coords
+      holder.element_logical_coords.get(d)[s] =
+          (2.0 * block_coord_holders[offset].data.get(d) - up - lo) /
+          (up - lo);
     }
   }
   return result;
@@ -84,6 +84,13 @@ struct ElementLogicalCoordHolder {
 /// If a point is on a shared boundary of two or more `Element`s, it
 /// will be returned only once, and will be considered to belong to
 /// the first `Element` in the list of `ElementId`s.
+///
+/// The `Element`s of each `Block` are sorted into a binary tree by bisecting
+/// the block logical coordinates along the `SegmentId` hierarchy, so each
+/// point is located in a time logarithmic in the number of `Element`s.  The
+/// element logical coordinates of each `Element` are written in one pass
+/// into `DataVector`s allocated to their final size, ready to be passed to
+/// `intrp::Irregular`.
 template <size_t Dim>
 std::unordered_map<ElementId<Dim>, ElementLogicalCoordHolder<Dim>>
 element_logical_coordinates(
@@ -11,16 +11,19 @@
 #include "AlgorithmArray.hpp"
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/DomainCreators/DomainCreator.hpp"  // IWYU pragma: keep
-#include "Domain/ElementId.hpp"                     // IWYU pragma: keep
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/ElementId.hpp"  // IWYU pragma: keep
 #include "Domain/ElementIndex.hpp"
-#include "Domain/InitialElementIds.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Evolution/DiscontinuousGalerkin/InitializeElement.hpp"
+#include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
+#include "Parallel/ArrayIndex.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/TypeTraits.hpp"
 #include "Time/Tags.hpp"  // IWYU pragma: keep
 #include "Utilities/TMPL.hpp"
 
@@ -30,9 +33,13 @@ struct Inertial;
 }  // namespace Frame
 namespace observers {
 namespace Actions {
+struct DeregisterSenderWithSelf;
+struct RegisterSenderWithSelf;
 template <observers::TypeOfObservation TypeOfObservation>
 struct RegisterWithObservers;
 }  // namespace Actions
+template <class Metavariables>
+struct Observer;
 }  // namespace observers
 /// \endcond
 
@@ -77,14 +84,78 @@ struct DgElementArray {
       Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
     auto& local_cache = *(global_cache.ckLocalBranch());
     if (next_phase == Metavariables::Phase::Evolve) {
+      // Restart the elements in case the evolution was paused for load
+      // balancing
       Parallel::get_parallel_component<DgElementArray>(local_cache)
-          .perform_algorithm();
+          .perform_algorithm(true);
     } else {
+      try_load_balancing(next_phase, global_cache);
       try_register_with_observers(next_phase, global_cache);
     }
   }
 
+  /// Move the registration with the observers to the new processor after the
+  /// element was migrated by the load balancer
+  static void migrated(Parallel::ConstGlobalCache<Metavariables>& cache,
+                       const array_index& element_index,
+                       const int previous_proc) noexcept {
+    try_move_observer_registration(typename Metavariables::Phase{}, cache,
+                                   element_index, previous_proc);
+  }
+
  private:
+  template <typename PhaseType,
+            Requires<not Parallel::has_load_balancing_phase_v<PhaseType>> =
+                nullptr>
+  static void try_load_balancing(
+      const PhaseType /*next_phase*/,
+      Parallel::CProxy_ConstGlobalCache<
+          Metavariables>& /*global_cache*/) noexcept {}
+
+  template <typename PhaseType,
+            Requires<Parallel::has_load_balancing_phase_v<PhaseType>> =
+                nullptr>
+  static void try_load_balancing(
+      const PhaseType next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    if (next_phase == Metavariables::Phase::LoadBalancing) {
+      auto& local_cache = *(global_cache.ckLocalBranch());
+      Parallel::get_parallel_component<DgElementArray>(local_cache).at_sync();
+    }
+  }
+
+  template <typename PhaseType,
+            Requires<not observers::has_register_with_observer_v<PhaseType>> =
+                nullptr>
+  static void try_move_observer_registration(
+      const PhaseType /*meta*/,
+      Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+      const array_index& /*element_index*/,
+      const int /*previous_proc*/) noexcept {}
+
+  template <
+      typename PhaseType,
+      Requires<observers::has_register_with_observer_v<PhaseType>> = nullptr>
+  static void try_move_observer_registration(
+      const PhaseType /*meta*/,
+      Parallel::ConstGlobalCache<Metavariables>& cache,
+      const array_index& element_index, const int previous_proc) noexcept {
+    // Same fake temporal id as in the RegisterWithObserver phase
+    const size_t fake_temporal_id = 0;
+    const observers::ArrayComponentId component_id(
+        std::add_pointer_t<DgElementArray>{nullptr},
+        Parallel::ArrayIndex<array_index>{element_index});
+    auto& observer_proxy =
+        Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+            cache);
+    Parallel::simple_action<observers::Actions::DeregisterSenderWithSelf>(
+        observer_proxy[previous_proc], fake_temporal_id, component_id,
+        observers::TypeOfObservation::Volume);
+    Parallel::simple_action<observers::Actions::RegisterSenderWithSelf>(
+        *observer_proxy.ckLocalBranch(), fake_temporal_id, component_id,
+        observers::TypeOfObservation::Volume);
+  }
+
   template <typename PhaseType,
             Requires<not observers::has_register_with_observer_v<PhaseType>> =
                 nullptr>
@@ -102,9 +173,9 @@ struct DgElementArray {
     if (next_phase == Metavariables::Phase::RegisterWithObserver) {
       auto& local_cache = *(global_cache.ckLocalBranch());
       // We currently use a fake temporal id when registering observers but in
-      // the future when we start doing load balancing and elements migrate
-      // around the system they will need to register and unregister themselves
-      // at specific times.
+      // the future elements may need to register and unregister themselves at
+      // specific times.  Elements migrated by the load balancer move their
+      // registration in `migrated`.
       const size_t fake_temporal_id = 0;
       Parallel::simple_action<observers::Actions::RegisterWithObservers<
           observers::TypeOfObservation::Volume>>(
@@ -144,18 +215,18 @@ void DgElementArray<Metavariables, ActionList>::initialize(
   }
 
   auto domain = domain_creator->create_domain();
-  for (const auto& block : domain.blocks()) {
-    const auto initial_ref_levs =
-        domain_creator->initial_refinement_levels()[block.id()];
-    const std::vector<ElementId<volume_dim>> element_ids =
-        initial_element_ids(block.id(), initial_ref_levs);
-    int which_proc = 0;
-    const int number_of_procs = Parallel::number_of_procs();
-    for (size_t i = 0; i < element_ids.size(); ++i) {
-      dg_element_array(ElementIndex<volume_dim>(element_ids[i]))
-          .insert(global_cache, which_proc);
-      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
-    }
+  // Place contiguous pieces of a space-filling curve through the elements on
+  // each processor, so neighboring elements tend to share a processor and
+  // the grid points are balanced between processors.
+  const BlockZCurveProcDistribution<volume_dim> element_distribution(
+      static_cast<size_t>(Parallel::number_of_procs()), domain,
+      domain_creator->initial_refinement_levels(),
+      domain_creator->initial_extents());
+  for (const auto& element_id : element_distribution.ordered_element_ids()) {
+    dg_element_array(ElementIndex<volume_dim>(element_id))
+        .insert(global_cache,
+                static_cast<int>(
+                    element_distribution.get_proc_for_element(element_id)));
   }
   dg_element_array.doneInserting();
 
@@ -89,6 +89,9 @@ namespace Actions {
 ///   * Tags::deriv<System::gradients_tags>
 ///   * db::add_tag_prefix<Tags::dt, System::variables_tag>
 ///   * Tags::UnnormalizedFaceNormal<Dim>
+///   * Tags::StepperError<System::variables_tag,
+///                  db::add_tag_prefix<Tags::dt, System::variables_tag>>
+///     (with local time-stepping)
 /// - Removes: nothing
 /// - Modifies: nothing
 template <size_t Dim>
@@ -271,6 +274,17 @@ struct InitializeElement {
 
     using compute_tags = typename ComputeTags<System>::type;
 
+    // The estimate of the error of the step is recorded in the
+    // evolution loop and used to choose the local step sizes.
+    using stepper_error_tag =
+        Tags::StepperError<variables_tag, dt_variables_tag>;
+
+    template <typename Metavariables>
+    using local_time_stepping_tags =
+        tmpl::conditional_t<Metavariables::local_time_stepping,
+                            db::AddSimpleTags<stepper_error_tag>,
+                            db::AddSimpleTags<>>;
+
     // Global time stepping
     template <typename Metavariables,
               Requires<not Metavariables::local_time_stepping> = nullptr>
@@ -363,9 +377,32 @@ struct InitializeElement {
         }
       }
 
-      return db::create_from<db::RemoveTags<>, simple_tags, compute_tags>(
-          std::move(box), TimeId{}, time_id, initial_dt, std::move(dt_vars),
-          std::move(history));
+      return add_local_time_stepping_items<Metavariables>(
+          db::create_from<db::RemoveTags<>, simple_tags, compute_tags>(
+              std::move(box), TimeId{}, time_id, initial_dt,
+              std::move(dt_vars), std::move(history)));
+    }
+
+    // Global time stepping
+    template <typename Metavariables, typename TagsList,
+              Requires<not Metavariables::local_time_stepping> = nullptr>
+    static auto add_local_time_stepping_items(
+        db::DataBox<TagsList>&& box) noexcept {
+      return std::move(box);
+    }
+
+    // Local time stepping
+    template <typename Metavariables, typename TagsList,
+              Requires<Metavariables::local_time_stepping> = nullptr>
+    static auto add_local_time_stepping_items(
+        db::DataBox<TagsList>&& box) noexcept {
+      const size_t num_grid_points =
+          db::get<Tags::Mesh<Dim>>(box).number_of_grid_points();
+      // A vanishing estimate does not restrict the first step.
+      typename stepper_error_tag::type stepper_error{num_grid_points, 0.0};
+      return db::create_from<db::RemoveTags<>,
+                             local_time_stepping_tags<Metavariables>>(
+          std::move(box), std::move(stepper_error));
     }
   };
 
@@ -525,6 +562,8 @@ struct InitializeElement {
       typename SystemTags<typename Metavariables::system>::simple_tags,
       typename DomainInterfaceTags<typename Metavariables::system>::simple_tags,
       typename EvolutionTags<typename Metavariables::system>::simple_tags,
+      typename EvolutionTags<typename Metavariables::system>::
+          template local_time_stepping_tags<Metavariables>,
       typename DgTags<Metavariables>::simple_tags,
       typename DomainTags::compute_tags,
       typename SystemTags<typename Metavariables::system>::compute_tags,
@@ -28,10 +28,12 @@
 #include "Time/Actions/SelfStartActions.hpp"  // IWYU pragma: keep
 #include "Time/Actions/ChangeStepSize.hpp"  // IWYU pragma: keep
 #include "Time/Actions/FinalTime.hpp"  // IWYU pragma: keep
+#include "Time/Actions/RecordStepperError.hpp"  // IWYU pragma: keep
 #include "Time/Actions/RecordTimeStepperData.hpp"  // IWYU pragma: keep
 #include "Time/Actions/UpdateU.hpp"  // IWYU pragma: keep
 #include "Time/StepChoosers/Cfl.hpp"  // IWYU pragma: keep
 #include "Time/StepChoosers/Constant.hpp"  // IWYU pragma: keep
+#include "Time/StepChoosers/ErrorEstimate.hpp"  // IWYU pragma: keep
 #include "Time/StepChoosers/Increase.hpp"  // IWYU pragma: keep
 #include "Time/StepChoosers/StepChooser.hpp"
 #include "Time/StepControllers/StepController.hpp"
@@ -63,6 +65,7 @@ struct EvolutionMetavars {
   using step_choosers =
       tmpl::list<StepChoosers::Register::Cfl<1, Frame::Inertial>,
                  StepChoosers::Register::Constant,
+                 StepChoosers::Register::ErrorEstimate,
                  StepChoosers::Register::Increase>;
 
   using compute_rhs = tmpl::flatten<tmpl::list<
@@ -91,6 +94,8 @@ struct EvolutionMetavars {
                               Actions::ChangeStepSize<step_choosers>,
                               tmpl::list<>>,
           compute_rhs,
+          tmpl::conditional_t<local_time_stepping,
+                              Actions::RecordStepperError, tmpl::list<>>,
           update_variables,
           Actions::Goto<EvolvePhaseStart>>>>>;
 
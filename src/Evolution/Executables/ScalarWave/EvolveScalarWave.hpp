@@ -19,6 +19,8 @@
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ApplyBoundaryFluxesGlobalTimeStepping.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ComputeNonconservativeBoundaryFluxes.hpp"  // IWYU pragma: keep
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxCommunication.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ReceiveAndApplyBoundaryFluxes.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxAggregator.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Options/Options.hpp"
 #include "Parallel/InitializationFunctions.hpp"
@@ -28,6 +30,7 @@
 #include "PointwiseFunctions/MathFunctions/MathFunction.hpp"
 #include "Time/Actions/AdvanceTime.hpp"            // IWYU pragma: keep
 #include "Time/Actions/FinalTime.hpp"              // IWYU pragma: keep
+#include "Time/Actions/PauseForLoadBalancing.hpp"  // IWYU pragma: keep
 #include "Time/Actions/RecordTimeStepperData.hpp"  // IWYU pragma: keep
 #include "Time/Actions/UpdateU.hpp"                // IWYU pragma: keep
 #include "Time/Tags.hpp"
@@ -60,18 +63,32 @@ struct EvolutionMetavars {
   using const_global_cache_tag_list = tmpl::list<analytic_solution_tag>;
   using domain_creator_tag = OptionTags::DomainCreator<Dim, Frame::Inertial>;
 
+  // Send the boundary data before computing the volume time derivative, and
+  // lift the boundary fluxes on each mortar as its data arrives, so that the
+  // volume work hides the communication latency.
+  static constexpr bool overlap_boundary_communication = true;
+  using compute_rhs = tmpl::conditional_t<
+      overlap_boundary_communication,
+      tmpl::list<dg::Actions::ComputeNonconservativeBoundaryFluxes,
+                 dg::Actions::SendDataForFluxes<EvolutionMetavars>,
+                 Actions::ComputeVolumeDuDt,
+                 dg::Actions::ReceiveAndApplyBoundaryFluxes<EvolutionMetavars>>,
+      tmpl::list<Actions::ComputeVolumeDuDt,
+                 dg::Actions::ComputeNonconservativeBoundaryFluxes,
+                 dg::Actions::SendDataForFluxes<EvolutionMetavars>,
+                 dg::Actions::ReceiveDataForFluxes<EvolutionMetavars>,
+                 dg::Actions::ApplyBoundaryFluxesGlobalTimeStepping>>;
+
   using component_list = tmpl::list<
       observers::Observer<EvolutionMetavars>,
       observers::ObserverWriter<EvolutionMetavars>,
+      dg::FluxAggregator<EvolutionMetavars>,
       DgElementArray<
           EvolutionMetavars,
-          tmpl::list<Actions::AdvanceTime, ScalarWave::Actions::Observe,
-                     Actions::FinalTime, Actions::ComputeVolumeDuDt,
-                     dg::Actions::ComputeNonconservativeBoundaryFluxes,
-                     dg::Actions::SendDataForFluxes<EvolutionMetavars>,
-                     dg::Actions::ReceiveDataForFluxes<EvolutionMetavars>,
-                     dg::Actions::ApplyBoundaryFluxesGlobalTimeStepping,
-                     Actions::RecordTimeStepperData, Actions::UpdateU>>>;
+          tmpl::flatten<tmpl::list<
+              Actions::AdvanceTime, ScalarWave::Actions::Observe,
+              Actions::FinalTime, Actions::PauseForLoadBalancing, compute_rhs,
+              Actions::RecordTimeStepperData, Actions::UpdateU>>>>;
 
   static constexpr OptionString help{
       "Evolve a Scalar Wave in Dim spatial dimension.\n\n"
@@ -82,6 +99,7 @@ struct EvolutionMetavars {
     Initialization,
     RegisterWithObserver,
     Evolve,
+    LoadBalancing,
     Exit
   };
 
@@ -96,6 +114,10 @@ struct EvolutionMetavars {
         return Phase::Evolve;
       case Phase::Evolve:
         return Phase::Exit;
+      case Phase::LoadBalancing:
+        ERROR(
+            "The LoadBalancing phase is requested by the elements, so "
+            "determine_next_phase should never be called with it.");
       case Phase::Exit:
         ERROR(
             "Should never call determine_next_phase with the current phase "
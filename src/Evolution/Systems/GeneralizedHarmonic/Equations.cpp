@@ -6,9 +6,10 @@
 #include <array>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"  // IWYU pragma: keep
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 
@@ -38,9 +39,46 @@ void ComputeDuDt<Dim>::apply(
     const tnsr::a<DataVector, Dim>& normal_spacetime_one_form) {
   const size_t n_pts = shift.begin()->size();
 
-  const DataVector gamma12 = gamma1.get() * gamma2.get();
-
-  tnsr::Iaa<DataVector, Dim> phi_1_up{DataVector(n_pts, 0.)};
+  // All intermediate results share one block of memory from the thread-local
+  // arena, so evaluating the equations does not allocate.
+  using gamma12_tag = ::Tags::TempTensor<0, Scalar<DataVector>>;
+  using phi_1_up_tag = ::Tags::TempTensor<1, tnsr::Iaa<DataVector, Dim>>;
+  using phi_3_up_tag = ::Tags::TempTensor<2, tnsr::abC<DataVector, Dim>>;
+  using pi_2_up_tag = ::Tags::TempTensor<3, tnsr::aB<DataVector, Dim>>;
+  using christoffel_first_kind_3_up_tag =
+      ::Tags::TempTensor<4, tnsr::abC<DataVector, Dim>>;
+  using pi_dot_normal_spacetime_vector_tag =
+      ::Tags::TempTensor<5, tnsr::a<DataVector, Dim>>;
+  using pi_contract_two_normal_spacetime_vectors_tag =
+      ::Tags::TempTensor<6, Scalar<DataVector>>;
+  using phi_dot_normal_spacetime_vector_tag =
+      ::Tags::TempTensor<7, tnsr::ia<DataVector, Dim>>;
+  using phi_contract_two_normal_spacetime_vectors_tag =
+      ::Tags::TempTensor<8, tnsr::a<DataVector, Dim>>;
+  using three_index_constraint_tag =
+      ::Tags::TempTensor<9, tnsr::iaa<DataVector, Dim>>;
+  using one_index_constraint_tag =
+      ::Tags::TempTensor<10, tnsr::a<DataVector, Dim>>;
+  using normal_dot_one_index_constraint_tag =
+      ::Tags::TempTensor<11, Scalar<DataVector>>;
+  using gamma1p1_tag = ::Tags::TempTensor<12, Scalar<DataVector>>;
+  using shift_dot_three_index_constraint_tag =
+      ::Tags::TempTensor<13, tnsr::aa<DataVector, Dim>>;
+  TempBuffer<tmpl::list<
+      gamma12_tag, phi_1_up_tag, phi_3_up_tag, pi_2_up_tag,
+      christoffel_first_kind_3_up_tag, pi_dot_normal_spacetime_vector_tag,
+      pi_contract_two_normal_spacetime_vectors_tag,
+      phi_dot_normal_spacetime_vector_tag,
+      phi_contract_two_normal_spacetime_vectors_tag,
+      three_index_constraint_tag, one_index_constraint_tag,
+      normal_dot_one_index_constraint_tag, gamma1p1_tag,
+      shift_dot_three_index_constraint_tag>>
+      buffer(n_pts, 0.);
+
+  DataVector& gamma12 = get(get<gamma12_tag>(buffer));
+  gamma12 = gamma1.get() * gamma2.get();
+
+  auto& phi_1_up = get<phi_1_up_tag>(buffer);
   for (size_t m = 0; m < Dim; ++m) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       for (size_t n = 0; n < Dim; ++n) {
@@ -52,7 +90,7 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::abC<DataVector, Dim> phi_3_up{DataVector(n_pts, 0.)};
+  auto& phi_3_up = get<phi_3_up_tag>(buffer);
   for (size_t m = 0; m < Dim; ++m) {
     for (size_t nu = 0; nu < Dim + 1; ++nu) {
       for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
@@ -64,7 +102,7 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::aB<DataVector, Dim> pi_2_up{DataVector(n_pts, 0.)};
+  auto& pi_2_up = get<pi_2_up_tag>(buffer);
   for (size_t nu = 0; nu < Dim + 1; ++nu) {
     for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
       for (size_t beta = 0; beta < Dim + 1; ++beta) {
@@ -74,7 +112,8 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::abC<DataVector, Dim> christoffel_first_kind_3_up{DataVector(n_pts, 0.)};
+  auto& christoffel_first_kind_3_up =
+      get<christoffel_first_kind_3_up_tag>(buffer);
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     for (size_t nu = 0; nu < Dim + 1; ++nu) {
       for (size_t alpha = 0; alpha < Dim + 1; ++alpha) {
@@ -87,8 +126,8 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::a<DataVector, Dim> pi_dot_normal_spacetime_vector{
-      DataVector(n_pts, 0.)};
+  auto& pi_dot_normal_spacetime_vector =
+      get<pi_dot_normal_spacetime_vector_tag>(buffer);
   for (size_t nu = 0; nu < Dim + 1; ++nu) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       pi_dot_normal_spacetime_vector.get(mu) +=
@@ -96,15 +135,16 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  DataVector pi_contract_two_normal_spacetime_vectors{DataVector(n_pts, 0.)};
+  DataVector& pi_contract_two_normal_spacetime_vectors =
+      get(get<pi_contract_two_normal_spacetime_vectors_tag>(buffer));
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     pi_contract_two_normal_spacetime_vectors +=
         normal_spacetime_vector.get(mu) *
         pi_dot_normal_spacetime_vector.get(mu);
   }
 
-  tnsr::ia<DataVector, Dim> phi_dot_normal_spacetime_vector{
-      DataVector(n_pts, 0.)};
+  auto& phi_dot_normal_spacetime_vector =
+      get<phi_dot_normal_spacetime_vector_tag>(buffer);
   for (size_t n = 0; n < Dim; ++n) {
     for (size_t nu = 0; nu < Dim + 1; ++nu) {
       for (size_t mu = 0; mu < Dim + 1; ++mu) {
@@ -114,8 +154,8 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::a<DataVector, Dim> phi_contract_two_normal_spacetime_vectors{
-      DataVector(n_pts, 0.)};
+  auto& phi_contract_two_normal_spacetime_vectors =
+      get<phi_contract_two_normal_spacetime_vectors_tag>(buffer);
   for (size_t n = 0; n < Dim; ++n) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       phi_contract_two_normal_spacetime_vectors.get(n) +=
@@ -124,7 +164,7 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::iaa<DataVector, Dim> three_index_constraint{DataVector(n_pts, 0.)};
+  auto& three_index_constraint = get<three_index_constraint_tag>(buffer);
   for (size_t n = 0; n < Dim; ++n) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       for (size_t nu = mu; nu < Dim + 1; ++nu) {
@@ -134,22 +174,24 @@ void ComputeDuDt<Dim>::apply(
     }
   }
 
-  tnsr::a<DataVector, Dim> one_index_constraint{DataVector(n_pts, 0.)};
+  auto& one_index_constraint = get<one_index_constraint_tag>(buffer);
   for (size_t nu = 0; nu < Dim + 1; ++nu) {
     one_index_constraint.get(nu) =
         gauge_function.get(nu) + trace_christoffel.get(nu);
   }
 
-  DataVector normal_dot_one_index_constraint{DataVector(n_pts, 0.)};
+  DataVector& normal_dot_one_index_constraint =
+      get(get<normal_dot_one_index_constraint_tag>(buffer));
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     normal_dot_one_index_constraint +=
         normal_spacetime_vector.get(mu) * one_index_constraint.get(mu);
   }
 
-  const DataVector gamma1p1 = 1.0 + gamma1.get();
+  DataVector& gamma1p1 = get(get<gamma1p1_tag>(buffer));
+  gamma1p1 = 1.0 + gamma1.get();
 
-  tnsr::aa<DataVector, Dim> shift_dot_three_index_constraint{
-      DataVector(n_pts, 0.)};
+  auto& shift_dot_three_index_constraint =
+      get<shift_dot_three_index_constraint_tag>(buffer);
   for (size_t m = 0; m < Dim; ++m) {
     for (size_t mu = 0; mu < Dim + 1; ++mu) {
       for (size_t nu = mu; nu < Dim + 1; ++nu) {
@@ -262,10 +304,17 @@ void ComputeNormalDotFluxes<Dim>::apply(
     const Scalar<DataVector>& lapse, const tnsr::I<DataVector, Dim>& shift,
     const tnsr::II<DataVector, Dim>& inverse_spatial_metric,
     const tnsr::i<DataVector, Dim>& unit_normal) noexcept {
-  const auto shift_dot_normal = get(dot_product(shift, unit_normal));
+  using shift_dot_normal_tag = ::Tags::TempTensor<0, Scalar<DataVector>>;
+  using normal_dot_phi_tag = ::Tags::TempTensor<1, tnsr::aa<DataVector, Dim>>;
+  TempBuffer<tmpl::list<shift_dot_normal_tag, normal_dot_phi_tag>> buffer(
+      get(gamma1).size(), 0.);
+
+  DataVector& shift_dot_normal = get(get<shift_dot_normal_tag>(buffer));
+  for (size_t i = 0; i < Dim; ++i) {
+    shift_dot_normal += shift.get(i) * unit_normal.get(i);
+  }
 
-  auto normal_dot_phi =
-      make_with_value<tnsr::aa<DataVector, Dim>>(gamma1, 0.);
+  auto& normal_dot_phi = get<normal_dot_phi_tag>(buffer);
   for (size_t mu = 0; mu < Dim + 1; ++mu) {
     for (size_t nu = mu; nu < Dim + 1; ++nu) {
       for (size_t i = 0; i < Dim; ++i) {
@@ -0,0 +1,267 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FallbackChain.hpp"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>  // IWYU pragma: keep
+#include <string>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/TempBuffer.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "Options/ParseOptions.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Overloader.hpp"
+
+// IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
+
+namespace grmhd {
+namespace ValenciaDivClean {
+namespace PrimitiveRecoverySchemes {
+
+std::ostream& operator<<(std::ostream& os, const Scheme& scheme) noexcept {
+  switch (scheme) {
+    case Scheme::NewmanHamlin:
+      return os << "NewmanHamlin";
+    case Scheme::PalenzuelaEtAl:
+      return os << "PalenzuelaEtAl";
+    case Scheme::Atmosphere:
+      return os << "Atmosphere";
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR("Need to add another case, don't understand value of 'scheme'");
+      // LCOV_EXCL_STOP
+  }
+}
+
+FallbackChain::FallbackChain(std::vector<Scheme> schemes,
+                             const double atmosphere_density,
+                             const OptionContext& context)
+    : schemes_(std::move(schemes)), atmosphere_density_(atmosphere_density) {
+  const auto atmosphere =
+      std::find(schemes_.begin(), schemes_.end(), Scheme::Atmosphere);
+  if (atmosphere != schemes_.end() and atmosphere + 1 != schemes_.end()) {
+    PARSE_ERROR(context,
+                "Atmosphere never fails, so it must be the last entry of the "
+                "primitive recovery fallback chain.");
+  }
+  if (atmosphere_density_ <= 0.0) {
+    PARSE_ERROR(context, "The atmosphere density must be positive, not "
+                             << atmosphere_density_);
+  }
+}
+
+void FallbackChain::pup(PUP::er& p) noexcept {
+  p | schemes_;
+  p | atmosphere_density_;
+}
+
+namespace {
+template <size_t N>
+using ScalarTemp = ::Tags::TempTensor<N, Scalar<DataVector>>;
+
+template <size_t ThermodynamicDim>
+void apply_scheme(
+    const Scheme scheme,
+    const gsl::not_null<PrimitiveRecoveryBatchData*> result,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  switch (scheme) {
+    case Scheme::NewmanHamlin:
+      NewmanHamlin::apply<ThermodynamicDim>(
+          result, total_energy_density, momentum_density_squared,
+          momentum_density_dot_magnetic_field, magnetic_field_squared,
+          rest_mass_density_times_lorentz_factor, equation_of_state);
+      return;
+    case Scheme::PalenzuelaEtAl:
+      PalenzuelaEtAl::apply<ThermodynamicDim>(
+          result, total_energy_density, momentum_density_squared,
+          momentum_density_dot_magnetic_field, magnetic_field_squared,
+          rest_mass_density_times_lorentz_factor, equation_of_state);
+      return;
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR("Cannot apply primitive recovery scheme " << scheme);
+      // LCOV_EXCL_STOP
+  }
+}
+}  // namespace
+
+template <size_t ThermodynamicDim>
+void FallbackChain::apply(
+    const gsl::not_null<PrimitiveRecoveryBatchData*> result,
+    const gsl::not_null<std::vector<size_t>*> scheme_used,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) const noexcept {
+  const size_t number_of_points = total_energy_density.size();
+  *result = PrimitiveRecoveryBatchData(number_of_points);
+  scheme_used->assign(number_of_points, schemes_.size());
+
+  // The points not yet recovered by any entry of the chain
+  std::vector<size_t> remaining(number_of_points);
+  std::iota(remaining.begin(), remaining.end(), size_t{0});
+  std::vector<size_t> still_remaining{};
+  still_remaining.reserve(number_of_points);
+  for (size_t entry = 0; entry < schemes_.size() and not remaining.empty();
+       ++entry) {
+    if (schemes_[entry] == Scheme::Atmosphere) {
+      double specific_internal_energy = 0.0;
+      const double pressure = get(make_overloader(
+          [this, &specific_internal_energy ](
+              const EquationsOfState::EquationOfState<true, 1>&
+                  the_equation_of_state) noexcept {
+            specific_internal_energy =
+                get(the_equation_of_state
+                        .specific_internal_energy_from_density(
+                            Scalar<double>(atmosphere_density_)));
+            return the_equation_of_state.pressure_from_density(
+                Scalar<double>(atmosphere_density_));
+          },
+          [this](const EquationsOfState::EquationOfState<true, 2>&
+                     the_equation_of_state) noexcept {
+            return the_equation_of_state.pressure_from_density_and_energy(
+                Scalar<double>(atmosphere_density_), Scalar<double>(0.0));
+          })(equation_of_state));
+      for (const size_t s : remaining) {
+        get(result->rest_mass_density)[s] = atmosphere_density_;
+        get(result->lorentz_factor)[s] = 1.0;
+        get(result->pressure)[s] = pressure;
+        get(result->rho_h_w_squared)[s] =
+            atmosphere_density_ * (1.0 + specific_internal_energy) + pressure;
+        (*scheme_used)[s] = entry;
+      }
+      remaining.clear();
+      break;
+    }
+
+    PrimitiveRecoveryBatchData entry_result{};
+    if (remaining.size() == number_of_points) {
+      apply_scheme(schemes_[entry], make_not_null(&entry_result),
+                   total_energy_density, momentum_density_squared,
+                   momentum_density_dot_magnetic_field, magnetic_field_squared,
+                   rest_mass_density_times_lorentz_factor, equation_of_state);
+    } else {
+      // Gather the inputs at the remaining points so the scheme is only paid
+      // for where it is needed
+      TempBuffer<tmpl::list<ScalarTemp<0>, ScalarTemp<1>, ScalarTemp<2>,
+                            ScalarTemp<3>, ScalarTemp<4>>>
+          buffer(remaining.size());
+      const std::array<const DataVector*, 5> inputs{
+          {&total_energy_density, &momentum_density_squared,
+           &momentum_density_dot_magnetic_field, &magnetic_field_squared,
+           &rest_mass_density_times_lorentz_factor}};
+      const std::array<DataVector*, 5> gathered_inputs{
+          {&get(get<ScalarTemp<0>>(buffer)), &get(get<ScalarTemp<1>>(buffer)),
+           &get(get<ScalarTemp<2>>(buffer)), &get(get<ScalarTemp<3>>(buffer)),
+           &get(get<ScalarTemp<4>>(buffer))}};
+      for (size_t i = 0; i < inputs.size(); ++i) {
+        for (size_t j = 0; j < remaining.size(); ++j) {
+          (*gsl::at(gathered_inputs, i))[j] =
+              (*gsl::at(inputs, i))[remaining[j]];
+        }
+      }
+      apply_scheme(schemes_[entry], make_not_null(&entry_result),
+                   *gathered_inputs[0], *gathered_inputs[1],
+                   *gathered_inputs[2], *gathered_inputs[3],
+                   *gathered_inputs[4], equation_of_state);
+    }
+
+    still_remaining.clear();
+    for (size_t j = 0; j < remaining.size(); ++j) {
+      const size_t s = remaining[j];
+      result->iterations[s] += entry_result.iterations[j];
+      if (entry_result.failed[j]) {
+        still_remaining.push_back(s);
+        continue;
+      }
+      get(result->rest_mass_density)[s] =
+          get(entry_result.rest_mass_density)[j];
+      get(result->lorentz_factor)[s] = get(entry_result.lorentz_factor)[j];
+      get(result->pressure)[s] = get(entry_result.pressure)[j];
+      get(result->rho_h_w_squared)[s] = get(entry_result.rho_h_w_squared)[j];
+      (*scheme_used)[s] = entry;
+    }
+    std::swap(remaining, still_remaining);
+  }
+
+  for (const size_t s : remaining) {
+    result->failed[s] = true;
+  }
+}
+
+bool operator==(const FallbackChain& lhs, const FallbackChain& rhs) noexcept {
+  return lhs.schemes() == rhs.schemes() and
+         lhs.atmosphere_density() == rhs.atmosphere_density();
+}
+
+bool operator!=(const FallbackChain& lhs, const FallbackChain& rhs) noexcept {
+  return not(lhs == rhs);
+}
+}  // namespace PrimitiveRecoverySchemes
+}  // namespace ValenciaDivClean
+}  // namespace grmhd
+
+grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::Scheme
+create_from_yaml<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::Scheme>::
+    create(const Option& options) {
+  using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::Scheme;
+  const std::string scheme_read = options.parse_as<std::string>();
+  if (scheme_read == "NewmanHamlin") {
+    return Scheme::NewmanHamlin;
+  } else if (scheme_read == "PalenzuelaEtAl") {
+    return Scheme::PalenzuelaEtAl;
+  } else if (scheme_read == "Atmosphere") {
+    return Scheme::Atmosphere;
+  }
+  PARSE_ERROR(options.context(),
+              "Failed to convert \""
+                  << scheme_read
+                  << "\" to Scheme. Expected one of: "
+                     "{NewmanHamlin, PalenzuelaEtAl, Atmosphere}.");
+}
+
+/// \cond
+#define THERMODIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(_, data)                                            \
+  template void grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::        \
+      FallbackChain::apply<THERMODIM(data)>(                               \
+          const gsl::not_null<grmhd::ValenciaDivClean::                    \
+                                  PrimitiveRecoverySchemes::               \
+                                      PrimitiveRecoveryBatchData*>         \
+              result,                                                      \
+          const gsl::not_null<std::vector<size_t>*> scheme_used,           \
+          const DataVector& total_energy_density,                          \
+          const DataVector& momentum_density_squared,                      \
+          const DataVector& momentum_density_dot_magnetic_field,           \
+          const DataVector& magnetic_field_squared,                        \
+          const DataVector& rest_mass_density_times_lorentz_factor,        \
+          const EquationsOfState::EquationOfState<true, THERMODIM(data)>&  \
+              equation_of_state) const noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2))
+
+#undef INSTANTIATION
+#undef THERMODIM
+/// \endcond
@@ -0,0 +1,136 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "Options/Options.hpp"
+#include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+// IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
+
+namespace grmhd {
+namespace ValenciaDivClean {
+namespace PrimitiveRecoverySchemes {
+
+/// \cond
+struct PrimitiveRecoveryBatchData;
+/// \endcond
+
+/// \brief The primitive recovery schemes that can be tried in a
+/// FallbackChain
+///
+/// `Atmosphere` is not a recovery scheme: it resets a point to a static fluid
+/// at the atmosphere density and never fails.
+enum class Scheme { NewmanHamlin, PalenzuelaEtAl, Atmosphere };
+
+std::ostream& operator<<(std::ostream& os, const Scheme& scheme) noexcept;
+
+/*!
+ * \brief Recover the primitive variables by trying several schemes in turn.
+ *
+ * The first scheme is applied to all points of the element.  Each subsequent
+ * scheme is applied only to the points at which all previous schemes failed,
+ * so a robust but expensive scheme such as PalenzuelaEtAl costs nothing where
+ * NewmanHamlin succeeds.  If the chain ends with `Scheme::Atmosphere`, the
+ * points at which all schemes failed are reset to a static fluid with the
+ * rest mass density `atmosphere_density()`, zero specific internal energy if
+ * the equation of state is not barotropic, and the pressure of the equation of
+ * state.  Points at which no entry of the chain succeeded are flagged as
+ * failed.
+ *
+ * For each point, `scheme_used` holds the index into `schemes()` of the entry
+ * that recovered it, or `schemes().size()` if no entry did.
+ */
+class FallbackChain {
+ public:
+  struct Schemes {
+    using type = std::vector<Scheme>;
+    static constexpr OptionString help = {
+        "Primitive recovery schemes in the order they are tried. Choose from "
+        "NewmanHamlin, PalenzuelaEtAl, and Atmosphere (which must be last)."};
+    static size_t lower_bound_on_size() { return 1; }
+  };
+  struct AtmosphereDensity {
+    using type = double;
+    static constexpr OptionString help = {
+        "Rest mass density of points reset to the atmosphere"};
+    static type default_value() { return 1.e-15; }
+  };
+  using options = tmpl::list<Schemes, AtmosphereDensity>;
+  static constexpr OptionString help = {
+      "Recover the primitive variables with the first of a list of schemes\n"
+      "that succeeds, trying each scheme only at the points where all\n"
+      "previous schemes failed."};
+
+  FallbackChain(std::vector<Scheme> schemes, double atmosphere_density,
+                const OptionContext& context = {});
+
+  FallbackChain() = default;
+  FallbackChain(const FallbackChain& /*rhs*/) = default;
+  FallbackChain& operator=(const FallbackChain& /*rhs*/) = default;
+  FallbackChain(FallbackChain&& /*rhs*/) noexcept = default;
+  FallbackChain& operator=(FallbackChain&& /*rhs*/) noexcept = default;
+  ~FallbackChain() = default;
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+  const std::vector<Scheme>& schemes() const noexcept { return schemes_; }
+  double atmosphere_density() const noexcept { return atmosphere_density_; }
+
+  template <size_t ThermodynamicDim>
+  void apply(gsl::not_null<PrimitiveRecoveryBatchData*> result,
+             gsl::not_null<std::vector<size_t>*> scheme_used,
+             const DataVector& total_energy_density,
+             const DataVector& momentum_density_squared,
+             const DataVector& momentum_density_dot_magnetic_field,
+             const DataVector& magnetic_field_squared,
+             const DataVector& rest_mass_density_times_lorentz_factor,
+             const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+                 equation_of_state) const noexcept;
+
+  static const std::string name() noexcept { return "Fallback chain"; }
+
+ private:
+  std::vector<Scheme> schemes_{};
+  double atmosphere_density_{1.e-15};
+};
+
+bool operator==(const FallbackChain& lhs, const FallbackChain& rhs) noexcept;
+bool operator!=(const FallbackChain& lhs, const FallbackChain& rhs) noexcept;
+}  // namespace PrimitiveRecoverySchemes
+
+namespace OptionTags {
+/// The primitive recovery schemes tried by PrimitiveFromConservative
+struct PrimitiveRecoveryFallbackChain {
+  static constexpr OptionString help =
+      "The primitive recovery schemes to try, in order";
+  using type = PrimitiveRecoverySchemes::FallbackChain;
+};
+}  // namespace OptionTags
+}  // namespace ValenciaDivClean
+}  // namespace grmhd
+
+template <>
+struct create_from_yaml<
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::Scheme> {
+  static grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::Scheme create(
+      const Option& options);
+};
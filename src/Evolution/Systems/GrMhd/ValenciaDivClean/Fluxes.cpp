@@ -7,7 +7,7 @@
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
@@ -15,6 +15,7 @@
 #include "PointwiseFunctions/Hydro/Tags.hpp"              // IWYU pragma: keep
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 // IWYU pragma: no_include <array>
@@ -43,35 +44,62 @@ void ComputeFluxes::apply(
     const tnsr::I<DataVector, 3, Frame::Inertial>& spatial_velocity,
     const Scalar<DataVector>& lorentz_factor,
     const tnsr::I<DataVector, 3, Frame::Inertial>& magnetic_field) noexcept {
-  // not const to save an allocation below
-  auto spatial_velocity_one_form =
-      raise_or_lower_index(spatial_velocity, spatial_metric);
-  const auto magnetic_field_one_form =
-      raise_or_lower_index(magnetic_field, spatial_metric);
-  const auto magnetic_field_dot_spatial_velocity =
-      dot_product(magnetic_field, spatial_velocity_one_form);
-  const auto magnetic_field_squared =
-      dot_product(magnetic_field, magnetic_field_one_form);
+  using spatial_velocity_one_form_tag =
+      ::Tags::TempTensor<0, tnsr::i<DataVector, 3, Frame::Inertial>>;
+  using magnetic_field_one_form_tag =
+      ::Tags::TempTensor<1, tnsr::i<DataVector, 3, Frame::Inertial>>;
+  using magnetic_field_dot_spatial_velocity_tag =
+      ::Tags::TempTensor<2, Scalar<DataVector>>;
+  using magnetic_field_squared_tag = ::Tags::TempTensor<3, Scalar<DataVector>>;
+  using one_over_w_squared_tag = ::Tags::TempTensor<4, Scalar<DataVector>>;
+  using p_star_alpha_sqrt_det_g_tag = ::Tags::TempTensor<5, Scalar<DataVector>>;
+  using transport_velocity_I_tag = ::Tags::TempTensor<6, Scalar<DataVector>>;
+  TempBuffer<tmpl::list<
+      spatial_velocity_one_form_tag, magnetic_field_one_form_tag,
+      magnetic_field_dot_spatial_velocity_tag, magnetic_field_squared_tag,
+      one_over_w_squared_tag, p_star_alpha_sqrt_det_g_tag,
+      transport_velocity_I_tag>>
+      buffer(get(lapse).size(), 0.);
 
-  const DataVector one_over_w_squared = 1.0 / square(get(lorentz_factor));
+  auto& spatial_velocity_one_form = get<spatial_velocity_one_form_tag>(buffer);
+  raise_or_lower_index(make_not_null(&spatial_velocity_one_form),
+                       spatial_velocity, spatial_metric);
+  auto& magnetic_field_one_form = get<magnetic_field_one_form_tag>(buffer);
+  raise_or_lower_index(make_not_null(&magnetic_field_one_form), magnetic_field,
+                       spatial_metric);
+  DataVector& magnetic_field_dot_spatial_velocity =
+      get(get<magnetic_field_dot_spatial_velocity_tag>(buffer));
+  DataVector& magnetic_field_squared =
+      get(get<magnetic_field_squared_tag>(buffer));
+  for (size_t i = 0; i < 3; ++i) {
+    magnetic_field_dot_spatial_velocity +=
+        magnetic_field.get(i) * spatial_velocity_one_form.get(i);
+    magnetic_field_squared +=
+        magnetic_field.get(i) * magnetic_field_one_form.get(i);
+  }
+
+  DataVector& one_over_w_squared = get(get<one_over_w_squared_tag>(buffer));
+  one_over_w_squared = 1.0 / square(get(lorentz_factor));
   // p_star = p + p_m = p + b^2/2 = p + ((B^m v_m)^2 + (B^m B_m)/W^2)/2
-  const DataVector p_star_alpha_sqrt_det_g =
+  DataVector& p_star_alpha_sqrt_det_g =
+      get(get<p_star_alpha_sqrt_det_g_tag>(buffer));
+  p_star_alpha_sqrt_det_g =
       get(sqrt_det_spatial_metric) * get(lapse) *
-      (get(pressure) + 0.5 * square(get(magnetic_field_dot_spatial_velocity)) +
-       0.5 * get(magnetic_field_squared) * one_over_w_squared);
+      (get(pressure) + 0.5 * square(magnetic_field_dot_spatial_velocity) +
+       0.5 * magnetic_field_squared * one_over_w_squared);
 
   // lapse b_i / W = lapse (B_i / W^2 + v_i (B^m v_m)
-  tnsr::i<DataVector, 3, Frame::Inertial> lapse_b_over_w =
-      std::move(spatial_velocity_one_form);
+  // This reuses the memory of spatial_velocity_one_form, which is not needed
+  // anymore
+  auto& lapse_b_over_w = spatial_velocity_one_form;
   for (size_t i = 0; i < 3; ++i) {
-    lapse_b_over_w.get(i) *= get(magnetic_field_dot_spatial_velocity);
+    lapse_b_over_w.get(i) *= magnetic_field_dot_spatial_velocity;
     lapse_b_over_w.get(i) +=
         one_over_w_squared * magnetic_field_one_form.get(i);
     lapse_b_over_w.get(i) *= get(lapse);
   }
 
-  // Outside the loop to save allocations
-  DataVector transport_velocity_I(p_star_alpha_sqrt_det_g.size());
+  DataVector& transport_velocity_I = get(get<transport_velocity_I_tag>(buffer));
 
   for (size_t i = 0; i < 3; ++i) {
     transport_velocity_I = get(lapse) * spatial_velocity.get(i) - shift.get(i);
@@ -79,7 +107,7 @@ void ComputeFluxes::apply(
     tilde_tau_flux->get(i) =
         get(tilde_tau) * transport_velocity_I +
         p_star_alpha_sqrt_det_g * spatial_velocity.get(i) -
-        get(lapse) * get(magnetic_field_dot_spatial_velocity) * tilde_b.get(i);
+        get(lapse) * magnetic_field_dot_spatial_velocity * tilde_b.get(i);
     tilde_phi_flux->get(i) =
         get(lapse) * tilde_b.get(i) - get(tilde_phi) * shift.get(i);
     for (size_t j = 0; j < 3; ++j) {
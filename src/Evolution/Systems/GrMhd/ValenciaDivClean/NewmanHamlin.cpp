@@ -8,7 +8,10 @@
 #include <boost/none.hpp>
 #include <cmath>
 #include <limits>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Error.hpp"
@@ -17,6 +20,7 @@
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Overloader.hpp"
+#include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
@@ -156,6 +160,193 @@ boost::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
     }
   }  // while loop
 }
+
+namespace {
+// Flag the points at which `is_valid` is false as failed, and replace the
+// value there by `replacement` so the lockstep iteration stays finite at the
+// failed points.
+template <typename IsValid>
+void flag_invalid_points(const gsl::not_null<DataVector*> values,
+                         const gsl::not_null<std::vector<bool>*> failed,
+                         const double replacement,
+                         const IsValid& is_valid) noexcept {
+  for (size_t s = 0; s < values->size(); ++s) {
+    if (UNLIKELY(not is_valid((*values)[s]))) {
+      (*failed)[s] = true;
+      (*values)[s] = replacement;
+    }
+  }
+}
+
+template <size_t N>
+using ScalarTemp = ::Tags::TempTensor<N, Scalar<DataVector>>;
+}  // namespace
+
+template <size_t ThermodynamicDim>
+void NewmanHamlin::apply(
+    const gsl::not_null<PrimitiveRecoveryBatchData*> result,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  const size_t number_of_points = total_energy_density.size();
+  *result = PrimitiveRecoveryBatchData(number_of_points);
+  auto& failed = result->failed;
+  DataVector& current_pressure = get(result->pressure);
+  DataVector& rho_h_w_squared = get(result->rho_h_w_squared);
+  DataVector& current_lorentz_factor = get(result->lorentz_factor);
+  DataVector& current_rest_mass_density = get(result->rest_mass_density);
+
+  TempBuffer<tmpl::list<ScalarTemp<0>, ScalarTemp<1>, ScalarTemp<2>,
+                        ScalarTemp<3>, ScalarTemp<4>, ScalarTemp<5>,
+                        ScalarTemp<6>, ScalarTemp<7>, ScalarTemp<8>,
+                        ScalarTemp<9>>>
+      buffer(number_of_points);
+  DataVector& d_in_cubic = get(get<ScalarTemp<0>>(buffer));
+  DataVector& minimum_pressure = get(get<ScalarTemp<1>>(buffer));
+  DataVector& previous_pressure = get(get<ScalarTemp<2>>(buffer));
+  DataVector& a_in_cubic = get(get<ScalarTemp<3>>(buffer));
+  DataVector& root_of_cubic = get(get<ScalarTemp<4>>(buffer));
+  DataVector& v_squared = get(get<ScalarTemp<5>>(buffer));
+  DataVector& cos_squared_phi = get(get<ScalarTemp<9>>(buffer));
+  std::array<DataVector*, 3> aitken_pressure{
+      {&get(get<ScalarTemp<6>>(buffer)), &get(get<ScalarTemp<7>>(buffer)),
+       &get(get<ScalarTemp<8>>(buffer))}};
+  std::vector<size_t> valid_entries_in_aitken_pressure(number_of_points, 1);
+
+  d_in_cubic = 0.5 * (momentum_density_squared * magnetic_field_squared -
+                      square(momentum_density_dot_magnetic_field));
+  flag_invalid_points(make_not_null(&d_in_cubic), make_not_null(&failed), 0.0,
+                      [](const double d) noexcept { return d >= 0.0; });
+  minimum_pressure = cbrt(6.75 * d_in_cubic) - total_energy_density -
+                     0.5 * magnetic_field_squared;
+  for (size_t s = 0; s < number_of_points; ++s) {
+    current_pressure[s] = std::max(minimum_pressure[s], 0.0);
+  }
+  *aitken_pressure[0] = current_pressure;
+
+  // A point is active until it converges or fails
+  std::vector<bool> active(number_of_points);
+  size_t number_of_active_points = 0;
+  for (size_t s = 0; s < number_of_points; ++s) {
+    active[s] = not failed[s];
+    number_of_active_points += active[s] ? 1 : 0;
+  }
+
+  for (size_t iteration_step = 0;; ++iteration_step) {
+    for (size_t s = 0; s < number_of_points; ++s) {
+      if (active[s]) {
+        previous_pressure[s] = current_pressure[s];
+      }
+      // enforces NH Eq.(5.9): d <= (4/27) a^3 so cubic has positive root
+      current_pressure[s] = std::max(current_pressure[s], minimum_pressure[s]);
+    }
+    // The primitives at all points, computed as in the scalar version
+    a_in_cubic = total_energy_density + current_pressure +
+                 0.5 * magnetic_field_squared;
+    flag_invalid_points(make_not_null(&a_in_cubic), make_not_null(&failed),
+                        1.0, [](const double a) noexcept { return a > 0.0; });
+    // NH Eq. (5.10): d = (4/27) a^3 cos^2(phi)
+    cos_squared_phi = 6.75 * d_in_cubic / cube(a_in_cubic);
+    // Only roundoff can push this past 1
+    for (size_t s = 0; s < number_of_points; ++s) {
+      cos_squared_phi[s] = std::min(cos_squared_phi[s], 1.0);
+    }
+    // NH Eq. (5.11) with l=1 is desired positive root
+    root_of_cubic = (a_in_cubic / 3.0) *
+                    (1.0 - 2.0 * cos((2.0 / 3.0) *
+                                     (M_PI + acos(sqrt(cos_squared_phi)))));
+    // NH Eq. (5.5)
+    rho_h_w_squared = root_of_cubic - magnetic_field_squared;
+    flag_invalid_points(
+        make_not_null(&rho_h_w_squared), make_not_null(&failed), 1.0,
+        [](const double rho_h_w2) noexcept { return rho_h_w2 > 0.0; });
+    // NH Eq. (5.2) with (5.5) substituted in denominator
+    v_squared = (momentum_density_squared * square(rho_h_w_squared) +
+                 square(momentum_density_dot_magnetic_field) *
+                     (magnetic_field_squared + 2.0 * rho_h_w_squared)) /
+                square(rho_h_w_squared * root_of_cubic);
+    flag_invalid_points(
+        make_not_null(&v_squared), make_not_null(&failed), 0.0,
+        [](const double v2) noexcept { return 0.0 <= v2 and v2 < 1.0; });
+    current_lorentz_factor = sqrt(1.0 / (1.0 - v_squared));
+    current_rest_mass_density =
+        rest_mass_density_times_lorentz_factor / current_lorentz_factor;
+    flag_invalid_points(make_not_null(&current_rest_mass_density),
+                        make_not_null(&failed), 1.0,
+                        [](const double rho) noexcept { return rho > 0.0; });
+
+    for (size_t s = 0; s < number_of_points; ++s) {
+      if (active[s] and failed[s]) {
+        active[s] = false;
+        --number_of_active_points;
+      }
+    }
+    if (number_of_active_points == 0 or max_iterations_ == iteration_step) {
+      break;
+    }
+
+    // One equation of state call updates the pressure at all points
+    const DataVector updated_pressure = get(make_overloader(
+        [&current_rest_mass_density](
+            const EquationsOfState::EquationOfState<true, 1>&
+                the_equation_of_state) noexcept {
+          return the_equation_of_state.pressure_from_density(
+              Scalar<DataVector>{current_rest_mass_density});
+        },
+        [&current_rest_mass_density, &rho_h_w_squared,
+         &current_lorentz_factor ](const EquationsOfState::EquationOfState<
+                                   true, 2>& the_equation_of_state) noexcept {
+          return the_equation_of_state.pressure_from_density_and_enthalpy(
+              Scalar<DataVector>{current_rest_mass_density},
+              Scalar<DataVector>{rho_h_w_squared /
+                                 (current_rest_mass_density *
+                                  square(current_lorentz_factor))});
+        })(equation_of_state));
+
+    for (size_t s = 0; s < number_of_points; ++s) {
+      if (not active[s]) {
+        continue;
+      }
+      ++result->iterations[s];
+      current_pressure[s] = updated_pressure[s];
+      size_t& valid_entries = valid_entries_in_aitken_pressure[s];
+      (*gsl::at(aitken_pressure, valid_entries++))[s] = current_pressure[s];
+      if (3 == valid_entries) {
+        const double p0 = (*aitken_pressure[0])[s];
+        const double p1 = (*aitken_pressure[1])[s];
+        const double p2 = (*aitken_pressure[2])[s];
+        const double aitken_residual = (p2 - p1) / (p1 - p0);
+        if (0.0 <= aitken_residual and aitken_residual < 1.0) {
+          previous_pressure[s] = current_pressure[s];
+          current_pressure[s] = p1 + (p2 - p1) / (1.0 - aitken_residual);
+          (*aitken_pressure[0])[s] = current_pressure[s];
+          valid_entries = 1;
+        } else {
+          // Aitken extrapolation failed, retain latest 2 values for next
+          // attempt
+          (*aitken_pressure[0])[s] = p1;
+          (*aitken_pressure[1])[s] = p2;
+          valid_entries = 2;
+        }
+      }
+      if (fabs(current_pressure[s] - previous_pressure[s]) <
+          relative_tolerance_ * (current_pressure[s] + previous_pressure[s])) {
+        active[s] = false;
+        --number_of_active_points;
+      }
+    }
+  }
+  // Points still active did not converge within the maximum iterations
+  for (size_t s = 0; s < number_of_points; ++s) {
+    if (active[s]) {
+      failed[s] = true;
+    }
+  }
+}
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -174,8 +365,25 @@ boost::optional<PrimitiveRecoveryData> NewmanHamlin::apply(
       const EquationsOfState::EquationOfState<true, THERMODIM(data)>&          \
           equation_of_state) noexcept;
 
+#define INSTANTIATION_BATCH(_, data)                                       \
+  template void grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::         \
+      NewmanHamlin::apply<THERMODIM(data)>(                                 \
+          const gsl::not_null<grmhd::ValenciaDivClean::                     \
+                                  PrimitiveRecoverySchemes::                \
+                                      PrimitiveRecoveryBatchData*>          \
+              result,                                                       \
+          const DataVector& total_energy_density,                           \
+          const DataVector& momentum_density_squared,                       \
+          const DataVector& momentum_density_dot_magnetic_field,            \
+          const DataVector& magnetic_field_squared,                         \
+          const DataVector& rest_mass_density_times_lorentz_factor,         \
+          const EquationsOfState::EquationOfState<true, THERMODIM(data)>&   \
+              equation_of_state) noexcept;
+
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2))
+GENERATE_INSTANTIATIONS(INSTANTIATION_BATCH, (1, 2))
 
+#undef INSTANTIATION_BATCH
 #undef INSTANTIATION
 #undef THERMODIM
 /// \endcond
@@ -9,6 +9,14 @@
 
 #include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
 
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
 // IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
 
 namespace grmhd {
@@ -16,6 +24,7 @@ namespace ValenciaDivClean {
 namespace PrimitiveRecoverySchemes {
 
 /// \cond
+struct PrimitiveRecoveryBatchData;
 struct PrimitiveRecoveryData;
 /// \endcond
 
@@ -46,6 +55,14 @@ struct PrimitiveRecoveryData;
  * density, momentum density, specific internal energy density, and magnetic
  * field, and \f$\gamma\f$ and \f$\gamma^{mn}\f$ are the determinant and inverse
  * of the spatial metric \f$\gamma_{mn}\f$.
+ *
+ * The overload taking `DataVector`s recovers all points of an element in
+ * lockstep: every iteration updates the pressure at all points that have not
+ * yet converged with vectorized operations and a single call to the equation
+ * of state.  Points that converged are left unchanged, and points at which
+ * the scheme fails are flagged in the returned PrimitiveRecoveryBatchData
+ * instead of aborting.  The overload taking `double`s is the reference
+ * implementation at a single point; both give the same result.
  */
 class NewmanHamlin {
  public:
@@ -57,6 +74,17 @@ class NewmanHamlin {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state) noexcept;
 
+  template <size_t ThermodynamicDim>
+  static void apply(
+      gsl::not_null<PrimitiveRecoveryBatchData*> result,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
   static const std::string name() noexcept { return "Newman Hamlin"; }
 
  private:
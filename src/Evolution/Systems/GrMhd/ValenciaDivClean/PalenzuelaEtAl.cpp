@@ -0,0 +1,202 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
+
+#include <algorithm>
+#include <boost/none.hpp>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "ErrorHandling/Exceptions.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Overloader.hpp"
+
+// IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
+
+/// \cond
+namespace grmhd {
+namespace ValenciaDivClean {
+namespace PrimitiveRecoverySchemes {
+
+template <size_t ThermodynamicDim>
+boost::optional<PrimitiveRecoveryData> PalenzuelaEtAl::apply(
+    const double total_energy_density, const double momentum_density_squared,
+    const double momentum_density_dot_magnetic_field,
+    const double magnetic_field_squared,
+    const double rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  size_t function_evaluations = 0;
+  return recover(make_not_null(&function_evaluations), total_energy_density,
+                 momentum_density_squared, momentum_density_dot_magnetic_field,
+                 magnetic_field_squared, rest_mass_density_times_lorentz_factor,
+                 equation_of_state);
+}
+
+template <size_t ThermodynamicDim>
+void PalenzuelaEtAl::apply(
+    const gsl::not_null<PrimitiveRecoveryBatchData*> result,
+    const DataVector& total_energy_density,
+    const DataVector& momentum_density_squared,
+    const DataVector& momentum_density_dot_magnetic_field,
+    const DataVector& magnetic_field_squared,
+    const DataVector& rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  const size_t number_of_points = total_energy_density.size();
+  *result = PrimitiveRecoveryBatchData(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const boost::optional<PrimitiveRecoveryData> primitive_data =
+        recover(make_not_null(&result->iterations[s]), total_energy_density[s],
+                momentum_density_squared[s],
+                momentum_density_dot_magnetic_field[s],
+                magnetic_field_squared[s],
+                rest_mass_density_times_lorentz_factor[s], equation_of_state);
+    if (UNLIKELY(not primitive_data)) {
+      result->failed[s] = true;
+      continue;
+    }
+    get(result->rest_mass_density)[s] = primitive_data->rest_mass_density;
+    get(result->lorentz_factor)[s] = primitive_data->lorentz_factor;
+    get(result->pressure)[s] = primitive_data->pressure;
+    get(result->rho_h_w_squared)[s] = primitive_data->rho_h_w_squared;
+  }
+}
+
+template <size_t ThermodynamicDim>
+boost::optional<PrimitiveRecoveryData> PalenzuelaEtAl::recover(
+    const gsl::not_null<size_t*> function_evaluations,
+    const double total_energy_density, const double momentum_density_squared,
+    const double momentum_density_dot_magnetic_field,
+    const double magnetic_field_squared,
+    const double rest_mass_density_times_lorentz_factor,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  *function_evaluations = 0;
+  const double& d = rest_mass_density_times_lorentz_factor;
+  if (UNLIKELY(not(d > 0.0))) {
+    return boost::none;
+  }
+  // Conserved variables scaled by powers of d, Palenzuela et al Eq. (45)
+  const double q = total_energy_density / d - 1.0;
+  const double r = momentum_density_squared / square(d);
+  const double s = magnetic_field_squared / d;
+  const double t_squared =
+      square(momentum_density_dot_magnetic_field) / cube(d);
+
+  const double lower_bound = std::max(1.0, 1.0 + q - s);
+  const double upper_bound = 2.0 + 2.0 * q - s;
+  if (UNLIKELY(not(upper_bound > lower_bound))) {
+    return boost::none;
+  }
+
+  const double maximum_v_squared = 1.0 - 1.0 / square(max_lorentz_factor_);
+  // The primitives implied by a trial value x = h W of the root
+  const auto primitives_at = [&d, &q, &r, &s, &t_squared, &maximum_v_squared,
+                              &equation_of_state ](const double x) noexcept {
+    const double v_squared = std::min(
+        maximum_v_squared,
+        std::max(0.0, (square(x) * r + (2.0 * x + s) * t_squared) /
+                          square(x * (x + s))));
+    const double lorentz_factor = 1.0 / sqrt(1.0 - v_squared);
+    const double rest_mass_density = d / lorentz_factor;
+    double specific_internal_energy = 0.0;
+    double pressure = 0.0;
+    make_overloader(
+        [&rest_mass_density, &specific_internal_energy, &pressure ](
+            const EquationsOfState::EquationOfState<true, 1>&
+                the_equation_of_state) noexcept {
+          specific_internal_energy =
+              get(the_equation_of_state.specific_internal_energy_from_density(
+                  Scalar<double>(rest_mass_density)));
+          pressure = get(the_equation_of_state.pressure_from_density(
+              Scalar<double>(rest_mass_density)));
+        },
+        [&x, &q, &s, &t_squared, &lorentz_factor, &rest_mass_density,
+         &specific_internal_energy, &pressure ](
+            const EquationsOfState::EquationOfState<true, 2>&
+                the_equation_of_state) noexcept {
+          // Palenzuela et al Eq. (43)
+          specific_internal_energy =
+              -1.0 + x * (1.0 - square(lorentz_factor)) / lorentz_factor +
+              lorentz_factor *
+                  (1.0 + q - s +
+                   0.5 * (t_squared / square(x) +
+                          s / square(lorentz_factor)));
+          pressure = get(the_equation_of_state.pressure_from_density_and_energy(
+              Scalar<double>(rest_mass_density),
+              Scalar<double>(specific_internal_energy)));
+        })(equation_of_state);
+    return PrimitiveRecoveryData{
+        rest_mass_density, lorentz_factor, pressure,
+        (rest_mass_density * (1.0 + specific_internal_energy) + pressure) *
+            square(lorentz_factor)};
+  };
+
+  double root = std::numeric_limits<double>::signaling_NaN();
+  try {
+    root = RootFinder::toms748(
+        [&primitives_at, &d, &function_evaluations ](const double x) noexcept {
+          ++(*function_evaluations);
+          // rho h W^2 / (rho W) = h W
+          return x - primitives_at(x).rho_h_w_squared / d;
+        },
+        lower_bound, upper_bound, absolute_tolerance_, relative_tolerance_,
+        max_iterations_);
+  } catch (const std::domain_error& /*error*/) {
+    // The bounds do not bracket a root
+    return boost::none;
+  } catch (const convergence_error& /*error*/) {
+    return boost::none;
+  }
+  return primitives_at(root);
+}
+}  // namespace PrimitiveRecoverySchemes
+}  // namespace ValenciaDivClean
+}  // namespace grmhd
+
+#define THERMODIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(_, data)                                                 \
+  template boost::optional<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes:: \
+                               PrimitiveRecoveryData>                          \
+  grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl::apply<    \
+      THERMODIM(data)>(                                                        \
+      const double total_energy_density,                                       \
+      const double momentum_density_squared,                                   \
+      const double momentum_density_dot_magnetic_field,                        \
+      const double magnetic_field_squared,                                     \
+      const double rest_mass_density_times_lorentz_factor,                     \
+      const EquationsOfState::EquationOfState<true, THERMODIM(data)>&          \
+          equation_of_state) noexcept;
+
+#define INSTANTIATION_BATCH(_, data)                                       \
+  template void grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::         \
+      PalenzuelaEtAl::apply<THERMODIM(data)>(                               \
+          const gsl::not_null<grmhd::ValenciaDivClean::                     \
+                                  PrimitiveRecoverySchemes::                \
+                                      PrimitiveRecoveryBatchData*>          \
+              result,                                                       \
+          const DataVector& total_energy_density,                           \
+          const DataVector& momentum_density_squared,                       \
+          const DataVector& momentum_density_dot_magnetic_field,            \
+          const DataVector& magnetic_field_squared,                         \
+          const DataVector& rest_mass_density_times_lorentz_factor,         \
+          const EquationsOfState::EquationOfState<true, THERMODIM(data)>&   \
+              equation_of_state) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2))
+GENERATE_INSTANTIATIONS(INSTANTIATION_BATCH, (1, 2))
+
+#undef INSTANTIATION_BATCH
+#undef INSTANTIATION
+#undef THERMODIM
+/// \endcond
@@ -0,0 +1,103 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <string>
+
+#include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
+
+/// \cond
+class DataVector;
+namespace gsl {
+template <typename T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+// IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
+
+namespace grmhd {
+namespace ValenciaDivClean {
+namespace PrimitiveRecoverySchemes {
+
+/// \cond
+struct PrimitiveRecoveryBatchData;
+struct PrimitiveRecoveryData;
+/// \endcond
+
+/*!
+ * \brief Compute the primitive variables from the conservative variables using
+ * the scheme of [Palenzuela {\em et al}, Phys. Rev. D 92, 044045
+ * (2015)](https://doi.org/10.1103/PhysRevD.92.044045).
+ *
+ * The inputs are those of NewmanHamlin.  In terms of
+ * \f$q = e / {\tilde \rho} - 1\f$,
+ * \f$r = {\cal M}^2 / {\tilde \rho}^2\f$, \f$s = {\cal B}^2 / {\tilde \rho}\f$,
+ * and \f$t = {\cal T} / {\tilde \rho}^{3/2}\f$, the scheme finds the root
+ * \f$x = h W\f$ of
+ * \f{align}
+ * f(x) = x - h(\rho(x), \epsilon(x)) W(x),
+ * \f}
+ * where
+ * \f{align}
+ * W^{-2} = & 1 - \frac{x^2 r + (2 x + s) t^2}{x^2 (x + s)^2}, \\
+ * \rho = & \frac{\tilde \rho}{W}, \\
+ * \epsilon = & -1 + \frac{x}{W} (1 - W^2)
+ *              + W \left[1 + q - s + \frac{1}{2}
+ *                \left(\frac{t^2}{x^2} + \frac{s}{W^2}\right)\right],
+ * \f}
+ * and \f$h\f$ is the specific enthalpy obtained from the equation of state.
+ * For a barotropic equation of state \f$\epsilon\f$ is instead obtained from
+ * \f$\rho\f$.  The root is bracketed by
+ * \f$\max(1, 1 + q - s) \leq x \leq 2 + 2q - s\f$, so unlike NewmanHamlin the
+ * scheme cannot diverge, and it is found with RootFinder::toms748.
+ *
+ * The overload taking `DataVector`s solves independently at each point and
+ * reports the number of function evaluations as the iterations.  A point at
+ * which the root is not bracketed or not found is flagged as failed.
+ */
+class PalenzuelaEtAl {
+ public:
+  template <size_t ThermodynamicDim>
+  static boost::optional<PrimitiveRecoveryData> apply(
+      double total_energy_density, double momentum_density_squared,
+      double momentum_density_dot_magnetic_field, double magnetic_field_squared,
+      double rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
+  template <size_t ThermodynamicDim>
+  static void apply(
+      gsl::not_null<PrimitiveRecoveryBatchData*> result,
+      const DataVector& total_energy_density,
+      const DataVector& momentum_density_squared,
+      const DataVector& momentum_density_dot_magnetic_field,
+      const DataVector& magnetic_field_squared,
+      const DataVector& rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
+  static const std::string name() noexcept { return "Palenzuela et al"; }
+
+ private:
+  template <size_t ThermodynamicDim>
+  static boost::optional<PrimitiveRecoveryData> recover(
+      gsl::not_null<size_t*> function_evaluations, double total_energy_density,
+      double momentum_density_squared,
+      double momentum_density_dot_magnetic_field, double magnetic_field_squared,
+      double rest_mass_density_times_lorentz_factor,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state) noexcept;
+
+  static constexpr size_t max_iterations_ = 100;
+  static constexpr double absolute_tolerance_ = 1.e-15;
+  static constexpr double relative_tolerance_ = 1.e-14;
+  // Bound on the Lorentz factor at trial values of the root
+  static constexpr double max_lorentz_factor_ = 1.e6;
+};
+}  // namespace PrimitiveRecoverySchemes
+}  // namespace ValenciaDivClean
+}  // namespace grmhd
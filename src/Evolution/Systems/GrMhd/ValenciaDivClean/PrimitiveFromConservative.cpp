@@ -3,13 +3,17 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
-#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "ErrorHandling/Error.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FallbackChain.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"  // IWYU pragma: keep
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"  // IWYU pragma: keep
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/EquationsOfState/SpecificEnthalpy.hpp"
@@ -28,76 +32,90 @@
 /// \cond
 namespace grmhd {
 namespace ValenciaDivClean {
+namespace {
+// The quantities in terms of which the PrimitiveRecoverySchemes are expressed
+struct RecoveryInputs {
+  DataVector total_energy_density;
+  DataVector momentum_density_squared;
+  DataVector momentum_density_dot_magnetic_field;
+  DataVector magnetic_field_squared;
+  DataVector rest_mass_density_times_lorentz_factor;
+  tnsr::I<DataVector, 3, Frame::Inertial> tilde_s_upper;
+};
 
-template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
-void PrimitiveFromConservative<PrimitiveRecoveryScheme, ThermodynamicDim>::
-    apply(
-        gsl::not_null<Scalar<DataVector>*> rest_mass_density,
-        gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
-        gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
-            spatial_velocity,
-        gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> magnetic_field,
-        gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,
-        gsl::not_null<Scalar<DataVector>*> lorentz_factor,
-        gsl::not_null<Scalar<DataVector>*> pressure,
-        gsl::not_null<Scalar<DataVector>*> specific_enthalpy,
-        const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_tau,
-        const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,
-        const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
-        const Scalar<DataVector>& tilde_phi,
-        const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
-        const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
-        const Scalar<DataVector>& sqrt_det_spatial_metric,
-        const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
-            equation_of_state) noexcept {
+// Sets the magnetic and divergence cleaning fields, which are known in closed
+// form, and returns the inputs of the recovery of the other primitives
+RecoveryInputs recovery_inputs(
+    const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+        magnetic_field,
+    const gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,
+    const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_tau,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+    const Scalar<DataVector>& tilde_phi,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+    const Scalar<DataVector>& sqrt_det_spatial_metric) noexcept {
   get(*divergence_cleaning_field) =
       get(tilde_phi) / get(sqrt_det_spatial_metric);
   for (size_t i = 0; i < 3; ++i) {
     magnetic_field->get(i) = tilde_b.get(i) / get(sqrt_det_spatial_metric);
   }
-  const DataVector total_energy_density =
-      (get(tilde_tau) + get(tilde_d)) / get(sqrt_det_spatial_metric);
-  const auto tilde_s_upper = raise_or_lower_index(tilde_s, inv_spatial_metric);
-  const DataVector momentum_density_squared =
+  auto tilde_s_upper = raise_or_lower_index(tilde_s, inv_spatial_metric);
+  DataVector momentum_density_squared =
       get(dot_product(tilde_s, tilde_s_upper)) /
       square(get(sqrt_det_spatial_metric));
-  const DataVector momentum_density_dot_magnetic_field =
-      get(dot_product(tilde_s, *magnetic_field)) / get(sqrt_det_spatial_metric);
-  const DataVector magnetic_field_squared =
-      get(dot_product(*magnetic_field, *magnetic_field, spatial_metric));
-  const DataVector rest_mass_density_times_lorentz_factor =
-      get(tilde_d) / get(sqrt_det_spatial_metric);
-
-  for (size_t s = 0; s < total_energy_density.size(); ++s) {
-    const boost::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
-        primitive_data =
-            PrimitiveRecoveryScheme::template apply<ThermodynamicDim>(
-                total_energy_density[s], momentum_density_squared[s],
-                momentum_density_dot_magnetic_field[s],
-                magnetic_field_squared[s],
-                rest_mass_density_times_lorentz_factor[s], equation_of_state);
-
-    if (primitive_data) {
-      get(*rest_mass_density)[s] = primitive_data.get().rest_mass_density;
-      const double coefficient_of_b =
-          momentum_density_dot_magnetic_field[s] /
-          (primitive_data.get().rho_h_w_squared *
-           (primitive_data.get().rho_h_w_squared + magnetic_field_squared[s]));
-      const double coefficient_of_s =
-          1.0 /
-          (get(sqrt_det_spatial_metric)[s] *
-           (primitive_data.get().rho_h_w_squared + magnetic_field_squared[s]));
-      for (size_t i = 0; i < 3; ++i) {
-        spatial_velocity->get(i)[s] =
-            coefficient_of_b * magnetic_field->get(i)[s] +
-            coefficient_of_s * tilde_s_upper.get(i)[s];
-      }
-      get(*lorentz_factor)[s] = primitive_data.get().lorentz_factor;
-      get(*pressure)[s] = primitive_data.get().pressure;
-    } else {
-      ERROR(PrimitiveRecoveryScheme::name()
-            << " primitive inversion scheme failed.");
-    }
+  return {(get(tilde_tau) + get(tilde_d)) / get(sqrt_det_spatial_metric),
+          std::move(momentum_density_squared),
+          get(dot_product(tilde_s, *magnetic_field)) /
+              get(sqrt_det_spatial_metric),
+          get(dot_product(*magnetic_field, *magnetic_field, spatial_metric)),
+          get(tilde_d) / get(sqrt_det_spatial_metric),
+          std::move(tilde_s_upper)};
+}
+
+template <typename PrimitiveRecoveryScheme>
+void check_for_failures(
+    const PrimitiveRecoverySchemes::PrimitiveRecoveryBatchData&
+        primitive_data) noexcept {
+  const size_t number_of_failures = primitive_data.number_of_failures();
+  if (UNLIKELY(number_of_failures > 0)) {
+    ERROR(PrimitiveRecoveryScheme::name()
+          << " primitive inversion scheme failed at " << number_of_failures
+          << " of " << primitive_data.failed.size() << " points.");
+  }
+}
+
+// Sets the primitives other than the magnetic and divergence cleaning fields
+// from the result of the recovery
+template <size_t ThermodynamicDim>
+void set_recovered_primitives(
+    const gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+    const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+    const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+        spatial_velocity,
+    const gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+    const gsl::not_null<Scalar<DataVector>*> pressure,
+    const gsl::not_null<Scalar<DataVector>*> specific_enthalpy,
+    const PrimitiveRecoverySchemes::PrimitiveRecoveryBatchData& primitive_data,
+    const RecoveryInputs& inputs,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& magnetic_field,
+    const Scalar<DataVector>& sqrt_det_spatial_metric,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state) noexcept {
+  *rest_mass_density = primitive_data.rest_mass_density;
+  *lorentz_factor = primitive_data.lorentz_factor;
+  *pressure = primitive_data.pressure;
+  const DataVector& rho_h_w_squared = get(primitive_data.rho_h_w_squared);
+  const DataVector coefficient_of_b =
+      inputs.momentum_density_dot_magnetic_field /
+      (rho_h_w_squared * (rho_h_w_squared + inputs.magnetic_field_squared));
+  const DataVector coefficient_of_s =
+      1.0 / (get(sqrt_det_spatial_metric) *
+             (rho_h_w_squared + inputs.magnetic_field_squared));
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_velocity->get(i) = coefficient_of_b * magnetic_field.get(i) +
+                               coefficient_of_s * inputs.tilde_s_upper.get(i);
   }
   *specific_internal_energy = make_overloader(
       [&rest_mass_density](const EquationsOfState::EquationOfState<true, 1>&
@@ -115,6 +133,111 @@ void PrimitiveFromConservative<PrimitiveRecoveryScheme, ThermodynamicDim>::
   *specific_enthalpy = EquationsOfState::specific_enthalpy(
       *rest_mass_density, *specific_internal_energy, *pressure);
 }
+}  // namespace
+
+template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
+void PrimitiveFromConservative<PrimitiveRecoveryScheme, ThermodynamicDim>::
+    apply(
+        const gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+        const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+        const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+            spatial_velocity,
+        const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+            magnetic_field,
+        const gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,
+        const gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+        const gsl::not_null<Scalar<DataVector>*> pressure,
+        const gsl::not_null<Scalar<DataVector>*> specific_enthalpy,
+        const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_tau,
+        const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,
+        const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+        const Scalar<DataVector>& tilde_phi,
+        const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+        const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+        const Scalar<DataVector>& sqrt_det_spatial_metric,
+        const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+            equation_of_state) noexcept {
+  const RecoveryInputs inputs = recovery_inputs(
+      magnetic_field, divergence_cleaning_field, tilde_d, tilde_tau, tilde_s,
+      tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+      sqrt_det_spatial_metric);
+
+  PrimitiveRecoverySchemes::PrimitiveRecoveryBatchData primitive_data{};
+  PrimitiveRecoveryScheme::template apply<ThermodynamicDim>(
+      make_not_null(&primitive_data), inputs.total_energy_density,
+      inputs.momentum_density_squared,
+      inputs.momentum_density_dot_magnetic_field,
+      inputs.magnetic_field_squared,
+      inputs.rest_mass_density_times_lorentz_factor, equation_of_state);
+  check_for_failures<PrimitiveRecoveryScheme>(primitive_data);
+
+  set_recovered_primitives(rest_mass_density, specific_internal_energy,
+                           spatial_velocity, lorentz_factor, pressure,
+                           specific_enthalpy, primitive_data, inputs,
+                           *magnetic_field, sqrt_det_spatial_metric,
+                           equation_of_state);
+}
+
+template <size_t ThermodynamicDim>
+void PrimitiveFromConservative<PrimitiveRecoverySchemes::FallbackChain,
+                               ThermodynamicDim>::
+    apply(
+        const gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+        const gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+        const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+            spatial_velocity,
+        const gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*>
+            magnetic_field,
+        const gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,
+        const gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+        const gsl::not_null<Scalar<DataVector>*> pressure,
+        const gsl::not_null<Scalar<DataVector>*> specific_enthalpy,
+        const gsl::not_null<std::vector<size_t>*>
+            number_of_points_recovered_by_scheme,
+        const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_tau,
+        const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,
+        const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+        const Scalar<DataVector>& tilde_phi,
+        const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+        const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+        const Scalar<DataVector>& sqrt_det_spatial_metric,
+        const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+            equation_of_state,
+        const PrimitiveRecoverySchemes::FallbackChain&
+            fallback_chain) noexcept {
+  const RecoveryInputs inputs = recovery_inputs(
+      magnetic_field, divergence_cleaning_field, tilde_d, tilde_tau, tilde_s,
+      tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+      sqrt_det_spatial_metric);
+
+  PrimitiveRecoverySchemes::PrimitiveRecoveryBatchData primitive_data{};
+  std::vector<size_t> scheme_used{};
+  fallback_chain.apply(
+      make_not_null(&primitive_data), make_not_null(&scheme_used),
+      inputs.total_energy_density, inputs.momentum_density_squared,
+      inputs.momentum_density_dot_magnetic_field,
+      inputs.magnetic_field_squared,
+      inputs.rest_mass_density_times_lorentz_factor, equation_of_state);
+  check_for_failures<PrimitiveRecoverySchemes::FallbackChain>(primitive_data);
+
+  set_recovered_primitives(rest_mass_density, specific_internal_energy,
+                           spatial_velocity, lorentz_factor, pressure,
+                           specific_enthalpy, primitive_data, inputs,
+                           *magnetic_field, sqrt_det_spatial_metric,
+                           equation_of_state);
+
+  const auto& schemes = fallback_chain.schemes();
+  number_of_points_recovered_by_scheme->assign(schemes.size(), 0);
+  for (size_t s = 0; s < scheme_used.size(); ++s) {
+    ++(*number_of_points_recovered_by_scheme)[scheme_used[s]];
+    if (schemes[scheme_used[s]] ==
+        PrimitiveRecoverySchemes::Scheme::Atmosphere) {
+      for (size_t i = 0; i < 3; ++i) {
+        spatial_velocity->get(i)[s] = 0.0;
+      }
+    }
+  }
+}
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
 
@@ -127,7 +250,14 @@ void PrimitiveFromConservative<PrimitiveRecoveryScheme, ThermodynamicDim>::
 
 GENERATE_INSTANTIATIONS(
     INSTANTIATION,
-    (grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin), (1, 2))
+    (grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+     grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl),
+    (1, 2))
+
+template struct grmhd::ValenciaDivClean::PrimitiveFromConservative<
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::FallbackChain, 1>;
+template struct grmhd::ValenciaDivClean::PrimitiveFromConservative<
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::FallbackChain, 2>;
 
 #undef INSTANTIATION
 #undef THERMODIM
@@ -4,8 +4,10 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FallbackChain.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/TagsDeclarations.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"  // IWYU pragma: keep
@@ -40,6 +42,14 @@ namespace ValenciaDivClean {
  * [Siegel {\em et al}, The Astrophysical Journal 859:71(2018)]
  * (http://iopscience.iop.org/article/10.3847/1538-4357/aabcc5/meta)
  * compares several inversion methods.
+ *
+ * The `PrimitiveRecoveryScheme` recovers all grid points at once through its
+ * `DataVector` interface, and it is an error if it fails at any point.
+ *
+ * With the PrimitiveRecoverySchemes::FallbackChain, the schemes to try are
+ * chosen in the input file, and the number of points recovered by each entry
+ * of the chain is stored in Tags::NumberOfPointsRecoveredByScheme.  Points
+ * reset to the atmosphere are given zero velocity.
  */
 template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
 struct PrimitiveFromConservative {
@@ -82,5 +92,56 @@ struct PrimitiveFromConservative {
       const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
           equation_of_state) noexcept;
 };
+
+/// \cond
+template <size_t ThermodynamicDim>
+struct PrimitiveFromConservative<PrimitiveRecoverySchemes::FallbackChain,
+                                 ThermodynamicDim> {
+  using return_tags =
+      tmpl::list<hydro::Tags::RestMassDensity<DataVector>,
+                 hydro::Tags::SpecificInternalEnergy<DataVector>,
+                 hydro::Tags::SpatialVelocity<DataVector, 3>,
+                 hydro::Tags::MagneticField<DataVector, 3>,
+                 hydro::Tags::DivergenceCleaningField<DataVector>,
+                 hydro::Tags::LorentzFactor<DataVector>,
+                 hydro::Tags::Pressure<DataVector>,
+                 hydro::Tags::SpecificEnthalpy<DataVector>,
+                 Tags::NumberOfPointsRecoveredByScheme>;
+
+  using argument_tags =
+      tmpl::list<grmhd::ValenciaDivClean::Tags::TildeD,
+                 grmhd::ValenciaDivClean::Tags::TildeTau,
+                 grmhd::ValenciaDivClean::Tags::TildeS<>,
+                 grmhd::ValenciaDivClean::Tags::TildeB<>,
+                 grmhd::ValenciaDivClean::Tags::TildePhi,
+                 gr::Tags::SpatialMetric<3>, gr::Tags::InverseSpatialMetric<3>,
+                 gr::Tags::SqrtDetSpatialMetric<>,
+                 hydro::Tags::EquationOfState<true, ThermodynamicDim>>;
+
+  using const_global_cache_tag_list =
+      tmpl::list<OptionTags::PrimitiveRecoveryFallbackChain>;
+
+  static void apply(
+      gsl::not_null<Scalar<DataVector>*> rest_mass_density,
+      gsl::not_null<Scalar<DataVector>*> specific_internal_energy,
+      gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> spatial_velocity,
+      gsl::not_null<tnsr::I<DataVector, 3, Frame::Inertial>*> magnetic_field,
+      gsl::not_null<Scalar<DataVector>*> divergence_cleaning_field,
+      gsl::not_null<Scalar<DataVector>*> lorentz_factor,
+      gsl::not_null<Scalar<DataVector>*> pressure,
+      gsl::not_null<Scalar<DataVector>*> specific_enthalpy,
+      gsl::not_null<std::vector<size_t>*> number_of_points_recovered_by_scheme,
+      const Scalar<DataVector>& tilde_d, const Scalar<DataVector>& tilde_tau,
+      const tnsr::i<DataVector, 3, Frame::Inertial>& tilde_s,
+      const tnsr::I<DataVector, 3, Frame::Inertial>& tilde_b,
+      const Scalar<DataVector>& tilde_phi,
+      const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+      const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
+      const Scalar<DataVector>& sqrt_det_spatial_metric,
+      const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+          equation_of_state,
+      const PrimitiveRecoverySchemes::FallbackChain& fallback_chain) noexcept;
+};
+/// \endcond
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -3,6 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+
 namespace grmhd {
 namespace ValenciaDivClean {
 
@@ -22,6 +30,45 @@ struct PrimitiveRecoveryData {
   const double pressure;
   const double rho_h_w_squared;
 };
+
+/*!
+ * \brief Data determined by PrimitiveRecoverySchemes at all grid points of an
+ * element at once.
+ *
+ * The quantities are those of PrimitiveRecoveryData.  Instead of aborting,
+ * a scheme flags the points at which the recovery failed in `failed`; the
+ * quantities at those points are unspecified.  `iterations` holds the number
+ * of iterations the scheme needed at each point.
+ */
+struct PrimitiveRecoveryBatchData {
+  PrimitiveRecoveryBatchData() = default;
+  explicit PrimitiveRecoveryBatchData(const size_t number_of_points) noexcept
+      : rest_mass_density(number_of_points),
+        lorentz_factor(number_of_points),
+        pressure(number_of_points),
+        rho_h_w_squared(number_of_points),
+        failed(number_of_points, false),
+        iterations(number_of_points, 0) {}
+
+  size_t number_of_failures() const noexcept {
+    return static_cast<size_t>(std::count(failed.begin(), failed.end(), true));
+  }
+  size_t total_iterations() const noexcept {
+    return std::accumulate(iterations.begin(), iterations.end(), size_t{0});
+  }
+  size_t max_iterations() const noexcept {
+    return iterations.empty()
+               ? 0
+               : *std::max_element(iterations.begin(), iterations.end());
+  }
+
+  Scalar<DataVector> rest_mass_density{};
+  Scalar<DataVector> lorentz_factor{};
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> rho_h_w_squared{};
+  std::vector<bool> failed{};
+  std::vector<size_t> iterations{};
+};
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -7,19 +7,20 @@
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "PointwiseFunctions/GeneralRelativity/Christoffel.hpp"
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 // IWYU pragma: no_include <array>
 
 /// \cond
 namespace {
-tnsr::II<DataVector, 3, Frame::Inertial> densitized_stress(
+void densitized_stress(
+    const gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*> result,
     const Scalar<DataVector>& rest_mass_density,
     const Scalar<DataVector>& specific_enthalpy,
     const Scalar<DataVector>& lorentz_factor,
@@ -29,42 +30,60 @@ tnsr::II<DataVector, 3, Frame::Inertial> densitized_stress(
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric,
     const Scalar<DataVector>& sqrt_det_spatial_metric,
     const Scalar<DataVector>& pressure) noexcept {
-  auto result = inv_spatial_metric;
-
-  const auto magnetic_field_oneform =
-      raise_or_lower_index(magnetic_field, spatial_metric);
-  const auto magnetic_field_dot_spatial_velocity =
-      dot_product(magnetic_field_oneform, spatial_velocity);
-  // not const to save an allocation below
-  auto magnetic_field_squared =
-      dot_product(magnetic_field, magnetic_field_oneform);
+  using magnetic_field_oneform_tag =
+      ::Tags::TempTensor<0, tnsr::i<DataVector, 3, Frame::Inertial>>;
+  using magnetic_field_dot_spatial_velocity_tag =
+      ::Tags::TempTensor<1, Scalar<DataVector>>;
+  using h_rho_w_squared_plus_b_squared_tag =
+      ::Tags::TempTensor<2, Scalar<DataVector>>;
+  using one_over_w_squared_tag = ::Tags::TempTensor<3, Scalar<DataVector>>;
+  using p_star_tag = ::Tags::TempTensor<4, Scalar<DataVector>>;
+  TempBuffer<tmpl::list<magnetic_field_oneform_tag,
+                        magnetic_field_dot_spatial_velocity_tag,
+                        h_rho_w_squared_plus_b_squared_tag,
+                        one_over_w_squared_tag, p_star_tag>>
+      buffer(get(pressure).size(), 0.);
+
+  auto& magnetic_field_oneform = get<magnetic_field_oneform_tag>(buffer);
+  raise_or_lower_index(make_not_null(&magnetic_field_oneform), magnetic_field,
+                       spatial_metric);
+  DataVector& magnetic_field_dot_spatial_velocity =
+      get(get<magnetic_field_dot_spatial_velocity_tag>(buffer));
+  // B^n B_n is accumulated into h_rho_w_squared_plus_b_squared
+  DataVector& h_rho_w_squared_plus_b_squared =
+      get(get<h_rho_w_squared_plus_b_squared_tag>(buffer));
+  for (size_t i = 0; i < 3; ++i) {
+    magnetic_field_dot_spatial_velocity +=
+        magnetic_field_oneform.get(i) * spatial_velocity.get(i);
+    h_rho_w_squared_plus_b_squared +=
+        magnetic_field.get(i) * magnetic_field_oneform.get(i);
+  }
 
-  const DataVector one_over_w_squared = 1.0 / square(get(lorentz_factor));
+  DataVector& one_over_w_squared = get(get<one_over_w_squared_tag>(buffer));
+  one_over_w_squared = 1.0 / square(get(lorentz_factor));
   // p_star = p + p_m = p + b^2/2 = p + ((B^n v_n)^2 + (B^n B_n)/W^2)/2
-  const DataVector p_star =
-      get(pressure) + 0.5 * (square(get(magnetic_field_dot_spatial_velocity)) +
-                             get(magnetic_field_squared) * one_over_w_squared);
+  DataVector& p_star = get(get<p_star_tag>(buffer));
+  p_star = get(pressure) + 0.5 * (square(magnetic_field_dot_spatial_velocity) +
+                                  h_rho_w_squared_plus_b_squared *
+                                      one_over_w_squared);
 
-  Scalar<DataVector> h_rho_w_squared_plus_b_squared =
-      std::move(magnetic_field_squared);
-  get(h_rho_w_squared_plus_b_squared) += get(rest_mass_density) *
-                                         get(specific_enthalpy) *
-                                         square(get(lorentz_factor));
+  h_rho_w_squared_plus_b_squared += get(rest_mass_density) *
+                                    get(specific_enthalpy) *
+                                    square(get(lorentz_factor));
 
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      result.get(i, j) *= p_star;
-      result.get(i, j) +=
-          get(h_rho_w_squared_plus_b_squared) * spatial_velocity.get(i) *
-              spatial_velocity.get(j) -
-          get(magnetic_field_dot_spatial_velocity) *
-              (magnetic_field.get(i) * spatial_velocity.get(j) +
-               magnetic_field.get(j) * spatial_velocity.get(i)) -
-          magnetic_field.get(i) * magnetic_field.get(j) * one_over_w_squared;
-      result.get(i, j) *= get(sqrt_det_spatial_metric);
+      result->get(i, j) =
+          get(sqrt_det_spatial_metric) *
+          (inv_spatial_metric.get(i, j) * p_star +
+           h_rho_w_squared_plus_b_squared * spatial_velocity.get(i) *
+               spatial_velocity.get(j) -
+           magnetic_field_dot_spatial_velocity *
+               (magnetic_field.get(i) * spatial_velocity.get(j) +
+                magnetic_field.get(j) * spatial_velocity.get(i)) -
+           magnetic_field.get(i) * magnetic_field.get(j) * one_over_w_squared);
     }
   }
-  return result;
 }
 }  // namespace
 
@@ -97,11 +116,29 @@ void compute_source_terms_of_u(
     const double constraint_damping_parameter) noexcept {
   get(*source_tilde_d) = 0.0;
 
-  const auto tilde_s_M = raise_or_lower_index(tilde_s, inv_spatial_metric);
-  const auto tilde_s_MN =
-      densitized_stress(rest_mass_density, specific_enthalpy, lorentz_factor,
-                        spatial_velocity, magnetic_field, spatial_metric,
-                        inv_spatial_metric, sqrt_det_spatial_metric, pressure);
+  using tilde_s_M_tag =
+      ::Tags::TempTensor<0, tnsr::I<DataVector, 3, Frame::Inertial>>;
+  using tilde_s_MN_tag =
+      ::Tags::TempTensor<1, tnsr::II<DataVector, 3, Frame::Inertial>>;
+  using contracted_d_spatial_metric_tag =
+      ::Tags::TempTensor<2, tnsr::i<DataVector, 3, Frame::Inertial>>;
+  using trace_of_christoffel_second_kind_tag =
+      ::Tags::TempTensor<3, tnsr::I<DataVector, 3, Frame::Inertial>>;
+  using trace_of_extrinsic_curvature_tag =
+      ::Tags::TempTensor<4, Scalar<DataVector>>;
+  TempBuffer<tmpl::list<tilde_s_M_tag, tilde_s_MN_tag,
+                        contracted_d_spatial_metric_tag,
+                        trace_of_christoffel_second_kind_tag,
+                        trace_of_extrinsic_curvature_tag>>
+      buffer(get(lapse).size(), 0.);
+
+  auto& tilde_s_M = get<tilde_s_M_tag>(buffer);
+  raise_or_lower_index(make_not_null(&tilde_s_M), tilde_s, inv_spatial_metric);
+  auto& tilde_s_MN = get<tilde_s_MN_tag>(buffer);
+  densitized_stress(make_not_null(&tilde_s_MN), rest_mass_density,
+                    specific_enthalpy, lorentz_factor, spatial_velocity,
+                    magnetic_field, spatial_metric, inv_spatial_metric,
+                    sqrt_det_spatial_metric, pressure);
 
   // unroll contributions from m=0 and n=0 to avoid initializing
   // source_tilde_tau to zero
@@ -131,11 +168,25 @@ void compute_source_terms_of_u(
     }
   }
 
-  const auto trace_of_christoffel_second_kind = trace_last_indices(
-      raise_or_lower_first_index(gr::christoffel_first_kind(d_spatial_metric),
-                                 inv_spatial_metric),
-      inv_spatial_metric);
-  *source_tilde_b = raise_or_lower_index(d_lapse, inv_spatial_metric);
+  // g^{mn} Gamma_{imn} = g^{mn} (d_m g_{in} - d_i g_{mn} / 2)
+  auto& contracted_d_spatial_metric =
+      get<contracted_d_spatial_metric_tag>(buffer);
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t m = 0; m < 3; ++m) {
+      for (size_t n = 0; n < 3; ++n) {
+        contracted_d_spatial_metric.get(i) +=
+            inv_spatial_metric.get(m, n) *
+            (d_spatial_metric.get(m, i, n) -
+             0.5 * d_spatial_metric.get(i, m, n));
+      }
+    }
+  }
+  auto& trace_of_christoffel_second_kind =
+      get<trace_of_christoffel_second_kind_tag>(buffer);
+  raise_or_lower_index(make_not_null(&trace_of_christoffel_second_kind),
+                       contracted_d_spatial_metric, inv_spatial_metric);
+
+  raise_or_lower_index(source_tilde_b, d_lapse, inv_spatial_metric);
   for (size_t i = 0; i < 3; ++i) {
     source_tilde_b->get(i) *= get(tilde_phi);
     source_tilde_b->get(i) -=
@@ -145,9 +196,16 @@ void compute_source_terms_of_u(
     }
   }
 
+  DataVector& trace_of_extrinsic_curvature =
+      get(get<trace_of_extrinsic_curvature_tag>(buffer));
+  for (size_t m = 0; m < 3; ++m) {
+    for (size_t n = 0; n < 3; ++n) {
+      trace_of_extrinsic_curvature +=
+          extrinsic_curvature.get(m, n) * inv_spatial_metric.get(m, n);
+    }
+  }
   get(*source_tilde_phi) =
-      (-get(trace(extrinsic_curvature, inv_spatial_metric)) -
-       constraint_damping_parameter) *
+      (-trace_of_extrinsic_curvature - constraint_damping_parameter) *
       get(lapse) * get(tilde_phi);
   for (size_t m = 0; m < 3; ++m) {
     get(*source_tilde_phi) += tilde_b.get(m) * d_lapse.get(m);
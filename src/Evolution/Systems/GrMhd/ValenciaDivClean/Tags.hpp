@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -50,6 +51,15 @@ struct TildePhi : db::SimpleTag {
   static std::string name() noexcept { return "TildePhi"; }
 };
 
+/// The number of grid points of the element recovered by each entry of the
+/// PrimitiveRecoverySchemes::FallbackChain during the most recent primitive
+/// recovery
+struct NumberOfPointsRecoveredByScheme : db::SimpleTag {
+  using type = std::vector<size_t>;
+  static std::string name() noexcept {
+    return "NumberOfPointsRecoveredByScheme";
+  }
+};
 }  // namespace Tags
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -20,6 +20,7 @@ struct TildeS;
 template <typename Fr = Frame::Inertial>
 struct TildeB;
 struct TildePhi;
+struct NumberOfPointsRecoveredByScheme;
 }  // namespace Tags
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -4,10 +4,12 @@
 #include "Evolution/Systems/RelativisticEuler/Valencia/Equations.hpp"
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "PointwiseFunctions/GeneralRelativity/IndexManipulation.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 // IWYU pragma: no_include <array>
@@ -15,22 +17,22 @@
 /// \cond
 namespace {
 template <size_t Dim>
-tnsr::II<DataVector, Dim, Frame::Inertial> densitized_stress(
+void densitized_stress(
+    const gsl::not_null<tnsr::II<DataVector, Dim, Frame::Inertial>*> result,
     const tnsr::I<DataVector, Dim, Frame::Inertial>& tilde_s_vector,
     const tnsr::I<DataVector, Dim, Frame::Inertial>& spatial_velocity,
     const tnsr::II<DataVector, Dim, Frame::Inertial>& inv_spatial_metric,
     const Scalar<DataVector>& sqrt_det_spatial_metric,
     const Scalar<DataVector>& pressure) noexcept {
-  auto result = inv_spatial_metric;
   for (size_t i = 0; i < Dim; ++i) {
     for (size_t j = i; j < Dim; ++j) {
-      result.get(i, j) *= get(sqrt_det_spatial_metric) * get(pressure);
-      result.get(i, j) +=
+      result->get(i, j) =
+          inv_spatial_metric.get(i, j) * get(sqrt_det_spatial_metric) *
+              get(pressure) +
           0.5 * (tilde_s_vector.get(i) * spatial_velocity.get(j) +
                  tilde_s_vector.get(j) * spatial_velocity.get(i));
     }
   }
-  return result;
 }
 }  // namespace
 
@@ -56,10 +58,18 @@ void compute_source_terms_of_u(
         extrinsic_curvature) noexcept {
   get(*source_tilde_d) = 0.0;
 
-  const auto tilde_s_M = raise_or_lower_index(tilde_s, inv_spatial_metric);
-  const auto tilde_s_MN =
-      densitized_stress(tilde_s_M, spatial_velocity, inv_spatial_metric,
-                        sqrt_det_spatial_metric, pressure);
+  using tilde_s_M_tag =
+      ::Tags::TempTensor<0, tnsr::I<DataVector, Dim, Frame::Inertial>>;
+  using tilde_s_MN_tag =
+      ::Tags::TempTensor<1, tnsr::II<DataVector, Dim, Frame::Inertial>>;
+  TempBuffer<tmpl::list<tilde_s_M_tag, tilde_s_MN_tag>> buffer(
+      get(lapse).size());
+
+  auto& tilde_s_M = get<tilde_s_M_tag>(buffer);
+  raise_or_lower_index(make_not_null(&tilde_s_M), tilde_s, inv_spatial_metric);
+  auto& tilde_s_MN = get<tilde_s_MN_tag>(buffer);
+  densitized_stress(make_not_null(&tilde_s_MN), tilde_s_M, spatial_velocity,
+                    inv_spatial_metric, sqrt_det_spatial_metric, pressure);
 
   // unroll contributions from m=0 and n=0 to avoid initializing
   // source_tilde_tau to zero
@@ -4,9 +4,11 @@
 #include "Evolution/Systems/RelativisticEuler/Valencia/Fluxes.hpp"
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 // IWYU pragma: no_include <array>
@@ -31,10 +33,15 @@ void fluxes(const gsl::not_null<tnsr::I<DataVector, Dim, Frame::Inertial>*>
             const Scalar<DataVector>& pressure,
             const tnsr::I<DataVector, Dim, Frame::Inertial>&
                 spatial_velocity) noexcept {
-  const DataVector p_alpha_sqrt_det_g =
+  using p_alpha_sqrt_det_g_tag = ::Tags::TempTensor<0, Scalar<DataVector>>;
+  using transport_velocity_I_tag = ::Tags::TempTensor<1, Scalar<DataVector>>;
+  TempBuffer<tmpl::list<p_alpha_sqrt_det_g_tag, transport_velocity_I_tag>>
+      buffer(get(lapse).size());
+
+  DataVector& p_alpha_sqrt_det_g = get(get<p_alpha_sqrt_det_g_tag>(buffer));
+  p_alpha_sqrt_det_g =
       get(sqrt_det_spatial_metric) * get(lapse) * get(pressure);
-  // Outside the loop to save allocations
-  DataVector transport_velocity_I(p_alpha_sqrt_det_g.size());
+  DataVector& transport_velocity_I = get(get<transport_velocity_I_tag>(buffer));
   for (size_t i = 0; i < Dim; ++i) {
     transport_velocity_I = get(lapse) * spatial_velocity.get(i) - shift.get(i);
     tilde_d_flux->get(i) = get(tilde_d) * transport_velocity_I;
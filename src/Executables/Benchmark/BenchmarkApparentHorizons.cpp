@@ -0,0 +1,76 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+#include "ApparentHorizons/YlmSpherepack.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+
+// Benchmarks of the spherical harmonic transforms used on apparent horizons,
+// for l_max = m_max from 2 to 12.
+
+namespace {
+YlmSpherepack make_ylm(const benchmark::State& state) noexcept {
+  const auto l_max = static_cast<size_t>(state.range(0));
+  return YlmSpherepack(l_max, l_max);
+}
+
+DataVector make_random_data_vector(const size_t size) noexcept {
+  DataVector result(size);
+  benchmark_helpers::fill_with_random_values(result.data(), result.size());
+  return result;
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_ylm_phys_to_spec(benchmark::State& state) {  // NOLINT
+  const auto ylm = make_ylm(state);
+  const auto collocation_values = make_random_data_vector(ylm.physical_size());
+  DataVector spectral_coefs(ylm.spectral_size());
+
+  while (state.KeepRunning()) {
+    ylm.phys_to_spec(make_not_null(spectral_coefs.data()),
+                     make_not_null(collocation_values.data()));
+    benchmark::DoNotOptimize(spectral_coefs.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(
+      state, ylm.physical_size(),
+      (ylm.physical_size() + ylm.spectral_size()) * sizeof(double));
+}
+BENCHMARK(bench_ylm_phys_to_spec)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_ylm_spec_to_phys(benchmark::State& state) {  // NOLINT
+  const auto ylm = make_ylm(state);
+  const auto spectral_coefs =
+      ylm.phys_to_spec(make_random_data_vector(ylm.physical_size()));
+  DataVector collocation_values(ylm.physical_size());
+
+  while (state.KeepRunning()) {
+    ylm.spec_to_phys(make_not_null(collocation_values.data()),
+                     make_not_null(spectral_coefs.data()));
+    benchmark::DoNotOptimize(collocation_values.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(
+      state, ylm.physical_size(),
+      (ylm.physical_size() + ylm.spectral_size()) * sizeof(double));
+}
+BENCHMARK(bench_ylm_spec_to_phys)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_ylm_gradient(benchmark::State& state) {  // NOLINT
+  const auto ylm = make_ylm(state);
+  const auto collocation_values = make_random_data_vector(ylm.physical_size());
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(ylm.gradient(collocation_values));
+  }
+  benchmark_helpers::set_throughput(state, ylm.physical_size(),
+                                    3 * ylm.physical_size() * sizeof(double));
+}
+BENCHMARK(bench_ylm_gradient)->DenseRange(2, 12);
+}  // namespace
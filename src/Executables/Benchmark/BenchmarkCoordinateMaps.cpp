@@ -0,0 +1,97 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/CoordinateMaps/Wedge3D.hpp"
+#include "Domain/LogicalCoordinates.hpp"
+#include "Domain/Mesh.hpp"
+#include "Domain/OrientationMap.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+// Benchmarks of the inverse Jacobian of the element maps, evaluated through
+// the `CoordinateMapBase` interface the executables use, for 1 to 3
+// dimensions and 2 to 12 points per dimension.
+
+namespace {
+template <size_t Dim>
+struct AffineMap;
+
+template <>
+struct AffineMap<1> {
+  static auto make() noexcept {
+    return make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+        CoordinateMaps::Affine{-1.0, 1.0, 2.0, 3.0});
+  }
+};
+
+template <>
+struct AffineMap<2> {
+  static auto make() noexcept {
+    const CoordinateMaps::Affine map1d{-1.0, 1.0, 2.0, 3.0};
+    return make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+        CoordinateMaps::ProductOf2Maps<CoordinateMaps::Affine,
+                                       CoordinateMaps::Affine>{map1d, map1d});
+  }
+};
+
+template <>
+struct AffineMap<3> {
+  static auto make() noexcept {
+    const CoordinateMaps::Affine map1d{-1.0, 1.0, 2.0, 3.0};
+    return make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+        CoordinateMaps::ProductOf3Maps<CoordinateMaps::Affine,
+                                       CoordinateMaps::Affine,
+                                       CoordinateMaps::Affine>{map1d, map1d,
+                                                               map1d});
+  }
+};
+
+template <size_t Dim>
+Mesh<Dim> make_mesh(const benchmark::State& state) noexcept {
+  return Mesh<Dim>{static_cast<size_t>(state.range(0)),
+                   Spectral::Basis::Legendre,
+                   Spectral::Quadrature::GaussLobatto};
+}
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim, typename Map>
+void bench_inv_jacobian(benchmark::State& state,  // NOLINT
+                        const Map& map) noexcept {
+  const auto logical_coords = logical_coordinates(make_mesh<Dim>(state));
+  const size_t number_of_points = get<0>(logical_coords).size();
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(map.inv_jacobian(logical_coords));
+  }
+  benchmark_helpers::set_throughput(state, number_of_points,
+                                    (Dim + Dim * Dim) * number_of_points *
+                                        sizeof(double));
+}
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_affine_inv_jacobian(benchmark::State& state) {  // NOLINT
+  bench_inv_jacobian<Dim>(state, *AffineMap<Dim>::make());
+}
+BENCHMARK_TEMPLATE(bench_affine_inv_jacobian, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_affine_inv_jacobian, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_affine_inv_jacobian, 3)->DenseRange(2, 12);
+
+// The map of the elements of a spherical shell
+// clang-tidy: don't pass be non-const reference
+void bench_wedge3d_inv_jacobian(benchmark::State& state) {  // NOLINT
+  const auto map = make_coordinate_map_base<Frame::Logical, Frame::Inertial>(
+      CoordinateMaps::Wedge3D{1.0, 3.0, OrientationMap<3>{}, 1.0, 1.0, true});
+  bench_inv_jacobian<3>(state, *map);
+}
+BENCHMARK(bench_wedge3d_inv_jacobian)->DenseRange(2, 12);
+}  // namespace
@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/BlockBoundingVolumeHierarchy.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainCreators/Shell.hpp"
+#include "Domain/DomainCreators/Sphere.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "Utilities/Literals.hpp"
+
+// Benchmarks of locating points in a domain, with the number of initial
+// refinement levels (and so of blocks) of a Shell or Sphere as the first
+// argument and the number of points as the second.
+
+namespace {
+// Points uniformly distributed in the logical coordinates of random blocks
+tnsr::I<DataVector, 3, Frame::Inertial> random_points_in_domain(
+    const Domain<3, Frame::Inertial>& domain,
+    const size_t number_of_points) noexcept {
+  std::mt19937 generator(number_of_points);
+  std::uniform_int_distribution<size_t> block_distribution(
+      0, domain.blocks().size() - 1);
+  std::uniform_real_distribution<> logical_distribution(-1.0, 1.0);
+  tnsr::I<DataVector, 3, Frame::Inertial> x(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    tnsr::I<double, 3, Frame::Logical> logical_point{};
+    for (size_t d = 0; d < 3; ++d) {
+      logical_point.get(d) = logical_distribution(generator);
+    }
+    const auto point = domain.blocks()[block_distribution(generator)]
+                           .coordinate_map()(logical_point);
+    for (size_t d = 0; d < 3; ++d) {
+      x.get(d)[s] = point.get(d);
+    }
+  }
+  return x;
+}
+
+Domain<3, Frame::Inertial> shell(const size_t refinement) noexcept {
+  return DomainCreators::Shell<Frame::Inertial>(1.5, 2.5, refinement, {{4, 4}},
+                                                true)
+      .create_domain();
+}
+
+Domain<3, Frame::Inertial> sphere(const size_t refinement) noexcept {
+  return DomainCreators::Sphere<Frame::Inertial>(1.0, 3.0, refinement,
+                                                 {{4, 4}}, true)
+      .create_domain();
+}
+
+// Locate the points one at a time, which inverts the map of every block in
+// turn until one contains the point, as done when there are few points per
+// block
+// clang-tidy: don't pass be non-const reference
+template <Domain<3, Frame::Inertial> (*CreateDomain)(size_t)>
+void bench_all_blocks(benchmark::State& state) {  // NOLINT
+  const auto domain = CreateDomain(static_cast<size_t>(state.range(0)));
+  const size_t number_of_points = static_cast<size_t>(state.range(1));
+  const auto x = random_points_in_domain(domain, number_of_points);
+  tnsr::I<DataVector, 3, Frame::Inertial> point(1_st);
+
+  while (state.KeepRunning()) {
+    for (size_t s = 0; s < number_of_points; ++s) {
+      for (size_t d = 0; d < 3; ++d) {
+        point.get(d)[0] = x.get(d)[s];
+      }
+      benchmark::DoNotOptimize(block_logical_coordinates(domain, point));
+    }
+  }
+  benchmark_helpers::set_throughput(state, number_of_points,
+                                    3 * number_of_points * sizeof(double));
+}
+
+// Locate the points by inverting only the maps of the blocks whose bounding
+// box contains each point, with the hierarchy built once up front
+// clang-tidy: don't pass be non-const reference
+template <Domain<3, Frame::Inertial> (*CreateDomain)(size_t)>
+void bench_hierarchy(benchmark::State& state) {  // NOLINT
+  const auto domain = CreateDomain(static_cast<size_t>(state.range(0)));
+  const size_t number_of_points = static_cast<size_t>(state.range(1));
+  const auto x = random_points_in_domain(domain, number_of_points);
+  const BlockBoundingVolumeHierarchy<3, Frame::Inertial> hierarchy(domain);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(block_logical_coordinates(domain, x, hierarchy));
+  }
+  benchmark_helpers::set_throughput(state, number_of_points,
+                                    3 * number_of_points * sizeof(double));
+}
+
+// The cost of building the hierarchy, paid once per domain
+// clang-tidy: don't pass be non-const reference
+template <Domain<3, Frame::Inertial> (*CreateDomain)(size_t)>
+void bench_build_hierarchy(benchmark::State& state) {  // NOLINT
+  const auto domain = CreateDomain(static_cast<size_t>(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        BlockBoundingVolumeHierarchy<3, Frame::Inertial>(domain));
+  }
+}
+
+void refinements_and_points(benchmark::internal::Benchmark* b) noexcept {
+  for (int refinement = 0; refinement <= 2; ++refinement) {
+    for (const int number_of_points : {100, 10000}) {
+      b->Args({refinement, number_of_points});
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(bench_all_blocks, shell)->Apply(refinements_and_points);
+BENCHMARK_TEMPLATE(bench_hierarchy, shell)->Apply(refinements_and_points);
+BENCHMARK_TEMPLATE(bench_build_hierarchy, shell)->DenseRange(0, 2);
+BENCHMARK_TEMPLATE(bench_all_blocks, sphere)->Apply(refinements_and_points);
+BENCHMARK_TEMPLATE(bench_hierarchy, sphere)->Apply(refinements_and_points);
+BENCHMARK_TEMPLATE(bench_build_hierarchy, sphere)->DenseRange(0, 2);
+}  // namespace
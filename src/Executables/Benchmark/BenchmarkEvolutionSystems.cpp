@@ -0,0 +1,268 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/Burgers/Fluxes.hpp"
+#include "Evolution/Systems/CurvedScalarWave/Equations.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Fluxes.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Sources.hpp"
+#include "Evolution/Systems/NewtonianEuler/Fluxes.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/Equations.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/Fluxes.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/ScalarWave/Equations.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "PointwiseFunctions/EquationsOfState/IdealFluid.hpp"
+#include "Utilities/Gsl.hpp"
+
+// Benchmarks of the volume terms of the evolution systems, for 1 to 3
+// dimensions (where the system supports them) and 2 to 12 points per
+// dimension. Systems with a `ComputeDuDt` are benchmarked through it; the
+// flux-conservative systems are benchmarked through their fluxes and sources,
+// which is the pointwise work they do in the volume. The primitive recovery
+// of the relativistic hydro systems is benchmarked on physically consistent
+// data.
+
+namespace {
+template <size_t Dim>
+size_t number_of_grid_points(const benchmark::State& state) noexcept {
+  return benchmark_helpers::number_of_grid_points<Dim>(
+      static_cast<size_t>(state.range(0)));
+}
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_scalar_wave_du_dt(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &ScalarWave::ComputeDuDt<Dim>::apply,
+      number_of_grid_points<Dim>(state));
+}
+BENCHMARK_TEMPLATE(bench_scalar_wave_du_dt, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_scalar_wave_du_dt, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_scalar_wave_du_dt, 3)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_curved_scalar_wave_du_dt(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &CurvedScalarWave::ComputeDuDt<Dim>::apply,
+      number_of_grid_points<Dim>(state));
+}
+BENCHMARK_TEMPLATE(bench_curved_scalar_wave_du_dt, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_curved_scalar_wave_du_dt, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_curved_scalar_wave_du_dt, 3)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_generalized_harmonic_du_dt(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &GeneralizedHarmonic::ComputeDuDt<Dim>::apply,
+      number_of_grid_points<Dim>(state));
+}
+BENCHMARK_TEMPLATE(bench_generalized_harmonic_du_dt, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_generalized_harmonic_du_dt, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_generalized_harmonic_du_dt, 3)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_burgers_fluxes(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(state, &Burgers::Fluxes::apply,
+                                            number_of_grid_points<1>(state));
+}
+BENCHMARK(bench_burgers_fluxes)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_newtonian_euler_fluxes(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &NewtonianEuler::ComputeFluxes<Dim>::apply,
+      number_of_grid_points<Dim>(state));
+}
+BENCHMARK_TEMPLATE(bench_newtonian_euler_fluxes, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_newtonian_euler_fluxes, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_newtonian_euler_fluxes, 3)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_valencia_fluxes(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &RelativisticEuler::Valencia::fluxes<Dim>,
+      number_of_grid_points<Dim>(state));
+}
+BENCHMARK_TEMPLATE(bench_valencia_fluxes, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_valencia_fluxes, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_valencia_fluxes, 3)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_valencia_sources(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &RelativisticEuler::Valencia::compute_source_terms_of_u<Dim>,
+      number_of_grid_points<Dim>(state));
+}
+BENCHMARK_TEMPLATE(bench_valencia_sources, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_valencia_sources, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_valencia_sources, 3)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_valencia_div_clean_fluxes(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &grmhd::ValenciaDivClean::ComputeFluxes::apply,
+      number_of_grid_points<3>(state));
+}
+BENCHMARK(bench_valencia_div_clean_fluxes)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_valencia_div_clean_sources(benchmark::State& state) {  // NOLINT
+  benchmark_helpers::bench_pointwise_kernel(
+      state, &grmhd::ValenciaDivClean::compute_source_terms_of_u,
+      number_of_grid_points<3>(state));
+}
+BENCHMARK(bench_valencia_div_clean_sources)->DenseRange(2, 12);
+
+// A fluid in flat space with an ideal fluid equation of state with adiabatic
+// index 4/3, with random density, internal energy, velocity, and magnetic
+// field.
+template <size_t Dim>
+struct FluidData {
+  explicit FluidData(const size_t number_of_points) noexcept
+      : rest_mass_density(number_of_points),
+        specific_internal_energy(number_of_points),
+        spatial_velocity(number_of_points),
+        magnetic_field(number_of_points),
+        divergence_cleaning_field(number_of_points, 0.),
+        spatial_metric(number_of_points, 0.),
+        inv_spatial_metric(number_of_points, 0.),
+        sqrt_det_spatial_metric(number_of_points, 1.) {
+    benchmark_helpers::fill_with_random_values(
+        get(rest_mass_density).data(), number_of_points);
+    benchmark_helpers::fill_with_random_values(
+        get(specific_internal_energy).data(), number_of_points);
+    for (size_t i = 0; i < Dim; ++i) {
+      benchmark_helpers::fill_with_random_values(
+          spatial_velocity.get(i).data(), number_of_points);
+      spatial_velocity.get(i) *= 0.5 / Dim;
+      benchmark_helpers::fill_with_random_values(
+          magnetic_field.get(i).data(), number_of_points);
+      spatial_velocity_one_form.get(i) = spatial_velocity.get(i);
+      spatial_metric.get(i, i) = 1.;
+      inv_spatial_metric.get(i, i) = 1.;
+    }
+    spatial_velocity_squared =
+        dot_product(spatial_velocity, spatial_velocity_one_form);
+    lorentz_factor =
+        Scalar<DataVector>{1. / sqrt(1. - get(spatial_velocity_squared))};
+    pressure = equation_of_state.pressure_from_density_and_energy(
+        rest_mass_density, specific_internal_energy);
+    specific_enthalpy = Scalar<DataVector>{
+        1. + get(specific_internal_energy) +
+        get(pressure) / get(rest_mass_density)};
+  }
+
+  EquationsOfState::IdealFluid<true> equation_of_state{4. / 3.};
+  Scalar<DataVector> rest_mass_density;
+  Scalar<DataVector> specific_internal_energy;
+  tnsr::I<DataVector, Dim, Frame::Inertial> spatial_velocity;
+  tnsr::i<DataVector, Dim, Frame::Inertial> spatial_velocity_one_form{};
+  Scalar<DataVector> spatial_velocity_squared{};
+  tnsr::I<DataVector, Dim, Frame::Inertial> magnetic_field;
+  Scalar<DataVector> divergence_cleaning_field;
+  Scalar<DataVector> lorentz_factor{};
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> specific_enthalpy{};
+  tnsr::ii<DataVector, Dim, Frame::Inertial> spatial_metric;
+  tnsr::II<DataVector, Dim, Frame::Inertial> inv_spatial_metric;
+  Scalar<DataVector> sqrt_det_spatial_metric;
+};
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_valencia_primitive_from_conservative(  // NOLINT
+    benchmark::State& state) {
+  const size_t number_of_points = number_of_grid_points<Dim>(state);
+  FluidData<Dim> fluid(number_of_points);
+  Scalar<DataVector> tilde_d(number_of_points);
+  Scalar<DataVector> tilde_tau(number_of_points);
+  tnsr::i<DataVector, Dim, Frame::Inertial> tilde_s(number_of_points);
+  RelativisticEuler::Valencia::conservative_from_primitive(
+      make_not_null(&tilde_d), make_not_null(&tilde_tau),
+      make_not_null(&tilde_s), fluid.rest_mass_density,
+      fluid.specific_internal_energy, fluid.spatial_velocity_one_form,
+      fluid.spatial_velocity_squared, fluid.lorentz_factor,
+      fluid.specific_enthalpy, fluid.pressure, fluid.sqrt_det_spatial_metric);
+
+  while (state.KeepRunning()) {
+    RelativisticEuler::Valencia::primitive_from_conservative(
+        make_not_null(&fluid.rest_mass_density),
+        make_not_null(&fluid.specific_internal_energy),
+        make_not_null(&fluid.lorentz_factor),
+        make_not_null(&fluid.specific_enthalpy), make_not_null(&fluid.pressure),
+        make_not_null(&fluid.spatial_velocity), tilde_d, tilde_tau, tilde_s,
+        fluid.inv_spatial_metric, fluid.sqrt_det_spatial_metric,
+        fluid.equation_of_state);
+    benchmark::DoNotOptimize(get(fluid.pressure).data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(
+      state, number_of_points,
+      (2 * Dim + Dim * (Dim + 1) / 2 + 9) * number_of_points * sizeof(double));
+}
+BENCHMARK_TEMPLATE(bench_valencia_primitive_from_conservative, 1)
+    ->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_valencia_primitive_from_conservative, 2)
+    ->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_valencia_primitive_from_conservative, 3)
+    ->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+void bench_valencia_div_clean_primitive_from_conservative(  // NOLINT
+    benchmark::State& state) {
+  const size_t number_of_points = number_of_grid_points<3>(state);
+  FluidData<3> fluid(number_of_points);
+  Scalar<DataVector> tilde_d(number_of_points);
+  Scalar<DataVector> tilde_tau(number_of_points);
+  tnsr::i<DataVector, 3, Frame::Inertial> tilde_s(number_of_points);
+  tnsr::I<DataVector, 3, Frame::Inertial> tilde_b(number_of_points);
+  Scalar<DataVector> tilde_phi(number_of_points);
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_tau),
+      make_not_null(&tilde_s), make_not_null(&tilde_b),
+      make_not_null(&tilde_phi), fluid.rest_mass_density,
+      fluid.specific_internal_energy, fluid.specific_enthalpy, fluid.pressure,
+      fluid.spatial_velocity, fluid.lorentz_factor, fluid.magnetic_field,
+      fluid.sqrt_det_spatial_metric, fluid.spatial_metric,
+      fluid.divergence_cleaning_field);
+
+  while (state.KeepRunning()) {
+    grmhd::ValenciaDivClean::PrimitiveFromConservative<
+        grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin,
+        2>::apply(make_not_null(&fluid.rest_mass_density),
+                  make_not_null(&fluid.specific_internal_energy),
+                  make_not_null(&fluid.spatial_velocity),
+                  make_not_null(&fluid.magnetic_field),
+                  make_not_null(&fluid.divergence_cleaning_field),
+                  make_not_null(&fluid.lorentz_factor),
+                  make_not_null(&fluid.pressure),
+                  make_not_null(&fluid.specific_enthalpy), tilde_d, tilde_tau,
+                  tilde_s, tilde_b, tilde_phi, fluid.spatial_metric,
+                  fluid.inv_spatial_metric, fluid.sqrt_det_spatial_metric,
+                  fluid.equation_of_state);
+    benchmark::DoNotOptimize(get(fluid.pressure).data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(state, number_of_points,
+                                    36 * number_of_points * sizeof(double));
+}
+BENCHMARK(bench_valencia_div_clean_primitive_from_conservative)
+    ->DenseRange(2, 12);
+}  // namespace
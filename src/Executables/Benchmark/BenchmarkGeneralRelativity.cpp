@@ -0,0 +1,112 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <numeric>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/RelativisticEuler/Valencia/ConservativeFromPrimitive.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "PointwiseFunctions/GeneralRelativity/ComputeSpacetimeQuantities.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+// Benchmarks of pointwise GR and hydro kernels on input data that is aligned,
+// as held by DataVector and Variables, and on the same data shifted by one
+// double so no component is aligned.
+
+namespace {
+// Point the components of all `tensors` at consecutive chunks of `buffer`,
+// starting `offset` doubles past its aligned beginning.
+template <typename... TensorTypes>
+void point_into_buffer(
+    const gsl::not_null<benchmark_helpers::AlignedBuffer*> buffer,
+    const size_t offset, const size_t number_of_points,
+    const gsl::not_null<TensorTypes*>... tensors) noexcept {
+  const std::array<size_t, sizeof...(TensorTypes)> sizes{
+      {TensorTypes::size()...}};
+  buffer->assign(
+      offset + number_of_points *
+                   std::accumulate(sizes.begin(), sizes.end(), size_t{0}),
+      1.0);
+  size_t position = offset;
+  const auto point_tensor = [&buffer, &position,
+                             &number_of_points ](auto tensor) noexcept {
+    for (auto& component : *tensor) {
+      component.set_data_ref(&(*buffer)[position], number_of_points);
+      position += number_of_points;
+    }
+    return 0;
+  };
+  expand_pack(point_tensor(tensors)...);
+}
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Offset>
+void bench_spacetime_metric(benchmark::State& state) {  // NOLINT
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  Scalar<DataVector> lapse{};
+  tnsr::I<DataVector, 3, Frame::Inertial> shift{};
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric{};
+  benchmark_helpers::AlignedBuffer buffer{};
+  point_into_buffer(&buffer, Offset, number_of_points, make_not_null(&lapse),
+                    make_not_null(&shift), make_not_null(&spatial_metric));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        gr::spacetime_metric(lapse, shift, spatial_metric));
+  }
+  benchmark_helpers::set_throughput(
+      state, number_of_points,
+      (buffer.size() - Offset + 10 * number_of_points) * sizeof(double));
+}
+BENCHMARK_TEMPLATE(bench_spacetime_metric, 0)->Range(64, 4096);
+BENCHMARK_TEMPLATE(bench_spacetime_metric, 1)->Range(64, 4096);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Offset>
+void bench_valencia_conservative_from_primitive(  // NOLINT
+    benchmark::State& state) {
+  const auto number_of_points = static_cast<size_t>(state.range(0));
+  Scalar<DataVector> tilde_d{};
+  Scalar<DataVector> tilde_tau{};
+  tnsr::i<DataVector, 3, Frame::Inertial> tilde_s{};
+  Scalar<DataVector> rest_mass_density{};
+  Scalar<DataVector> specific_internal_energy{};
+  tnsr::i<DataVector, 3, Frame::Inertial> spatial_velocity_oneform{};
+  Scalar<DataVector> spatial_velocity_squared{};
+  Scalar<DataVector> lorentz_factor{};
+  Scalar<DataVector> specific_enthalpy{};
+  Scalar<DataVector> pressure{};
+  Scalar<DataVector> sqrt_det_spatial_metric{};
+  benchmark_helpers::AlignedBuffer buffer{};
+  point_into_buffer(
+      &buffer, Offset, number_of_points, make_not_null(&tilde_d),
+      make_not_null(&tilde_tau), make_not_null(&tilde_s),
+      make_not_null(&rest_mass_density),
+      make_not_null(&specific_internal_energy),
+      make_not_null(&spatial_velocity_oneform),
+      make_not_null(&spatial_velocity_squared), make_not_null(&lorentz_factor),
+      make_not_null(&specific_enthalpy), make_not_null(&pressure),
+      make_not_null(&sqrt_det_spatial_metric));
+
+  while (state.KeepRunning()) {
+    RelativisticEuler::Valencia::conservative_from_primitive(
+        make_not_null(&tilde_d), make_not_null(&tilde_tau),
+        make_not_null(&tilde_s), rest_mass_density, specific_internal_energy,
+        spatial_velocity_oneform, spatial_velocity_squared, lorentz_factor,
+        specific_enthalpy, pressure, sqrt_det_spatial_metric);
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(state, number_of_points,
+                                    (buffer.size() - Offset) * sizeof(double));
+}
+BENCHMARK_TEMPLATE(bench_valencia_conservative_from_primitive, 0)
+    ->Range(64, 4096);
+BENCHMARK_TEMPLATE(bench_valencia_conservative_from_primitive, 1)
+    ->Range(64, 4096);
+}  // namespace
@@ -0,0 +1,157 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/AlignedAllocator.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <typename TagsList>
+class Variables;
+/// \endcond
+
+namespace benchmark_helpers {
+using AlignedBuffer = std::vector<double, AlignedAllocator<double>>;
+
+/// Number of grid points of a `Dim`-dimensional mesh with `points_per_dim`
+/// points in each dimension
+template <size_t Dim>
+size_t number_of_grid_points(const size_t points_per_dim) noexcept {
+  size_t result = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    result *= points_per_dim;
+  }
+  return result;
+}
+
+/// Fill `data` with values in [0.5, 1), which are valid inputs to every
+/// benchmarked kernel that does not need physically consistent data.
+inline void fill_with_random_values(double* const data,
+                                    const size_t size) noexcept {
+  std::mt19937 generator(size);
+  std::uniform_real_distribution<> distribution(0.5, 1.0);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = distribution(generator);  // NOLINT
+  }
+}
+
+template <typename TagsList>
+void fill_with_random_values(
+    const gsl::not_null<Variables<TagsList>*> vars) noexcept {
+  fill_with_random_values(vars->data(), vars->size());
+}
+
+/// Report the throughput of the benchmark in grid points per second and in
+/// bytes of input and output data per second.
+// clang-tidy: don't pass be non-const reference
+inline void set_throughput(benchmark::State& state,  // NOLINT
+                           const size_t number_of_points,
+                           const size_t bytes_per_iteration) noexcept {
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_points));
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(bytes_per_iteration));
+}
+
+namespace detail {
+template <typename T>
+size_t number_of_components(const T& /*argument*/) noexcept {
+  return 0;
+}
+
+template <typename Symm, typename IndexList>
+size_t number_of_components(
+    const Tensor<DataVector, Symm, IndexList>& tensor) noexcept {
+  return tensor.size();
+}
+
+template <typename T>
+void point_into(const gsl::not_null<T*> /*argument*/,
+                const gsl::not_null<double**> /*position*/,
+                const size_t /*number_of_points*/) noexcept {}
+
+template <typename Symm, typename IndexList>
+void point_into(
+    const gsl::not_null<Tensor<DataVector, Symm, IndexList>*> tensor,
+    const gsl::not_null<double**> position,
+    const size_t number_of_points) noexcept {
+  for (auto& component : *tensor) {
+    component.set_data_ref(*position, number_of_points);
+    *position += number_of_points;  // NOLINT
+  }
+}
+
+// The type an argument of a kernel is stored as, and how it is passed
+template <typename T>
+struct Argument {
+  using type = std::decay_t<T>;
+  static const type& pass(type& argument) noexcept { return argument; }
+};
+
+template <typename T>
+struct Argument<gsl::not_null<T*>> {
+  using type = T;
+  static gsl::not_null<T*> pass(type& argument) noexcept {
+    return make_not_null(&argument);
+  }
+};
+
+template <typename... Args, typename Tuple, size_t... Is>
+void call_kernel(void (*kernel)(Args...), const gsl::not_null<Tuple*> arguments,
+                 std::index_sequence<Is...> /*meta*/) noexcept {
+  kernel(Argument<Args>::pass(std::get<Is>(*arguments))...);
+}
+}  // namespace detail
+
+/*!
+ * \brief Benchmark a pointwise kernel on `number_of_points` points.
+ *
+ * All `Tensor<DataVector>` arguments, inputs and outputs, point into one
+ * aligned buffer of random values in [0.5, 1). Other arguments are value
+ * initialized.
+ */
+template <typename... Args>
+// clang-tidy: don't pass be non-const reference
+void bench_pointwise_kernel(benchmark::State& state,  // NOLINT
+                            void (*kernel)(Args...),
+                            const size_t number_of_points) noexcept {
+  std::tuple<typename detail::Argument<Args>::type...> arguments{};
+  size_t number_of_components = 0;
+  tmpl::for_each<tmpl::range<size_t, 0, sizeof...(Args)>>(
+      [&arguments, &number_of_components](auto index) noexcept {
+        number_of_components += detail::number_of_components(
+            std::get<tmpl::type_from<decltype(index)>::value>(arguments));
+      });
+  AlignedBuffer buffer(number_of_components * number_of_points);
+  fill_with_random_values(buffer.data(), buffer.size());
+  double* position = buffer.data();
+  tmpl::for_each<tmpl::range<size_t, 0, sizeof...(Args)>>(
+      [&arguments, &position, &number_of_points](auto index) noexcept {
+        detail::point_into(
+            make_not_null(
+                &std::get<tmpl::type_from<decltype(index)>::value>(arguments)),
+            make_not_null(&position), number_of_points);
+      });
+
+  while (state.KeepRunning()) {
+    detail::call_kernel(kernel, make_not_null(&arguments),
+                        std::make_index_sequence<sizeof...(Args)>{});
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  set_throughput(state, number_of_points, buffer.size() * sizeof(double));
+}
+}  // namespace benchmark_helpers
@@ -0,0 +1,260 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TensorData.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/OutputSettings.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Utilities/FileSystem.hpp"
+
+// Benchmarks of writing one volume observation of synthetic 3D elements with
+// 5^3 points and four tensor components, as done by the observer writers.
+// The elements are split evenly between a number of nodes, which either each
+// write their own file, with one group per element or in the contiguous
+// format, or fill the pre-sized contiguous datasets of one shared file one
+// after another. The first argument is the number of elements and the second
+// the number of nodes.
+//
+// The output settings benchmark writes smooth data with each of the
+// `output_settings` in turn, given by the argument, and reports the size of
+// the file next to the write throughput. The file also holds the
+// connectivity, so the uncompressed file is the baseline for the sizes.
+
+namespace {
+constexpr size_t points_per_dim = 5;
+constexpr size_t number_of_components = 4;
+
+std::vector<ExtentsAndTensorVolumeData> make_elements(
+    const size_t number_of_elements) noexcept {
+  const size_t number_of_points =
+      benchmark_helpers::number_of_grid_points<3>(points_per_dim);
+  std::vector<ExtentsAndTensorVolumeData> elements{};
+  elements.reserve(number_of_elements);
+  for (size_t i = 0; i < number_of_elements; ++i) {
+    std::vector<TensorComponent> components{};
+    for (size_t j = 0; j < number_of_components; ++j) {
+      DataVector data(number_of_points);
+      benchmark_helpers::fill_with_random_values(data.data(), data.size());
+      components.emplace_back(
+          "Element" + std::to_string(i) + "/T_" + std::to_string(j),
+          std::move(data));
+    }
+    elements.emplace_back(
+        std::vector<size_t>{points_per_dim, points_per_dim, points_per_dim},
+        std::move(components));
+  }
+  return elements;
+}
+
+// Elements with smooth data, which compresses like the fields of a
+// simulation unlike random data
+std::vector<ExtentsAndTensorVolumeData> make_smooth_elements(
+    const size_t number_of_elements) noexcept {
+  auto elements = make_elements(number_of_elements);
+  for (size_t i = 0; i < number_of_elements; ++i) {
+    for (size_t j = 0; j < number_of_components; ++j) {
+      auto& data = elements[i].tensor_components[j].data;
+      for (size_t k = 0; k < data.size(); ++k) {
+        data[k] = std::sin(0.01 * static_cast<double>(i * data.size() + k) +
+                           static_cast<double>(j));
+      }
+    }
+  }
+  return elements;
+}
+
+const std::array<std::pair<const char*, h5::TensorOutputSettings>, 6>
+    output_settings{{{"Uncompressed", {0, false, false, 52}},
+                     {"Deflate1", {1, false, false, 52}},
+                     {"Shuffle+Deflate1", {1, true, false, 52}},
+                     {"Shuffle+Deflate6", {6, true, false, 52}},
+                     {"Float+Shuffle+Deflate1", {1, true, true, 23}},
+                     {"Round16+Shuffle+Deflate1", {1, true, false, 16}}}};
+
+// The elements written by each node, assigned round robin
+std::vector<std::vector<ExtentsAndTensorVolumeData>> split_between_nodes(
+    std::vector<ExtentsAndTensorVolumeData> elements,
+    const size_t number_of_nodes) noexcept {
+  std::vector<std::vector<ExtentsAndTensorVolumeData>> node_elements(
+      number_of_nodes);
+  for (size_t i = 0; i < elements.size(); ++i) {
+    node_elements[i % number_of_nodes].push_back(std::move(elements[i]));
+  }
+  return node_elements;
+}
+
+void remove_file(const std::string& file_name) noexcept {
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+
+size_t bytes_per_observation(const size_t number_of_elements) noexcept {
+  return number_of_elements * number_of_components *
+         benchmark_helpers::number_of_grid_points<3>(points_per_dim) *
+         sizeof(double);
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_file_per_node(benchmark::State& state) {  // NOLINT
+  const auto number_of_elements = static_cast<size_t>(state.range(0));
+  const auto number_of_nodes = static_cast<size_t>(state.range(1));
+  const auto elements = make_elements(number_of_elements);
+  const auto file_name = [](const size_t node) noexcept {
+    return "./BenchmarkIO.FilePerNode" + std::to_string(node) + ".h5";
+  };
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    for (size_t node = 0; node < number_of_nodes; ++node) {
+      remove_file(file_name(node));
+    }
+    state.ResumeTiming();
+    for (size_t node = 0; node < number_of_nodes; ++node) {
+      h5::H5File<h5::AccessType::ReadWrite> h5file(file_name(node), true);
+      auto& volume_file = h5file.try_insert<h5::VolumeData>("/element_data", 0);
+      for (size_t i = node; i < number_of_elements; i += number_of_nodes) {
+        volume_file.insert_tensor_data(0, 0., elements[i]);
+      }
+    }
+  }
+  for (size_t node = 0; node < number_of_nodes; ++node) {
+    remove_file(file_name(node));
+  }
+  benchmark_helpers::set_throughput(
+      state,
+      number_of_elements *
+          benchmark_helpers::number_of_grid_points<3>(points_per_dim),
+      bytes_per_observation(number_of_elements));
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_contiguous_file_per_node(benchmark::State& state) {  // NOLINT
+  const auto number_of_elements = static_cast<size_t>(state.range(0));
+  const auto number_of_nodes = static_cast<size_t>(state.range(1));
+  const auto node_elements =
+      split_between_nodes(make_elements(number_of_elements), number_of_nodes);
+  const auto file_name = [](const size_t node) noexcept {
+    return "./BenchmarkIO.ContiguousFilePerNode" + std::to_string(node) +
+           ".h5";
+  };
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    for (size_t node = 0; node < number_of_nodes; ++node) {
+      remove_file(file_name(node));
+    }
+    state.ResumeTiming();
+    for (size_t node = 0; node < number_of_nodes; ++node) {
+      h5::H5File<h5::AccessType::ReadWrite> h5file(file_name(node), true);
+      auto& volume_file = h5file.try_insert<h5::VolumeData>("/element_data", 0);
+      volume_file.write_volume_data(0, 0., node_elements[node]);
+    }
+  }
+  for (size_t node = 0; node < number_of_nodes; ++node) {
+    remove_file(file_name(node));
+  }
+  benchmark_helpers::set_throughput(
+      state,
+      number_of_elements *
+          benchmark_helpers::number_of_grid_points<3>(points_per_dim),
+      bytes_per_observation(number_of_elements));
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_shared_file(benchmark::State& state) {  // NOLINT
+  const auto number_of_elements = static_cast<size_t>(state.range(0));
+  const auto number_of_nodes = static_cast<size_t>(state.range(1));
+  const auto node_elements =
+      split_between_nodes(make_elements(number_of_elements), number_of_nodes);
+  const std::string file_name = "./BenchmarkIO.SharedFile.h5";
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    remove_file(file_name);
+    state.ResumeTiming();
+    std::vector<size_t> node_offsets{};
+    {
+      h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true);
+      auto& volume_file = h5file.try_insert<h5::VolumeData>("/element_data", 0);
+      std::vector<std::pair<std::vector<size_t>, std::vector<std::string>>>
+          layout{};
+      size_t number_of_points = 0;
+      for (const auto& elements : node_elements) {
+        node_offsets.push_back(number_of_points);
+        for (const auto& element : elements) {
+          std::vector<std::string> component_names{};
+          for (const auto& component : element.tensor_components) {
+            component_names.push_back(component.name);
+          }
+          layout.emplace_back(element.extents, std::move(component_names));
+          number_of_points += element.tensor_components.front().data.size();
+        }
+      }
+      volume_file.create_contiguous_datasets(0, 0., layout);
+    }
+    for (size_t node = 0; node < number_of_nodes; ++node) {
+      h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true);
+      auto& volume_file = h5file.get<h5::VolumeData>("/element_data");
+      volume_file.write_contiguous_data(0, node_offsets[node],
+                                        node_elements[node]);
+    }
+  }
+  remove_file(file_name);
+  benchmark_helpers::set_throughput(
+      state,
+      number_of_elements *
+          benchmark_helpers::number_of_grid_points<3>(points_per_dim),
+      bytes_per_observation(number_of_elements));
+}
+
+// clang-tidy: don't pass be non-const reference
+void bench_output_settings(benchmark::State& state) {  // NOLINT
+  constexpr size_t number_of_elements = 256;
+  const auto& settings = output_settings[static_cast<size_t>(state.range(0))];
+  const auto elements = make_smooth_elements(number_of_elements);
+  const std::string file_name = "./BenchmarkIO.OutputSettings.h5";
+
+  size_t file_size = 0;
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    remove_file(file_name);
+    state.ResumeTiming();
+    {
+      h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true);
+      auto& volume_file = h5file.try_insert<h5::VolumeData>("/element_data", 0);
+      volume_file.write_volume_data(0, 0., elements,
+                                    h5::VolumeOutputSettings{settings.second,
+                                                             {}});
+    }
+    state.PauseTiming();
+    file_size = file_system::file_size(file_name);
+    state.ResumeTiming();
+  }
+  remove_file(file_name);
+  state.SetLabel(settings.first);
+  state.counters["file_size"] = static_cast<double>(file_size);
+  benchmark_helpers::set_throughput(
+      state,
+      number_of_elements *
+          benchmark_helpers::number_of_grid_points<3>(points_per_dim),
+      bytes_per_observation(number_of_elements));
+}
+
+BENCHMARK(bench_file_per_node)->Ranges({{16, 512}, {1, 16}});
+BENCHMARK(bench_contiguous_file_per_node)->Ranges({{16, 512}, {1, 16}});
+BENCHMARK(bench_shared_file)->Ranges({{16, 512}, {1, 16}});
+BENCHMARK(bench_output_settings)->DenseRange(
+    0, static_cast<int>(output_settings.size()) - 1);
+}  // namespace
@@ -0,0 +1,71 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <string>
+
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Mesh.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+// Benchmarks of interpolating the evolved variables of an element to
+// arbitrary points, for 1 to 3 dimensions and 2 to 12 points per dimension,
+// with the interpolation matrix stored densely or as a tensor product.
+
+namespace {
+template <size_t Dim>
+struct Var : db::SimpleTag {
+  using type = tnsr::aa<DataVector, Dim, Frame::Inertial>;
+  static std::string name() noexcept { return "Var"; }
+};
+
+// Interpolate to as many random points in the element as it has grid points
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim, intrp::InterpolationMatrixStorage Storage>
+void bench_irregular_interpolate(benchmark::State& state) {  // NOLINT
+  const Mesh<Dim> mesh{static_cast<size_t>(state.range(0)),
+                       Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  const size_t number_of_points = mesh.number_of_grid_points();
+  tnsr::I<DataVector, Dim, Frame::Logical> target_points(number_of_points);
+  std::mt19937 generator(number_of_points);
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  for (auto& component : target_points) {
+    for (auto& x : component) {
+      x = distribution(generator);
+    }
+  }
+  const intrp::Irregular<Dim> interpolant(mesh, target_points, Storage);
+  Variables<tmpl::list<Var<Dim>>> vars(number_of_points);
+  benchmark_helpers::fill_with_random_values(make_not_null(&vars));
+  Variables<tmpl::list<Var<Dim>>> result(number_of_points);
+
+  while (state.KeepRunning()) {
+    interpolant.interpolate(make_not_null(&result), vars);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(
+      state, number_of_points, (vars.size() + result.size()) * sizeof(double));
+}
+
+constexpr auto dense = intrp::InterpolationMatrixStorage::Dense;
+constexpr auto tensor_product =
+    intrp::InterpolationMatrixStorage::TensorProduct;
+BENCHMARK_TEMPLATE(bench_irregular_interpolate, 1, dense)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_irregular_interpolate, 2, dense)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_irregular_interpolate, 3, dense)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_irregular_interpolate, 2, tensor_product)
+    ->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_irregular_interpolate, 3, tensor_product)
+    ->DenseRange(2, 12);
+}  // namespace
@@ -0,0 +1,169 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Mesh.hpp"
+#include "Executables/Benchmark/BenchmarkHelpers.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/ApplyMatrices.hpp"
+#include "NumericalAlgorithms/LinearOperators/Divergence.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/Spectral/Projection.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/TMPL.hpp"
+
+// Benchmarks of the linear operators applied to the evolved variables of an
+// element, for 1 to 3 dimensions and 2 to 12 points per dimension. The
+// variables are a scalar and a spacetime one-form in `Dim` dimensions, the
+// same number of components as a small evolution system.
+
+namespace {
+struct ScalarVar : db::SimpleTag {
+  using type = Scalar<DataVector>;
+  static std::string name() noexcept { return "ScalarVar"; }
+};
+
+template <size_t Dim>
+struct OneFormVar : db::SimpleTag {
+  using type = tnsr::a<DataVector, Dim, Frame::Inertial>;
+  static std::string name() noexcept { return "OneFormVar"; }
+};
+
+template <size_t Dim>
+struct FluxVar : db::SimpleTag {
+  using type = tnsr::Ia<DataVector, Dim, Frame::Inertial>;
+  static std::string name() noexcept { return "FluxVar"; }
+};
+
+template <size_t Dim>
+using VarTags = tmpl::list<ScalarVar, OneFormVar<Dim>>;
+
+template <size_t Dim>
+Mesh<Dim> make_mesh(const benchmark::State& state) noexcept {
+  return Mesh<Dim>{static_cast<size_t>(state.range(0)),
+                   Spectral::Basis::Legendre,
+                   Spectral::Quadrature::GaussLobatto};
+}
+
+// The inverse Jacobian of an affine map from the logical cube to a cube of
+// side 4
+template <size_t Dim>
+InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial>
+make_inverse_jacobian(const size_t number_of_points) noexcept {
+  InverseJacobian<DataVector, Dim, Frame::Logical, Frame::Inertial> inv_jac(
+      number_of_points, 0.);
+  for (size_t d = 0; d < Dim; ++d) {
+    inv_jac.get(d, d) = 0.5;
+  }
+  return inv_jac;
+}
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_partial_derivatives(benchmark::State& state) {  // NOLINT
+  const auto mesh = make_mesh<Dim>(state);
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const auto inv_jac = make_inverse_jacobian<Dim>(number_of_points);
+  Variables<VarTags<Dim>> u(number_of_points);
+  benchmark_helpers::fill_with_random_values(make_not_null(&u));
+  Variables<db::wrap_tags_in<Tags::deriv, VarTags<Dim>, tmpl::size_t<Dim>,
+                             Frame::Inertial>>
+      du(number_of_points);
+
+  while (state.KeepRunning()) {
+    partial_derivatives(make_not_null(&du), u, mesh, inv_jac);
+    benchmark::DoNotOptimize(du.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(state, number_of_points,
+                                    (u.size() + du.size()) * sizeof(double));
+}
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 3)->DenseRange(2, 12);
+
+// Apply a full square matrix in every dimension
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_apply_matrices(benchmark::State& state) {  // NOLINT
+  const auto mesh = make_mesh<Dim>(state);
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const Matrix& matrix =
+      Spectral::differentiation_matrix(mesh.slice_through(0));
+  const auto matrices = make_array<Dim>(std::cref(matrix));
+  Variables<VarTags<Dim>> u(number_of_points);
+  benchmark_helpers::fill_with_random_values(make_not_null(&u));
+  Variables<VarTags<Dim>> result(number_of_points);
+
+  while (state.KeepRunning()) {
+    apply_matrices(make_not_null(&result), matrices, u, mesh.extents());
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  benchmark_helpers::set_throughput(
+      state, number_of_points, (u.size() + result.size()) * sizeof(double));
+}
+BENCHMARK_TEMPLATE(bench_apply_matrices, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_apply_matrices, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_apply_matrices, 3)->DenseRange(2, 12);
+
+// clang-tidy: don't pass be non-const reference
+template <size_t Dim>
+void bench_divergence(benchmark::State& state) {  // NOLINT
+  const auto mesh = make_mesh<Dim>(state);
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const auto inv_jac = make_inverse_jacobian<Dim>(number_of_points);
+  Variables<tmpl::list<FluxVar<Dim>>> fluxes(number_of_points);
+  benchmark_helpers::fill_with_random_values(make_not_null(&fluxes));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(divergence(fluxes, mesh, inv_jac));
+  }
+  benchmark_helpers::set_throughput(
+      state, number_of_points,
+      (Dim + 1) * fluxes.size() / Dim * sizeof(double));
+}
+BENCHMARK_TEMPLATE(bench_divergence, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_divergence, 2)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_divergence, 3)->DenseRange(2, 12);
+
+// Project data on a face of a `FaceDim + 1`-dimensional element to a mortar
+// covering the lower half of the face in every dimension, as for a neighbor
+// that is refined once
+// clang-tidy: don't pass be non-const reference
+template <size_t FaceDim>
+void bench_project_to_mortar(benchmark::State& state) {  // NOLINT
+  const auto face_mesh = make_mesh<FaceDim>(state);
+  const size_t number_of_points = face_mesh.number_of_grid_points();
+  const auto mortar_size =
+      make_array<FaceDim>(Spectral::MortarSize::LowerHalf);
+  Variables<VarTags<FaceDim + 1>> vars(number_of_points);
+  benchmark_helpers::fill_with_random_values(make_not_null(&vars));
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        dg::project_to_mortar(vars, face_mesh, face_mesh, mortar_size));
+  }
+  benchmark_helpers::set_throughput(state, number_of_points,
+                                    2 * vars.size() * sizeof(double));
+}
+BENCHMARK_TEMPLATE(bench_project_to_mortar, 1)->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_project_to_mortar, 2)->DenseRange(2, 12);
+}  // namespace
+
+// Definitions of the function templates benchmarked above
+#include "NumericalAlgorithms/LinearOperators/Divergence.tpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
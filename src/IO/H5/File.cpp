@@ -17,7 +17,8 @@
 
 namespace h5 {
 template <AccessType Access_t>
-H5File<Access_t>::H5File(std::string file_name, bool append_to_file)
+H5File<Access_t>::H5File(std::string file_name, bool append_to_file,
+                         const bool collective)
     : file_name_(std::move(file_name)) {
   if (file_name_.size() - 3 != file_name_.find(".h5")) {
     ERROR("All HDF5 file names must end in '.h5'. The path and file name '"
@@ -39,14 +40,32 @@ H5File<Access_t>::H5File(std::string file_name, bool append_to_file)
                       "explicitly delete the file first using the file_system "
                       "library in SpECTRE or through your shell.");
   }
+  hid_t access_property_list = h5p_default();
+  if (collective) {
+#ifdef H5_HAVE_PARALLEL
+    access_property_list = H5Pcreate(h5p_file_access());
+    CHECK_H5(access_property_list, "Failed to create property list");
+    CHECK_H5(H5Pset_fapl_mpio(access_property_list, MPI_COMM_WORLD,
+                              MPI_INFO_NULL),
+             "Failed to set the MPI-IO driver");
+#else
+    ERROR("Cannot open the file '"
+          << file_name_
+          << "' collectively because the HDF5 library was built without "
+             "parallel support.");
+#endif
+  }
   file_id_ = file_exists
                  ? H5Fopen(file_name_.c_str(),
                            AccessType::ReadOnly == Access_t ? h5f_acc_rdonly()
                                                             : h5f_acc_rdwr(),
-                           h5p_default())
+                           access_property_list)
                  : H5Fcreate(file_name_.c_str(), h5f_acc_trunc(), h5p_default(),
-                             h5p_default());
+                             access_property_list);
   CHECK_H5(file_id_, "Failed to open file '" << file_name_ << "'");
+  if (collective) {
+    CHECK_H5(H5Pclose(access_property_list), "Failed to close property list");
+  }
   if (not file_exists) {
     insert_header();
   }
@@ -65,8 +65,13 @@ class H5File {
    * @param file_name the path to the file to open or create
    * @param append_to_file if true allow appending to the file, otherwise abort
    * the simulation if the file exists
+   * @param collective if true open the file with the MPI-IO driver on all
+   * processes of `MPI_COMM_WORLD`, which must all construct the H5File
+   * together. This requires an HDF5 library built with parallel support
+   * (`H5_HAVE_PARALLEL`).
    */
-  explicit H5File(std::string file_name, bool append_to_file = false);
+  explicit H5File(std::string file_name, bool append_to_file = false,
+                  bool collective = false);
 
   /// \cond HIDDEN_SYMBOLS
   ~H5File();
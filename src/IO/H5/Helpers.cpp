@@ -9,6 +9,7 @@
 #include <string>
 #include <type_traits>
 
+#include "ErrorHandling/Assert.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
@@ -59,6 +60,265 @@ void write_data(const hid_t group_id, const DataVector& data,
   CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
 }
 
+void create_data(const hid_t group_id, const std::vector<size_t>& extents,
+                 const std::string& name, const size_t chunk_size,
+                 const TensorOutputSettings& settings) noexcept {
+  const std::vector<hsize_t> dims(extents.begin(), extents.end());
+  const hid_t space_id = H5Screate_simple(dims.size(), dims.data(), nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t property_list_id = H5Pcreate(h5p_dataset_create());
+  CHECK_H5(property_list_id, "Failed to create property list");
+  if (chunk_size != 0) {
+    ASSERT(dims.size() == 1, "Only rank-1 datasets can be chunked, but '"
+                                 << name << "' has rank " << dims.size());
+    const hsize_t chunk_dims =
+        std::max(std::min(static_cast<hsize_t>(chunk_size), dims[0]),
+                 static_cast<hsize_t>(1));
+    CHECK_H5(H5Pset_chunk(property_list_id, 1, &chunk_dims),
+             "Failed to set chunk size");
+  }
+  if (settings.uses_filters()) {
+    // The filtered chunks are allocated when they are written, because
+    // their size is only known then
+    ASSERT(chunk_size != 0, "The dataset '" << name
+                                            << "' must be chunked to be "
+                                               "compressed.");
+    if (settings.shuffle()) {
+      CHECK_H5(H5Pset_shuffle(property_list_id), "Failed to set shuffle");
+    }
+    if (settings.deflate_level() > 0) {
+      if (UNLIKELY(H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0)) {
+        ERROR("The HDF5 library does not support the deflate compression "
+              "requested for the dataset '"
+              << name << "'.");
+      }
+      CHECK_H5(H5Pset_deflate(property_list_id,
+                              static_cast<unsigned>(settings.deflate_level())),
+               "Failed to set deflate level");
+    }
+  } else {
+    // Allocate the data now, so that writing it does not change the metadata
+    // of the file
+    CHECK_H5(H5Pset_alloc_time(property_list_id, H5D_ALLOC_TIME_EARLY),
+             "Failed to set allocation time");
+    CHECK_H5(H5Pset_fill_time(property_list_id, H5D_FILL_TIME_NEVER),
+             "Failed to set fill time");
+  }
+  const hid_t dataset_id = H5Dcreate2(
+      group_id, name.c_str(),
+      settings.single_precision() ? h5_type<float>() : h5_type<double>(),
+      space_id, h5p_default(), property_list_id, h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset '" << name << "'");
+  if (settings.rounds_mantissa()) {
+    write_to_attribute(dataset_id, "mantissa_bits",
+                       static_cast<unsigned int>(settings.mantissa_bits()));
+  }
+  CHECK_H5(H5Pclose(property_list_id), "Failed to close property list");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
+TensorOutputSettings read_output_settings(const hid_t group_id,
+                                          const std::string& name) noexcept {
+  const hid_t dataset_id = H5Dopen2(group_id, name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset '" << name << "'");
+  const hid_t type_id = H5Dget_type(dataset_id);
+  CHECK_H5(type_id, "Failed to get the type of dataset '" << name << "'");
+  const bool single_precision = H5Tget_size(type_id) == sizeof(float);
+  CHECK_H5(H5Tclose(type_id), "Failed to close type");
+
+  const hid_t property_list_id = H5Dget_create_plist(dataset_id);
+  CHECK_H5(property_list_id, "Failed to get property list");
+  const int number_of_filters = H5Pget_nfilters(property_list_id);
+  CHECK_H5(number_of_filters, "Failed to get the number of filters");
+  size_t deflate_level = 0;
+  bool shuffle = false;
+  for (int i = 0; i < number_of_filters; ++i) {
+    unsigned int flags = 0;
+    size_t number_of_values = 1;
+    unsigned int values[1] = {0};
+    unsigned int filter_config = 0;
+    const H5Z_filter_t filter =
+        H5Pget_filter2(property_list_id, static_cast<unsigned>(i), &flags,
+                       &number_of_values, values, 0, nullptr, &filter_config);
+    CHECK_H5(filter, "Failed to get filter " << i);
+    if (filter == H5Z_FILTER_DEFLATE) {
+      deflate_level = values[0];
+    } else if (filter == H5Z_FILTER_SHUFFLE) {
+      shuffle = true;
+    }
+  }
+  CHECK_H5(H5Pclose(property_list_id), "Failed to close property list");
+
+  size_t mantissa_bits = TensorOutputSettings::MantissaBits::upper_bound();
+  const htri_t has_mantissa_bits = H5Aexists(dataset_id, "mantissa_bits");
+  CHECK_H5(has_mantissa_bits, "Failed to check for attribute");
+  if (has_mantissa_bits > 0) {
+    mantissa_bits =
+        read_value_attribute<unsigned int>(dataset_id, "mantissa_bits");
+  }
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  return {deflate_level, shuffle, single_precision, mantissa_bits};
+}
+
+void write_to_existing_data(const hid_t group_id, const DataVector& data,
+                            const std::string& name, const size_t offset,
+                            const bool collective) noexcept {
+  const hid_t dataset_id = H5Dopen2(group_id, name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset '" << name << "'");
+  const hid_t file_space_id = H5Dget_space(dataset_id);
+  CHECK_H5(file_space_id, "Failed to open dataspace");
+  const hssize_t number_of_points = H5Sget_simple_extent_npoints(file_space_id);
+  CHECK_H5(number_of_points, "Failed to get number of points");
+  const int rank = H5Sget_simple_extent_ndims(file_space_id);
+  CHECK_H5(rank, "Failed to get the rank of dataset '" << name << "'");
+  const bool data_fits =
+      rank == 1
+          ? offset + data.size() <= static_cast<size_t>(number_of_points)
+          : offset == 0 and
+                data.size() == static_cast<size_t>(number_of_points);
+  if (UNLIKELY(not data_fits)) {
+    ERROR("The dataset '" << name << "' holds " << number_of_points
+                          << " points but the data to write has "
+                          << data.size() << " points at offset " << offset
+                          << ".");
+  }
+  hid_t transfer_property_list = h5p_default();
+  if (collective) {
+#ifdef H5_HAVE_PARALLEL
+    transfer_property_list = H5Pcreate(h5p_dataset_xfer());
+    CHECK_H5(transfer_property_list, "Failed to create property list");
+    CHECK_H5(H5Pset_dxpl_mpio(transfer_property_list, H5FD_MPIO_COLLECTIVE),
+             "Failed to set collective transfer");
+#else
+    ERROR("Cannot write the dataset '"
+          << name
+          << "' collectively because the HDF5 library was built without "
+             "parallel support.");
+#endif
+  }
+  if (rank == 1) {
+    const hsize_t start = offset;
+    const hsize_t count = data.size();
+    const hid_t memory_space_id = H5Screate_simple(1, &count, nullptr);
+    CHECK_H5(memory_space_id, "Failed to create dataspace");
+    if (count == 0) {
+      // A process without data still takes part in a collective write
+      CHECK_H5(H5Sselect_none(file_space_id),
+               "Failed to select nothing in dataset '" << name << "'");
+      CHECK_H5(H5Sselect_none(memory_space_id),
+               "Failed to select nothing in dataspace");
+    } else {
+      CHECK_H5(H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, &start,
+                                   nullptr, &count, nullptr),
+               "Failed to select hyperslab in dataset '" << name << "'");
+    }
+    // HDF5 rejects a null buffer even if nothing is selected
+    const double no_data = 0.0;
+    CHECK_H5(H5Dwrite(dataset_id, h5_type<double>(), memory_space_id,
+                      file_space_id, transfer_property_list,
+                      count == 0 ? static_cast<const void*>(&no_data)
+                                 : static_cast<const void*>(data.data())),
+             "Failed to write data to dataset '" << name << "'");
+    CHECK_H5(H5Sclose(memory_space_id), "Failed to close dataspace");
+  } else {
+    CHECK_H5(H5Dwrite(dataset_id, h5_type<double>(), h5s_all(), h5s_all(),
+                      transfer_property_list,
+                      static_cast<const void*>(data.data())),
+             "Failed to write data to dataset '" << name << "'");
+  }
+  if (collective) {
+    CHECK_H5(H5Pclose(transfer_property_list), "Failed to close property list");
+  }
+  CHECK_H5(H5Sclose(file_space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
+template <typename T>
+void write_rank1_data(const hid_t group_id, const std::vector<T>& data,
+                      const std::string& name) noexcept {
+  const hsize_t size = data.size();
+  const hid_t space_id = H5Screate_simple(1, &size, nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t dataset_id =
+      H5Dcreate2(group_id, name.c_str(), h5_type<T>(), space_id, h5p_default(),
+                 h5p_default(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset '" << name << "'");
+  CHECK_H5(H5Dwrite(dataset_id, h5_type<T>(), h5s_all(), h5s_all(),
+                    h5p_default(), static_cast<const void*>(data.data())),
+           "Failed to write dataset '" << name << "'");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+}
+
+template <>
+void write_rank1_data<std::string>(const hid_t group_id,
+                                   const std::vector<std::string>& data,
+                                   const std::string& name) noexcept {
+  const hid_t type_id = h5_type<std::string>();
+  const hsize_t size = data.size();
+  const hid_t space_id = H5Screate_simple(1, &size, nullptr);
+  CHECK_H5(space_id, "Failed to create dataspace");
+  const hid_t dataset_id =
+      H5Dcreate2(group_id, name.c_str(), type_id, space_id, h5p_default(),
+                 h5p_default(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to create dataset '" << name << "'");
+  // Variable length strings are written from an array of pointers
+  std::vector<const char*> string_pointers(data.size());
+  std::transform(data.begin(), data.end(), string_pointers.begin(),
+                 [](const auto& t) { return t.c_str(); });
+  CHECK_H5(H5Dwrite(dataset_id, type_id, h5s_all(), h5s_all(), h5p_default(),
+                    string_pointers.data()),
+           "Failed to write dataset '" << name << "'");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  CHECK_H5(H5Tclose(type_id), "Failed to close type_id");
+}
+
+template <typename T>
+std::vector<T> read_rank1_data(const hid_t group_id,
+                               const std::string& name) noexcept {
+  const hid_t dataset_id = H5Dopen2(group_id, name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset '" << name << "'");
+  const hid_t space_id = H5Dget_space(dataset_id);
+  CHECK_H5(space_id, "Failed to open dataspace");
+  const hssize_t number_of_points = H5Sget_simple_extent_npoints(space_id);
+  CHECK_H5(number_of_points, "Failed to get number of points");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  std::vector<T> data(static_cast<size_t>(number_of_points));
+  CHECK_H5(H5Dread(dataset_id, h5_type<T>(), h5s_all(), h5s_all(),
+                   h5p_default(), static_cast<void*>(data.data())),
+           "Failed to read dataset '" << name << "'");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  return data;
+}
+
+template <>
+std::vector<std::string> read_rank1_data<std::string>(
+    const hid_t group_id, const std::string& name) noexcept {
+  const hid_t dataset_id = H5Dopen2(group_id, name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "Failed to open dataset '" << name << "'");
+  const hid_t space_id = H5Dget_space(dataset_id);
+  CHECK_H5(space_id, "Failed to open dataspace");
+  const hssize_t number_of_points = H5Sget_simple_extent_npoints(space_id);
+  CHECK_H5(number_of_points, "Failed to get number of points");
+  std::vector<char*> temp(static_cast<size_t>(number_of_points));
+  const hid_t memtype = h5_type<std::string>();
+  CHECK_H5(H5Dread(dataset_id, memtype, h5s_all(), h5s_all(), h5p_default(),
+                   static_cast<void*>(temp.data())),
+           "Failed to read dataset '" << name << "'");
+  std::vector<std::string> result(temp.size());
+  std::transform(temp.begin(), temp.end(), result.begin(),
+                 [](const auto& t) { return std::string(t); });
+  // Clean up memory from variable length arrays and close everything
+  CHECK_H5(H5Dvlen_reclaim(memtype, space_id, h5p_default(), temp.data()),
+           "Failed H5Dvlen_reclaim");
+  CHECK_H5(H5Tclose(memtype), "Failed to close memtype");
+  CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  return result;
+}
+
 template <size_t Dim>
 void write_extents(const hid_t group_id, const Index<Dim>& extents,
                    const std::string& name) {
@@ -77,17 +337,18 @@ void write_extents(const hid_t group_id, const Index<Dim>& extents,
   CHECK_H5(H5Aclose(att_id), "Failed to close attribute");
 }
 
+template <typename T>
 void write_connectivity(const hid_t group_id,
-                        const std::vector<int>& connectivity) noexcept {
+                        const std::vector<T>& connectivity) noexcept {
   const hsize_t size = connectivity.size();
   const hid_t space_id = H5Screate_simple(1, &size, nullptr);
   CHECK_H5(space_id, "Failed to create dataspace");
   const hid_t dataset_id =
-      H5Dcreate2(group_id, "connectivity", h5_type<int>(), space_id,
+      H5Dcreate2(group_id, "connectivity", h5_type<T>(), space_id,
                  h5p_default(), h5p_default(), h5p_default());
   CHECK_H5(dataset_id, "Failed to create dataset");
   CHECK_H5(
-      H5Dwrite(dataset_id, h5_type<int>(), h5s_all(), h5s_all(), h5p_default(),
+      H5Dwrite(dataset_id, h5_type<T>(), h5s_all(), h5s_all(), h5p_default(),
                static_cast<const void*>(connectivity.data())),
       "Failed to write connectivity");
   CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
@@ -359,6 +620,35 @@ DataVector read_data(const hid_t group_id, const std::string& dataset_name) {
   return data;
 }
 
+DataVector read_data(const hid_t group_id, const std::string& dataset_name,
+                     const size_t offset,
+                     const size_t number_of_points) noexcept {
+  const hid_t dataset_id =
+      H5Dopen2(group_id, dataset_name.c_str(), h5p_default());
+  CHECK_H5(dataset_id, "could not open dataset '" << dataset_name << "'");
+  const hid_t file_space_id = H5Dget_space(dataset_id);
+  CHECK_H5(file_space_id, "Failed to open dataspace");
+  const hsize_t start = offset;
+  const hsize_t count = number_of_points;
+  CHECK_H5(H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, &start, nullptr,
+                               &count, nullptr),
+           "Failed to select points " << offset << " to "
+                                      << offset + number_of_points
+                                      << " of dataset '" << dataset_name
+                                      << "'");
+  const hid_t memory_space_id = H5Screate_simple(1, &count, nullptr);
+  CHECK_H5(memory_space_id, "Failed to create dataspace");
+  DataVector data(number_of_points);
+  CHECK_H5(H5Dread(dataset_id, h5_type<double>(), memory_space_id,
+                   file_space_id, h5p_default(),
+                   static_cast<void*>(data.data())),
+           "Failed to read data");
+  CHECK_H5(H5Sclose(memory_space_id), "Failed to close dataspace");
+  CHECK_H5(H5Sclose(file_space_id), "Failed to close dataspace");
+  CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  return data;
+}
+
 template <size_t Dim>
 Index<Dim> read_extents(const hid_t group_id, const std::string& extents_name) {
   const hid_t attr_id = H5Aopen(group_id, extents_name.c_str(), h5p_default());
@@ -410,6 +700,20 @@ template Index<3> read_extents<3>(const hid_t group_id,
 GENERATE_INSTANTIATIONS(INSTANTIATE, (double, unsigned int, unsigned long, int))
 
 #undef INSTANTIATE
+
+#define INSTANTIATE_DATA(_, DATA)                                    \
+  template void write_rank1_data<TYPE(DATA)>(                        \
+      const hid_t group_id, const std::vector<TYPE(DATA)>& data,     \
+      const std::string& name) noexcept;                             \
+  template std::vector<TYPE(DATA)> read_rank1_data<TYPE(DATA)>(      \
+      const hid_t group_id, const std::string& name) noexcept;     \
+  template void write_connectivity<TYPE(DATA)>(                      \
+      const hid_t group_id,                                          \
+      const std::vector<TYPE(DATA)>& connectivity) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE_DATA, (unsigned long, int, long))
+
+#undef INSTANTIATE_DATA
 #undef TYPE
 }  // namespace h5
 
@@ -14,6 +14,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
+#include "IO/H5/OutputSettings.hpp"
 
 namespace h5 {
 /*!
@@ -32,6 +33,69 @@ void write_data(hid_t group_id, const DataVector& data,
                 const std::vector<size_t>& extents,
                 const std::string& name = "scalar") noexcept;
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Create a dataset of doubles named `name` with the `extents` in the
+ * group `group_id` without writing any data to it.
+ *
+ * The storage of the dataset is allocated when it is created and no fill
+ * value is written, so that the data can later be written by
+ * `write_to_existing_data` without changing the metadata of the file. A
+ * nonzero `chunk_size` stores a rank-1 dataset in chunks of that many points
+ * instead of contiguously.
+ *
+ * The `settings` select the type of the values on disk and the compression
+ * filters. Datasets with filters must be chunked, and their chunks are only
+ * allocated when they are written. The number of mantissa bits is stored as
+ * the attribute `mantissa_bits` of the dataset if values are rounded, but the
+ * values have to be rounded by the caller before they are written.
+ */
+void create_data(
+    hid_t group_id, const std::vector<size_t>& extents, const std::string& name,
+    size_t chunk_size = 0,
+    const TensorOutputSettings& settings = TensorOutputSettings{}) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief The TensorOutputSettings of the dataset named `name` in the group
+ * `group_id`, as read from its type, filters and attributes
+ */
+TensorOutputSettings read_output_settings(hid_t group_id,
+                                          const std::string& name) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Write a DataVector to the existing dataset named `name` in the group
+ * `group_id`, starting at the point `offset` of a rank-1 dataset
+ *
+ * With `collective` the data is written with a collective MPI-IO transfer,
+ * so all processes that opened the file collectively must call this for the
+ * same dataset, with an empty `data` if they have nothing to write.
+ *
+ * \requires the dataset holds at least `offset + data.size()` points, and
+ * exactly `data.size()` points if it is not rank 1
+ */
+void write_to_existing_data(hid_t group_id, const DataVector& data,
+                            const std::string& name, size_t offset = 0,
+                            bool collective = false) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Write the vector `data` as a rank-1 dataset named `name` in the group
+ * `group_id`
+ */
+template <typename T>
+void write_rank1_data(hid_t group_id, const std::vector<T>& data,
+                      const std::string& name) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Read the rank-1 dataset `name` of type `T` from the group `group_id`
+ */
+template <typename T>
+std::vector<T> read_rank1_data(hid_t group_id,
+                               const std::string& name) noexcept;
+
 /*!
  * \ingroup HDF5Group
  * \brief Write the extents as an attribute named `name` to the group
@@ -83,9 +147,13 @@ std::vector<std::string> get_attribute_names(hid_t file_id,
 /*!
  * \ingroup HDF5Group
  * \brief Write the connectivity into the group in the H5 file
+ *
+ * The connectivity of all grids of a contiguous volume observation indexes
+ * more points than an `int` can hold, so it is written as `long`.
  */
+template <typename T>
 void write_connectivity(hid_t group_id,
-                        const std::vector<int>& connectivity) noexcept;
+                        const std::vector<T>& connectivity) noexcept;
 
 /*!
  * \ingroup HDF5Group
@@ -117,6 +185,14 @@ bool contains_attribute(hid_t file_id, const std::string& group_name,
  */
 DataVector read_data(hid_t group_id, const std::string& dataset_name);
 
+/*!
+ * \ingroup HDF5Group
+ * \brief Read `number_of_points` points starting at `offset` from a rank-1
+ * dataset in a group
+ */
+DataVector read_data(hid_t group_id, const std::string& dataset_name,
+                     size_t offset, size_t number_of_points) noexcept;
+
 /*!
  * \ingroup HDF5Group
  * \brief Read the HDF5 attribute representing extents from a group
@@ -0,0 +1,142 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/OutputSettings.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+namespace h5 {
+namespace {
+constexpr size_t double_mantissa_bits = 52;
+constexpr size_t float_mantissa_bits = 23;
+}  // namespace
+
+TensorOutputSettings::TensorOutputSettings(
+    const size_t deflate_level, const bool shuffle, const bool single_precision,
+    const size_t mantissa_bits) noexcept
+    : deflate_level_(deflate_level),
+      shuffle_(shuffle),
+      single_precision_(single_precision),
+      mantissa_bits_(mantissa_bits) {}
+
+size_t TensorOutputSettings::mantissa_bits() const noexcept {
+  return single_precision_ ? std::min(mantissa_bits_, float_mantissa_bits)
+                           : mantissa_bits_;
+}
+
+bool TensorOutputSettings::rounds_mantissa() const noexcept {
+  return mantissa_bits() <
+         (single_precision_ ? float_mantissa_bits : double_mantissa_bits);
+}
+
+void TensorOutputSettings::pup(PUP::er& p) noexcept {
+  p | deflate_level_;
+  p | shuffle_;
+  p | single_precision_;
+  p | mantissa_bits_;
+}
+
+bool operator==(const TensorOutputSettings& lhs,
+                const TensorOutputSettings& rhs) noexcept {
+  return lhs.deflate_level() == rhs.deflate_level() and
+         lhs.shuffle() == rhs.shuffle() and
+         lhs.single_precision() == rhs.single_precision() and
+         lhs.mantissa_bits() == rhs.mantissa_bits();
+}
+
+bool operator!=(const TensorOutputSettings& lhs,
+                const TensorOutputSettings& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const TensorOutputSettings& settings) noexcept {
+  return os << "(DeflateLevel: " << settings.deflate_level()
+            << ", Shuffle: " << std::boolalpha << settings.shuffle()
+            << ", SinglePrecision: " << settings.single_precision()
+            << ", MantissaBits: " << settings.mantissa_bits() << ")";
+}
+
+VolumeOutputSettings::VolumeOutputSettings(
+    TensorOutputSettings default_settings,
+    std::unordered_map<std::string, TensorOutputSettings>
+        tensor_settings) noexcept
+    : default_settings_(std::move(default_settings)),
+      tensor_settings_(std::move(tensor_settings)) {}
+
+const TensorOutputSettings& VolumeOutputSettings::operator()(
+    const std::string& component_name) const noexcept {
+  // The tensor name is the component name without the component indices
+  // after the last underscore, unless the tensor itself is listed.
+  const auto exact_match = tensor_settings_.find(component_name);
+  if (exact_match != tensor_settings_.end()) {
+    return exact_match->second;
+  }
+  const auto underscore = component_name.find_last_of('_');
+  if (underscore != std::string::npos) {
+    const auto tensor_match =
+        tensor_settings_.find(component_name.substr(0, underscore));
+    if (tensor_match != tensor_settings_.end()) {
+      return tensor_match->second;
+    }
+  }
+  return default_settings_;
+}
+
+void VolumeOutputSettings::pup(PUP::er& p) noexcept {
+  p | default_settings_;
+  p | tensor_settings_;
+}
+
+bool operator==(const VolumeOutputSettings& lhs,
+                const VolumeOutputSettings& rhs) noexcept {
+  return lhs.default_settings() == rhs.default_settings() and
+         lhs.tensor_settings() == rhs.tensor_settings();
+}
+
+bool operator!=(const VolumeOutputSettings& lhs,
+                const VolumeOutputSettings& rhs) noexcept {
+  return not(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream& os,
+                         const VolumeOutputSettings& settings) noexcept {
+  // The operators of h5 hide the one for the map in the global namespace
+  using ::operator<<;
+  return os << "(Default: " << settings.default_settings()
+            << ", Tensors: " << settings.tensor_settings() << ")";
+}
+
+void round_mantissa(const gsl::not_null<DataVector*> data,
+                    const size_t mantissa_bits) noexcept {
+  if (mantissa_bits >= double_mantissa_bits) {
+    return;
+  }
+  const size_t dropped_bits = double_mantissa_bits - mantissa_bits;
+  const uint64_t half = uint64_t{1} << (dropped_bits - 1);
+  const uint64_t mask = ~((uint64_t{1} << dropped_bits) - 1);
+  constexpr uint64_t exponent_mask = uint64_t{0x7ff} << double_mantissa_bits;
+  for (double& value : *data) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // Infinities and NaNs are left unchanged
+    if ((bits & exponent_mask) == exponent_mask) {
+      continue;
+    }
+    // Adding half of the last kept bit rounds the magnitude to the nearest
+    // representable value, carrying into the exponent if needed
+    bits = (bits + half) & mask;
+    std::memcpy(&value, &bits, sizeof(bits));
+  }
+}
+}  // namespace h5
@@ -0,0 +1,185 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines classes h5::TensorOutputSettings and h5::VolumeOutputSettings
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+
+#include "Options/Options.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+namespace PUP {
+class er;
+}  // namespace PUP
+namespace gsl {
+template <class T>
+class not_null;
+}  // namespace gsl
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief How the values of a tensor component are stored in a volume file
+ *
+ * The lossless settings compress the datasets with the deflate filter,
+ * optionally after shuffling the bytes of the values so that bytes of equal
+ * significance are adjacent, which usually compresses much better. The lossy
+ * settings store the values as single precision floats and round the
+ * mantissa of the values to `mantissa_bits` bits, which zeros the trailing
+ * bits so that they compress well. A single precision value keeps at most 23
+ * bits of its mantissa, and a double precision value 52.
+ *
+ * The settings are stored with the datasets, so the values are read back as
+ * double precision values without knowing the settings.
+ */
+class TensorOutputSettings {
+ public:
+  struct DeflateLevel {
+    using type = size_t;
+    static constexpr OptionString help = {
+        "Level of the deflate compression, where 0 disables it"};
+    static type default_value() noexcept { return 0; }
+    static type upper_bound() noexcept { return 9; }
+  };
+
+  struct Shuffle {
+    using type = bool;
+    static constexpr OptionString help = {
+        "Shuffle the bytes of the values before compressing them"};
+    static type default_value() noexcept { return false; }
+  };
+
+  struct SinglePrecision {
+    using type = bool;
+    static constexpr OptionString help = {
+        "Store the values as single precision floats"};
+    static type default_value() noexcept { return false; }
+  };
+
+  struct MantissaBits {
+    using type = size_t;
+    static constexpr OptionString help = {
+        "Number of bits of the mantissa that are kept"};
+    static type default_value() noexcept { return 52; }
+    static type upper_bound() noexcept { return 52; }
+  };
+
+  using options = tmpl::list<DeflateLevel, Shuffle, SinglePrecision,
+                             MantissaBits>;
+  static constexpr OptionString help = {
+      "How the values of a tensor are stored in the volume data file"};
+
+  TensorOutputSettings() = default;
+  TensorOutputSettings(size_t deflate_level, bool shuffle,
+                       bool single_precision, size_t mantissa_bits) noexcept;
+
+  size_t deflate_level() const noexcept { return deflate_level_; }
+  bool shuffle() const noexcept { return shuffle_; }
+  bool single_precision() const noexcept { return single_precision_; }
+
+  /// The number of bits of the mantissa that are kept, which is at most 23
+  /// for single precision
+  size_t mantissa_bits() const noexcept;
+
+  /// Whether the values are rounded to fewer mantissa bits than their type
+  /// holds
+  bool rounds_mantissa() const noexcept;
+
+  /// Whether the dataset is stored with HDF5 filters, which requires it to be
+  /// chunked
+  bool uses_filters() const noexcept { return deflate_level_ > 0 or shuffle_; }
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  size_t deflate_level_{0};
+  bool shuffle_{false};
+  bool single_precision_{false};
+  size_t mantissa_bits_{52};
+};
+
+bool operator==(const TensorOutputSettings& lhs,
+                const TensorOutputSettings& rhs) noexcept;
+bool operator!=(const TensorOutputSettings& lhs,
+                const TensorOutputSettings& rhs) noexcept;
+std::ostream& operator<<(std::ostream& os,
+                         const TensorOutputSettings& settings) noexcept;
+
+/*!
+ * \ingroup HDF5Group
+ * \brief The TensorOutputSettings of the tensor components in a volume file
+ *
+ * The settings of a tensor component are those of its tensor in `Tensors`,
+ * where a tensor `T` matches the component `T` and the components `T_x`,
+ * `T_xy`, etc. Components whose tensor is not listed use the `Default`
+ * settings.
+ */
+class VolumeOutputSettings {
+ public:
+  struct Default {
+    using type = TensorOutputSettings;
+    static constexpr OptionString help = {
+        "Settings of the tensors that are not listed in Tensors"};
+    static type default_value() noexcept { return {}; }
+  };
+
+  struct Tensors {
+    using type = std::unordered_map<std::string, TensorOutputSettings>;
+    static constexpr OptionString help = {"Settings of tensors by name"};
+    static type default_value() noexcept { return {}; }
+  };
+
+  using options = tmpl::list<Default, Tensors>;
+  static constexpr OptionString help = {
+      "How the values of the tensors are stored in the volume data file"};
+
+  VolumeOutputSettings() = default;
+  VolumeOutputSettings(
+      TensorOutputSettings default_settings,
+      std::unordered_map<std::string, TensorOutputSettings>
+          tensor_settings) noexcept;
+
+  /// The settings of the tensor component `component_name`, given without
+  /// the name of its grid
+  const TensorOutputSettings& operator()(
+      const std::string& component_name) const noexcept;
+
+  const TensorOutputSettings& default_settings() const noexcept {
+    return default_settings_;
+  }
+  const std::unordered_map<std::string, TensorOutputSettings>&
+  tensor_settings() const noexcept {
+    return tensor_settings_;
+  }
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  TensorOutputSettings default_settings_{};
+  std::unordered_map<std::string, TensorOutputSettings> tensor_settings_{};
+};
+
+bool operator==(const VolumeOutputSettings& lhs,
+                const VolumeOutputSettings& rhs) noexcept;
+bool operator!=(const VolumeOutputSettings& lhs,
+                const VolumeOutputSettings& rhs) noexcept;
+std::ostream& operator<<(std::ostream& os,
+                         const VolumeOutputSettings& settings) noexcept;
+
+/// \ingroup HDF5Group
+/// Round the mantissa of the finite values in `data` to the nearest value
+/// with `mantissa_bits` bits
+void round_mantissa(gsl::not_null<DataVector*> data,
+                    size_t mantissa_bits) noexcept;
+}  // namespace h5
@@ -32,6 +32,10 @@ SPECTRE_ALWAYS_INLINE hid_t h5_type<double>() {
   return H5T_NATIVE_DOUBLE;  // LCOV_EXCL_LINE
 }
 template <>
+SPECTRE_ALWAYS_INLINE hid_t h5_type<float>() {
+  return H5T_NATIVE_FLOAT;  // LCOV_EXCL_LINE
+}
+template <>
 SPECTRE_ALWAYS_INLINE hid_t h5_type<int>() {
   return H5T_NATIVE_INT;  // LCOV_EXCL_LINE
 }
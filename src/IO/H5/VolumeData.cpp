@@ -5,9 +5,14 @@
 
 #include <algorithm>
 #include <boost/iterator/transform_iterator.hpp>
+#include <cstddef>
+#include <functional>
 #include <hdf5.h>
+#include <iterator>
 #include <memory>
+#include <numeric>
 #include <ostream>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -15,12 +20,55 @@
 #include "ErrorHandling/Error.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/CheckH5.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
 #include "IO/H5/Version.hpp"
+#include "IO/H5/Wrappers.hpp"
+#include "Utilities/Gsl.hpp"
 
 /// \cond HIDDEN_SYMBOLS
 namespace h5 {
+namespace {
+// The format version of observations written contiguously
+constexpr uint32_t contiguous_format_version = 2;
+// The number of points per chunk of the contiguous tensor component datasets
+constexpr size_t contiguous_chunk_size = 65536;
+
+// Split a tensor component name of the form 'GRID_NAME/COMPONENT_NAME' into
+// the grid name and the component name
+std::pair<std::string, std::string> split_component_name(
+    const std::string& tensor_component_name) noexcept {
+  const auto separator = tensor_component_name.find_last_of('/');
+  ASSERT(separator != std::string::npos,
+         "The expected format of the tensor component names is "
+         "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
+             << tensor_component_name << "'.");
+  return {tensor_component_name.substr(0, separator),
+          tensor_component_name.substr(separator + 1)};
+}
+
+void write_extents_and_connectivity(
+    const hid_t spatial_group_id, const std::vector<size_t>& extents) noexcept {
+  if (not contains_attribute(spatial_group_id, "", "extents")) {
+    h5::write_to_attribute(spatial_group_id, "extents", extents);
+  }
+  if (not h5::contains_dataset_or_group(spatial_group_id, "",
+                                        "connectivity")) {
+    const std::vector<int> connectivity = [&extents]() noexcept {
+      std::vector<int> local_connectivity;
+      for (const auto& cell : vis::detail::compute_cells(extents)) {
+        for (const auto& bounding_indices : cell.bounding_indices) {
+          local_connectivity.emplace_back(bounding_indices);
+        }
+      }
+      return local_connectivity;
+    }();
+    h5::write_connectivity(spatial_group_id, connectivity);
+  }
+}
+}  // namespace
+
 VolumeData::VolumeData(const bool exists, detail::OpenGroup&& group,
                        const hid_t /*location*/, const std::string& name,
                        const uint32_t version) noexcept
@@ -64,46 +112,19 @@ void VolumeData::insert_tensor_data(
     h5::write_to_attribute(observation_group.id(), "observation_value",
                            observation_value);
   }
-  const auto& first_tensor_name =
-      extents_and_tensors.tensor_components.front().name;
-  ASSERT(first_tensor_name.find_last_of('/') != std::string::npos,
-         "The expected format of the tensor component names is "
-         "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
-             << first_tensor_name << "'.");
   const auto spatial_name =
-      first_tensor_name.substr(0, first_tensor_name.find_last_of('/'));
+      split_component_name(extents_and_tensors.tensor_components.front().name)
+          .first;
   detail::OpenGroup spatial_group(observation_group.id(), spatial_name,
                                   AccessType::ReadWrite);
 
-  // Write extents.
   const auto& extents = extents_and_tensors.extents;
-  if (not contains_attribute(spatial_group.id(), "", "extents")) {
-    h5::write_to_attribute(spatial_group.id(), "extents", extents);
-  }
-
-  // Write the connectivity.
-  if (not h5::contains_dataset_or_group(spatial_group.id(), "",
-                                        "connectivity")) {
-    const std::vector<int> connectivity = [&extents]() noexcept {
-      std::vector<int> local_connectivity;
-      for (const auto& cell : vis::detail::compute_cells(extents)) {
-        for (const auto& bounding_indices : cell.bounding_indices) {
-          local_connectivity.emplace_back(bounding_indices);
-        }
-      }
-      return local_connectivity;
-    }();
-    h5::write_connectivity(spatial_group.id(), connectivity);
-  }
+  write_extents_and_connectivity(spatial_group.id(), extents);
 
   // Write the tensor components.
   for (const auto& tensor_component : extents_and_tensors.tensor_components) {
-    ASSERT(tensor_component.name.find_last_of('/') != std::string::npos,
-           "The expected format of the tensor component names is "
-           "'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in '"
-               << tensor_component.name << "'.");
-    const auto component_name = tensor_component.name.substr(
-        tensor_component.name.find_last_of('/') + 1);
+    const auto component_name =
+        split_component_name(tensor_component.name).second;
     if (not h5::contains_dataset_or_group(spatial_group.id(), "",
                                           component_name)) {
       h5::write_data(spatial_group.id(), tensor_component.data, extents,
@@ -117,6 +138,198 @@ void VolumeData::insert_tensor_data(
   }
 }
 
+void VolumeData::write_volume_data(
+    const size_t observation_id, const double observation_value,
+    const std::vector<ExtentsAndTensorVolumeData>& grids,
+    const VolumeOutputSettings& settings) noexcept {
+  std::vector<std::pair<std::vector<size_t>, std::vector<std::string>>>
+      layout{};
+  layout.reserve(grids.size());
+  for (const auto& grid : grids) {
+    std::vector<std::string> component_names{};
+    component_names.reserve(grid.tensor_components.size());
+    for (const auto& tensor_component : grid.tensor_components) {
+      component_names.push_back(tensor_component.name);
+    }
+    layout.emplace_back(grid.extents, std::move(component_names));
+  }
+  create_contiguous_datasets(observation_id, observation_value, layout,
+                             settings);
+  write_contiguous_data(observation_id, 0, grids, settings);
+}
+
+void VolumeData::create_contiguous_datasets(
+    const size_t observation_id, const double observation_value,
+    const std::vector<std::pair<std::vector<size_t>, std::vector<std::string>>>&
+        layout,
+    const VolumeOutputSettings& settings) noexcept {
+  ASSERT(not layout.empty(), "Cannot write an observation without grids.");
+  const std::string path = "ObservationId" + std::to_string(observation_id);
+  // Merge the grids already written at this observation, which are moved
+  // behind the new grids
+  std::vector<ExtentsAndTensorVolumeData> existing_grids{};
+  double merged_observation_value = observation_value;
+  if (h5::contains_dataset_or_group(volume_file_root_group_.id(), "", path)) {
+    if (UNLIKELY(get_format_version(observation_id) !=
+                 contiguous_format_version)) {
+      ERROR("Cannot merge grids into the observation '"
+            << path << "' in HDF5 file in group '" << name_
+            << "', which is not in the contiguous format.");
+    }
+    existing_grids = read_contiguous_grids(observation_id);
+    merged_observation_value = get_observation_value(observation_id);
+    CHECK_H5(H5Ldelete(volume_file_root_group_.id(), path.c_str(),
+                       h5p_default()),
+             "Failed to delete the observation '" << path << "'");
+  }
+  auto merged_layout = layout;
+  for (const auto& grid : existing_grids) {
+    const auto grid_name =
+        split_component_name(grid.tensor_components.front().name).first;
+    if (UNLIKELY(std::any_of(
+            layout.begin(), layout.end(),
+            [&grid_name](const auto& grid_layout) noexcept {
+              return split_component_name(grid_layout.second.front()).first ==
+                     grid_name;
+            }))) {
+      ERROR("Trying to write the grid '"
+            << grid_name << "' which already exists in HDF5 file in group '"
+            << name_ << '/' << path << "'.");
+    }
+    std::vector<std::string> component_names{};
+    component_names.reserve(grid.tensor_components.size());
+    for (const auto& tensor_component : grid.tensor_components) {
+      component_names.push_back(tensor_component.name);
+    }
+    merged_layout.emplace_back(grid.extents, std::move(component_names));
+  }
+
+  grid_table_valid_ = false;
+  detail::OpenGroup observation_group(volume_file_root_group_.id(), path,
+                                      AccessType::ReadWrite);
+  h5::write_to_attribute(observation_group.id(), "observation_value",
+                         merged_observation_value);
+  h5::write_to_attribute(observation_group.id(), "format_version",
+                         contiguous_format_version);
+
+  // The names of the tensor components without the grid name, which must be
+  // the same for all grids
+  std::vector<std::string> component_names{};
+  for (const auto& tensor_component_name : merged_layout.front().second) {
+    component_names.push_back(
+        split_component_name(tensor_component_name).second);
+  }
+  const auto sorted = [](std::vector<std::string> names) noexcept {
+    std::sort(names.begin(), names.end());
+    return names;
+  };
+  const auto sorted_component_names = sorted(component_names);
+  const size_t dimension = merged_layout.front().first.size();
+
+  std::vector<std::string> grid_names{};
+  std::vector<size_t> extents{};
+  std::vector<size_t> offsets{};
+  std::vector<long> connectivity{};
+  grid_names.reserve(merged_layout.size());
+  extents.reserve(merged_layout.size() * dimension);
+  offsets.reserve(merged_layout.size());
+  size_t number_of_points = 0;
+  for (const auto& grid_layout : merged_layout) {
+    const auto& grid_extents = grid_layout.first;
+    std::vector<std::string> grid_component_names{};
+    for (const auto& tensor_component_name : grid_layout.second) {
+      grid_component_names.push_back(
+          split_component_name(tensor_component_name).second);
+    }
+    grid_names.push_back(
+        split_component_name(grid_layout.second.front()).first);
+    if (UNLIKELY(grid_extents.size() != dimension or
+                 sorted(std::move(grid_component_names)) !=
+                     sorted_component_names)) {
+      ERROR("All grids in the observation '"
+            << path << "' must have the same dimension and tensor components, "
+            << "but the grid '" << grid_names.back() << "' differs from '"
+            << grid_names.front() << "'.");
+    }
+    extents.insert(extents.end(), grid_extents.begin(), grid_extents.end());
+    offsets.push_back(number_of_points);
+    for (const auto& cell : vis::detail::compute_cells(grid_extents)) {
+      for (const auto& bounding_indices : cell.bounding_indices) {
+        connectivity.push_back(static_cast<long>(number_of_points) +
+                               static_cast<long>(bounding_indices));
+      }
+    }
+    number_of_points += std::accumulate(grid_extents.begin(),
+                                        grid_extents.end(), size_t{1},
+                                        std::multiplies<size_t>{});
+  }
+  h5::write_rank1_data(observation_group.id(), grid_names, "grid_names");
+  h5::write_rank1_data(observation_group.id(), extents, "extents");
+  h5::write_rank1_data(observation_group.id(), offsets, "offsets");
+  h5::write_connectivity(observation_group.id(), connectivity);
+  h5::write_to_attribute(observation_group.id(), "tensor_components",
+                         component_names);
+  for (const auto& component_name : component_names) {
+    h5::create_data(observation_group.id(), {number_of_points},
+                    component_name, contiguous_chunk_size,
+                    settings(component_name));
+  }
+  if (not existing_grids.empty()) {
+    write_contiguous_data(observation_id, offsets[layout.size()],
+                          existing_grids, settings);
+  }
+}
+
+void VolumeData::write_contiguous_data(
+    const size_t observation_id, const size_t offset,
+    const std::vector<ExtentsAndTensorVolumeData>& grids,
+    const VolumeOutputSettings& settings, const bool collective) noexcept {
+  if (grids.empty() and not collective) {
+    return;
+  }
+  detail::OpenGroup observation_group(
+      volume_file_root_group_.id(),
+      "ObservationId" + std::to_string(observation_id), AccessType::ReadWrite);
+  size_t number_of_points = 0;
+  for (const auto& grid : grids) {
+    number_of_points += grid.tensor_components.front().data.size();
+  }
+  // The tensor components are taken from the file rather than from the
+  // grids, so that all processes of a collective write go through the same
+  // datasets in the same order, even those without grids.
+  const auto component_names = h5::read_rank1_attribute<std::string>(
+      observation_group.id(), "tensor_components");
+  // Gather each tensor component of all grids and write it at once
+  DataVector buffer(number_of_points);
+  for (const auto& component_name : component_names) {
+    size_t buffer_offset = 0;
+    for (const auto& grid : grids) {
+      const auto tensor_component = std::find_if(
+          grid.tensor_components.begin(), grid.tensor_components.end(),
+          [&component_name](const TensorComponent& component) noexcept {
+            return split_component_name(component.name).second ==
+                   component_name;
+          });
+      ASSERT(tensor_component != grid.tensor_components.end(),
+             "Could not find the tensor component '"
+                 << component_name << "' in the data of grid '"
+                 << split_component_name(grid.tensor_components.front().name)
+                        .first
+                 << "'.");
+      std::copy(tensor_component->data.begin(), tensor_component->data.end(),
+                buffer.begin() + static_cast<std::ptrdiff_t>(buffer_offset));
+      buffer_offset += tensor_component->data.size();
+    }
+    const auto& component_settings = settings(component_name);
+    if (component_settings.rounds_mantissa()) {
+      round_mantissa(make_not_null(&buffer),
+                     component_settings.mantissa_bits());
+    }
+    h5::write_to_existing_data(observation_group.id(), buffer, component_name,
+                               offset, collective);
+  }
+}
+
 std::vector<size_t> VolumeData::list_observation_ids() const noexcept {
   const auto names = get_group_names(volume_file_root_group_.id(), "");
   const auto helper = [](const std::string& s) noexcept {
@@ -137,6 +350,9 @@ double VolumeData::get_observation_value(const size_t observation_id) const
 
 std::vector<std::string> VolumeData::list_grids(
     const size_t observation_id) const noexcept {
+  if (get_format_version(observation_id) == contiguous_format_version) {
+    return grid_table(observation_id).grid_names;
+  }
   detail::OpenGroup observation_group(
       volume_file_root_group_.id(),
       "ObservationId" + std::to_string(observation_id), AccessType::ReadOnly);
@@ -145,6 +361,15 @@ std::vector<std::string> VolumeData::list_grids(
 
 std::vector<std::string> VolumeData::list_tensor_components(
     size_t observation_id, const std::string& grid_name) const noexcept {
+  if (get_format_version(observation_id) == contiguous_format_version) {
+    detail::OpenGroup observation_group(
+        volume_file_root_group_.id(),
+        "ObservationId" + std::to_string(observation_id),
+        AccessType::ReadOnly);
+    static_cast<void>(grid_index(grid_table(observation_id), grid_name));
+    return h5::read_rank1_attribute<std::string>(observation_group.id(),
+                                                 "tensor_components");
+  }
   detail::OpenGroup spatial_group(
       volume_file_root_group_.id(),
       "ObservationId" + std::to_string(observation_id) + "/" + grid_name,
@@ -159,6 +384,22 @@ std::vector<std::string> VolumeData::list_tensor_components(
 DataVector VolumeData::get_tensor_component(
     size_t observation_id, const std::string& grid_name,
     const std::string& tensor_component) const noexcept {
+  if (get_format_version(observation_id) == contiguous_format_version) {
+    const auto& table = grid_table(observation_id);
+    const size_t index = grid_index(table, grid_name);
+    const size_t number_of_points = std::accumulate(
+        table.extents.begin() +
+            static_cast<std::ptrdiff_t>(index * table.dimension),
+        table.extents.begin() +
+            static_cast<std::ptrdiff_t>((index + 1) * table.dimension),
+        size_t{1}, std::multiplies<size_t>{});
+    detail::OpenGroup observation_group(
+        volume_file_root_group_.id(),
+        "ObservationId" + std::to_string(observation_id),
+        AccessType::ReadOnly);
+    return h5::read_data(observation_group.id(), tensor_component,
+                         table.offsets[index], number_of_points);
+  }
   detail::OpenGroup spatial_group(
       volume_file_root_group_.id(),
       "ObservationId" + std::to_string(observation_id) + "/" + grid_name,
@@ -169,11 +410,135 @@ DataVector VolumeData::get_tensor_component(
 std::vector<size_t> VolumeData::get_extents(size_t observation_id,
                                             const std::string& grid_name) const
     noexcept {
+  if (get_format_version(observation_id) == contiguous_format_version) {
+    const auto& table = grid_table(observation_id);
+    const size_t index = grid_index(table, grid_name);
+    return {table.extents.begin() +
+                static_cast<std::ptrdiff_t>(index * table.dimension),
+            table.extents.begin() +
+                static_cast<std::ptrdiff_t>((index + 1) * table.dimension)};
+  }
   detail::OpenGroup spatial_group(
       volume_file_root_group_.id(),
       "ObservationId" + std::to_string(observation_id) + "/" + grid_name,
       AccessType::ReadOnly);
   return h5::read_rank1_attribute<size_t>(spatial_group.id(), "extents");
 }
+
+uint32_t VolumeData::get_format_version(const size_t observation_id) const
+    noexcept {
+  detail::OpenGroup observation_group(
+      volume_file_root_group_.id(),
+      "ObservationId" + std::to_string(observation_id), AccessType::ReadOnly);
+  if (not contains_attribute(observation_group.id(), "", "format_version")) {
+    return 1;
+  }
+  return h5::read_value_attribute<uint32_t>(observation_group.id(),
+                                            "format_version");
+}
+
+DataVector VolumeData::get_tensor_component(
+    const size_t observation_id, const std::string& tensor_component) const
+    noexcept {
+  const auto& observation_group = contiguous_observation_group(observation_id);
+  return h5::read_data(observation_group.id(), tensor_component);
+}
+
+TensorOutputSettings VolumeData::get_output_settings(
+    const size_t observation_id, const std::string& tensor_component) const
+    noexcept {
+  return h5::read_output_settings(
+      contiguous_observation_group(observation_id).id(), tensor_component);
+}
+
+std::vector<size_t> VolumeData::get_offsets(const size_t observation_id) const
+    noexcept {
+  return grid_table(observation_id).offsets;
+}
+
+std::vector<long> VolumeData::get_connectivity(
+    const size_t observation_id) const noexcept {
+  const auto& observation_group = contiguous_observation_group(observation_id);
+  return h5::read_rank1_data<long>(observation_group.id(), "connectivity");
+}
+
+std::vector<ExtentsAndTensorVolumeData> VolumeData::read_contiguous_grids(
+    const size_t observation_id) const noexcept {
+  const auto table = grid_table(observation_id);
+  const auto& observation_group = contiguous_observation_group(observation_id);
+  const auto component_names = h5::read_rank1_attribute<std::string>(
+      observation_group.id(), "tensor_components");
+  std::vector<ExtentsAndTensorVolumeData> grids(table.grid_names.size());
+  for (size_t i = 0; i < grids.size(); ++i) {
+    grids[i].extents.assign(
+        table.extents.begin() +
+            static_cast<std::ptrdiff_t>(i * table.dimension),
+        table.extents.begin() +
+            static_cast<std::ptrdiff_t>((i + 1) * table.dimension));
+  }
+  for (const auto& component_name : component_names) {
+    const DataVector data =
+        h5::read_data(observation_group.id(), component_name);
+    for (size_t i = 0; i < grids.size(); ++i) {
+      const size_t number_of_points = std::accumulate(
+          grids[i].extents.begin(), grids[i].extents.end(), size_t{1},
+          std::multiplies<size_t>{});
+      DataVector grid_data(number_of_points);
+      std::copy(data.begin() + static_cast<std::ptrdiff_t>(table.offsets[i]),
+                data.begin() + static_cast<std::ptrdiff_t>(table.offsets[i] +
+                                                           number_of_points),
+                grid_data.begin());
+      grids[i].tensor_components.emplace_back(
+          table.grid_names[i] + "/" + component_name, std::move(grid_data));
+    }
+  }
+  return grids;
+}
+
+detail::OpenGroup VolumeData::contiguous_observation_group(
+    const size_t observation_id) const noexcept {
+  if (UNLIKELY(get_format_version(observation_id) !=
+               contiguous_format_version)) {
+    ERROR("The observation id " << observation_id << " in '" << name_
+                                << "' is not in the contiguous format.");
+  }
+  return detail::OpenGroup(volume_file_root_group_.id(),
+                           "ObservationId" + std::to_string(observation_id),
+                           AccessType::ReadOnly);
+}
+
+const VolumeData::GridTable& VolumeData::grid_table(
+    const size_t observation_id) const noexcept {
+  if (grid_table_valid_ and grid_table_.observation_id == observation_id) {
+    return grid_table_;
+  }
+  const auto& observation_group = contiguous_observation_group(observation_id);
+  grid_table_.observation_id = observation_id;
+  grid_table_.grid_names =
+      h5::read_rank1_data<std::string>(observation_group.id(), "grid_names");
+  grid_table_.extents =
+      h5::read_rank1_data<size_t>(observation_group.id(), "extents");
+  grid_table_.offsets =
+      h5::read_rank1_data<size_t>(observation_group.id(), "offsets");
+  grid_table_.dimension =
+      grid_table_.extents.size() / grid_table_.grid_names.size();
+  grid_table_.grid_indices.clear();
+  for (size_t i = 0; i < grid_table_.grid_names.size(); ++i) {
+    grid_table_.grid_indices.emplace(grid_table_.grid_names[i], i);
+  }
+  grid_table_valid_ = true;
+  return grid_table_;
+}
+
+size_t VolumeData::grid_index(const GridTable& table,
+                              const std::string& grid_name) const noexcept {
+  const auto index = table.grid_indices.find(grid_name);
+  if (UNLIKELY(index == table.grid_indices.end())) {
+    ERROR("Could not find the grid '" << grid_name << "' at observation id "
+                                      << table.observation_id << " in '"
+                                      << name_ << "'.");
+  }
+  return index->second;
+}
 }  // namespace h5
 /// \endcond HIDDEN_SYMBOLS
@@ -7,10 +7,13 @@
 #include <cstdint>
 #include <hdf5.h>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
+#include "IO/H5/OutputSettings.hpp"
 
 /// \cond
 class DataVector;
@@ -41,6 +44,22 @@ namespace h5 {
  * in the case of a dG evolution where the spatial IDs are `ElementId`s, the
  * grid names would be of the form `[B0,(L2I3,L2I3,L2I3)]`.
  *
+ * The data at an observation is stored in one of two formats, recorded in the
+ * `format_version` attribute of the observation:
+ * - Version 1, written by `insert_tensor_data()`, has a group per grid holding
+ *   the extents, the connectivity and one dataset per tensor component.
+ * - Version 2, written by `write_volume_data()` or by
+ *   `create_contiguous_datasets()` followed by `write_contiguous_data()`, has
+ *   one chunked dataset per tensor component holding the data of all grids
+ *   one after another. The tables `grid_names`, `extents` (the flattened
+ *   extents of all grids) and `offsets` (the index of the first point of each
+ *   grid) describe where each grid is stored, and a single `connectivity`
+ *   dataset holds the cells of all grids in terms of these point indices.
+ *   This avoids the metadata of the millions of small groups and datasets of
+ *   version 1 for large numbers of elements.
+ *
+ * The readers slice the data of a single grid out of either format.
+ *
  * \warning Currently the topology of the grids is assumed to be tensor products
  * of lines, i.e. lines, quadrilaterals, and hexahedrons. However, this can be
  * extended in the future. If support for more topologies is required, please
@@ -82,6 +101,63 @@ class VolumeData : public h5::Object {
       size_t observation_id, double observation_value,
       const ExtentsAndTensorVolumeData& extents_and_tensors) noexcept;
 
+  /// Write the tensor components of all `grids` at `observation_id` with
+  /// floating point value `observation_value` in the contiguous format
+  /// (version 2)
+  ///
+  /// The tensor components are stored as selected by `settings`. If the
+  /// observation already exists the grids are merged into it (see
+  /// `create_contiguous_datasets`).
+  ///
+  /// \requires The names of the tensor components is of the form
+  /// `GRID_NAME/TENSOR_NAME_COMPONENT`, and all grids have the same tensor
+  /// components
+  void write_volume_data(
+      size_t observation_id, double observation_value,
+      const std::vector<ExtentsAndTensorVolumeData>& grids,
+      const VolumeOutputSettings& settings = VolumeOutputSettings{}) noexcept;
+
+  /// Create the tables, the connectivity and the tensor component datasets
+  /// of an observation in the contiguous format (version 2) from the extents
+  /// and the tensor component names of each grid, without writing the tensor
+  /// data.
+  ///
+  /// The data is written later by `write_contiguous_data`. Creating all
+  /// datasets first allows several writers to fill a shared file one after
+  /// another without changing its metadata, unless the `settings` compress
+  /// the datasets, whose chunks are allocated as they are written.
+  ///
+  /// If the observation already exists, e.g. because it is written again
+  /// after a restart, its grids are merged with the new ones, as
+  /// `insert_tensor_data` does: the datasets are recreated with the new
+  /// grids first, so the offsets passed to `write_contiguous_data` are not
+  /// changed, followed by the grids already written. It is an error to write
+  /// a grid that already exists, or to merge into an observation in the
+  /// format version 1. HDF5 does not reuse the space of the replaced
+  /// datasets, which `h5repack` recovers.
+  void create_contiguous_datasets(
+      size_t observation_id, double observation_value,
+      const std::vector<std::pair<std::vector<size_t>,
+                                  std::vector<std::string>>>& layout,
+      const VolumeOutputSettings& settings = VolumeOutputSettings{}) noexcept;
+
+  /// Write the tensor components of consecutive `grids` into the datasets
+  /// created by `create_contiguous_datasets`, starting at the point `offset`
+  ///
+  /// The values are rounded as selected by the `settings`, which must be those
+  /// the datasets were created with. With `collective` the file must have
+  /// been opened collectively, and all processes write their grids at once
+  /// with collective MPI-IO transfers, including those without any grids.
+  ///
+  /// \requires `grids` are in the same order as in the layout passed to
+  /// `create_contiguous_datasets`, starting with the grid whose data starts
+  /// at `offset`
+  void write_contiguous_data(
+      size_t observation_id, size_t offset,
+      const std::vector<ExtentsAndTensorVolumeData>& grids,
+      const VolumeOutputSettings& settings = VolumeOutputSettings{},
+      bool collective = false) noexcept;
+
   /// List all the integral observation ids in the subfile
   std::vector<size_t> list_observation_ids() const noexcept;
 
@@ -110,11 +186,67 @@ class VolumeData : public h5::Object {
   std::vector<size_t> get_extents(size_t observation_id,
                                   const std::string& grid_name) const noexcept;
 
+  /// The format version of the data at the observation id `observation_id`
+  uint32_t get_format_version(size_t observation_id) const noexcept;
+
+  /// Read the tensor component with name `tensor_component` of all grids at
+  /// the observation id `observation_id`, which must be in the contiguous
+  /// format
+  DataVector get_tensor_component(size_t observation_id,
+                                  const std::string& tensor_component) const
+      noexcept;
+
+  /// The index of the first point of each grid in the tensor component
+  /// datasets at the observation id `observation_id`, which must be in the
+  /// contiguous format. The grids are in the order of `list_grids`.
+  std::vector<size_t> get_offsets(size_t observation_id) const noexcept;
+
+  /// Read the connectivity of all grids at the observation id
+  /// `observation_id`, which must be in the contiguous format
+  std::vector<long> get_connectivity(size_t observation_id) const noexcept;
+
+  /// The settings the tensor component `tensor_component` at the observation
+  /// id `observation_id` was written with, which must be in the contiguous
+  /// format. The tensor components are read as double precision values
+  /// regardless of the settings.
+  TensorOutputSettings get_output_settings(
+      size_t observation_id, const std::string& tensor_component) const
+      noexcept;
+
  private:
+  // The tables of an observation in the contiguous format
+  struct GridTable {
+    size_t observation_id{};
+    std::vector<std::string> grid_names{};
+    std::unordered_map<std::string, size_t> grid_indices{};
+    std::vector<size_t> extents{};
+    std::vector<size_t> offsets{};
+    size_t dimension{};
+  };
+
+  // Read the tables of the observation, which are kept until another
+  // observation is read from or written to, so that reading all grids one
+  // after another does not read the tables every time
+  const GridTable& grid_table(size_t observation_id) const noexcept;
+
+  // Read all grids of an observation in the contiguous format
+  std::vector<ExtentsAndTensorVolumeData> read_contiguous_grids(
+      size_t observation_id) const noexcept;
+
+  // Open the group of an observation that must be in the contiguous format
+  detail::OpenGroup contiguous_observation_group(size_t observation_id) const
+      noexcept;
+
+  // The index of `grid_name` in the tables of the observation
+  size_t grid_index(const GridTable& table,
+                    const std::string& grid_name) const noexcept;
+
   detail::OpenGroup group_{};
   std::string name_{};
   uint32_t version_{};
   detail::OpenGroup volume_file_root_group_{};
   std::string header_{};
+  mutable GridTable grid_table_{};
+  mutable bool grid_table_valid_{false};
 };
 }  // namespace h5
@@ -43,6 +43,30 @@ SPECTRE_ALWAYS_INLINE auto h5p_default() noexcept {
   return H5P_DEFAULT;
 #pragma GCC diagnostic pop
 }
+
+/// \ingroup HDF5Group
+SPECTRE_ALWAYS_INLINE auto h5p_dataset_create() noexcept {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+  return H5P_DATASET_CREATE;
+#pragma GCC diagnostic pop
+}
+
+/// \ingroup HDF5Group
+SPECTRE_ALWAYS_INLINE auto h5p_dataset_xfer() noexcept {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+  return H5P_DATASET_XFER;
+#pragma GCC diagnostic pop
+}
+
+/// \ingroup HDF5Group
+SPECTRE_ALWAYS_INLINE auto h5p_file_access() noexcept {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+  return H5P_FILE_ACCESS;
+#pragma GCC diagnostic pop
+}
 }  // namespace h5
 
 // H5S wrappers
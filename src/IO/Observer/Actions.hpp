@@ -9,12 +9,16 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/Index.hpp"
+#include "ErrorHandling/Assert.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "IO/Observer/TypeOfObservation.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 namespace observers {
@@ -23,6 +27,64 @@ namespace observers {
  * \brief %Actions used by the observer parallel component
  */
 namespace Actions {
+/*!
+ * \brief Action that is called on the ObserverWriter parallel component of
+ * the node when the observer on one of its processors registers its first
+ * component sending volume data
+ *
+ * The writer then expects this observer to contribute to every volume
+ * observation of the node.
+ */
+struct RegisterVolumeObserverWithWriter {
+  template <typename DbTagList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl::list_contains_v<
+                DbTagList, observers::Tags::VolumeObserversRegistered>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    db::mutate<observers::Tags::VolumeObserversRegistered>(
+        make_not_null(&box),
+        [](const gsl::not_null<size_t*> volume_observers_registered) noexcept {
+          ++(*volume_observers_registered);
+        });
+  }
+};
+
+/*!
+ * \brief Action that is called on the ObserverWriter parallel component of
+ * the node when the observer on one of its processors deregisters its last
+ * component sending volume data
+ */
+struct DeregisterVolumeObserverWithWriter {
+  template <typename DbTagList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl::list_contains_v<
+                DbTagList, observers::Tags::VolumeObserversRegistered>> =
+                nullptr>
+  static void apply(db::DataBox<DbTagList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    db::mutate<observers::Tags::VolumeObserversRegistered>(
+        make_not_null(&box),
+        [](const gsl::not_null<size_t*> volume_observers_registered) noexcept {
+          ASSERT(*volume_observers_registered > 0,
+                 "Trying to deregister an observer of volume data that was "
+                 "not registered with the writer.");
+          --(*volume_observers_registered);
+        });
+  }
+};
+
 /*!
  * \brief Action that is called on the Observer parallel component to register
  * the parallel component that will send the data to the observer
@@ -39,7 +101,7 @@ struct RegisterSenderWithSelf {
           nullptr>
   static void apply(db::DataBox<DbTagList>& box,
                     const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
-                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const ActionList /*meta*/,
                     const ParallelComponent* const /*meta*/,
@@ -57,7 +119,7 @@ struct RegisterSenderWithSelf {
             array_component_ids->insert(component_id);
           });
     };
-    const auto register_volume = [&box, &component_id]() noexcept {
+    const auto register_volume = [&box, &cache, &component_id]() noexcept {
       db::mutate<observers::Tags::VolumeArrayComponentIds>(
           make_not_null(&box), [&component_id](
                                    const auto array_component_ids) noexcept {
@@ -67,6 +129,12 @@ struct RegisterSenderWithSelf {
                    "itself with the observers more than once.");
             array_component_ids->insert(component_id);
           });
+      if (db::get<observers::Tags::VolumeArrayComponentIds>(box).size() == 1) {
+        Parallel::simple_action<RegisterVolumeObserverWithWriter>(
+            *Parallel::get_parallel_component<
+                 observers::ObserverWriter<Metavariables>>(cache)
+                 .ckLocalBranch());
+      }
     };
 
     switch (type_of_observation) {
@@ -88,6 +156,76 @@ struct RegisterSenderWithSelf {
   }
 };
 
+/*!
+ * \brief Action that is called on the Observer parallel component to
+ * deregister a parallel component that no longer sends data to this observer,
+ * e.g. because it was migrated to another processor
+ */
+struct DeregisterSenderWithSelf {
+  template <
+      typename DbTagList, typename... InboxTags, typename Metavariables,
+      typename ArrayIndex, typename ActionList, typename ParallelComponent,
+      typename TemporalId,
+      Requires<tmpl::list_contains_v<
+                   DbTagList, observers::Tags::ReductionArrayComponentIds> and
+               tmpl::list_contains_v<
+                   DbTagList, observers::Tags::VolumeArrayComponentIds>> =
+          nullptr>
+  static void apply(db::DataBox<DbTagList>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const TemporalId& /*temporal_id*/,
+                    const observers::ArrayComponentId& component_id,
+                    const TypeOfObservation& type_of_observation) noexcept {
+    const auto deregister_reduction = [&box, &component_id]() noexcept {
+      db::mutate<observers::Tags::ReductionArrayComponentIds>(
+          make_not_null(&box), [&component_id](
+                                   const auto array_component_ids) noexcept {
+            ASSERT(array_component_ids->count(component_id) == 1,
+                   "Trying to deregister a component_id for reduction that "
+                   "was not registered with this observer.");
+            array_component_ids->erase(component_id);
+          });
+    };
+    const auto deregister_volume = [&box, &cache, &component_id]() noexcept {
+      db::mutate<observers::Tags::VolumeArrayComponentIds>(
+          make_not_null(&box), [&component_id](
+                                   const auto array_component_ids) noexcept {
+            ASSERT(array_component_ids->count(component_id) == 1,
+                   "Trying to deregister a component_id for volume "
+                   "observation that was not registered with this observer.");
+            array_component_ids->erase(component_id);
+          });
+      if (db::get<observers::Tags::VolumeArrayComponentIds>(box).empty()) {
+        Parallel::simple_action<DeregisterVolumeObserverWithWriter>(
+            *Parallel::get_parallel_component<
+                 observers::ObserverWriter<Metavariables>>(cache)
+                 .ckLocalBranch());
+      }
+    };
+
+    switch (type_of_observation) {
+      case TypeOfObservation::ReductionAndVolume:
+        deregister_reduction();
+        deregister_volume();
+        return;
+      case TypeOfObservation::Reduction:
+        deregister_reduction();
+        return;
+      case TypeOfObservation::Volume:
+        deregister_volume();
+        return;
+      default:
+        ERROR(
+          "Deregistering an unknown TypeOfObservation. Should be one of "
+          "'Reduction', 'Volume', or 'ReductionAndVolume'");
+    };
+  }
+};
+
 /*!
  * \brief Registers itself with the local observer parallel component so the
  * observer knows to expect data from this component, and also whether to expect
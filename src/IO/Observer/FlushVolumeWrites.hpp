@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "IO/Observer/VolumeWriteQueue.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace observers {
+namespace ThreadedActions {
+/*!
+ * \ingroup ObserverGroup
+ * \brief Waits until the VolumeWriteQueue of the node has finished all
+ * queued writes, and prints the metrics of the writes.
+ *
+ * Charm++ does not destroy the nodegroups when the program exits, so the
+ * destructor of the queue never runs. The ObserverWriter therefore runs this
+ * action on every node in the `Exit` phase, and the program only exits once
+ * all nodes finished it.
+ */
+struct FlushVolumeWrites {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock) noexcept {
+    Parallel::lock(node_lock);
+    const VolumeWriteQueue& queue = *db::get<Tags::VolumeWriteQueue>(box);
+    Parallel::unlock(node_lock);
+
+    queue.flush();
+    if (queue.number_of_writes() > 0) {
+      Parallel::printf(
+          "Node %d wrote %zu volume observations, %zu bytes at %g bytes per "
+          "second; at most %zu writes were queued and %zu observations "
+          "waited for the disk\n",
+          Parallel::my_node(), queue.number_of_writes(),
+          queue.bytes_written(), queue.bandwidth(), queue.max_size(),
+          queue.number_of_blocked_pushes());
+    }
+  }
+};
+}  // namespace ThreadedActions
+}  // namespace observers
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -49,7 +52,10 @@ struct Initialize {
 struct InitializeWriter {
   using simple_tags =
       db::AddSimpleTags<Tags::TensorData, Tags::VolumeObserversContributed,
-                        Tags::ReductionFileLock, Tags::VolumeFileLock>;
+                        Tags::VolumeObserversRegistered,
+                        Tags::ReductionFileLock, Tags::VolumeFileLock,
+                        Tags::VolumeLayouts, Tags::VolumeLayoutsContributed,
+                        Tags::SharedVolumeFileQueue, Tags::VolumeWriteQueue>;
   using compute_tags = db::AddComputeTags<>;
 
   using return_tag_list = tmpl::append<simple_tags, compute_tags>;
@@ -58,14 +64,19 @@ struct InitializeWriter {
             typename ActionList, typename ParallelComponent>
   static auto apply(const db::DataBox<tmpl::list<>>& /*box*/,
                     const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
-                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const ActionList /*meta*/,
                     const ParallelComponent* const /*meta*/) noexcept {
     return std::make_tuple(db::create<simple_tags>(
         db::item_type<Tags::TensorData>{},
-        db::item_type<Tags::VolumeObserversContributed>{},
-        Parallel::create_lock(), Parallel::create_lock()));
+        db::item_type<Tags::VolumeObserversContributed>{}, size_t{0},
+        Parallel::create_lock(), Parallel::create_lock(),
+        db::item_type<Tags::VolumeLayouts>{},
+        db::item_type<Tags::VolumeLayoutsContributed>{},
+        db::item_type<Tags::SharedVolumeFileQueue>{},
+        std::make_unique<VolumeWriteQueue>(
+            Parallel::get<OptionTags::VolumeWriteQueueCapacity>(cache))));
   }
 };
 }  // namespace Actions
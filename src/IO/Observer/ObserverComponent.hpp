@@ -6,6 +6,7 @@
 #include "AlgorithmGroup.hpp"
 #include "AlgorithmNodegroup.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/FlushVolumeWrites.hpp"
 #include "IO/Observer/Initialize.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
@@ -24,7 +25,10 @@ namespace observers {
 template <class Metavariables>
 struct Observer {
   using chare_type = Parallel::Algorithms::Group;
-  using const_global_cache_tag_list = tmpl::list<OptionTags::VolumeFileName>;
+  using const_global_cache_tag_list =
+      tmpl::list<OptionTags::VolumeFileName, OptionTags::SingleVolumeFile,
+                 OptionTags::VolumeWriteQueueCapacity,
+                 OptionTags::VolumeOutputSettings>;
   using metavariables = Metavariables;
   using action_list = tmpl::list<>;
 
@@ -50,11 +54,24 @@ struct Observer {
  * \ingroup ObserversGroup
  * \brief The nodegroup parallel component that is responsible for writing data
  * to disk.
+ *
+ * By default each node writes its volume data into its own file. With the
+ * `SingleVolumeFile` option all nodes write into one file: the writer on the
+ * first node creates the datasets of all elements from the layouts sent by
+ * every node, and the nodes then fill them one after another (see
+ * `ThreadedActions::ContributeVolumeLayout`).
+ *
+ * The volume data of a node is written by the I/O thread of its
+ * VolumeWriteQueue. In the `Exit` phase every node waits for its queued
+ * writes to finish (see `ThreadedActions::FlushVolumeWrites`).
  */
 template <class Metavariables>
 struct ObserverWriter {
   using chare_type = Parallel::Algorithms::Nodegroup;
-  using const_global_cache_tag_list = tmpl::list<OptionTags::VolumeFileName>;
+  using const_global_cache_tag_list =
+      tmpl::list<OptionTags::VolumeFileName, OptionTags::SingleVolumeFile,
+                 OptionTags::VolumeWriteQueueCapacity,
+                 OptionTags::VolumeOutputSettings>;
   using metavariables = Metavariables;
   using action_list = tmpl::list<>;
 
@@ -71,8 +88,13 @@ struct ObserverWriter {
   }
 
   static void execute_next_phase(
-      const typename Metavariables::Phase /*next_phase*/,
-      Parallel::CProxy_ConstGlobalCache<
-          Metavariables>& /*global_cache*/) noexcept {}
+      const typename Metavariables::Phase next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    if (next_phase == Metavariables::Phase::Exit) {
+      auto& local_cache = *(global_cache.ckLocalBranch());
+      Parallel::threaded_action<ThreadedActions::FlushVolumeWrites>(
+          Parallel::get_parallel_component<ObserverWriter>(local_cache));
+    }
+  }
 };
 }  // namespace observers
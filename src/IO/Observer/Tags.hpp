@@ -4,20 +4,32 @@
 #pragma once
 
 #include <cstddef>
+#include <deque>
 #include <lrtslock.h>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
+#include "IO/H5/OutputSettings.hpp"
 #include "IO/Observer/ArrayComponentId.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/VolumeWriteQueue.hpp"
 #include "Options/Options.hpp"
 
 namespace observers {
+/// \ingroup ObserversGroup
+/// The extents and the names of the tensor components of each grid in a
+/// volume observation, from which the datasets of a shared volume file are
+/// created before any data is written.
+using VolumeLayout =
+    std::vector<std::pair<std::vector<size_t>, std::vector<std::string>>>;
+
 /// \ingroup ObserversGroup
 /// %Tags used on the observer parallel component
 namespace Tags {
@@ -58,6 +70,45 @@ struct VolumeObserversContributed : db::SimpleTag {
   using type = std::unordered_map<observers::ObservationId, size_t>;
 };
 
+/// The number of observer components on the node that have registered
+/// components sending volume data, and so contribute to every volume
+/// observation of the node.
+struct VolumeObserversRegistered : db::SimpleTag {
+  static std::string name() noexcept { return "VolumeObserversRegistered"; }
+  using type = size_t;
+};
+
+/// The layouts of the volume data at the observation ids received by the
+/// writer on the first node from the writers on all nodes, indexed by node,
+/// when all nodes write into one volume file.
+struct VolumeLayouts : db::SimpleTag {
+  static std::string name() noexcept { return "VolumeLayouts"; }
+  using type = std::unordered_map<observers::ObservationId,
+                                  std::vector<VolumeLayout>>;
+};
+
+/// The number of nodes that have contributed a layout at the observation ids.
+struct VolumeLayoutsContributed : db::SimpleTag {
+  static std::string name() noexcept { return "VolumeLayoutsContributed"; }
+  using type = std::unordered_map<observers::ObservationId, size_t>;
+};
+
+/// The observations whose layout is complete, in the order in which they are
+/// written into the shared volume file. The front observation is the one
+/// currently being written.
+struct SharedVolumeFileQueue : db::SimpleTag {
+  static std::string name() noexcept { return "SharedVolumeFileQueue"; }
+  using type = std::deque<
+      std::pair<observers::ObservationId, std::vector<VolumeLayout>>>;
+};
+
+/// The queue of volume data writes done by the I/O thread of the node. The
+/// queue also holds the metrics of the writes, such as the write bandwidth.
+struct VolumeWriteQueue : db::SimpleTag {
+  static std::string name() noexcept { return "VolumeWriteQueue"; }
+  using type = std::unique_ptr<observers::VolumeWriteQueue>;
+};
+
 /// Node lock used when needing to lock the H5 file on disk.
 struct VolumeFileLock : db::SimpleTag {
   static std::string name() noexcept { return "VolumeFileLock"; }
@@ -80,5 +131,36 @@ struct VolumeFileName {
       "Name of the volume data file without extension"};
   static type default_value() noexcept { return "./VolumeData"; }
 };
+
+/// \ingroup ObserversGroup
+/// Whether the volume data of all nodes is written into one H5 file instead
+/// of one file per node.
+struct SingleVolumeFile {
+  using type = bool;
+  static constexpr OptionString help = {
+      "Write the volume data of all nodes into a single file"};
+  static type default_value() noexcept { return false; }
+};
+
+/// \ingroup ObserversGroup
+/// The number of volume observations of a node that can be queued for
+/// writing or be written at once before the observers wait for the disk.
+struct VolumeWriteQueueCapacity {
+  using type = size_t;
+  static constexpr OptionString help = {
+      "Number of volume observations of a node buffered for writing"};
+  static type default_value() noexcept { return 2; }
+  static type lower_bound() noexcept { return 1; }
+};
+
+/// \ingroup ObserversGroup
+/// The compression and precision with which the tensors of the volume data
+/// are stored when they are written contiguously.
+struct VolumeOutputSettings {
+  using type = h5::VolumeOutputSettings;
+  static constexpr OptionString help = {
+      "Compression and precision of the tensors in the volume data file"};
+  static type default_value() noexcept { return {}; }
+};
 }  // namespace OptionTags
 }  // namespace observers
@@ -3,9 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <iterator>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
@@ -23,6 +28,8 @@
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Numeric.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -30,9 +37,105 @@ namespace observers {
 namespace ThreadedActions {
 /// \cond
 struct WriteVolumeData;
+struct WriteVolumeDataToSharedFile;
+struct ContributeVolumeLayout;
+struct ContributeEmptyVolumeLayout;
+struct ReleaseSharedVolumeFile;
 /// \endcond
 }  // namespace ThreadedActions
 
+namespace VolumeActions_detail {
+// With an HDF5 library built for MPI-IO all nodes write their data into the
+// shared volume file at once with collective writes, else they write one
+// after another.
+#ifdef H5_HAVE_PARALLEL
+constexpr bool collective_volume_writes = true;
+#else
+constexpr bool collective_volume_writes = false;
+#endif
+
+inline std::string shared_volume_file_name(
+    const std::string& file_prefix) noexcept {
+  return file_prefix + ".h5";
+}
+
+// The volume data of the grids on this node, in the order of the grid names
+// so that the layout sent to the first node and the data written later
+// agree.
+inline std::vector<ExtentsAndTensorVolumeData> sorted_grids(
+    std::unordered_map<observers::ArrayComponentId,
+                       ExtentsAndTensorVolumeData>&& volume_data) noexcept {
+  std::vector<ExtentsAndTensorVolumeData> grids{};
+  grids.reserve(volume_data.size());
+  for (auto& id_and_tensor_data_for_grid : volume_data) {
+    grids.push_back(std::move(id_and_tensor_data_for_grid.second));
+  }
+  std::sort(grids.begin(), grids.end(),
+            [](const ExtentsAndTensorVolumeData& lhs,
+               const ExtentsAndTensorVolumeData& rhs) noexcept {
+              return lhs.tensor_components.front().name <
+                     rhs.tensor_components.front().name;
+            });
+  return grids;
+}
+
+// Create the datasets of all grids in the shared volume file, then let the
+// nodes write their data into them. The grids of each node are contiguous in
+// the datasets, in the order of the nodes, so the offset of each node is the
+// exclusive scan of the number of points of the nodes.
+template <typename Metavariables>
+void create_shared_volume_datasets(
+    Parallel::ConstGlobalCache<Metavariables>& cache,
+    const gsl::not_null<CmiNodeLock*> file_lock,
+    const observers::ObservationId& observation_id,
+    const std::vector<VolumeLayout>& node_layouts) noexcept {
+  VolumeLayout layout{};
+  std::vector<size_t> node_offsets{};
+  node_offsets.reserve(node_layouts.size());
+  size_t number_of_points = 0;
+  for (const auto& node_layout : node_layouts) {
+    node_offsets.push_back(number_of_points);
+    for (const auto& extents_and_names : node_layout) {
+      number_of_points +=
+          alg::accumulate(extents_and_names.first, size_t{1},
+                          std::multiplies<size_t>{});
+    }
+    layout.insert(layout.end(), node_layout.begin(), node_layout.end());
+  }
+
+  auto& writer_proxy =
+      Parallel::get_parallel_component<ObserverWriter<Metavariables>>(cache);
+  if (layout.empty()) {
+    // No node has data at this observation
+    Parallel::threaded_action<ThreadedActions::ReleaseSharedVolumeFile>(
+        writer_proxy[0]);
+    return;
+  }
+
+  Parallel::lock(file_lock);
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5file(
+        shared_volume_file_name(
+            Parallel::get<OptionTags::VolumeFileName>(cache)),
+        true);
+    constexpr size_t version_number = 0;
+    auto& volume_file =
+        h5file.try_insert<h5::VolumeData>("/element_data", version_number);
+    volume_file.create_contiguous_datasets(
+        observation_id.hash(), observation_id.value(), layout,
+        Parallel::get<OptionTags::VolumeOutputSettings>(cache));
+  }
+  Parallel::unlock(file_lock);
+  if (collective_volume_writes) {
+    Parallel::threaded_action<ThreadedActions::WriteVolumeDataToSharedFile>(
+        writer_proxy, observation_id, std::move(node_offsets));
+  } else {
+    Parallel::threaded_action<ThreadedActions::WriteVolumeDataToSharedFile>(
+        writer_proxy[0], observation_id, std::move(node_offsets));
+  }
+}
+}  // namespace VolumeActions_detail
+
 namespace Actions {
 /// \cond
 struct ContributeVolumeDataToWriter;
@@ -142,7 +245,8 @@ struct ContributeVolumeDataToWriter {
                 volume_data,
             const gsl::not_null<
                 std::unordered_map<observers::ObservationId, size_t>*>
-                volume_observers_contributed) mutable noexcept {
+                volume_observers_contributed,
+            const size_t volume_observers_registered) mutable noexcept {
           if (volume_data->count(observation_id) == 0) {
             volume_data->operator[](observation_id) = std::move(in_volume_data);
             (*volume_observers_contributed)[observation_id] = 1;
@@ -152,19 +256,19 @@ struct ContributeVolumeDataToWriter {
                                 std::make_move_iterator(in_volume_data.end()));
             (*volume_observers_contributed)[observation_id]++;
           }
-          // Check if we have received all "volume" data from the Observer
-          // group. If so we write to disk.
-          const auto procs_on_node =
-              static_cast<size_t>(Parallel::procs_on_node(Parallel::my_node()));
+          // Check if we have received all "volume" data from the observers
+          // of the Observer group that have volume data. If so we write to
+          // disk.
           if (volume_observers_contributed->at(observation_id) ==
-              procs_on_node) {
+              volume_observers_registered) {
             Parallel::threaded_action<ThreadedActions::WriteVolumeData>(
                 Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
                     cache)[static_cast<size_t>(Parallel::my_node())],
                 observation_id);
             volume_observers_contributed->erase(observation_id);
           }
-        });
+        },
+        db::get<Tags::VolumeObserversRegistered>(box));
   }
 };
 }  // namespace Actions
@@ -173,6 +277,18 @@ namespace ThreadedActions {
 /*!
  * \ingroup ObserverGroup
  * \brief Writes volume data at the `observation_id` to disk.
+ *
+ * The grids of the node are written in the contiguous format of
+ * h5::VolumeData, one dataset per tensor component, in the order of the grid
+ * names. The data is moved into the VolumeWriteQueue of the node and written
+ * by its I/O thread, so the action returns before the data is on disk and
+ * only waits when the queue is full.
+ *
+ * With the `SingleVolumeFile` option the data stays on the node and only its
+ * layout is sent to the writer on the first node (see
+ * ContributeVolumeLayout). The nodes write into the shared file together or
+ * one after another, coordinated by actions, so these writes are done by the
+ * Charm++ threads and not by the I/O thread.
  */
 struct WriteVolumeData {
   template <typename... DbTags, typename... InboxTags, typename Metavariables,
@@ -181,13 +297,250 @@ struct WriteVolumeData {
             Requires<sizeof...(DbTags) != 0> = nullptr>
   static auto apply(db::DataBox<tmpl::list<DbTags...>>& box,
                     tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
-                    const Parallel::ConstGlobalCache<Metavariables>& cache,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const ActionList /*meta*/,
                     const ParallelComponent* const /*meta*/,
                     const gsl::not_null<CmiNodeLock*> node_lock,
                     const observers::ObservationId& observation_id) noexcept {
-    // Get data from the DataBox in a thread-safe manner
+    // Get data from the DataBox in a thread-safe manner. With a single
+    // volume file the data stays on the node until its turn to write.
+    const bool single_volume_file =
+        Parallel::get<OptionTags::SingleVolumeFile>(cache);
+    Parallel::lock(node_lock);
+    std::unordered_map<observers::ArrayComponentId, ExtentsAndTensorVolumeData>
+        volume_data{};
+    VolumeLayout layout{};
+    CmiNodeLock file_lock;
+    db::mutate<Tags::VolumeFileLock, Tags::TensorData>(
+        make_not_null(&box),
+        [&file_lock, &layout, &observation_id, &single_volume_file,
+         &volume_data ](const gsl::not_null<CmiNodeLock*> in_file_lock,
+                        const gsl::not_null<db::item_type<Tags::TensorData>*>
+                            in_volume_data) noexcept {
+          if (single_volume_file) {
+            for (const auto& id_and_tensor_data_for_grid :
+                 in_volume_data->at(observation_id)) {
+              const auto& extents_and_tensors =
+                  id_and_tensor_data_for_grid.second;
+              std::vector<std::string> component_names{};
+              component_names.reserve(
+                  extents_and_tensors.tensor_components.size());
+              for (const auto& tensor_component :
+                   extents_and_tensors.tensor_components) {
+                component_names.push_back(tensor_component.name);
+              }
+              layout.emplace_back(extents_and_tensors.extents,
+                                  std::move(component_names));
+            }
+            // Same order as VolumeActions_detail::sorted_grids
+            std::sort(layout.begin(), layout.end(),
+                      [](const auto& lhs, const auto& rhs) noexcept {
+                        return lhs.second.front() < rhs.second.front();
+                      });
+            return;
+          }
+          volume_data = std::move((*in_volume_data)[observation_id]);
+          in_volume_data->erase(observation_id);
+          file_lock = *in_file_lock;
+        });
+    Parallel::unlock(node_lock);
+
+    if (single_volume_file) {
+      Parallel::threaded_action<ContributeVolumeLayout>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache)[0],
+          observation_id, static_cast<size_t>(Parallel::my_node()),
+          std::move(layout));
+      return;
+    }
+
+    // Hand the data to the I/O thread of the node, so that the observers
+    // continue while it is written to disk. The writes use a separate node
+    // lock because writing can be very time consuming (it's network
+    // dependent, depends on how full the disks are, what other users are
+    // doing, etc.) and we want to be able to continue to work on the
+    // nodegroup while we are writing data to disk.
+    auto grids = VolumeActions_detail::sorted_grids(std::move(volume_data));
+    size_t number_of_bytes = 0;
+    for (const auto& extents_and_tensors : grids) {
+      for (const auto& tensor_component :
+           extents_and_tensors.tensor_components) {
+        number_of_bytes += tensor_component.data.size() * sizeof(double);
+      }
+    }
+    std::string file_name = Parallel::get<OptionTags::VolumeFileName>(cache) +
+                            std::to_string(Parallel::my_node()) + ".h5";
+    db::get<Tags::VolumeWriteQueue>(box)->push(
+        [
+          file_lock, file_name = std::move(file_name), grids = std::move(grids),
+          observation_id,
+          settings = Parallel::get<OptionTags::VolumeOutputSettings>(cache)
+        ]() mutable noexcept {
+          Parallel::lock(&file_lock);
+          {
+            h5::H5File<h5::AccessType::ReadWrite> h5file(file_name, true);
+            constexpr size_t version_number = 0;
+            auto& volume_file = h5file.try_insert<h5::VolumeData>(
+                "/element_data", version_number);
+            volume_file.write_volume_data(
+                observation_id.hash(), observation_id.value(), grids, settings);
+          }
+          Parallel::unlock(&file_lock);
+        },
+        number_of_bytes);
+  }
+};
+
+/*!
+ * \ingroup ObserverGroup
+ * \brief Collect the layouts of the volume data at `observation_id` from all
+ * nodes on the writer of the first node.
+ *
+ * Once every node has sent its layout, the datasets of the observation are
+ * created in the contiguous format of h5::VolumeData, so that the nodes only
+ * write raw data into a file whose metadata no longer changes. The grids of
+ * each node are adjacent in the datasets, in the order of the nodes, so each
+ * node writes all its data with one write at an offset found by an exclusive
+ * scan over the number of points of the nodes. With an HDF5 library built for
+ * MPI-IO (`H5_HAVE_PARALLEL`) all nodes write at once with collective writes,
+ * which requires Charm++ to be built on MPI with one process per node. Else
+ * the nodes write one after another, starting with the first node, and the
+ * file is passed on with actions (see WriteVolumeDataToSharedFile). In both
+ * cases the observations are written one after another, in the order in
+ * which their layouts are completed.
+ *
+ * A node without any volume data does not observe anything by itself, so
+ * when the first layout of an observation arrives all nodes are asked for
+ * their layout with ContributeEmptyVolumeLayout, and the nodes without
+ * volume data send an empty layout.
+ */
+struct ContributeVolumeLayout {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock,
+                    const observers::ObservationId& observation_id,
+                    const size_t node, VolumeLayout&& layout) noexcept {
+    bool start_writing = false;
+    bool request_empty_layouts = false;
+    std::vector<VolumeLayout> node_layouts{};
+    CmiNodeLock file_lock;
+    Parallel::lock(node_lock);
+    db::mutate<Tags::VolumeLayouts, Tags::VolumeLayoutsContributed,
+               Tags::SharedVolumeFileQueue>(
+        make_not_null(&box),
+        [&file_lock, &layout, &node, &node_layouts, &observation_id,
+         &request_empty_layouts, &start_writing ](
+            const gsl::not_null<db::item_type<Tags::VolumeLayouts>*> layouts,
+            const gsl::not_null<db::item_type<Tags::VolumeLayoutsContributed>*>
+                layouts_contributed,
+            const gsl::not_null<db::item_type<Tags::SharedVolumeFileQueue>*>
+                queue,
+            const CmiNodeLock& in_file_lock) noexcept {
+          const auto number_of_nodes =
+              static_cast<size_t>(Parallel::number_of_nodes());
+          auto& observation_layouts = (*layouts)[observation_id];
+          observation_layouts.resize(number_of_nodes);
+          observation_layouts[node] = std::move(layout);
+          const size_t layouts_received =
+              ++(*layouts_contributed)[observation_id];
+          request_empty_layouts = layouts_received == 1 and number_of_nodes > 1;
+          if (layouts_received != number_of_nodes) {
+            return;
+          }
+          queue->emplace_back(observation_id, std::move(observation_layouts));
+          layouts->erase(observation_id);
+          layouts_contributed->erase(observation_id);
+          // Start writing unless an earlier observation is being written
+          if (queue->size() == 1) {
+            start_writing = true;
+            node_layouts = std::move(queue->front().second);
+            file_lock = in_file_lock;
+          }
+        },
+        db::get<Tags::VolumeFileLock>(box));
+    Parallel::unlock(node_lock);
+
+    if (request_empty_layouts) {
+      Parallel::threaded_action<ContributeEmptyVolumeLayout>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache),
+          observation_id);
+    }
+    if (start_writing) {
+      VolumeActions_detail::create_shared_volume_datasets(
+          cache, &file_lock, observation_id, node_layouts);
+    }
+  }
+};
+
+/*!
+ * \ingroup ObserverGroup
+ * \brief Send an empty layout at `observation_id` to the writer of the first
+ * node if no observer on this node has volume data, so that the layout of
+ * the observation is completed (see ContributeVolumeLayout).
+ */
+struct ContributeEmptyVolumeLayout {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock,
+                    const observers::ObservationId& observation_id) noexcept {
+    Parallel::lock(node_lock);
+    const bool has_volume_data =
+        db::get<Tags::VolumeObserversRegistered>(box) != 0;
+    Parallel::unlock(node_lock);
+    if (not has_volume_data) {
+      Parallel::threaded_action<ContributeVolumeLayout>(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache)[0],
+          observation_id, static_cast<size_t>(Parallel::my_node()),
+          VolumeLayout{});
+    }
+  }
+};
+
+/*!
+ * \ingroup ObserverGroup
+ * \brief Write the volume data of this node at `observation_id` into the
+ * datasets of the shared volume file, starting at the point
+ * `node_offsets[my_node]`.
+ *
+ * With collective writes (see ContributeVolumeLayout) all nodes run this
+ * action at once, including those without data, and the first node starts
+ * the next observation with ReleaseSharedVolumeFile once all nodes are done.
+ * Else each node passes the file on to the next node, and the last node
+ * hands the file back to the first node with ReleaseSharedVolumeFile.
+ */
+struct WriteVolumeDataToSharedFile {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock,
+                    const observers::ObservationId& observation_id,
+                    std::vector<size_t>&& node_offsets) noexcept {
     Parallel::lock(node_lock);
     std::unordered_map<observers::ArrayComponentId, ExtentsAndTensorVolumeData>
         volume_data{};
@@ -204,23 +557,89 @@ struct WriteVolumeData {
         });
     Parallel::unlock(node_lock);
 
-    // Write to file. We use a separate node lock because writing can be very
-    // time consuming (it's network dependent, depends on how full the disks
-    // are, what other users are doing, etc.) and we want to be able to continue
-    // to work on the nodegroup while we are writing data to disk.
+    const auto my_node = static_cast<size_t>(Parallel::my_node());
+    const auto grids =
+        VolumeActions_detail::sorted_grids(std::move(volume_data));
+    constexpr bool collective = VolumeActions_detail::collective_volume_writes;
     Parallel::lock(&file_lock);
-    const auto& file_prefix = Parallel::get<OptionTags::VolumeFileName>(cache);
-    h5::H5File<h5::AccessType::ReadWrite> h5file(
-        file_prefix + std::to_string(Parallel::my_node()) + ".h5", true);
-    constexpr size_t version_number = 0;
-    auto& volume_file =
-        h5file.try_insert<h5::VolumeData>("/element_data", version_number);
-    for (const auto& id_and_tensor_data_for_grid : volume_data) {
-      const auto& extents_and_tensors = id_and_tensor_data_for_grid.second;
-      volume_file.insert_tensor_data(
-          observation_id.hash(), observation_id.value(), extents_and_tensors);
+    {
+      h5::H5File<h5::AccessType::ReadWrite> h5file(
+          VolumeActions_detail::shared_volume_file_name(
+              Parallel::get<OptionTags::VolumeFileName>(cache)),
+          true, collective);
+      auto& volume_file = h5file.get<h5::VolumeData>("/element_data");
+      volume_file.write_contiguous_data(
+          observation_id.hash(), node_offsets[my_node], grids,
+          Parallel::get<OptionTags::VolumeOutputSettings>(cache), collective);
     }
+#ifdef H5_HAVE_PARALLEL
+    // No node opens the file for the next observation before all nodes
+    // closed it
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
     Parallel::unlock(&file_lock);
+
+    auto& writer_proxy =
+        Parallel::get_parallel_component<ObserverWriter<Metavariables>>(cache);
+    if (collective) {
+      if (my_node == 0) {
+        Parallel::threaded_action<ReleaseSharedVolumeFile>(writer_proxy[0]);
+      }
+      return;
+    }
+    const auto next_node = my_node + 1;
+    if (next_node < static_cast<size_t>(Parallel::number_of_nodes())) {
+      Parallel::threaded_action<WriteVolumeDataToSharedFile>(
+          writer_proxy[next_node], observation_id, std::move(node_offsets));
+    } else {
+      Parallel::threaded_action<ReleaseSharedVolumeFile>(writer_proxy[0]);
+    }
+  }
+};
+
+/*!
+ * \ingroup ObserverGroup
+ * \brief Start writing the next observation whose layout is complete into
+ * the shared volume file, after all nodes wrote the previous one.
+ */
+struct ReleaseSharedVolumeFile {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const gsl::not_null<CmiNodeLock*> node_lock) noexcept {
+    bool start_writing = false;
+    observers::ObservationId observation_id{};
+    std::vector<VolumeLayout> node_layouts{};
+    CmiNodeLock file_lock;
+    Parallel::lock(node_lock);
+    db::mutate<Tags::SharedVolumeFileQueue>(
+        make_not_null(&box),
+        [&file_lock, &node_layouts, &observation_id, &start_writing ](
+            const gsl::not_null<db::item_type<Tags::SharedVolumeFileQueue>*>
+                queue,
+            const CmiNodeLock& in_file_lock) noexcept {
+          queue->pop_front();
+          if (not queue->empty()) {
+            start_writing = true;
+            observation_id = queue->front().first;
+            node_layouts = std::move(queue->front().second);
+            file_lock = in_file_lock;
+          }
+        },
+        db::get<Tags::VolumeFileLock>(box));
+    Parallel::unlock(node_lock);
+
+    if (start_writing) {
+      VolumeActions_detail::create_shared_volume_datasets(
+          cache, &file_lock, observation_id, node_layouts);
+    }
   }
 };
 }  // namespace ThreadedActions
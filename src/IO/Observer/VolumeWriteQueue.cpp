@@ -0,0 +1,134 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/VolumeWriteQueue.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <pup.h>
+
+#include "ErrorHandling/Assert.hpp"
+
+namespace observers {
+VolumeWriteQueue::VolumeWriteQueue(const size_t capacity) noexcept
+    : capacity_(capacity) {
+  ASSERT(capacity_ > 0, "The capacity of the volume write queue must be "
+                        "positive.");
+  io_thread_ = std::thread([this]() noexcept { write_loop(); });
+}
+
+VolumeWriteQueue::~VolumeWriteQueue() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  write_queued_.notify_one();
+  io_thread_.join();
+}
+
+void VolumeWriteQueue::push(std::function<void()> write,
+                            const size_t number_of_bytes) noexcept {
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto is_full = [this]() noexcept {
+    return writes_.size() + writes_in_progress_ >= capacity_;
+  };
+  if (is_full()) {
+    ++number_of_blocked_pushes_;
+    write_finished_.wait(lock, [&is_full]() noexcept { return not is_full(); });
+  }
+  writes_.emplace_back(std::move(write), number_of_bytes);
+  max_size_ = std::max(max_size_, writes_.size() + writes_in_progress_);
+  lock.unlock();
+  write_queued_.notify_one();
+}
+
+void VolumeWriteQueue::flush() const noexcept {
+  std::unique_lock<std::mutex> lock(mutex_);
+  write_finished_.wait(lock, [this]() noexcept {
+    return writes_.empty() and writes_in_progress_ == 0;
+  });
+}
+
+size_t VolumeWriteQueue::capacity() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return capacity_;
+}
+
+size_t VolumeWriteQueue::size() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return writes_.size() + writes_in_progress_;
+}
+
+size_t VolumeWriteQueue::max_size() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_size_;
+}
+
+size_t VolumeWriteQueue::number_of_blocked_pushes() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return number_of_blocked_pushes_;
+}
+
+size_t VolumeWriteQueue::number_of_writes() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return number_of_writes_;
+}
+
+size_t VolumeWriteQueue::bytes_written() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_written_;
+}
+
+double VolumeWriteQueue::write_time() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return write_time_;
+}
+
+double VolumeWriteQueue::bandwidth() const noexcept {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return write_time_ > 0.0 ? static_cast<double>(bytes_written_) / write_time_
+                           : 0.0;
+}
+
+void VolumeWriteQueue::pup(PUP::er& p) noexcept {
+  if (not p.isUnpacking()) {
+    flush();
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  p | capacity_;
+  p | max_size_;
+  p | number_of_blocked_pushes_;
+  p | number_of_writes_;
+  p | bytes_written_;
+  p | write_time_;
+}
+
+void VolumeWriteQueue::write_loop() noexcept {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    write_queued_.wait(lock, [this]() noexcept {
+      return stop_ or not writes_.empty();
+    });
+    // Queued writes are finished before stopping
+    if (writes_.empty()) {
+      return;
+    }
+    auto write = std::move(writes_.front());
+    writes_.pop_front();
+    ++writes_in_progress_;
+    lock.unlock();
+
+    const auto start = std::chrono::steady_clock::now();
+    write.first();
+    const std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+
+    lock.lock();
+    --writes_in_progress_;
+    ++number_of_writes_;
+    bytes_written_ += write.second;
+    write_time_ += duration.count();
+    write_finished_.notify_all();
+  }
+}
+}  // namespace observers
@@ -0,0 +1,107 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief A bounded queue of volume data writes that are done one after
+ * another by a dedicated I/O thread.
+ *
+ * The compute threads move the data of an observation into a write and
+ * continue while the I/O thread writes it to disk. The queue holds at most
+ * `capacity` writes, including the one being written, so that the memory
+ * held by observations waiting to be written is bounded. With the default
+ * capacity of two, one observation is written while the next one is
+ * collected. When the queue is full `push` blocks until a write finished,
+ * which applies back-pressure to the compute threads when the disk is slower
+ * than the observations.
+ *
+ * The queue records the largest number of writes it held, the number of
+ * pushes that had to wait, and the bytes written and the time spent writing,
+ * from which the write bandwidth is computed.
+ *
+ * \warning The writes run outside of the Charm++ scheduler, so they must not
+ * send messages or invoke actions.
+ */
+class VolumeWriteQueue {
+ public:
+  explicit VolumeWriteQueue(size_t capacity = 2) noexcept;
+  VolumeWriteQueue(const VolumeWriteQueue& /*rhs*/) = delete;
+  VolumeWriteQueue& operator=(const VolumeWriteQueue& /*rhs*/) = delete;
+  VolumeWriteQueue(VolumeWriteQueue&& /*rhs*/) noexcept = delete;
+  VolumeWriteQueue& operator=(VolumeWriteQueue&& /*rhs*/) noexcept = delete;
+  /// Finishes all queued writes
+  ~VolumeWriteQueue() noexcept;
+
+  /// Queue `write`, which writes `number_of_bytes` to disk, waiting while
+  /// the queue is full
+  void push(std::function<void()> write, size_t number_of_bytes) noexcept;
+
+  /// Wait until all queued writes are finished
+  void flush() const noexcept;
+
+  size_t capacity() const noexcept;
+
+  /// The number of writes queued or being written
+  size_t size() const noexcept;
+
+  /// The largest number of writes that were queued or being written at once
+  size_t max_size() const noexcept;
+
+  /// The number of pushes that waited for a write to finish
+  size_t number_of_blocked_pushes() const noexcept;
+
+  size_t number_of_writes() const noexcept;
+
+  size_t bytes_written() const noexcept;
+
+  /// The time in seconds the I/O thread spent writing
+  double write_time() const noexcept;
+
+  /// The bytes written per second spent writing, or zero if nothing was
+  /// written yet
+  double bandwidth() const noexcept;
+
+  /// Finishes all queued writes before serializing
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  void write_loop() noexcept;
+
+  size_t capacity_;
+  std::deque<std::pair<std::function<void()>, size_t>> writes_{};
+  // The writes that were popped from the queue but are not finished yet
+  size_t writes_in_progress_{0};
+  bool stop_{false};
+
+  size_t max_size_{0};
+  size_t number_of_blocked_pushes_{0};
+  size_t number_of_writes_{0};
+  size_t bytes_written_{0};
+  double write_time_{0.0};
+
+  mutable std::mutex mutex_{};
+  // Signals the I/O thread that a write was queued or the queue stops
+  std::condition_variable write_queued_{};
+  // Signals the compute threads that a write finished
+  mutable std::condition_variable write_finished_{};
+  std::thread io_thread_{};
+};
+}  // namespace observers
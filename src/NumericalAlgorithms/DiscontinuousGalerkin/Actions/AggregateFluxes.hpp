@@ -0,0 +1,146 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines the actions of the dg::FluxAggregator
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Printf.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace dg {
+namespace Actions {
+/*!
+ * \ingroup ActionsGroup
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Initializes the DataBox of the dg::FluxAggregator
+ */
+template <typename Metavariables>
+struct InitializeFluxAggregator {
+  using simple_tags = db::AddSimpleTags<::Tags::FluxMessageStatistics<
+      db::item_type<typename Metavariables::temporal_id>>>;
+  using compute_tags = db::AddComputeTags<>;
+
+  using return_tag_list = tmpl::append<simple_tags, compute_tags>;
+
+  template <typename... InboxTags, typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(const db::DataBox<tmpl::list<>>& /*box*/,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    return std::make_tuple(db::create<simple_tags>(
+        db::item_type<tmpl::front<simple_tags>>{}));
+  }
+};
+
+/*!
+ * \ingroup ActionsGroup
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Record the flux messages sent by an element at `temporal_id` in the
+ * dg::FluxMessageStatistics of its node.
+ *
+ * Every `OptionTags::FluxMessageStatisticsInterval` steps the counts are
+ * printed, so that runs with and without `OptionTags::AggregateFluxMessages`
+ * can be compared.  Must only be called if the interval is not zero.
+ */
+struct RecordFluxMessages {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent, typename TemporalId,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/,
+                    const TemporalId& temporal_id,
+                    const size_t number_of_messages,
+                    const size_t number_of_mortars) noexcept {
+    db::mutate<::Tags::FluxMessageStatistics<TemporalId>>(
+        make_not_null(&box),
+        [&cache, &temporal_id, &number_of_messages, &number_of_mortars ](
+            const gsl::not_null<FluxMessageStatistics<TemporalId>*>
+                statistics) noexcept {
+          const bool new_step =
+              statistics->record(temporal_id, number_of_messages,
+                                 number_of_mortars, Parallel::wall_time());
+          const size_t interval =
+              Parallel::get<OptionTags::FluxMessageStatisticsInterval>(cache);
+          if (new_step and statistics->number_of_steps() % interval == 0) {
+            Parallel::printf(
+                "Node %d sent %zu flux messages for %zu mortars in %zu "
+                "steps, %g seconds per step\n",
+                Parallel::my_node(), statistics->number_of_messages(),
+                statistics->number_of_mortars(),
+                statistics->number_of_steps(),
+                statistics->mean_step_wall_time());
+          }
+        });
+  }
+};
+}  // namespace Actions
+
+namespace ThreadedActions {
+/*!
+ * \ingroup ActionsGroup
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief Deliver the flux messages batched by SendDataForFluxes into the
+ * inboxes of the elements of `ReceiverComponent`.
+ *
+ * The receivers are on the node of the dg::FluxAggregator, unless they
+ * migrated since the sender last learned their location, so the messages
+ * usually stay on the node.  Data for receivers on the processor running
+ * this action is moved into their inboxes without copying, which continues
+ * their algorithms right away.  This is a threaded action so that the node
+ * lock is not held meanwhile, since the receivers may record their own
+ * messages with RecordFluxMessages.
+ */
+template <typename ReceiverComponent>
+struct ReceiveAggregatedFluxes {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<sizeof...(DbTags) != 0> = nullptr>
+  static void apply(
+      db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+      tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::ConstGlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/,
+      const gsl::not_null<CmiNodeLock*> /*node_lock*/,
+      const typename FluxCommunicationTypes<
+          Metavariables>::FluxesTag::temporal_id& temporal_id,
+      typename FluxCommunicationTypes<Metavariables>::AggregatedFluxes&&
+          fluxes) noexcept {
+    auto& receiver_proxy =
+        Parallel::get_parallel_component<ReceiverComponent>(cache);
+    for (auto& receiver_and_message : fluxes) {
+      Parallel::receive_data_without_local_copy<
+          typename FluxCommunicationTypes<Metavariables>::FluxesTag>(
+          receiver_proxy[receiver_and_message.first], temporal_id,
+          std::move(receiver_and_message.second));
+    }
+  }
+};
+}  // namespace ThreadedActions
+}  // namespace dg
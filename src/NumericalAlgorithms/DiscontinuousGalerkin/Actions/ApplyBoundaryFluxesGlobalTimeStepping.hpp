@@ -5,12 +5,15 @@
 
 #include <cstddef>
 #include <tuple>
+#include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/VariablesHelpers.hpp"
+#include "Domain/Direction.hpp"
 #include "Domain/IndexToSliceAt.hpp"
+#include "Domain/Mesh.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"  // IWYU pragma: keep // for db::item_type<Tags::Mortars<...>>
@@ -30,6 +33,32 @@ struct Mesh;
 /// \endcond
 
 namespace dg {
+namespace ApplyBoundaryFluxesGlobalTimeStepping_detail {
+// Lift the numerical flux computed from the local and remote data on one
+// mortar and add it to the time derivatives on the face in `direction`.
+template <typename FluxCommTypes, typename DtVariables, size_t VolumeDim,
+          typename NumericalFlux, typename BoundaryData, typename MortarMesh,
+          typename MortarSize>
+void lift_mortar_flux(const gsl::not_null<DtVariables*> dt_vars,
+                      const NumericalFlux& normal_dot_numerical_flux_computer,
+                      BoundaryData data, const Direction<VolumeDim>& direction,
+                      const Mesh<VolumeDim>& mesh,
+                      const MortarMesh& mortar_mesh,
+                      const MortarSize& mortar_size) noexcept {
+  const size_t dimension = direction.dimension();
+  auto& local_mortar_data = data.first;
+  const auto& remote_mortar_data = data.second;
+
+  DtVariables lifted_data(compute_boundary_flux_contribution<FluxCommTypes>(
+      normal_dot_numerical_flux_computer, std::move(local_mortar_data),
+      remote_mortar_data, mesh.slice_away(dimension), mortar_mesh,
+      mesh.extents(dimension), mortar_size));
+
+  add_slice_to_data(dt_vars, lifted_data, mesh.extents(), dimension,
+                    index_to_slice_at(mesh.extents(), direction));
+}
+}  // namespace ApplyBoundaryFluxesGlobalTimeStepping_detail
+
 namespace Actions {
 /// \ingroup ActionsGroup
 /// \ingroup DiscontinuousGalerkinGroup
@@ -88,22 +117,12 @@ struct ApplyBoundaryFluxesGlobalTimeStepping {
 
           for (auto& this_mortar_data : *mortar_data) {
             const auto& mortar_id = this_mortar_data.first;
-            const auto& direction = mortar_id.first;
-            const size_t dimension = direction.dimension();
-
-            auto data = this_mortar_data.second.extract();
-            auto& local_mortar_data = data.first;
-            const auto& remote_mortar_data = data.second;
-
-            db::item_type<dt_variables_tag> lifted_data(
-                compute_boundary_flux_contribution<flux_comm_types>(
-                    normal_dot_numerical_flux_computer,
-                    std::move(local_mortar_data), remote_mortar_data,
-                    mesh.slice_away(dimension), mortar_meshes.at(mortar_id),
-                    mesh.extents(dimension), mortar_sizes.at(mortar_id)));
-
-            add_slice_to_data(dt_vars, lifted_data, mesh.extents(), dimension,
-                              index_to_slice_at(mesh.extents(), direction));
+            ApplyBoundaryFluxesGlobalTimeStepping_detail::lift_mortar_flux<
+                flux_comm_types>(dt_vars, normal_dot_numerical_flux_computer,
+                                 this_mortar_data.second.extract(),
+                                 mortar_id.first, mesh,
+                                 mortar_meshes.at(mortar_id),
+                                 mortar_sizes.at(mortar_id));
           }
         },
         db::get<Tags::Mesh<volume_dim>>(box),
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -17,16 +18,23 @@
 #include "Domain/FaceNormal.hpp"
 #include "Domain/Tags.hpp"
 #include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/AggregateFluxes.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MortarHelpers.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 /// \cond
+namespace dg {
+template <class Metavariables>
+struct FluxAggregator;
+}  // namespace dg
 namespace Tags {
 template <typename Tag>
 struct Magnitude;
@@ -37,6 +45,97 @@ struct Next;
 /// \endcond
 
 namespace dg {
+namespace FluxCommunication_detail {
+template <typename Metavariables>
+constexpr bool has_flux_aggregator_v =
+    tmpl::list_contains_v<typename Metavariables::component_list,
+                          FluxAggregator<Metavariables>>;
+
+template <typename ParallelComponent, typename Metavariables>
+void send_fluxes_directly(
+    Parallel::ConstGlobalCache<Metavariables>& cache,
+    const typename FluxCommunicationTypes<
+        Metavariables>::FluxesTag::temporal_id& temporal_id,
+    typename FluxCommunicationTypes<Metavariables>::AggregatedFluxes&&
+        messages) noexcept {
+  auto& receiver_proxy =
+      Parallel::get_parallel_component<ParallelComponent>(cache);
+  for (auto& receiver_and_message : messages) {
+    Parallel::receive_data_without_local_copy<
+        typename FluxCommunicationTypes<Metavariables>::FluxesTag>(
+        receiver_proxy[receiver_and_message.first], temporal_id,
+        std::move(receiver_and_message.second));
+  }
+}
+
+template <typename ParallelComponent, typename Metavariables,
+          Requires<not has_flux_aggregator_v<Metavariables>> = nullptr>
+void send_fluxes(
+    Parallel::ConstGlobalCache<Metavariables>& cache,
+    const typename FluxCommunicationTypes<
+        Metavariables>::FluxesTag::temporal_id& temporal_id,
+    typename FluxCommunicationTypes<Metavariables>::AggregatedFluxes&&
+        messages) noexcept {
+  send_fluxes_directly<ParallelComponent>(cache, temporal_id,
+                                          std::move(messages));
+}
+
+template <typename ParallelComponent, typename Metavariables,
+          Requires<has_flux_aggregator_v<Metavariables>> = nullptr>
+void send_fluxes(
+    Parallel::ConstGlobalCache<Metavariables>& cache,
+    const typename FluxCommunicationTypes<
+        Metavariables>::FluxesTag::temporal_id& temporal_id,
+    typename FluxCommunicationTypes<Metavariables>::AggregatedFluxes&&
+        messages) noexcept {
+  using AggregatedFluxes =
+      typename FluxCommunicationTypes<Metavariables>::AggregatedFluxes;
+  using FluxesTag = typename FluxCommunicationTypes<Metavariables>::FluxesTag;
+  auto& receiver_proxy =
+      Parallel::get_parallel_component<ParallelComponent>(cache);
+  auto& aggregator_proxy =
+      Parallel::get_parallel_component<FluxAggregator<Metavariables>>(cache);
+  const bool aggregate =
+      Parallel::get<OptionTags::AggregateFluxMessages>(cache);
+  const size_t number_of_mortars = messages.size();
+  size_t number_of_messages = 0;
+  std::unordered_map<int, AggregatedFluxes> messages_to_nodes{};
+  for (auto& receiver_and_message : messages) {
+    auto receiver = receiver_proxy[receiver_and_message.first];
+    // Data for elements on this processor is moved into their inboxes
+    // without sending a message
+    auto* const local_receiver = receiver.ckLocal();
+    if (local_receiver != nullptr) {
+      local_receiver->template receive_data<FluxesTag>(
+          temporal_id, std::move(receiver_and_message.second));
+    } else if (aggregate) {
+      // If the receiver migrated since its location was last known here,
+      // Charm++ forwards the message from the aggregator.
+      const int node = Parallel::node_of(
+          receiver_proxy.ckLocalBranch()->lastKnown(receiver.ckGetIndex()));
+      messages_to_nodes[node].push_back(std::move(receiver_and_message));
+    } else {
+      Parallel::receive_data<FluxesTag>(
+          receiver, temporal_id, std::move(receiver_and_message.second));
+      ++number_of_messages;
+    }
+  }
+  number_of_messages += messages_to_nodes.size();
+  for (auto& node_and_messages : messages_to_nodes) {
+    Parallel::threaded_action<
+        ThreadedActions::ReceiveAggregatedFluxes<ParallelComponent>>(
+        aggregator_proxy[node_and_messages.first], temporal_id,
+        std::move(node_and_messages.second));
+  }
+
+  if (Parallel::get<OptionTags::FluxMessageStatisticsInterval>(cache) > 0) {
+    Parallel::simple_action<Actions::RecordFluxMessages>(
+        *aggregator_proxy.ckLocalBranch(), temporal_id, number_of_messages,
+        number_of_mortars);
+  }
+}
+}  // namespace FluxCommunication_detail
+
 namespace Actions {
 /// \ingroup ActionsGroup
 /// \ingroup DiscontinuousGalerkinGroup
@@ -53,6 +152,10 @@ namespace Actions {
 ///   - Tags::Mortars<Tags::Next<Metavariables::temporal_id>, volume_dim>
 ///   - Tags::VariablesBoundaryData
 ///
+/// The received data is held in a dg::MortarInbox, which counts the mortars
+/// whose data is complete as messages arrive, so `is_ready` does not search
+/// the inbox for every mortar.
+///
 /// \see SendDataForFluxes
 template <typename Metavariables>
 struct ReceiveDataForFluxes {
@@ -88,25 +191,21 @@ struct ReceiveDataForFluxes {
                        local_next_temporal_id) noexcept {
           auto& inbox =
               tuples::get<typename flux_comm_types::FluxesTag>(inboxes);
-          for (auto received_data = inbox.begin();
-               received_data != inbox.end() and
-                   received_data->first < local_next_temporal_id;
-               received_data = inbox.erase(received_data)) {
-            const auto& receive_temporal_id = received_data->first;
-            for (auto& received_mortar_data : received_data->second) {
-              const auto mortar_id = received_mortar_data.first;
-              ASSERT(neighbor_next_temporal_ids->at(mortar_id) ==
-                         receive_temporal_id,
-                     "Expected data at "
-                     << neighbor_next_temporal_ids->at(mortar_id)
-                     << " but received at " << receive_temporal_id);
-              neighbor_next_temporal_ids->at(mortar_id) =
-                  received_mortar_data.second.first;
-              mortar_data->at(mortar_id).remote_insert(
-                  receive_temporal_id,
-                  std::move(received_mortar_data.second.second));
-            }
-          }
+          inbox.extract_before(
+              local_next_temporal_id,
+              [&mortar_data, &neighbor_next_temporal_ids](
+                  auto receive_temporal_id, const auto& mortar_id,
+                  auto next_temporal_id, auto received_data) noexcept {
+                ASSERT(neighbor_next_temporal_ids->at(mortar_id) ==
+                           receive_temporal_id,
+                       "Expected data at "
+                       << neighbor_next_temporal_ids->at(mortar_id)
+                       << " but received at " << receive_temporal_id);
+                neighbor_next_temporal_ids->at(mortar_id) =
+                    std::move(next_temporal_id);
+                mortar_data->at(mortar_id).remote_insert(
+                    std::move(receive_temporal_id), std::move(received_data));
+              });
 
           // The apparently pointless lambda wrapping this check
           // prevents gcc-7.3.0 from segfaulting.
@@ -121,12 +220,10 @@ struct ReceiveDataForFluxes {
                        });
                  }()),
                  "apply called before all data received");
-          ASSERT(
-              inbox.empty() or (inbox.size() == 1 and
-                                inbox.begin()->first == local_next_temporal_id),
-              "Shouldn't have received data that depended upon the step being "
-              "taken: Received data at " << inbox.begin()->first
-              << " while stepping to " << local_next_temporal_id);
+          ASSERT(inbox.size() == inbox.count(local_next_temporal_id),
+                 "Shouldn't have received data that depended upon the step "
+                 "being taken while stepping to "
+                 << local_next_temporal_id);
         },
         db::get<Tags::Next<temporal_id_tag>>(box));
 
@@ -142,28 +239,10 @@ struct ReceiveDataForFluxes {
     constexpr size_t volume_dim = Metavariables::system::volume_dim;
     using temporal_id = typename Metavariables::temporal_id;
 
-    const auto& inbox =
-        tuples::get<typename flux_comm_types::FluxesTag>(inboxes);
-
-    const auto& local_next_temporal_id = db::get<Tags::Next<temporal_id>>(box);
-    const auto& mortars_next_temporal_id =
-        db::get<Tags::Mortars<Tags::Next<temporal_id>, volume_dim>>(box);
-    for (const auto& mortar_id_next_temporal_id : mortars_next_temporal_id) {
-      const auto& mortar_id = mortar_id_next_temporal_id.first;
-      auto next_temporal_id = mortar_id_next_temporal_id.second;
-      while (next_temporal_id < local_next_temporal_id) {
-        const auto temporal_received = inbox.find(next_temporal_id);
-        if (temporal_received == inbox.end()) {
-          return false;
-        }
-        const auto mortar_received = temporal_received->second.find(mortar_id);
-        if (mortar_received == temporal_received->second.end()) {
-          return false;
-        }
-        next_temporal_id = mortar_received->second.first;
-      }
-    }
-    return true;
+    return tuples::get<typename flux_comm_types::FluxesTag>(inboxes)
+        .is_ready(
+            db::get<Tags::Mortars<Tags::Next<temporal_id>, volume_dim>>(box),
+            db::get<Tags::Next<temporal_id>>(box));
   }
 };
 
@@ -193,6 +272,12 @@ struct ReceiveDataForFluxes {
 /// - Removes: nothing
 /// - Modifies: Tags::VariablesBoundaryData
 ///
+/// The data for neighbors on the same processor is moved into their inboxes
+/// without being serialized or copied.  If the dg::FluxAggregator is one of
+/// the parallel components and the `AggregateFluxMessages` option is set, the
+/// data for all other neighbors on the same node is sent in one message
+/// through the dg::FluxAggregator.
+///
 /// \see ReceiveDataForFluxes
 template <typename Metavariables>
 struct SendDataForFluxes {
@@ -220,14 +305,12 @@ struct SendDataForFluxes {
     const auto& normal_dot_numerical_flux_computer =
         get<typename Metavariables::normal_dot_numerical_flux>(cache);
 
-    auto& receiver_proxy =
-        Parallel::get_parallel_component<ParallelComponent>(cache);
-
     const auto& element = db::get<Tags::Element<volume_dim>>(box);
     const auto& temporal_id = db::get<typename Metavariables::temporal_id>(box);
     const auto& next_temporal_id =
         db::get<Tags::Next<typename Metavariables::temporal_id>>(box);
 
+    typename flux_comm_types::AggregatedFluxes messages{};
     for (const auto& direction_neighbors : element.neighbors()) {
       const auto& direction = direction_neighbors.first;
       const size_t dimension = direction.dimension();
@@ -302,8 +385,8 @@ struct SendDataForFluxes {
               orientation);
         }
 
-        Parallel::receive_data<typename flux_comm_types::FluxesTag>(
-            receiver_proxy[neighbor], temporal_id,
+        messages.emplace_back(
+            neighbor,
             std::make_pair(
                 std::make_pair(direction_from_neighbor, element.id()),
                 std::make_pair(next_temporal_id,
@@ -321,6 +404,9 @@ struct SendDataForFluxes {
       }  // loop over neighbors_in_direction
     }    // loop over element.neighbors()
 
+    FluxCommunication_detail::send_fluxes<ParallelComponent>(
+        cache, temporal_id, std::move(messages));
+
     return std::forward_as_tuple(std::move(box));
   }
 };
@@ -0,0 +1,198 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "Domain/Tags.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ApplyBoundaryFluxesGlobalTimeStepping.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+// IWYU pragma: no_forward_declare db::DataBox
+/// \endcond
+
+namespace dg {
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Receive the boundary data from the neighbors and add the lifted
+/// boundary fluxes to the time derivative one mortar at a time, for use in
+/// global time stepping.
+///
+/// This replaces ReceiveDataForFluxes followed by
+/// ApplyBoundaryFluxesGlobalTimeStepping when the volume time derivative is
+/// computed between SendDataForFluxes and this action, so that the volume
+/// work overlaps with the communication.  The action is ready as soon as the
+/// data of any neighbor arrived.  It lifts the fluxes on the mortars whose
+/// data is available and repeats itself until all mortars are done, so the
+/// lifting of the first mortars also overlaps with the communication of the
+/// others.  Since the action repeats itself, it can appear only once in the
+/// action list.
+///
+/// Uses:
+/// - ConstGlobalCache: Metavariables::normal_dot_numerical_flux
+/// - DataBox:
+///   - Tags::Next<Metavariables::temporal_id>
+///   - Tags::Mesh<volume_dim>
+///   - Tags::Mortars<Tags::Mesh<volume_dim - 1>, volume_dim>
+///   - Tags::Mortars<Tags::MortarSize<volume_dim - 1>, volume_dim>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - db::add_tag_prefix<Tags::dt, variables_tag>
+///   - Tags::Mortars<Tags::Next<Metavariables::temporal_id>, volume_dim>
+///   - FluxCommunicationTypes<Metavariables>::simple_mortar_data_tag
+///
+/// \see SendDataForFluxes
+template <typename Metavariables>
+struct ReceiveAndApplyBoundaryFluxes {
+  using const_global_cache_tags =
+      tmpl::list<typename Metavariables::normal_dot_numerical_flux>;
+
+ private:
+  using flux_comm_types = FluxCommunicationTypes<Metavariables>;
+  static constexpr size_t volume_dim = Metavariables::system::volume_dim;
+  using temporal_id_tag = typename Metavariables::temporal_id;
+  using neighbor_temporal_id_tag =
+      Tags::Mortars<Tags::Next<temporal_id_tag>, volume_dim>;
+
+  template <typename NeighborNextTemporalIds, typename TemporalId>
+  static size_t number_of_received_mortars(
+      const NeighborNextTemporalIds& neighbor_next_temporal_ids,
+      const TemporalId& local_next_temporal_id) noexcept {
+    return static_cast<size_t>(std::count_if(
+        neighbor_next_temporal_ids.begin(), neighbor_next_temporal_ids.end(),
+        [&local_next_temporal_id](const auto& next) noexcept {
+          return not(next.second < local_next_temporal_id);
+        }));
+  }
+
+ public:
+  using inbox_tags = tmpl::list<typename flux_comm_types::FluxesTag>;
+
+  template <typename DbTags, typename... InboxTags, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent>
+  static std::tuple<db::DataBox<DbTags>&&, bool, size_t> apply(
+      db::DataBox<DbTags>& box, tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::ConstGlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) noexcept {
+    static_assert(not Metavariables::local_time_stepping,
+                  "ReceiveAndApplyBoundaryFluxes cannot be used with local "
+                  "time-stepping.");
+
+    using variables_tag = typename Metavariables::system::variables_tag;
+    using dt_variables_tag = db::add_tag_prefix<Tags::dt, variables_tag>;
+    using mortar_data_tag = typename flux_comm_types::simple_mortar_data_tag;
+
+    bool all_mortars_received = false;
+    db::mutate<dt_variables_tag, mortar_data_tag, neighbor_temporal_id_tag>(
+        make_not_null(&box),
+        [&all_mortars_received, &cache, &inboxes ](
+            const gsl::not_null<db::item_type<dt_variables_tag>*> dt_vars,
+            const gsl::not_null<db::item_type<mortar_data_tag>*> mortar_data,
+            const gsl::not_null<db::item_type<neighbor_temporal_id_tag>*>
+                neighbor_next_temporal_ids,
+            const db::item_type<Tags::Next<temporal_id_tag>>&
+                local_next_temporal_id,
+            const db::item_type<Tags::Mesh<volume_dim>>& mesh,
+            const db::item_type<
+                Tags::Mortars<Tags::Mesh<volume_dim - 1>, volume_dim>>&
+                mortar_meshes,
+            const db::item_type<
+                Tags::Mortars<Tags::MortarSize<volume_dim - 1>, volume_dim>>&
+                mortar_sizes) noexcept {
+          const auto& normal_dot_numerical_flux_computer =
+              get<typename Metavariables::normal_dot_numerical_flux>(cache);
+          tuples::get<typename flux_comm_types::FluxesTag>(inboxes)
+              .extract_before(
+                  local_next_temporal_id,
+                  [
+                    &dt_vars, &mesh, &mortar_data, &mortar_meshes,
+                    &mortar_sizes, &neighbor_next_temporal_ids,
+                    &normal_dot_numerical_flux_computer
+                  ](auto receive_temporal_id, const auto& mortar_id,
+                    auto next_temporal_id, auto received_data) noexcept {
+                    ASSERT(neighbor_next_temporal_ids->at(mortar_id) ==
+                               receive_temporal_id,
+                           "Expected data at "
+                           << neighbor_next_temporal_ids->at(mortar_id)
+                           << " but received at " << receive_temporal_id);
+                    neighbor_next_temporal_ids->at(mortar_id) =
+                        std::move(next_temporal_id);
+                    auto& this_mortar_data = mortar_data->at(mortar_id);
+                    this_mortar_data.remote_insert(
+                        std::move(receive_temporal_id),
+                        std::move(received_data));
+                    ApplyBoundaryFluxesGlobalTimeStepping_detail::
+                        lift_mortar_flux<flux_comm_types>(
+                            dt_vars, normal_dot_numerical_flux_computer,
+                            this_mortar_data.extract(), mortar_id.first, mesh,
+                            mortar_meshes.at(mortar_id),
+                            mortar_sizes.at(mortar_id));
+                  });
+          all_mortars_received =
+              number_of_received_mortars(*neighbor_next_temporal_ids,
+                                         local_next_temporal_id) ==
+              neighbor_next_temporal_ids->size();
+        },
+        db::get<Tags::Next<temporal_id_tag>>(box),
+        db::get<Tags::Mesh<volume_dim>>(box),
+        db::get<Tags::Mortars<Tags::Mesh<volume_dim - 1>, volume_dim>>(box),
+        db::get<Tags::Mortars<Tags::MortarSize<volume_dim - 1>, volume_dim>>(
+            box));
+
+    using this_action = ReceiveAndApplyBoundaryFluxes;
+    static_assert(
+        tmpl::count_if<ActionList,
+                       std::is_same<tmpl::_1, tmpl::pin<this_action>>>::value ==
+            1,
+        "ReceiveAndApplyBoundaryFluxes repeats itself, so it can only appear "
+        "once in the action list.");
+    constexpr size_t this_action_index =
+        tmpl::index_of<ActionList, this_action>::value;
+    return std::tuple<db::DataBox<DbTags>&&, bool, size_t>(
+        std::move(box), false,
+        all_mortars_received ? this_action_index + 1 : this_action_index);
+  }
+
+  template <typename DbTags, typename... InboxTags, typename ArrayIndex>
+  static bool is_ready(
+      const db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/) noexcept {
+    const auto& local_next_temporal_id =
+        db::get<Tags::Next<temporal_id_tag>>(box);
+    const auto& neighbor_next_temporal_ids =
+        db::get<neighbor_temporal_id_tag>(box);
+    const size_t received = number_of_received_mortars(
+        neighbor_next_temporal_ids, local_next_temporal_id);
+    // Ready when there is nothing to wait for or some mortar that has not
+    // been lifted yet has all its data
+    return received == neighbor_next_temporal_ids.size() or
+           tuples::get<typename flux_comm_types::FluxesTag>(inboxes)
+                   .number_of_ready_mortars(neighbor_next_temporal_ids,
+                                            local_next_temporal_id) >
+               received;
+  }
+};
+}  // namespace Actions
+}  // namespace dg
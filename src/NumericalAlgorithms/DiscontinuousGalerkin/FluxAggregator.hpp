@@ -0,0 +1,59 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "AlgorithmNodegroup.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/AggregateFluxes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace dg {
+/*!
+ * \ingroup DiscontinuousGalerkinGroup
+ * \brief The nodegroup parallel component that delivers batched flux messages
+ * to the elements on its node.
+ *
+ * Adding this component to the `component_list` of the metavariables enables
+ * the `AggregateFluxMessages` option.  With it, dg::Actions::SendDataForFluxes
+ * sends the boundary data of all mortars whose neighbors are on the same node
+ * in one message to this component, which passes them on to the inboxes of
+ * the neighbors (see dg::ThreadedActions::ReceiveAggregatedFluxes).  Elements
+ * with many small mortars then send one message per node they border instead
+ * of one per mortar.
+ *
+ * The `FluxMessageStatisticsInterval` option makes each node count the
+ * messages sent from its elements, with and without aggregation, and
+ * periodically print the counts with the mean wall time per step.
+ */
+template <class Metavariables>
+struct FluxAggregator {
+  using chare_type = Parallel::Algorithms::Nodegroup;
+  using const_global_cache_tag_list =
+      tmpl::list<OptionTags::AggregateFluxMessages,
+                 OptionTags::FluxMessageStatisticsInterval>;
+  using metavariables = Metavariables;
+  using action_list = tmpl::list<>;
+
+  using initial_databox =
+      db::compute_databox_type<typename Actions::InitializeFluxAggregator<
+          Metavariables>::return_tag_list>;
+
+  using options = tmpl::list<>;
+
+  static void initialize(
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) noexcept {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    Parallel::simple_action<Actions::InitializeFluxAggregator<Metavariables>>(
+        Parallel::get_parallel_component<FluxAggregator>(local_cache));
+  }
+
+  static void execute_next_phase(
+      const typename Metavariables::Phase /*next_phase*/,
+      Parallel::CProxy_ConstGlobalCache<
+          Metavariables>& /*global_cache*/) noexcept {}
+};
+}  // namespace dg
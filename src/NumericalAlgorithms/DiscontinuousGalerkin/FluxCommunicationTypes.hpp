@@ -3,11 +3,9 @@
 
 #pragma once
 
-#include <boost/functional/hash.hpp>  // IWYU pragma: keep
 #include <cstddef>
-#include <map>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
@@ -18,8 +16,10 @@
 #include "Domain/Direction.hpp"  // IWYU pragma: keep
 #include "Domain/ElementId.hpp"  // IWYU pragma: keep
 #include "Domain/Tags.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MortarInbox.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
 #include "Time/Tags.hpp"  // IWYU pragma: keep
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -90,16 +90,33 @@ struct FluxCommunicationTypes {
                             db::item_type<typename system::variables_tag>>,
       volume_dim>;
 
+  /// The data received in FluxesTag from one neighbor: the mortar as seen
+  /// from the receiver, and the next temporal id of the sender with its
+  /// packaged data.
+  using FluxesMessage = std::pair<
+      std::pair<Direction<volume_dim>, ElementId<volume_dim>>,
+      std::pair<db::item_type<typename Metavariables::temporal_id>,
+                PackagedData>>;
+
   /// The inbox tag for flux communication.
   struct FluxesTag {
     using temporal_id = db::item_type<typename Metavariables::temporal_id>;
-    using type = std::map<
-        temporal_id,
-        std::unordered_map<
-            std::pair<Direction<volume_dim>, ElementId<volume_dim>>,
-            std::pair<temporal_id, PackagedData>,
-            boost::hash<
-                std::pair<Direction<volume_dim>, ElementId<volume_dim>>>>>;
+    using type = MortarInbox<volume_dim, temporal_id, PackagedData>;
+
+    /// Called by the algorithm instead of inserting into a map, since the
+    /// inbox is not keyed by the temporal id.
+    static void insert_into_inbox(const gsl::not_null<type*> inbox,
+                                  const temporal_id& instance,
+                                  FluxesMessage message) noexcept {
+      inbox->insert(instance, message.first,
+                    std::move(message.second.first),
+                    std::move(message.second.second));
+    }
   };
+
+  /// The messages sent to the elements on one node in a single message by
+  /// the dg::FluxAggregator, each with the id of its receiver.
+  using AggregatedFluxes =
+      std::vector<std::pair<ElementId<volume_dim>, FluxesMessage>>;
 };
 }  // namespace dg
@@ -0,0 +1,87 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>  // IWYU pragma: keep
+#include <utility>
+
+namespace dg {
+
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief Counts of the flux messages sent from the elements on a node
+///
+/// The elements report how many messages they sent and how many mortars they
+/// sent data for.  Without aggregation every mortar with a neighbor on
+/// another processor is sent in its own message, so comparing the two counts
+/// shows how many messages the dg::FluxAggregator and the handing over of
+/// data on the same processor saved.  A step starts whenever a report
+/// arrives with a temporal id later than all earlier ones, and the wall time
+/// between the first and the latest step gives the mean time per step.
+template <typename TemporalId>
+class FluxMessageStatistics {
+ public:
+  /// Record that an element sent `number_of_messages` messages covering
+  /// `number_of_mortars` mortars at `temporal_id`, with the wall time of the
+  /// report.  Returns whether the report started a new step.
+  bool record(const TemporalId& temporal_id, size_t number_of_messages,
+              size_t number_of_mortars, double wall_time) noexcept;
+
+  size_t number_of_messages() const noexcept { return number_of_messages_; }
+  size_t number_of_mortars() const noexcept { return number_of_mortars_; }
+  size_t number_of_steps() const noexcept { return number_of_steps_; }
+
+  /// The mean wall time between the starts of consecutive steps, or zero if
+  /// fewer than two steps were recorded.
+  double mean_step_wall_time() const noexcept;
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  size_t number_of_messages_{0};
+  size_t number_of_mortars_{0};
+  size_t number_of_steps_{0};
+  TemporalId latest_temporal_id_{};
+  double first_step_wall_time_{0.0};
+  double latest_step_wall_time_{0.0};
+};
+
+template <typename TemporalId>
+bool FluxMessageStatistics<TemporalId>::record(
+    const TemporalId& temporal_id, const size_t number_of_messages,
+    const size_t number_of_mortars, const double wall_time) noexcept {
+  number_of_messages_ += number_of_messages;
+  number_of_mortars_ += number_of_mortars;
+  if (number_of_steps_ != 0 and not(latest_temporal_id_ < temporal_id)) {
+    return false;
+  }
+  if (number_of_steps_ == 0) {
+    first_step_wall_time_ = wall_time;
+  }
+  ++number_of_steps_;
+  latest_temporal_id_ = temporal_id;
+  latest_step_wall_time_ = wall_time;
+  return true;
+}
+
+template <typename TemporalId>
+double FluxMessageStatistics<TemporalId>::mean_step_wall_time() const
+    noexcept {
+  return number_of_steps_ < 2
+             ? 0.0
+             : (latest_step_wall_time_ - first_step_wall_time_) /
+                   static_cast<double>(number_of_steps_ - 1);
+}
+
+template <typename TemporalId>
+void FluxMessageStatistics<TemporalId>::pup(PUP::er& p) noexcept {
+  p | number_of_messages_;
+  p | number_of_mortars_;
+  p | number_of_steps_;
+  p | latest_temporal_id_;
+  p | first_step_wall_time_;
+  p | latest_step_wall_time_;
+}
+}  // namespace dg
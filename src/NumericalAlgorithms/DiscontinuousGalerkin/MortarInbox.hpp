@@ -0,0 +1,304 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <pup.h>
+#include <pup_stl.h>  // IWYU pragma: keep
+#include <utility>
+#include <vector>
+
+#include "Domain/Direction.hpp"
+#include "Domain/ElementId.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Parallel/PupStlCpp11.hpp"  // IWYU pragma: keep
+
+namespace dg {
+
+/// \ingroup DiscontinuousGalerkinGroup
+/// \brief The inbox of an element for the boundary data sent by its
+/// neighbors
+///
+/// Each mortar has a slot holding the messages received on it in order of
+/// their temporal ids.  With global time stepping a slot holds at most one
+/// or two messages, with local time stepping it holds the steps of a faster
+/// neighbor.  A message contains the temporal id at which it was sent and
+/// the next temporal id of the sender, so that the messages on a mortar form
+/// a chain, starting from the temporal id the receiver expects next on that
+/// mortar.
+///
+/// The number of mortars whose chain reaches the next temporal id of the
+/// receiver is counted as the messages arrive, so that `is_ready` only
+/// compares two counters unless the next temporal id of the receiver
+/// changed since the last call.  The slots are created when the first
+/// message on a mortar arrives and are reused for all later steps.
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+class MortarInbox {
+ public:
+  using MortarId = std::pair<Direction<VolumeDim>, ElementId<VolumeDim>>;
+
+  /// Store the `data` received on the mortar `mortar_id`, sent at
+  /// `temporal_id` by a neighbor whose next temporal id is
+  /// `next_temporal_id`.
+  void insert(TemporalId temporal_id, const MortarId& mortar_id,
+              TemporalId next_temporal_id, RemoteData data) noexcept;
+
+  /// The number of mortars in `mortar_next_temporal_ids`, a map from the
+  /// mortars to the temporal id expected next on them, whose data has been
+  /// received up to `local_next_temporal_id`.  This includes the mortars
+  /// that need no further data.
+  template <typename MortarNextTemporalIds>
+  size_t number_of_ready_mortars(
+      const MortarNextTemporalIds& mortar_next_temporal_ids,
+      const TemporalId& local_next_temporal_id) const noexcept;
+
+  /// Whether the data on every mortar in `mortar_next_temporal_ids` has been
+  /// received up to `local_next_temporal_id`.
+  template <typename MortarNextTemporalIds>
+  bool is_ready(const MortarNextTemporalIds& mortar_next_temporal_ids,
+                const TemporalId& local_next_temporal_id) const noexcept {
+    return number_of_ready_mortars(mortar_next_temporal_ids,
+                                   local_next_temporal_id) ==
+           mortar_next_temporal_ids.size();
+  }
+
+  /// Remove all messages sent before `local_next_temporal_id`, calling
+  /// `f(temporal_id, mortar_id, next_temporal_id, data)` for each of them.
+  /// The messages on each mortar are passed in order.
+  template <typename F>
+  void extract_before(const TemporalId& local_next_temporal_id, F&& f) noexcept;
+
+  /// The number of messages held
+  size_t size() const noexcept;
+  bool empty() const noexcept { return size() == 0; }
+
+  /// The number of mortars with a message sent at `temporal_id`
+  size_t count(const TemporalId& temporal_id) const noexcept;
+
+  /// The number of messages sent at `temporal_id` on `mortar_id`
+  size_t count(const TemporalId& temporal_id, const MortarId& mortar_id) const
+      noexcept;
+
+  /// The next temporal id of the sender and the data of the message sent at
+  /// `temporal_id` on `mortar_id`
+  const std::pair<TemporalId, RemoteData>& at(
+      const TemporalId& temporal_id, const MortarId& mortar_id) const noexcept;
+
+  /// Remove all messages
+  void clear() noexcept;
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  using Message = std::pair<TemporalId, std::pair<TemporalId, RemoteData>>;
+
+  struct Slot {
+    MortarId mortar_id{};
+    std::deque<Message> messages{};
+    // The temporal id expected next on the mortar, which is known once the
+    // slot took part in a readiness check or had messages extracted
+    TemporalId expected{};
+    bool expected_known{false};
+
+    // Whether the chain of messages starting at `expected` reaches `target`
+    bool reaches(const TemporalId& target) const noexcept;
+
+    // clang-tidy: google-runtime-references
+    void pup(PUP::er& p) noexcept {  // NOLINT
+      p | mortar_id;
+      p | messages;
+      p | expected;
+      p | expected_known;
+    }
+  };
+
+  typename std::vector<Slot>::iterator find_slot(
+      const MortarId& mortar_id) const noexcept {
+    return std::find_if(slots_.begin(), slots_.end(),
+                        [&mortar_id](const Slot& slot) noexcept {
+                          return slot.mortar_id == mortar_id;
+                        });
+  }
+
+  // The slots and the readiness counters are mutable so that is_ready can
+  // record the expected temporal ids it is passed
+  mutable std::vector<Slot> slots_{};
+  mutable TemporalId ready_target_{};
+  mutable bool ready_target_valid_{false};
+  mutable size_t number_of_ready_mortars_{0};
+};
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+bool MortarInbox<VolumeDim, TemporalId, RemoteData>::Slot::reaches(
+    const TemporalId& target) const noexcept {
+  TemporalId next = expected;
+  for (const auto& message : messages) {
+    if (not(next < target) or next < message.first) {
+      break;
+    }
+    if (message.first == next) {
+      next = message.second.first;
+    }
+  }
+  return not(next < target);
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+void MortarInbox<VolumeDim, TemporalId, RemoteData>::insert(
+    TemporalId temporal_id, const MortarId& mortar_id,
+    TemporalId next_temporal_id, RemoteData data) noexcept {
+  auto slot = find_slot(mortar_id);
+  if (slot == slots_.end()) {
+    if (slots_.empty()) {
+      slots_.reserve(2 * VolumeDim);
+    }
+    slots_.emplace_back();
+    slot = std::prev(slots_.end());
+    slot->mortar_id = mortar_id;
+  }
+
+  const bool was_ready = ready_target_valid_ and slot->expected_known and
+                         slot->reaches(ready_target_);
+  // Messages usually arrive in order, so search from the back
+  auto position = slot->messages.end();
+  while (position != slot->messages.begin() and
+         temporal_id < std::prev(position)->first) {
+    --position;
+  }
+  ASSERT(position == slot->messages.begin() or
+             std::prev(position)->first < temporal_id,
+         "Received data from the same mortar twice at " << temporal_id);
+  slot->messages.emplace(
+      position, std::move(temporal_id),
+      std::make_pair(std::move(next_temporal_id), std::move(data)));
+
+  if (not slot->expected_known) {
+    // The mortar has to be checked against the expected temporal id in the
+    // DataBox first
+    ready_target_valid_ = false;
+  } else if (ready_target_valid_ and not was_ready and
+             slot->reaches(ready_target_)) {
+    ++number_of_ready_mortars_;
+  }
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+template <typename MortarNextTemporalIds>
+size_t MortarInbox<VolumeDim, TemporalId, RemoteData>::number_of_ready_mortars(
+    const MortarNextTemporalIds& mortar_next_temporal_ids,
+    const TemporalId& local_next_temporal_id) const noexcept {
+  if (not ready_target_valid_ or
+      not(ready_target_ == local_next_temporal_id)) {
+    ready_target_ = local_next_temporal_id;
+    ready_target_valid_ = true;
+    number_of_ready_mortars_ = 0;
+    for (const auto& mortar_id_and_next : mortar_next_temporal_ids) {
+      const auto& next_temporal_id = mortar_id_and_next.second;
+      const auto slot = find_slot(mortar_id_and_next.first);
+      if (slot == slots_.end()) {
+        if (not(next_temporal_id < local_next_temporal_id)) {
+          ++number_of_ready_mortars_;
+        }
+        continue;
+      }
+      slot->expected = next_temporal_id;
+      slot->expected_known = true;
+      if (slot->reaches(local_next_temporal_id)) {
+        ++number_of_ready_mortars_;
+      }
+    }
+  }
+  return number_of_ready_mortars_;
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+template <typename F>
+void MortarInbox<VolumeDim, TemporalId, RemoteData>::extract_before(
+    const TemporalId& local_next_temporal_id, F&& f) noexcept {
+  for (auto& slot : slots_) {
+    while (not slot.messages.empty() and
+           slot.messages.front().first < local_next_temporal_id) {
+      auto& message = slot.messages.front();
+      slot.expected = message.second.first;
+      slot.expected_known = true;
+      f(std::move(message.first), slot.mortar_id,
+        std::move(message.second.first), std::move(message.second.second));
+      slot.messages.pop_front();
+    }
+  }
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+size_t MortarInbox<VolumeDim, TemporalId, RemoteData>::size() const noexcept {
+  size_t result = 0;
+  for (const auto& slot : slots_) {
+    result += slot.messages.size();
+  }
+  return result;
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+size_t MortarInbox<VolumeDim, TemporalId, RemoteData>::count(
+    const TemporalId& temporal_id) const noexcept {
+  size_t result = 0;
+  for (const auto& slot : slots_) {
+    result += count(temporal_id, slot.mortar_id);
+  }
+  return result;
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+size_t MortarInbox<VolumeDim, TemporalId, RemoteData>::count(
+    const TemporalId& temporal_id, const MortarId& mortar_id) const noexcept {
+  const auto slot = find_slot(mortar_id);
+  if (slot == slots_.end()) {
+    return 0;
+  }
+  return static_cast<size_t>(
+      std::count_if(slot->messages.begin(), slot->messages.end(),
+                    [&temporal_id](const Message& message) noexcept {
+                      return message.first == temporal_id;
+                    }));
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+const std::pair<TemporalId, RemoteData>&
+MortarInbox<VolumeDim, TemporalId, RemoteData>::at(
+    const TemporalId& temporal_id, const MortarId& mortar_id) const noexcept {
+  const auto slot = find_slot(mortar_id);
+  if (slot != slots_.end()) {
+    for (const auto& message : slot->messages) {
+      if (message.first == temporal_id) {
+        return message.second;
+      }
+    }
+  }
+  ERROR("No data received at " << temporal_id << " on mortar ("
+                               << mortar_id.first << ", " << mortar_id.second
+                               << ")");
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+void MortarInbox<VolumeDim, TemporalId, RemoteData>::clear() noexcept {
+  for (auto& slot : slots_) {
+    slot.messages.clear();
+  }
+  ready_target_valid_ = false;
+}
+
+template <size_t VolumeDim, typename TemporalId, typename RemoteData>
+void MortarInbox<VolumeDim, TemporalId, RemoteData>::pup(
+    PUP::er& p) noexcept {
+  p | slots_;
+  // The counters are recomputed by the next readiness check
+  if (p.isUnpacking()) {
+    ready_target_valid_ = false;
+  }
+}
+}  // namespace dg
@@ -13,6 +13,7 @@
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "Domain/Direction.hpp"  // IWYU pragma: keep
 #include "Domain/ElementId.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxMessageStatistics.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/SimpleBoundaryData.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
 #include "Options/Options.hpp"
@@ -47,6 +48,15 @@ struct MortarSize : db::SimpleTag {
   static std::string name() noexcept { return "MortarSize"; }
   using type = std::array<Spectral::MortarSize, Dim>;
 };
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup DiscontinuousGalerkinGroup
+/// The counts of flux messages sent from the elements on a node
+template <typename TemporalId>
+struct FluxMessageStatistics : db::SimpleTag {
+  static std::string name() noexcept { return "FluxMessageStatistics"; }
+  using type = dg::FluxMessageStatistics<TemporalId>;
+};
 }  // namespace Tags
 
 namespace OptionTags {
@@ -60,4 +70,30 @@ struct NumericalFluxParams {
   static constexpr OptionString help = "The options for the numerical flux";
   using type = NumericalFluxType;
 };
+
+/*!
+ * \ingroup OptionTagsGroup
+ * \brief Whether to batch the flux messages going to each node through the
+ * dg::FluxAggregator
+ */
+struct AggregateFluxMessages {
+  using type = bool;
+  static constexpr OptionString help{
+      "Send the boundary data going to the elements on each node in a single "
+      "message per element and step"};
+  static type default_value() noexcept { return false; }
+};
+
+/*!
+ * \ingroup OptionTagsGroup
+ * \brief The number of steps between reports of the flux message counts on
+ * each node
+ */
+struct FluxMessageStatisticsInterval {
+  using type = size_t;
+  static constexpr OptionString help{
+      "The number of steps between reports of the flux messages sent from "
+      "each node, or 0 to not count them"};
+  static type default_value() noexcept { return 0; }
+};
 }  // namespace OptionTags
@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/Interpolation/IrregularCache.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <iterator>
+#include <utility>
+
+#include "DataStructures/Index.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <size_t Dim>
+size_t hash_of(
+    const Mesh<Dim>& source_mesh,
+    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept {
+  size_t hash = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    boost::hash_combine(hash, source_mesh.extents(d));
+    boost::hash_combine(hash,
+                        static_cast<int>(gsl::at(source_mesh.basis(), d)));
+    boost::hash_combine(hash,
+                        static_cast<int>(gsl::at(source_mesh.quadrature(), d)));
+    boost::hash_range(hash, target_points.get(d).begin(),
+                      target_points.get(d).end());
+  }
+  return hash;
+}
+}  // namespace
+
+namespace intrp {
+
+template <size_t Dim>
+IrregularCache<Dim>::IrregularCache(
+    const size_t maximum_size_in_bytes,
+    const InterpolationMatrixStorage storage) noexcept
+    : maximum_size_in_bytes_(maximum_size_in_bytes), storage_(storage) {}
+
+template <size_t Dim>
+const Irregular<Dim>& IrregularCache<Dim>::operator()(
+    const Mesh<Dim>& source_mesh,
+    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept {
+  const size_t hash = hash_of(source_mesh, target_points);
+  const auto candidates = entries_by_hash_.equal_range(hash);
+  for (auto candidate = candidates.first; candidate != candidates.second;
+       ++candidate) {
+    const auto entry = candidate->second;
+    if (entry->source_mesh == source_mesh and
+        entry->target_points == target_points) {
+      ++hits_;
+      entries_.splice(entries_.begin(), entries_, entry);
+      return entry->interpolant;
+    }
+  }
+
+  ++misses_;
+  Irregular<Dim> interpolant(source_mesh, target_points, storage_);
+  const size_t entry_size_in_bytes =
+      interpolant.size_in_bytes() +
+      Dim * target_points.get(0).size() * sizeof(double);
+  entries_.push_front(Entry{hash, source_mesh, target_points,
+                            std::move(interpolant), entry_size_in_bytes});
+  entries_by_hash_.emplace(hash, entries_.begin());
+  size_in_bytes_ += entry_size_in_bytes;
+
+  while (size_in_bytes_ > maximum_size_in_bytes_ and entries_.size() > 1) {
+    const auto least_recently_used = std::prev(entries_.end());
+    const auto same_hash =
+        entries_by_hash_.equal_range(least_recently_used->hash);
+    for (auto it = same_hash.first; it != same_hash.second; ++it) {
+      if (it->second == least_recently_used) {
+        entries_by_hash_.erase(it);
+        break;
+      }
+    }
+    size_in_bytes_ -= least_recently_used->size_in_bytes;
+    entries_.erase(least_recently_used);
+  }
+  return entries_.front().interpolant;
+}
+
+template <size_t Dim>
+void IrregularCache<Dim>::clear() noexcept {
+  entries_.clear();
+  entries_by_hash_.clear();
+  size_in_bytes_ = 0;
+}
+
+template class IrregularCache<1>;
+template class IrregularCache<2>;
+template class IrregularCache<3>;
+}  // namespace intrp
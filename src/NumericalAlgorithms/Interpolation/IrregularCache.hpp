@@ -0,0 +1,88 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Mesh.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+
+namespace intrp {
+
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Holds the `intrp::Irregular` interpolants of recently used pairs of
+/// a source `Mesh` and a set of target points, so that interpolating to the
+/// same points again (e.g. to a fixed wave-extraction surface at every step)
+/// does not recompute the interpolation matrices.
+///
+/// \details The interpolants are looked up by a hash of the mesh and the
+/// target points, and a hit is confirmed by comparing the stored mesh and
+/// points, so a hash collision cannot return the wrong interpolant.  When the
+/// memory used by the stored interpolants and target points exceeds
+/// `maximum_size_in_bytes`, the least recently used ones are evicted.  The
+/// most recently used interpolant is never evicted, so one larger than the
+/// limit is still returned.  All interpolants are constructed with the
+/// `storage` passed to the constructor.
+template <size_t Dim>
+class IrregularCache {
+ public:
+  explicit IrregularCache(size_t maximum_size_in_bytes,
+                          InterpolationMatrixStorage storage =
+                              InterpolationMatrixStorage::Dense) noexcept;
+
+  IrregularCache() = default;
+  IrregularCache(const IrregularCache&) = delete;
+  IrregularCache& operator=(const IrregularCache&) = delete;
+  IrregularCache(IrregularCache&&) noexcept = default;
+  IrregularCache& operator=(IrregularCache&&) noexcept = default;
+  ~IrregularCache() = default;
+
+  /// The interpolant from `source_mesh` to `target_points`, constructed if
+  /// it is not in the cache.  The reference is valid until the next call.
+  const Irregular<Dim>& operator()(
+      const Mesh<Dim>& source_mesh,
+      const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept;
+
+  /// The number of stored interpolants
+  size_t size() const noexcept { return entries_.size(); }
+
+  /// The memory used by the stored interpolants and target points
+  size_t size_in_bytes() const noexcept { return size_in_bytes_; }
+
+  size_t maximum_size_in_bytes() const noexcept {
+    return maximum_size_in_bytes_;
+  }
+
+  /// The number of lookups that found, or had to construct, the interpolant
+  //@{
+  size_t hits() const noexcept { return hits_; }
+  size_t misses() const noexcept { return misses_; }
+  //@}
+
+  void clear() noexcept;
+
+ private:
+  struct Entry {
+    size_t hash;
+    Mesh<Dim> source_mesh;
+    tnsr::I<DataVector, Dim, Frame::Logical> target_points;
+    Irregular<Dim> interpolant;
+    size_t size_in_bytes;
+  };
+
+  size_t maximum_size_in_bytes_{0};
+  InterpolationMatrixStorage storage_{InterpolationMatrixStorage::Dense};
+  // Ordered from the most to the least recently used
+  std::list<Entry> entries_{};
+  std::unordered_multimap<size_t, typename std::list<Entry>::iterator>
+      entries_by_hash_{};
+  size_t size_in_bytes_{0};
+  size_t hits_{0};
+  size_t misses_{0};
+};
+}  // namespace intrp
@@ -4,11 +4,17 @@
 #include "IrregularInterpolant.hpp"
 
 #include <array>
+#include <ostream>
+#include <pup.h>
+#include <pup_stl.h>  // IWYU pragma: keep
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Mesh.hpp"
+#include "ErrorHandling/Error.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Blas.hpp"
+#include "Utilities/Gsl.hpp"
 // IWYU pragma: no_forward_declare Tensor
 
 namespace {
@@ -78,18 +84,110 @@ Matrix interpolation_matrix(
 
 namespace intrp {
 
+std::ostream& operator<<(std::ostream& os,
+                         const InterpolationMatrixStorage storage) noexcept {
+  switch (storage) {
+    case InterpolationMatrixStorage::Dense:
+      return os << "Dense";
+    case InterpolationMatrixStorage::TensorProduct:
+      return os << "TensorProduct";
+    default:  // LCOV_EXCL_LINE
+      // LCOV_EXCL_START
+      ERROR("Need to add another case, don't understand value of 'storage'");
+      // LCOV_EXCL_STOP
+  }
+}
+
 template <size_t Dim>
 Irregular<Dim>::Irregular() = default;
 
 template <size_t Dim>
 Irregular<Dim>::Irregular(
     const Mesh<Dim>& source_mesh,
-    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept
-    : interpolation_matrix_(interpolation_matrix(source_mesh, target_points)) {}
+    const tnsr::I<DataVector, Dim, Frame::Logical>& target_points,
+    const InterpolationMatrixStorage storage) noexcept
+    : storage_(storage) {
+  if (storage_ == InterpolationMatrixStorage::Dense) {
+    interpolation_matrix_ = interpolation_matrix(source_mesh, target_points);
+    return;
+  }
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(interpolation_matrices_1d_, d) = Spectral::interpolation_matrix(
+        source_mesh.slice_through(d), target_points.get(d));
+  }
+}
 
 template <size_t Dim>
 void Irregular<Dim>::pup(PUP::er& p) noexcept {
+  p | storage_;
   p | interpolation_matrix_;
+  p | interpolation_matrices_1d_;
+}
+
+template <size_t Dim>
+size_t Irregular<Dim>::number_of_target_points() const noexcept {
+  return storage_ == InterpolationMatrixStorage::Dense
+             ? interpolation_matrix_.rows()
+             : interpolation_matrices_1d_[0].rows();
+}
+
+template <size_t Dim>
+size_t Irregular<Dim>::number_of_source_points() const noexcept {
+  if (storage_ == InterpolationMatrixStorage::Dense) {
+    return interpolation_matrix_.columns();
+  }
+  size_t result = 1;
+  for (const auto& matrix : interpolation_matrices_1d_) {
+    result *= matrix.columns();
+  }
+  return result;
+}
+
+template <size_t Dim>
+size_t Irregular<Dim>::size_in_bytes() const noexcept {
+  size_t number_of_entries =
+      interpolation_matrix_.rows() * interpolation_matrix_.columns();
+  for (const auto& matrix : interpolation_matrices_1d_) {
+    number_of_entries += matrix.rows() * matrix.columns();
+  }
+  return number_of_entries * sizeof(double);
+}
+
+template <size_t Dim>
+void Irregular<Dim>::interpolate_tensor_product(
+    const gsl::not_null<double*> result, const double* const source,
+    const size_t number_of_components) const noexcept {
+  const size_t number_of_target_points = this->number_of_target_points();
+  const size_t number_of_source_points = this->number_of_source_points();
+  DataVector weights(number_of_source_points);
+  for (size_t p = 0; p < number_of_target_points; ++p) {
+    // The weight of a source point is the product of the 1d weights of its
+    // coordinates.  They are built up one dimension at a time, with the
+    // first dimension varying fastest, and the blocks of the previous
+    // dimensions are filled from the last so the first block is read
+    // before it is overwritten.
+    size_t stride = 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      const Matrix& matrix = gsl::at(interpolation_matrices_1d_, d);
+      if (d == 0) {
+        for (size_t i = 0; i < matrix.columns(); ++i) {
+          weights[i] = matrix(p, i);
+        }
+      } else {
+        for (size_t j = matrix.columns(); j-- > 0;) {
+          for (size_t i = 0; i < stride; ++i) {
+            weights[j * stride + i] = weights[i] * matrix(p, j);
+          }
+        }
+      }
+      stride *= matrix.columns();
+    }
+    // The interpolated value of each component is the dot product of its
+    // source values with the weights
+    dgemv_('t', number_of_source_points, number_of_components, 1.0, source,
+           number_of_source_points, weights.data(), 1, 0.0,
+           result.get() + p, number_of_target_points);
+  }
 }
 
 template <size_t Dim>
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <iosfwd>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
@@ -24,14 +26,34 @@ class er;
 
 namespace intrp {
 
+/// \ingroup NumericalAlgorithmsGroup
+/// How `intrp::Irregular` stores the weights of the source grid points.
+///
+/// - `Dense`: the full matrix with a row for each target point and a column
+///   for each source grid point, which is applied with a single `dgemm_`.
+/// - `TensorProduct`: the one-dimensional interpolation matrix of each
+///   dimension, from which the weights of each target point are computed
+///   when interpolating.  This needs memory proportional to the number of
+///   source grid points per dimension rather than to their product, at the
+///   cost of recomputing the weights in each interpolation.
+enum class InterpolationMatrixStorage { Dense, TensorProduct };
+
+/// Output operator for InterpolationMatrixStorage
+std::ostream& operator<<(std::ostream& os,
+                         InterpolationMatrixStorage storage) noexcept;
+
 /// \ingroup NumericalAlgorithmsGroup
 /// Interpolates a `Variables` onto an arbitrary set of points.
+///
+/// \see intrp::IrregularCache to reuse the interpolant for the same target
+/// points.
 template <size_t Dim>
 class Irregular {
  public:
-  Irregular(
-      const Mesh<Dim>& source_mesh,
-      const tnsr::I<DataVector, Dim, Frame::Logical>& target_points) noexcept;
+  Irregular(const Mesh<Dim>& source_mesh,
+            const tnsr::I<DataVector, Dim, Frame::Logical>& target_points,
+            InterpolationMatrixStorage storage =
+                InterpolationMatrixStorage::Dense) noexcept;
   Irregular();
 
   // clang-tidy: no runtime references
@@ -52,11 +74,33 @@ class Irregular {
       noexcept;
   //@}
 
+  InterpolationMatrixStorage storage() const noexcept { return storage_; }
+
+  size_t number_of_target_points() const noexcept;
+
+  /// The memory used by the stored interpolation matrices
+  size_t size_in_bytes() const noexcept;
+
  private:
   friend bool operator==(const Irregular& lhs, const Irregular& rhs) noexcept {
-    return lhs.interpolation_matrix_ == rhs.interpolation_matrix_;
+    return lhs.storage_ == rhs.storage_ and
+           lhs.interpolation_matrix_ == rhs.interpolation_matrix_ and
+           lhs.interpolation_matrices_1d_ == rhs.interpolation_matrices_1d_;
   }
+
+  size_t number_of_source_points() const noexcept;
+
+  // Sets the first `number_of_components` columns of the column-major
+  // `result` to the interpolated values of those of `source`
+  void interpolate_tensor_product(gsl::not_null<double*> result,
+                                  const double* source,
+                                  size_t number_of_components) const noexcept;
+
+  InterpolationMatrixStorage storage_{InterpolationMatrixStorage::Dense};
+  // Only used with dense storage
   Matrix interpolation_matrix_;
+  // Only used with tensor-product storage
+  std::array<Matrix, Dim> interpolation_matrices_1d_{};
 };
 
 template <size_t Dim>
@@ -68,8 +112,8 @@ void Irregular<Dim>::interpolate(
   //   matrix Interp is m rows by k columns
   //   matrix Source is k rows by n columns
   //   matrix Result is m rows by n columns
-  const size_t m = interpolation_matrix_.rows();
-  const size_t k = interpolation_matrix_.columns();
+  const size_t m = number_of_target_points();
+  const size_t k = number_of_source_points();
   const size_t n = vars.number_of_independent_components;
   ASSERT(k == vars.number_of_grid_points(),
          "Number of grid points in source 'vars', "
@@ -79,6 +123,10 @@ void Irregular<Dim>::interpolate(
   if (result->number_of_grid_points() != m) {
     *result = Variables<TagsList>(m, 0.);
   }
+  if (storage_ == InterpolationMatrixStorage::TensorProduct) {
+    interpolate_tensor_product(result->data(), vars.data(), n);
+    return;
+  }
   dgemm_('n', 'n', m, n, k, 1.0, interpolation_matrix_.data(), m, vars.data(),
          k, 0.0, result->data(), m);
 }
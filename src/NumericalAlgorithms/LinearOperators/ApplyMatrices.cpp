@@ -6,52 +6,171 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
-#include "NumericalAlgorithms/LinearOperators/Transpose.hpp"
-#include "Utilities/Blas.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
+#include "Utilities/ForceInline.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
+// The matrices are applied directly to the data in each dimension, which is
+// laid out with the first dimension varying fastest, so no transposes are
+// needed. For the matrix sizes allowed for spectral elements the kernels are
+// instantiated for every (rows, columns) pair so that the matrix loops are
+// fully unrolled, and the loops over the remaining dimensions run over
+// contiguous memory and are vectorized. At these sizes the kernels are faster
+// than a BLAS call, whose dispatch overhead dominates.
+//
+// clang-tidy: pointer arithmetic is required throughout to address the raw
+// strided data.
 namespace {
-void multiply_in_first_dimension(const gsl::not_null<double*> result,
-                                 const gsl::not_null<size_t*> data_size,
-                                 const Matrix& matrix,
-                                 const double* data) noexcept {
-  *data_size /= matrix.columns();
-  dgemm_<true>('N', 'N',
-               matrix.rows(),     // rows of matrix and result
-               *data_size,        // columns of result and u
-               matrix.columns(),  // columns of matrix and rows of u
-               1.0,               // overall multiplier
-               matrix.data(),     // matrix
-               matrix.rows(),     // rows of matrix
-               data,              // u
-               matrix.columns(),  // rows of u
-               0.0,               // multiplier for unused term
-               result.get(),      // result
-               matrix.rows());    // rows of result
-  *data_size *= matrix.rows();
+// Multiply each contiguous stripe of `columns` values by the matrix.
+SPECTRE_ALWAYS_INLINE void multiply_in_first_dimension_impl(
+    double* const result, const double* const data, const double* const matrix,
+    const size_t rows, const size_t columns,
+    const size_t number_of_stripes) noexcept {
+  for (size_t s = 0; s < number_of_stripes; ++s) {
+    const double* const data_stripe = data + s * columns;  // NOLINT
+    double* const result_stripe = result + s * rows;  // NOLINT
+    for (size_t i = 0; i < rows; ++i) {
+      result_stripe[i] = matrix[i] * data_stripe[0];  // NOLINT
+    }
+    for (size_t j = 1; j < columns; ++j) {
+      const double data_j = data_stripe[j];  // NOLINT
+      const double* const matrix_column = matrix + j * rows;  // NOLINT
+      for (size_t i = 0; i < rows; ++i) {
+        result_stripe[i] += matrix_column[i] * data_j;  // NOLINT
+      }
+    }
+  }
+}
+
+// Multiply in a dimension whose consecutive points are `stride` apart. The
+// data is treated as `number_of_blocks` blocks of `columns * stride` values,
+// each of which produces a block of `rows * stride` values in the result.
+SPECTRE_ALWAYS_INLINE void multiply_in_strided_dimension_impl(
+    double* const result, const double* const data, const double* const matrix,
+    const size_t rows, const size_t columns, const size_t stride,
+    const size_t number_of_blocks) noexcept {
+  for (size_t b = 0; b < number_of_blocks; ++b) {
+    const double* const data_block = data + b * columns * stride;  // NOLINT
+    double* const result_block = result + b * rows * stride;  // NOLINT
+    for (size_t i = 0; i < rows; ++i) {
+      double* const result_row = result_block + i * stride;  // NOLINT
+      const double m_i0 = matrix[i];  // NOLINT
+      for (size_t s = 0; s < stride; ++s) {
+        result_row[s] = m_i0 * data_block[s];  // NOLINT
+      }
+      for (size_t j = 1; j < columns; ++j) {
+        const double m_ij = matrix[i + j * rows];  // NOLINT
+        const double* const data_row = data_block + j * stride;  // NOLINT
+        for (size_t s = 0; s < stride; ++s) {
+          result_row[s] += m_ij * data_row[s];  // NOLINT
+        }
+      }
+    }
+  }
+}
+
+using Kernel = void (*)(double*, const double*, const double*, size_t,
+                        size_t);
+
+template <size_t Rows, size_t Columns>
+void multiply_in_first_dimension(double* const result,
+                                 const double* const data,
+                                 const double* const matrix,
+                                 const size_t /*stride*/,
+                                 const size_t number_of_stripes) noexcept {
+  multiply_in_first_dimension_impl(result, data, matrix, Rows, Columns,
+                                   number_of_stripes);
 }
 
-void do_transpose(const gsl::not_null<double*> result, const double* const data,
-                  const size_t data_size, const size_t chunk_size) noexcept {
-  raw_transpose(result, data, chunk_size, data_size / chunk_size);
+template <size_t Rows, size_t Columns>
+void multiply_in_strided_dimension(double* const result,
+                                   const double* const data,
+                                   const double* const matrix,
+                                   const size_t stride,
+                                   const size_t number_of_blocks) noexcept {
+  multiply_in_strided_dimension_impl(result, data, matrix, Rows, Columns,
+                                     stride, number_of_blocks);
 }
 
-struct Scratch {
-  std::vector<double> buffer;
-  double* a;
-  double* b;
-};
+constexpr size_t maximum_number_of_points =
+    Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+constexpr size_t kernel_table_size = maximum_number_of_points + 1;
+
+// The kernel for a `Rows` x `Columns` matrix is stored at index
+// `Rows * kernel_table_size + Columns`.
+template <size_t... Is>
+constexpr std::array<Kernel, sizeof...(Is)> first_dimension_kernels(
+    std::index_sequence<Is...> /*meta*/) noexcept {
+  return {{&multiply_in_first_dimension<Is / kernel_table_size,
+                                        Is % kernel_table_size>...}};
+}
+
+template <size_t... Is>
+constexpr std::array<Kernel, sizeof...(Is)> strided_dimension_kernels(
+    std::index_sequence<Is...> /*meta*/) noexcept {
+  return {{&multiply_in_strided_dimension<Is / kernel_table_size,
+                                          Is % kernel_table_size>...}};
+}
+
+constexpr std::array<Kernel, kernel_table_size * kernel_table_size>
+    first_dimension_kernel_table = first_dimension_kernels(
+        std::make_index_sequence<kernel_table_size * kernel_table_size>{});
+constexpr std::array<Kernel, kernel_table_size * kernel_table_size>
+    strided_dimension_kernel_table = strided_dimension_kernels(
+        std::make_index_sequence<kernel_table_size * kernel_table_size>{});
+
+// Multiply `data` by `matrix` in the dimension whose points are `stride`
+// apart, for `number_of_blocks` blocks.
+void multiply_in_dimension(double* const result, const double* const data,
+                           const Matrix& matrix, const size_t stride,
+                           const size_t number_of_blocks) noexcept {
+  const size_t rows = matrix.rows();
+  const size_t columns = matrix.columns();
+  const bool use_kernel_table =
+      rows <= maximum_number_of_points and columns <= maximum_number_of_points;
+  if (stride == 1) {
+    if (use_kernel_table) {
+      gsl::at(first_dimension_kernel_table, rows * kernel_table_size + columns)(
+          result, data, matrix.data(), 1, number_of_blocks);
+    } else {
+      multiply_in_first_dimension_impl(result, data, matrix.data(), rows,
+                                       columns, number_of_blocks);
+    }
+  } else {
+    if (use_kernel_table) {
+      gsl::at(strided_dimension_kernel_table,
+              rows * kernel_table_size + columns)(
+          result, data, matrix.data(), stride, number_of_blocks);
+    } else {
+      multiply_in_strided_dimension_impl(result, data, matrix.data(), rows,
+                                         columns, stride, number_of_blocks);
+    }
+  }
+}
+
+// Returns a pointer to at least `size` doubles of scratch memory. The memory
+// is owned by the calling thread and reused by subsequent calls, so that
+// applying matrices does not allocate once the buffer has grown to the
+// largest size needed.
+double* get_scratch(const size_t size) noexcept {
+  thread_local std::vector<double> scratch{};
+  if (scratch.size() < size) {
+    scratch.resize(size);
+  }
+  return scratch.data();
+}
 
 // This does not take into account the order that the matrices are
 // applied in and gives the largest amount of space that could be
-// required for any application order.
+// required for any intermediate result.
 template <typename MatrixType, size_t Dim>
-Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
+size_t scratch_size(const std::array<MatrixType, Dim>& matrices,
                     const Index<Dim>& extents,
                     const size_t number_of_independent_components) noexcept {
   size_t size = number_of_independent_components;
@@ -64,309 +183,69 @@ Scratch get_scratch(const std::array<MatrixType, Dim>& matrices,
                        dereference_wrapper(matrix).columns());
     }
   }
-  Scratch result{};
-  result.buffer.resize(2 * size);
-  result.a = &result.buffer[0];
-  result.b = &result.buffer[size];
-  return result;
-}
-
-// Produce the array of the number of rows in each matrix.  Empty
-// matrices are processed as if they were identity matrices.
-template <size_t Dim, typename MatrixType>
-std::array<size_t, Dim> matrix_rows(const std::array<MatrixType, Dim>& matrices,
-                                    const Index<Dim>& extents) noexcept {
-  std::array<size_t, Dim> result{};
-  for (size_t i = 0; i < Dim; ++i) {
-    if (dereference_wrapper(gsl::at(matrices, i)) == Matrix{}) {
-      gsl::at(result, i) = extents[i];
-    } else {
-      gsl::at(result, i) = dereference_wrapper(gsl::at(matrices, i)).rows();
-    }
-  }
-  return result;
+  return size;
 }
 }  // namespace
 
 namespace apply_matrices_detail {
-template <size_t Dim, bool... DimensionIsIdentity>
+template <size_t Dim>
 template <typename MatrixType>
-void Impl<Dim, DimensionIsIdentity...>::apply(
-    const gsl::not_null<double*> result,
-    const std::array<MatrixType, Dim>& matrices, const double* const data,
-    const Index<Dim>& extents,
-    const size_t number_of_independent_components) noexcept {
-  if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
-      Matrix{}) {
-    Impl<Dim, DimensionIsIdentity..., true>::apply(
-        result, matrices, data, extents, number_of_independent_components);
-  } else {
-    Impl<Dim, DimensionIsIdentity..., false>::apply(
-        result, matrices, data, extents, number_of_independent_components);
-  }
-}
-
-template <>
-struct Impl<0> {
-  static constexpr const size_t Dim = 0;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& /*matrices*/,
-                    const double* const data, const Index<Dim>& /*extents*/,
-                    const size_t number_of_independent_components) noexcept {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    std::copy(data, data + number_of_independent_components, result.get());
-  }
-};
-
-template <>
-struct Impl<1, false> {
-  static constexpr const size_t Dim = 1;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    size_t data_size = number_of_independent_components * extents.product();
-    multiply_in_first_dimension(result, &data_size, matrices[0], data);
+void Impl<Dim>::apply(const gsl::not_null<double*> result,
+                      const std::array<MatrixType, Dim>& matrices,
+                      const double* const data, const Index<Dim>& extents,
+                      const size_t number_of_independent_components) noexcept {
+  size_t number_of_matrices = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    if (not (dereference_wrapper(gsl::at(matrices, d)) == Matrix{})) {
+      ++number_of_matrices;
+    }
   }
-};
-
-template <>
-struct Impl<1, true> {
-  static constexpr const size_t Dim = 1;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& /*matrices*/,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+  if (number_of_matrices == 0) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
     std::copy(data, data + number_of_independent_components * extents.product(),
               result.get());
+    return;
   }
-};
-
-template <>
-struct Impl<2, false, false> {
-  static constexpr size_t Dim = 2;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
-    do_transpose(scratch.b, scratch.a, data_size, rows[0]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[1], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[1]);
-  }
-};
 
-template <>
-struct Impl<2, false, true> {
-  static constexpr size_t Dim = 2;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    size_t data_size = number_of_independent_components * extents.product();
-    multiply_in_first_dimension(result, &data_size, matrices[0], data);
-  }
-};
-
-template <>
-struct Impl<2, true, false> {
-  static constexpr size_t Dim = 2;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    do_transpose(scratch.b, data, data_size, rows[0]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[1], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[1]);
-  }
-};
-
-template <>
-struct Impl<2, true, true> {
-  static constexpr size_t Dim = 2;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& /*matrices*/,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
+  // Intermediate results alternate between the two halves of the scratch
+  // buffer, and the last matrix writes directly into the result.
+  std::array<double*, 2> scratch{{nullptr, nullptr}};
+  if (number_of_matrices > 1) {
+    const size_t size =
+        scratch_size(matrices, extents, number_of_independent_components);
+    scratch[0] = get_scratch(2 * size);
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    std::copy(data, data + number_of_independent_components * extents.product(),
-              result.get());
-  }
-};
-
-template <>
-struct Impl<3, false, false, false> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
-    do_transpose(scratch.b, scratch.a, data_size, rows[0]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[1], scratch.b);
-    do_transpose(scratch.b, scratch.a, data_size, rows[1]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[2], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[2]);
-  }
-};
-
-template <>
-struct Impl<3, false, false, true> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
-    do_transpose(scratch.b, scratch.a, data_size, rows[0]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[1], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[1] * rows[2]);
-  }
-};
-
-template <>
-struct Impl<3, false, true, false> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[0], data);
-    do_transpose(scratch.b, scratch.a, data_size, rows[0] * rows[1]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[2], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[2]);
+    scratch[1] = scratch[0] + size;
   }
-};
 
-template <>
-struct Impl<3, false, true, true> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    size_t data_size = number_of_independent_components * extents.product();
-    multiply_in_first_dimension(result, &data_size, matrices[0], data);
-  }
-};
-
-template <>
-struct Impl<3, true, false, false> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    do_transpose(scratch.b, data, data_size, rows[0]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[1], scratch.b);
-    do_transpose(scratch.b, scratch.a, data_size, rows[1]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[2], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[2]);
-  }
-};
-
-template <>
-struct Impl<3, true, false, true> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    do_transpose(scratch.b, data, data_size, rows[0]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[1], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[1] * rows[2]);
-  }
-};
-
-template <>
-struct Impl<3, true, true, false> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& matrices,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    const auto rows = matrix_rows(matrices, extents);
-    auto scratch =
-        get_scratch(matrices, extents, number_of_independent_components);
-
-    size_t data_size = number_of_independent_components * extents.product();
-    do_transpose(scratch.b, data, data_size, rows[0] * rows[1]);
-    multiply_in_first_dimension(scratch.a, &data_size, matrices[2], scratch.b);
-    do_transpose(result, scratch.a, data_size,
-                 number_of_independent_components * rows[2]);
+  std::array<size_t, Dim> current_extents{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(current_extents, d) = extents[d];
   }
-};
-
-template <>
-struct Impl<3, true, true, true> {
-  static constexpr size_t Dim = 3;
-  template <typename MatrixType>
-  static void apply(const gsl::not_null<double*> result,
-                    const std::array<MatrixType, Dim>& /*matrices*/,
-                    const double* const data, const Index<Dim>& extents,
-                    const size_t number_of_independent_components) noexcept {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    std::copy(data, data + number_of_independent_components * extents.product(),
-              result.get());
+  const double* input = data;
+  size_t matrices_applied = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix == Matrix{}) {
+      continue;
+    }
+    ++matrices_applied;
+    double* const output = matrices_applied == number_of_matrices
+                               ? result.get()
+                               : gsl::at(scratch, matrices_applied % 2);
+    size_t stride = 1;
+    for (size_t i = 0; i < d; ++i) {
+      stride *= gsl::at(current_extents, i);
+    }
+    size_t number_of_blocks = number_of_independent_components;
+    for (size_t i = d + 1; i < Dim; ++i) {
+      number_of_blocks *= gsl::at(current_extents, i);
+    }
+    multiply_in_dimension(output, input, matrix, stride, number_of_blocks);
+    gsl::at(current_extents, d) = matrix.rows();
+    input = output;
   }
-};
+}
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 #define MATRIX(data) BOOST_PP_TUPLE_ELEM(1, data)
@@ -20,7 +20,7 @@ class Index;
 /// \endcond
 
 namespace apply_matrices_detail {
-template <size_t Dim, bool... DimensionIsIdentity>
+template <size_t Dim>
 struct Impl {
   template <typename MatrixType>
   static void apply(gsl::not_null<double*> result,
@@ -0,0 +1,189 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Mesh.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/ForceInline.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+// The kernels below apply the (column-major) differentiation matrix along one
+// logical dimension of data laid out with the first dimension varying
+// fastest. The number of points `n` in the differentiated dimension is a
+// template parameter for all allowed extents so that the compiler fully
+// unrolls the matrix loops, while the loops over the remaining dimensions run
+// over contiguous memory and are vectorized.
+//
+// clang-tidy: pointer arithmetic is required throughout to address the raw
+// strided data.
+namespace {
+// Differentiate each contiguous stripe of `n` values.
+SPECTRE_ALWAYS_INLINE void differentiate_first_dimension_impl(
+    double* const du, const double* const u, const double* const matrix,
+    const size_t n, const size_t number_of_stripes) noexcept {
+  for (size_t s = 0; s < number_of_stripes; ++s) {
+    const double* const u_stripe = u + s * n;  // NOLINT
+    double* const du_stripe = du + s * n;  // NOLINT
+    for (size_t i = 0; i < n; ++i) {
+      du_stripe[i] = matrix[i] * u_stripe[0];  // NOLINT
+    }
+    for (size_t j = 1; j < n; ++j) {
+      const double u_j = u_stripe[j];  // NOLINT
+      const double* const column = matrix + j * n;  // NOLINT
+      for (size_t i = 0; i < n; ++i) {
+        du_stripe[i] += column[i] * u_j;  // NOLINT
+      }
+    }
+  }
+}
+
+// Differentiate a dimension whose consecutive points are `stride` apart. The
+// data is treated as `number_of_blocks` blocks of `n * stride` values, and the
+// innermost loop runs over the `stride` contiguous values of each block.
+SPECTRE_ALWAYS_INLINE void differentiate_strided_dimension_impl(
+    double* const du, const double* const u, const double* const matrix,
+    const size_t n, const size_t stride,
+    const size_t number_of_blocks) noexcept {
+  const size_t block_size = n * stride;
+  for (size_t b = 0; b < number_of_blocks; ++b) {
+    const double* const u_block = u + b * block_size;  // NOLINT
+    double* const du_block = du + b * block_size;  // NOLINT
+    for (size_t i = 0; i < n; ++i) {
+      double* const du_row = du_block + i * stride;  // NOLINT
+      const double m_i0 = matrix[i];  // NOLINT
+      for (size_t s = 0; s < stride; ++s) {
+        du_row[s] = m_i0 * u_block[s];  // NOLINT
+      }
+      for (size_t j = 1; j < n; ++j) {
+        const double m_ij = matrix[i + j * n];  // NOLINT
+        const double* const u_row = u_block + j * stride;  // NOLINT
+        for (size_t s = 0; s < stride; ++s) {
+          du_row[s] += m_ij * u_row[s];  // NOLINT
+        }
+      }
+    }
+  }
+}
+
+using Kernel = void (*)(double*, const double*, const double*, size_t,
+                        size_t);
+
+template <size_t N>
+void differentiate_first_dimension(double* const du, const double* const u,
+                                   const double* const matrix,
+                                   const size_t /*stride*/,
+                                   const size_t number_of_stripes) noexcept {
+  differentiate_first_dimension_impl(du, u, matrix, N, number_of_stripes);
+}
+
+template <size_t N>
+void differentiate_strided_dimension(double* const du, const double* const u,
+                                     const double* const matrix,
+                                     const size_t stride,
+                                     const size_t number_of_blocks) noexcept {
+  differentiate_strided_dimension_impl(du, u, matrix, N, stride,
+                                       number_of_blocks);
+}
+
+constexpr size_t maximum_number_of_points =
+    Spectral::maximum_number_of_points<Spectral::Basis::Legendre>;
+
+template <size_t... Is>
+constexpr std::array<Kernel, sizeof...(Is)> first_dimension_kernels(
+    std::index_sequence<Is...> /*meta*/) noexcept {
+  return {{&differentiate_first_dimension<Is>...}};
+}
+
+template <size_t... Is>
+constexpr std::array<Kernel, sizeof...(Is)> strided_dimension_kernels(
+    std::index_sequence<Is...> /*meta*/) noexcept {
+  return {{&differentiate_strided_dimension<Is>...}};
+}
+
+// Jump tables indexed by the number of points in the differentiated dimension
+constexpr std::array<Kernel, maximum_number_of_points + 1>
+    first_dimension_kernel_table = first_dimension_kernels(
+        std::make_index_sequence<maximum_number_of_points + 1>{});
+constexpr std::array<Kernel, maximum_number_of_points + 1>
+    strided_dimension_kernel_table = strided_dimension_kernels(
+        std::make_index_sequence<maximum_number_of_points + 1>{});
+}  // namespace
+
+namespace partial_derivatives_detail {
+template <size_t Dim>
+void logical_partial_derivative(const gsl::not_null<double*> du,
+                                const double* const u, const size_t size,
+                                const Mesh<Dim>& mesh,
+                                const size_t logical_dim) noexcept {
+  ASSERT(logical_dim < Dim,
+         "Cannot differentiate in dimension " << logical_dim << " of a "
+         << Dim << "-dimensional mesh");
+  const size_t n = mesh.extents(logical_dim);
+  size_t stride = 1;
+  for (size_t d = 0; d < logical_dim; ++d) {
+    stride *= mesh.extents(d);
+  }
+  ASSERT(size % (n * stride) == 0,
+         "The size of the data (" << size
+         << ") is not a multiple of the number of grid points ("
+         << mesh.number_of_grid_points() << ")");
+  const Matrix& differentiation_matrix =
+      Spectral::differentiation_matrix(mesh.slice_through(logical_dim));
+  const double* const matrix = differentiation_matrix.data();
+  if (stride == 1) {
+    if (n <= maximum_number_of_points) {
+      gsl::at(first_dimension_kernel_table, n)(du.get(), u, matrix, 1,
+                                               size / n);
+    } else {
+      differentiate_first_dimension_impl(du.get(), u, matrix, n, size / n);
+    }
+  } else {
+    if (n <= maximum_number_of_points) {
+      gsl::at(strided_dimension_kernel_table, n)(du.get(), u, matrix, stride,
+                                                 size / (n * stride));
+    } else {
+      differentiate_strided_dimension_impl(du.get(), u, matrix, n, stride,
+                                           size / (n * stride));
+    }
+  }
+}
+}  // namespace partial_derivatives_detail
+
+template <size_t Dim>
+void logical_partial_derivatives(
+    const gsl::not_null<double*> logical_partial_derivatives_of_u,
+    const double* const u, const size_t number_of_independent_components,
+    const Mesh<Dim>& mesh) noexcept {
+  const size_t size =
+      number_of_independent_components * mesh.number_of_grid_points();
+  for (size_t d = 0; d < Dim; ++d) {
+    partial_derivatives_detail::logical_partial_derivative(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        logical_partial_derivatives_of_u.get() + d * size, u, size, mesh, d);
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                                \
+  template void partial_derivatives_detail::logical_partial_derivative(     \
+      const gsl::not_null<double*> du, const double* const u,               \
+      const size_t size, const Mesh<DIM(data)>& mesh,                       \
+      const size_t logical_dim) noexcept;                                   \
+  template void logical_partial_derivatives(                                \
+      const gsl::not_null<double*> logical_partial_derivatives_of_u,        \
+      const double* const u, const size_t number_of_independent_components, \
+      const Mesh<DIM(data)>& mesh) noexcept;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef DIM
+#undef INSTANTIATE
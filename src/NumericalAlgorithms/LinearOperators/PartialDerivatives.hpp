@@ -12,6 +12,7 @@
 
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits.hpp"
@@ -79,6 +80,39 @@ auto logical_partial_derivatives(const Variables<VariableTags>& u,
                                  const Mesh<Dim>& mesh) noexcept
     -> std::array<Variables<DerivativeTags>, Dim>;
 
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Compute the partial derivatives of each variable with respect to
+/// the logical coordinate, writing into `logical_partial_derivatives_of_u`.
+///
+/// The `Variables` in `logical_partial_derivatives_of_u` are resized if they
+/// do not hold the number of grid points of `u`, so no allocations are made
+/// when the result buffers are reused.
+///
+/// \requires `DerivativeTags` to be the head of `VariableTags`
+template <typename DerivativeTags, typename VariableTags, size_t Dim>
+void logical_partial_derivatives(
+    gsl::not_null<std::array<Variables<DerivativeTags>, Dim>*>
+        logical_partial_derivatives_of_u,
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh) noexcept;
+
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Compute the logical partial derivatives of the first
+/// `number_of_independent_components` components of the data pointed to by
+/// `u`, writing all `Dim` derivatives into one contiguous buffer.
+///
+/// The derivative with respect to \f$\xi^d\f$ is written to the `d`-th chunk
+/// of size `number_of_independent_components * mesh.number_of_grid_points()`
+/// of `logical_partial_derivatives_of_u`, which must hold `Dim` such chunks.
+///
+/// \details The differentiation matrices are applied directly to the
+/// strided data in each dimension using kernels specialized on the number of
+/// grid points, so no transposed copies of `u` are made and no memory is
+/// allocated.
+template <size_t Dim>
+void logical_partial_derivatives(
+    gsl::not_null<double*> logical_partial_derivatives_of_u, const double* u,
+    size_t number_of_independent_components, const Mesh<Dim>& mesh) noexcept;
+
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Compute the partial derivatives of each variable with respect to
 /// the coordinates of `DerivativeFrame`.
@@ -99,6 +133,26 @@ auto partial_derivatives(
     -> Variables<db::wrap_tags_in<Tags::deriv, DerivativeTags,
                                   tmpl::size_t<Dim>, DerivativeFrame>>;
 
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief Compute the partial derivatives of each variable with respect to
+/// the coordinates of `DerivativeFrame`, writing into `du`.
+///
+/// `du` is resized if it does not hold the number of grid points of `u`.
+/// The logical derivatives are computed in the memory of `du` and contracted
+/// with the inverse Jacobian in place, so no memory is allocated when `du` is
+/// reused.
+///
+/// \requires `DerivativeTags` to be the head of `VariableTags`
+template <typename DerivativeTags, typename VariableTags, size_t Dim,
+          typename DerivativeFrame>
+void partial_derivatives(
+    gsl::not_null<Variables<db::wrap_tags_in<
+        Tags::deriv, DerivativeTags, tmpl::size_t<Dim>, DerivativeFrame>>*>
+        du,
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const InverseJacobian<DataVector, Dim, Frame::Logical, DerivativeFrame>&
+        inverse_jacobian) noexcept;
+
 namespace Tags {
 
 /*!
@@ -130,10 +184,11 @@ struct ComputeDeriv
   static constexpr auto Dim = tmpl::back<inv_jac_indices>::dim;
 
  public:
-  static constexpr auto function =
-      partial_derivatives<DerivTags,
-                          typename db::item_type<VariablesTag>::tags_list, Dim,
-                          typename tmpl::back<inv_jac_indices>::Frame>;
+  static auto function(
+      const db::item_type<VariablesTag>& u, const ::Mesh<Dim>& mesh,
+      const db::item_type<InverseJacobianTag>& inverse_jacobian) noexcept {
+    return partial_derivatives<DerivTags>(u, mesh, inverse_jacobian);
+  }
   using argument_tags =
       tmpl::list<VariablesTag, Tags::Mesh<Dim>, InverseJacobianTag>;
 };
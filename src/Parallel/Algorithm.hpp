@@ -23,8 +23,10 @@
 // IWYU pragma: no_include "Parallel/Algorithm.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/CharmRegistration.hpp"
+#include "Parallel/Info.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/PupStlCpp11.hpp"
 #include "Parallel/SimpleActionVisitation.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "Utilities/BoostHelpers.hpp"
@@ -45,6 +47,7 @@ class CProxy_ConstGlobalCache;
 template <class Metavariables>
 class ConstGlobalCache;
 namespace Algorithms {
+struct Array;
 struct Nodegroup;
 struct Singleton;
 }  // namespace Algorithms
@@ -123,6 +126,19 @@ class AlgorithmImpl;
  *
  * If you encounter this issue please file a bug report supplying everything
  * necessary to reproduce the issue.
+ *
+ * ### Load balancing
+ * The wall time spent evaluating the algorithm in `perform_algorithm` is
+ * accumulated as the cost of the chare.  Elements of array Algorithms use
+ * Charm++'s `AtSync` load balancing: calling the `at_sync` entry method on the
+ * array lets Charm++ migrate the elements according to their costs, which
+ * serializes the DataBox and the inboxes with `pup`.  The balancing strategy
+ * is chosen at runtime with the `+balancer` flag.  The graph-partitioning
+ * strategies, e.g. `+balancer MetisLB`, use the measured communication between
+ * the elements to keep neighboring elements together, while `RefineLB` only
+ * moves elements off overloaded processors.  See Parallel::Main and
+ * Parallel::request_load_balancing for how an array pauses its algorithm for a
+ * `LoadBalancing` phase.
  */
 template <typename ParallelComponent, typename ChareType,
           typename Metavariables, typename... ActionsPack, typename ArrayIndex,
@@ -249,6 +265,47 @@ class AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
   /// returns false, or an Action returns with `terminate` set to `true`
   constexpr void perform_algorithm() noexcept;
 
+  /// Start evaluating the algorithm as `perform_algorithm()` does, first
+  /// restarting it if it has terminated and `restart_if_terminated` is `true`.
+  /// This is used to resume an algorithm after a `LoadBalancing` phase.
+  void perform_algorithm(bool restart_if_terminated) noexcept;
+
+  /// Hand control to the Charm++ load balancer, which may migrate the element
+  /// to another processor. Only available for array Algorithms.
+  void at_sync() noexcept {
+    static_assert(is_array,
+                  "Only elements of array Algorithms can be load balanced.");
+    proc_before_load_balancing_ = Parallel::my_proc();
+    // down cast to the algorithm_type, so that the `AtSync` method can be
+    // called, which is defined in the CBase class
+    static_cast<typename ChareType::template algorithm_type<
+        ParallelComponent, Metavariables, tmpl::list<ActionsPack...>,
+        ArrayIndex, InitialDataBox>&>(*this)
+        .AtSync();
+  }
+
+  /// Called by Charm++ on the processor the element lives on after load
+  /// balancing.  If the element was migrated and the `ParallelComponent`
+  /// defines a function
+  /// \code
+  /// static void migrated(Parallel::ConstGlobalCache<Metavariables>& cache,
+  ///                      const array_index& array_index, int previous_proc);
+  /// \endcode
+  /// it is called, e.g. to move registrations with the local branches of
+  /// groups.
+  void resume_from_sync() noexcept;
+
+  /// The wall time spent evaluating the algorithm since the last call, which
+  /// is reported to the Charm++ load balancer as the cost of the element.
+  double take_measured_cost() noexcept {
+    const double measured_cost = measured_cost_;
+    measured_cost_ = 0.0;
+    return measured_cost;
+  }
+
+  /// Charm++ serialization, used when an array element is migrated
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
   /// Tell the Algorithm it should no longer execute the algorithm. This does
   /// not mean that the execution of the program is terminated, but only that
   /// the algorithm has terminated. An algorithm can be restarted by pass `true`
@@ -261,6 +318,8 @@ class AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
  private:
   static constexpr bool is_singleton =
       cpp17::is_same_v<ChareType, Parallel::Algorithms::Singleton>;
+  static constexpr bool is_array =
+      cpp17::is_same_v<ChareType, Parallel::Algorithms::Array>;
 
   template <class Dummy = int,
             Requires<(sizeof(Dummy), is_singleton)> = nullptr>
@@ -276,6 +335,20 @@ class AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
                        .thisIndex;
   }
 
+  template <class Dummy = int,
+            Requires<(sizeof(Dummy), not is_array)> = nullptr>
+  constexpr void enable_load_balancing() noexcept {}
+  template <class Dummy = int, Requires<(sizeof(Dummy), is_array)> = nullptr>
+  void enable_load_balancing() noexcept {
+    // Array elements only migrate when `at_sync` is called, and report the
+    // cost measured by the algorithm instead of the Charm++ measurement
+    auto& algorithm = static_cast<typename ChareType::template algorithm_type<
+        ParallelComponent, Metavariables, tmpl::list<ActionsPack...>,
+        ArrayIndex, InitialDataBox>&>(*this);
+    algorithm.usesAtSync = true;
+    algorithm.usesAutoMeasure = false;
+  }
+
   template <size_t... Is>
   constexpr bool iterate_over_actions(
       std::index_sequence<Is...> /*meta*/) noexcept;
@@ -318,6 +391,16 @@ class AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
                           typename ReceiveTag::type::mapped_type>> = nullptr>
   constexpr void receive_data_impl(typename ReceiveTag::temporal_id& instance,
                                    ReceiveDataType&& t);
+
+  // Inboxes that are not maps from the temporal id provide their own
+  // insertion through a static `insert_into_inbox` function of the tag
+  template <typename ReceiveTag, typename ReceiveDataType,
+            Requires<Algorithm_detail::is_insert_into_inbox_callable_v<
+                ReceiveTag, gsl::not_null<typename ReceiveTag::type*>,
+                const typename ReceiveTag::temporal_id&, ReceiveDataType>> =
+                nullptr>
+  void receive_data_impl(typename ReceiveTag::temporal_id& instance,
+                         ReceiveDataType&& t);
   // @}
 
   // Member variables
@@ -327,6 +410,10 @@ class AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
 #endif
 
   Parallel::ConstGlobalCache<Metavariables>* const_global_cache_{nullptr};
+  // Used to find the local ConstGlobalCache after a migration
+  CkGroupID const_global_cache_id_{};
+  double measured_cost_{0.0};
+  int proc_before_load_balancing_{-1};
   bool performing_action_ = false;
   std::size_t algorithm_step_ = 0;
   tmpl::conditional_t<Parallel::is_node_group_proxy<cproxy_type>::value,
@@ -356,6 +443,7 @@ AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
   make_overloader([](CmiNodeLock& node_lock) { node_lock = create_lock(); },
                   [](NoSuchType /*unused*/) {})(node_lock_);
   set_array_index();
+  enable_load_balancing();
 }
 
 template <typename ParallelComponent, typename ChareType,
@@ -367,6 +455,7 @@ AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
                       global_cache_proxy) noexcept
     : AlgorithmImpl() {
   const_global_cache_ = global_cache_proxy.ckLocalBranch();
+  const_global_cache_id_ = global_cache_proxy.ckGetGroupID();
 }
 
 template <typename ParallelComponent, typename ChareType,
@@ -505,17 +594,79 @@ constexpr void AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
 #ifdef SPECTRE_CHARM_PROJECTIONS
   non_action_time_start_ = Parallel::wall_time();
 #endif
+  const double start_time = Parallel::wall_time();
   lock(&node_lock_);
   while (sizeof...(ActionsPack) > 0 and not get_terminate() and
          iterate_over_actions(
              std::make_index_sequence<sizeof...(ActionsPack)>{})) {
   }
+  measured_cost_ += Parallel::wall_time() - start_time;
   unlock(&node_lock_);
 #ifdef SPECTRE_CHARM_PROJECTIONS
   traceUserBracketEvent(SPECTRE_CHARM_NON_ACTION_WALLTIME_EVENT_ID,
                         non_action_time_start_, Parallel::wall_time());
 #endif
 }
+
+template <typename ParallelComponent, typename ChareType,
+          typename Metavariables, typename... ActionsPack, typename ArrayIndex,
+          typename InitialDataBox>
+void AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
+                   tmpl::list<ActionsPack...>, ArrayIndex, InitialDataBox>::
+    perform_algorithm(const bool restart_if_terminated) noexcept {
+  if (restart_if_terminated) {
+    lock(&node_lock_);
+    set_terminate(false);
+    unlock(&node_lock_);
+  }
+  perform_algorithm();
+}
+
+template <typename ParallelComponent, typename ChareType,
+          typename Metavariables, typename... ActionsPack, typename ArrayIndex,
+          typename InitialDataBox>
+void AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
+                   tmpl::list<ActionsPack...>, ArrayIndex,
+                   InitialDataBox>::pup(PUP::er& p) noexcept {  // NOLINT
+  ASSERT(not performing_action_,
+         "Cannot serialize an Algorithm while it is performing an Action.");
+  p | const_global_cache_id_;
+  p | measured_cost_;
+  p | proc_before_load_balancing_;
+  p | algorithm_step_;
+  p | terminate_;
+  p | box_;
+  p | inboxes_;
+  p | array_index_;
+  if (p.isUnpacking()) {
+    const_global_cache_ =
+        static_cast<Parallel::ConstGlobalCache<Metavariables>*>(
+            CkLocalNodeBranch(const_global_cache_id_));
+  }
+}
+
+template <typename ParallelComponent, typename ChareType,
+          typename Metavariables, typename... ActionsPack, typename ArrayIndex,
+          typename InitialDataBox>
+void AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
+                   tmpl::list<ActionsPack...>, ArrayIndex,
+                   InitialDataBox>::resume_from_sync() noexcept {
+  if (proc_before_load_balancing_ == Parallel::my_proc()) {
+    return;
+  }
+  make_overloader(
+      [this](auto component, int /*gcc_bug*/)
+          -> decltype(tmpl::type_from<decltype(component)>::migrated(
+              *const_global_cache_,
+              std::declval<const array_index&>(), 0)) {
+        tmpl::type_from<decltype(component)>::migrated(
+            *const_global_cache_,
+            static_cast<const array_index&>(array_index_),
+            proc_before_load_balancing_);
+      },
+      [](auto /*component*/, auto... /*meta*/) {})(
+      tmpl::type_<ParallelComponent>{}, 0);
+}
 /// \endcond
 
 template <typename ParallelComponent, typename ChareType,
@@ -677,4 +828,20 @@ AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
   tuples::get<ReceiveTag>(inboxes_)[instance].insert(
       std::forward<ReceiveDataType>(t));
 }
+
+template <typename ParallelComponent, typename ChareType,
+          typename Metavariables, typename... ActionsPack, typename ArrayIndex,
+          typename InitialDataBox>
+template <typename ReceiveTag, typename ReceiveDataType,
+          Requires<Algorithm_detail::is_insert_into_inbox_callable_v<
+              ReceiveTag, gsl::not_null<typename ReceiveTag::type*>,
+              const typename ReceiveTag::temporal_id&, ReceiveDataType>>>
+void AlgorithmImpl<ParallelComponent, ChareType, Metavariables,
+                   tmpl::list<ActionsPack...>, ArrayIndex, InitialDataBox>::
+    receive_data_impl(typename ReceiveTag::temporal_id& instance,
+                      ReceiveDataType&& t) {
+  ReceiveTag::insert_into_inbox(
+      make_not_null(&tuples::get<ReceiveTag>(inboxes_)), instance,
+      std::forward<ReceiveDataType>(t));
+}
 }  // namespace Parallel
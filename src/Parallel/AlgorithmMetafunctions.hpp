@@ -58,5 +58,7 @@ using build_action_return_typelist =
 CREATE_IS_CALLABLE(is_ready)
 
 CREATE_IS_CALLABLE(apply)
+
+CREATE_IS_CALLABLE(insert_into_inbox)
 }  // namespace Algorithm_detail
 }  // namespace Parallel
@@ -101,10 +101,20 @@ class ConstGlobalCache : public CBase_ConstGlobalCache<Metavariables> {
   /// \endcond
 
   /// Entry method to set the ParallelComponents (should only be called once)
+  ///
+  /// `load_balancing_callback` is the empty reduction through which array
+  /// elements request a load balancing phase from Parallel::Main.
   void set_parallel_components(
       tuples::tagged_tuple_from_typelist<parallel_component_tag_list>&
           parallel_components,
-      const CkCallback& callback) noexcept;
+      const CkCallback& callback,
+      const CkCallback& load_balancing_callback) noexcept;
+
+  /// The callback array elements contribute to in order to request a load
+  /// balancing phase, see Parallel::request_load_balancing
+  const CkCallback& load_balancing_callback() const noexcept {
+    return load_balancing_callback_;
+  }
 
  private:
   // clang-tidy: false positive, redundant declaration
@@ -133,16 +143,19 @@ class ConstGlobalCache : public CBase_ConstGlobalCache<Metavariables> {
   tuples::tagged_tuple_from_typelist<parallel_component_tag_list>
       parallel_components_;
   bool parallel_components_have_been_set_{false};
+  CkCallback load_balancing_callback_{};
 };
 
 template <typename Metavariables>
 void ConstGlobalCache<Metavariables>::set_parallel_components(
     tuples::tagged_tuple_from_typelist<parallel_component_tag_list>&
         parallel_components,
-    const CkCallback& callback) noexcept {
+    const CkCallback& callback,
+    const CkCallback& load_balancing_callback) noexcept {
   ASSERT(!parallel_components_have_been_set_,
          "Can only set the parallel_components once");
   parallel_components_ = std::move(parallel_components);
+  load_balancing_callback_ = load_balancing_callback;
   parallel_components_have_been_set_ = true;
   this->contribute(callback);
 }
@@ -35,6 +35,31 @@ void receive_data(Proxy&& proxy, typename ReceiveTag::temporal_id temporal_id,
 }
 // @}
 
+/*!
+ * \ingroup ParallelGroup
+ * \brief Send `receive_data` to the algorithm running on the array element
+ * `proxy` as Parallel::receive_data does, but move it straight into the inbox
+ * if the element is on this processor.
+ *
+ * Data for an element on this processor is neither serialized nor copied, so
+ * large data such as `Variables` are handed over without touching their
+ * buffers.  As with messages to the `[inline]` `receive_data` entry method,
+ * the receiving algorithm continues before this function returns.
+ */
+template <typename ReceiveTag, typename Proxy, typename ReceiveDataType>
+void receive_data_without_local_copy(
+    Proxy&& proxy, typename ReceiveTag::temporal_id temporal_id,
+    ReceiveDataType&& receive_data) noexcept {
+  auto* const local_object = proxy.ckLocal();
+  if (local_object != nullptr) {
+    local_object->template receive_data<ReceiveTag>(
+        std::move(temporal_id), std::forward<ReceiveDataType>(receive_data));
+  } else {
+    proxy.template receive_data<ReceiveTag>(
+        std::move(temporal_id), std::forward<ReceiveDataType>(receive_data));
+  }
+}
+
 // @{
 /*!
  * \ingroup ParallelGroup
@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines function Parallel::request_load_balancing
+
+#pragma once
+
+#include "Parallel/ConstGlobalCache.hpp"
+
+namespace Parallel {
+/*!
+ * \ingroup ParallelGroup
+ * \brief Ask Parallel::Main to insert a `LoadBalancing` phase after the current
+ * phase.
+ *
+ * \details Every element of the array `ParallelComponent` must call this
+ * function before terminating its algorithm, since the request is an empty
+ * reduction over the array.  In the `LoadBalancing` phase the component
+ * should call `at_sync` on the array, so that Charm++ migrates the elements
+ * according to the cost measured by the algorithm, after which the interrupted
+ * phase is executed again.
+ */
+template <typename ParallelComponent, typename Metavariables,
+          typename ArrayIndex>
+void request_load_balancing(ConstGlobalCache<Metavariables>& cache,
+                            const ArrayIndex& array_index) noexcept {
+  Parallel::get_parallel_component<ParallelComponent>(cache)[array_index]
+      .ckLocal()
+      ->contribute(cache.load_balancing_callback());
+}
+}  // namespace Parallel
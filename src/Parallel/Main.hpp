@@ -21,7 +21,9 @@
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Printf.hpp"
 #include "Parallel/TypeTraits.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Overloader.hpp"
+#include "Utilities/Requires.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -64,9 +66,32 @@ class Main : public CBase_Main<Metavariables> {
   void initialize() noexcept;
 
   /// Determine the next phase of the simulation and execute it.
+  ///
+  /// The `Exit` phase is executed like the other phases, and the program
+  /// exits once it has finished.
+  ///
+  /// If load balancing was requested during the phase that just finished, the
+  /// `LoadBalancing` phase is executed next, after which the interrupted phase
+  /// is executed again so the parallel components can resume it.
   void execute_next_phase() noexcept;
 
+  /// Request a `LoadBalancing` phase once the current phase has finished.
+  /// This is the target of the empty reduction in
+  /// Parallel::request_load_balancing, and requires the `Phase` of the
+  /// Metavariables to have a `LoadBalancing` member.
+  void request_load_balancing() noexcept { load_balancing_requested_ = true; }
+
  private:
+  template <typename PhaseType,
+            Requires<Parallel::has_load_balancing_phase_v<PhaseType>> =
+                nullptr>
+  PhaseType next_phase(PhaseType current_phase) noexcept;
+
+  template <typename PhaseType,
+            Requires<not Parallel::has_load_balancing_phase_v<PhaseType>> =
+                nullptr>
+  PhaseType next_phase(PhaseType current_phase) noexcept;
+
   template <typename ParallelComponent>
   using parallel_component_options = typename ParallelComponent::options;
   using option_list = tmpl::remove_duplicates<tmpl::flatten<tmpl::list<
@@ -80,6 +105,10 @@ class Main : public CBase_Main<Metavariables> {
           tmpl::bind<Parallel::proxy_from_parallel_component, tmpl::_1>>>;
   typename Metavariables::Phase current_phase_{
       Metavariables::Phase::Initialization};
+  bool load_balancing_requested_{false};
+  bool resume_interrupted_phase_{false};
+  typename Metavariables::Phase interrupted_phase_{
+      Metavariables::Phase::Initialization};
 
   CProxy_ConstGlobalCache<Metavariables> const_global_cache_proxy_;
   Options<option_list> options_;
@@ -279,8 +308,10 @@ Main<Metavariables>::Main(CkArgMsg* msg) noexcept
   // executed.
   CkCallback callback(CkIndex_Main<Metavariables>::initialize(),
                       this->thisProxy);
-  const_global_cache_proxy_.set_parallel_components(the_parallel_components,
-                                                    callback);
+  CkCallback load_balancing_callback(
+      CkIndex_Main<Metavariables>::request_load_balancing(), this->thisProxy);
+  const_global_cache_proxy_.set_parallel_components(
+      the_parallel_components, callback, load_balancing_callback);
 }
 
 template <typename Metavariables>
@@ -299,12 +330,13 @@ void Main<Metavariables>::initialize() noexcept {
 
 template <typename Metavariables>
 void Main<Metavariables>::execute_next_phase() noexcept {
-  current_phase_ = Metavariables::determine_next_phase(
-      current_phase_, const_global_cache_proxy_);
+  // The parallel components have finished the Exit phase, e.g. the writes to
+  // disk that were still in progress.
   if (Metavariables::Phase::Exit == current_phase_) {
     Informer::print_exit_info();
     Parallel::exit();
   }
+  current_phase_ = next_phase(current_phase_);
   tmpl::for_each<component_list>([this](auto parallel_component) noexcept {
     tmpl::type_from<decltype(parallel_component)>::execute_next_phase(
         current_phase_, const_global_cache_proxy_);
@@ -313,6 +345,39 @@ void Main<Metavariables>::execute_next_phase() noexcept {
                        this->thisProxy));
 }
 
+template <typename Metavariables>
+template <typename PhaseType,
+          Requires<Parallel::has_load_balancing_phase_v<PhaseType>>>
+PhaseType Main<Metavariables>::next_phase(
+    const PhaseType current_phase) noexcept {
+  if (load_balancing_requested_) {
+    load_balancing_requested_ = false;
+    resume_interrupted_phase_ = true;
+    interrupted_phase_ = current_phase;
+    return PhaseType::LoadBalancing;
+  }
+  if (resume_interrupted_phase_) {
+    resume_interrupted_phase_ = false;
+    return interrupted_phase_;
+  }
+  return Metavariables::determine_next_phase(current_phase,
+                                             const_global_cache_proxy_);
+}
+
+template <typename Metavariables>
+template <typename PhaseType,
+          Requires<not Parallel::has_load_balancing_phase_v<PhaseType>>>
+PhaseType Main<Metavariables>::next_phase(
+    const PhaseType current_phase) noexcept {
+  if (UNLIKELY(load_balancing_requested_)) {
+    ERROR(
+        "Load balancing was requested, but the Metavariables have no "
+        "LoadBalancing phase.");
+  }
+  return Metavariables::determine_next_phase(current_phase,
+                                             const_global_cache_proxy_);
+}
+
 }  // namespace Parallel
 
 #define CK_TEMPLATES_ONLY
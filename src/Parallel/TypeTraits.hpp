@@ -142,4 +142,24 @@ template <typename T>
 using is_pupable_t = typename is_pupable<T>::type;
 // @}
 
+// @{
+/// \ingroup ParallelGroup
+/// \brief Check if the `Phase` enum `T` has a member `LoadBalancing`
+///
+/// \details
+/// Inherits from std::true_type if `T::LoadBalancing` exists, otherwise
+/// inherits from std::false_type.  Parallel::Main inserts a `LoadBalancing`
+/// phase when load balancing is requested only if the phase exists.
+template <typename T, typename = cpp17::void_t<>>
+struct has_load_balancing_phase : std::false_type {};
+/// \cond HIDDEN_SYMBOLS
+template <typename T>
+struct has_load_balancing_phase<T, cpp17::void_t<decltype(T::LoadBalancing)>>
+    : std::true_type {};
+/// \endcond
+/// \see has_load_balancing_phase
+template <typename T>
+constexpr bool has_load_balancing_phase_v = has_load_balancing_phase<T>::value;
+// @}
+
 } // namespace Parallel
@@ -7,6 +7,7 @@
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 
 template <typename X, typename Symm, typename IndexList>
@@ -42,23 +43,36 @@ raise_or_lower_first_index(
 }
 
 template <typename DataType, typename Index0>
-Tensor<DataType, Symmetry<1>, index_list<change_index_up_lo<Index0>>>
-raise_or_lower_index(
+void raise_or_lower_index(
+    const gsl::not_null<
+        Tensor<DataType, Symmetry<1>, index_list<change_index_up_lo<Index0>>>*>
+        result,
     const Tensor<DataType, Symmetry<1>, index_list<Index0>>& tensor,
     const Tensor<DataType, Symmetry<1, 1>,
                  index_list<change_index_up_lo<Index0>,
                             change_index_up_lo<Index0>>>& metric) noexcept {
-  auto tensor_opposite_valence = make_with_value<
-      Tensor<DataType, Symmetry<1>, index_list<change_index_up_lo<Index0>>>>(
-      metric, 0.);
-
   constexpr auto dimension = Index0::dim;
 
   for (size_t i = 0; i < dimension; ++i) {
-    for (size_t m = 0; m < dimension; ++m) {
-      tensor_opposite_valence.get(i) += tensor.get(m) * metric.get(i, m);
+    result->get(i) = tensor.get(0) * metric.get(i, 0);
+    for (size_t m = 1; m < dimension; ++m) {
+      result->get(i) += tensor.get(m) * metric.get(i, m);
     }
   }
+}
+
+template <typename DataType, typename Index0>
+Tensor<DataType, Symmetry<1>, index_list<change_index_up_lo<Index0>>>
+raise_or_lower_index(
+    const Tensor<DataType, Symmetry<1>, index_list<Index0>>& tensor,
+    const Tensor<DataType, Symmetry<1, 1>,
+                 index_list<change_index_up_lo<Index0>,
+                            change_index_up_lo<Index0>>>& metric) noexcept {
+  auto tensor_opposite_valence = make_with_value<
+      Tensor<DataType, Symmetry<1>, index_list<change_index_up_lo<Index0>>>>(
+      metric, 0.);
+  raise_or_lower_index(make_not_null(&tensor_opposite_valence), tensor,
+                       metric);
   return tensor_opposite_valence;
 }
 
@@ -152,6 +166,17 @@ GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3), (double, DataVector),
 #undef INSTANTIATE
 
 #define INSTANTIATE2(_, data)                                           \
+  template void raise_or_lower_index(                                   \
+      const gsl::not_null<Tensor<DTYPE(data), Symmetry<1>,              \
+                                 index_list<change_index_up_lo<         \
+                                     INDEX0(data)>>>*>                  \
+          result,                                                       \
+      const Tensor<DTYPE(data), Symmetry<1>, index_list<INDEX0(data)>>& \
+          tensor,                                                       \
+      const Tensor<DTYPE(data), Symmetry<1, 1>,                         \
+                   index_list<change_index_up_lo<INDEX0(data)>,         \
+                              change_index_up_lo<INDEX0(data)>>>&       \
+          metric) noexcept;                                             \
   template Tensor<DTYPE(data), Symmetry<1>,                             \
                   index_list<change_index_up_lo<INDEX0(data)>>>         \
   raise_or_lower_index(                                                 \
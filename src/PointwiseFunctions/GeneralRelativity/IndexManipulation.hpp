@@ -4,6 +4,7 @@
 #pragma once
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -47,6 +48,17 @@ raise_or_lower_first_index(
  * corresponding tensor \f$ S_{a} \f$ is calculated with respect to the metric
  * \f$g_{ab}\f$.
  */
+//@{
+template <typename DataType, typename Index0>
+void raise_or_lower_index(
+    gsl::not_null<
+        Tensor<DataType, Symmetry<1>, index_list<change_index_up_lo<Index0>>>*>
+        result,
+    const Tensor<DataType, Symmetry<1>, index_list<Index0>>& tensor,
+    const Tensor<DataType, Symmetry<1, 1>,
+                 index_list<change_index_up_lo<Index0>,
+                            change_index_up_lo<Index0>>>& metric) noexcept;
+
 template <typename DataType, typename Index0>
 Tensor<DataType, Symmetry<1>, index_list<change_index_up_lo<Index0>>>
 raise_or_lower_index(
@@ -54,6 +66,7 @@ raise_or_lower_index(
     const Tensor<DataType, Symmetry<1, 1>,
                  index_list<change_index_up_lo<Index0>,
                             change_index_up_lo<Index0>>>& metric) noexcept;
+//@}
 
 /*!
  * \ingroup GeneralRelativityGroup
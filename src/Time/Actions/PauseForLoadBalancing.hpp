@@ -0,0 +1,68 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines action PauseForLoadBalancing
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/LoadBalancing.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeId.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// \brief Pause the algorithm for a `LoadBalancing` phase at the start of
+/// every `OptionTags::LoadBalancingInterval`th slab
+///
+/// The algorithm is terminated after requesting the phase with
+/// Parallel::request_load_balancing, so the parallel component must restart
+/// it when Parallel::Main resumes the interrupted phase.  Since all elements
+/// pass through the start of every slab, they all pause, also with local time
+/// stepping.
+///
+/// Uses:
+/// - ConstGlobalCache: OptionTags::LoadBalancingInterval
+/// - DataBox: Tags::TimeId
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies: nothing
+struct PauseForLoadBalancing {
+  using const_global_cache_tags =
+      tmpl::list<OptionTags::LoadBalancingInterval>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    const size_t interval =
+        Parallel::get<OptionTags::LoadBalancingInterval>(cache);
+    const TimeId& time_id = db::get<Tags::TimeId>(box);
+    // Negative slab numbers are used while self-starting
+    const bool pause = interval > 0 and time_id.slab_number() > 0 and
+                       time_id.substep() == 0 and
+                       time_id.time().is_at_slab_boundary() and
+                       static_cast<size_t>(time_id.slab_number()) % interval ==
+                           0;
+    if (pause) {
+      Parallel::request_load_balancing<ParallelComponent>(cache, array_index);
+    }
+    return std::tuple<db::DataBox<DbTags>&&, bool>(std::move(box), pause);
+  }
+};
+}  // namespace Actions
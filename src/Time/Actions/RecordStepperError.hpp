@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <tuple>
+#include <utility>  // IWYU pragma: keep // for std::move
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "Time/StepChoosers/ErrorEstimate.hpp"
+#include "Time/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+namespace Parallel {
+template <typename Metavariables>
+class ConstGlobalCache;
+}  // namespace Parallel
+// IWYU pragma: no_forward_declare db::DataBox
+/// \endcond
+
+namespace Actions {
+namespace RecordStepperError_detail {
+template <typename System>
+using history_tag = Tags::HistoryEvolvedVariables<
+    typename System::variables_tag,
+    db::add_tag_prefix<Tags::dt, typename System::variables_tag>>;
+
+template <typename System>
+using error_tag = Tags::StepperError<
+    typename System::variables_tag,
+    db::add_tag_prefix<Tags::dt, typename System::variables_tag>>;
+}  // namespace RecordStepperError_detail
+
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// \brief Records the estimate of the local truncation error of the
+/// step about to be taken, for StepChoosers::ErrorEstimate.
+///
+/// The estimate is the difference between the Adams-Bashforth steps
+/// of the order of the history and of one order lower.  It must
+/// therefore be placed after Actions::RecordTimeStepperData and before
+/// Actions::UpdateU, where the history holds all derivatives used by
+/// the step.  It should not be placed in the self-start procedure,
+/// which uses shorter steps and histories.  Nothing is recorded for a
+/// history of fewer than two entries.  The estimate must already be in
+/// the DataBox, so the type of the DataBox does not change when this
+/// action is placed in a loop; dg::Actions::InitializeElement adds it
+/// with a vanishing value when local time-stepping is enabled.
+///
+/// With `dt_variables_tag = db::add_tag_prefix<Tags::dt, variables_tag>`:
+///
+/// Uses:
+/// - ConstGlobalCache: nothing
+/// - DataBox:
+///   - Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>
+///   - Tags::TimeStep
+///   - Tags::StepperError<variables_tag, dt_variables_tag>
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies: Tags::StepperError<variables_tag, dt_variables_tag>
+struct RecordStepperError {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    using history_tag = RecordStepperError_detail::history_tag<
+        typename Metavariables::system>;
+    using error_tag = RecordStepperError_detail::error_tag<
+        typename Metavariables::system>;
+    if (db::get<history_tag>(box).size() >= 2) {
+      db::mutate<error_tag>(
+          make_not_null(&box),
+          [](const gsl::not_null<db::item_type<error_tag>*> error,
+             const db::item_type<history_tag>& history,
+             const db::item_type<Tags::TimeStep>& time_step) noexcept {
+            StepChoosers::ErrorEstimate_detail::adams_bashforth_error(
+                error, history, time_step.value());
+          },
+          db::get<history_tag>(box), db::get<Tags::TimeStep>(box));
+    }
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+}  // namespace Actions
@@ -9,17 +9,15 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/DataBoxTag.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
 #include "Time/Tags.hpp"
 // IWYU pragma: no_include "Time/Time.hpp" // for Time
 #include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 /// \cond
 // IWYU pragma: no_forward_declare Time
-namespace Parallel {
-template <typename Metavariables>
-class ConstGlobalCache;
-}  // namespace Parallel
 // IWYU pragma: no_forward_declare db::DataBox
 /// \endcond
 
@@ -29,10 +27,13 @@ namespace Actions {
 /// \brief Records the variables and their time derivatives in the
 /// time stepper history.
 ///
+/// The variables are only copied into the history if the time stepper
+/// reads them (see TimeStepper::uses_history_values).
+///
 /// With `dt_variables_tag = db::add_tag_prefix<Tags::dt, variables_tag>`:
 ///
 /// Uses:
-/// - ConstGlobalCache: nothing
+/// - ConstGlobalCache: OptionTags::TimeStepper
 /// - DataBox:
 ///   - variables_tag
 ///   - dt_variables_tag
@@ -46,12 +47,14 @@ namespace Actions {
 ///   - dt_variables_tag,
 ///   - Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>
 struct RecordTimeStepperData {
+  using const_global_cache_tags = tmpl::list<OptionTags::TimeStepper>;
+
   template <typename DbTags, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
             typename ParallelComponent>
   static auto apply(db::DataBox<DbTags>& box,
                     tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
-                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& cache,
                     const ArrayIndex& /*array_index*/,
                     const ActionList /*meta*/,
                     const ParallelComponent* const /*meta*/) noexcept {
@@ -62,11 +65,16 @@ struct RecordTimeStepperData {
 
     db::mutate<dt_variables_tag, history_tag>(
         make_not_null(&box),
-        [](const gsl::not_null<db::item_type<dt_variables_tag>*> dt_vars,
-           const gsl::not_null<db::item_type<history_tag>*> history,
-           const db::item_type<variables_tag>& vars,
-           const db::item_type<Tags::Time>& time) noexcept {
-          history->insert(time, vars, std::move(*dt_vars));
+        [&cache](const gsl::not_null<db::item_type<dt_variables_tag>*> dt_vars,
+                 const gsl::not_null<db::item_type<history_tag>*> history,
+                 const db::item_type<variables_tag>& vars,
+                 const db::item_type<Tags::Time>& time) noexcept {
+          if (Parallel::get<OptionTags::TimeStepper>(cache)
+                  .uses_history_values()) {
+            history->insert(time, vars, std::move(*dt_vars));
+          } else {
+            history->insert_without_value(time, std::move(*dt_vars));
+          }
         },
         db::get<variables_tag>(box), db::get<Tags::Time>(box));
 
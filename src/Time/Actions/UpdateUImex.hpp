@@ -0,0 +1,125 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines action UpdateUImex
+
+#pragma once
+
+#include <tuple>
+#include <utility>  // IWYU pragma: keep // for std::move
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/ImexRungeKutta3.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+/// \cond
+// IWYU pragma: no_forward_declare db::DataBox
+/// \endcond
+
+namespace Actions {
+/// \ingroup ActionsGroup
+/// \ingroup TimeGroup
+/// \brief Perform variable updates for one substep, treating the
+/// implicit sources of the system implicitly
+///
+/// The time stepper must be a TimeSteppers::ImexRungeKutta3.  The time
+/// derivative in the history must not include the implicit sources,
+/// which are given by `system::implicit_sources`.  That struct must
+/// have a type alias `argument_tags` and a static `apply` function
+/// \code
+/// static void apply(
+///     gsl::not_null<db::item_type<variables_tag>*> vars,
+///     gsl::not_null<db::item_type<dt_variables_tag>*> source,
+///     double implicit_weight, const db::item_type<ArgumentTags>&...);
+/// \endcode
+/// replacing `vars` by the solution \f$U\f$ of \f$U = u + w S(U)\f$,
+/// where \f$u\f$ is the value of `vars` on entry and \f$w\f$ is the
+/// `implicit_weight`, and setting `source` to \f$S(U)\f$.  The sources
+/// are local, so the solve is done point by point, using
+/// RootFinder::newton_raphson for nonlinear sources.  Since the source
+/// is evaluated at the values of the variables only, sources depending
+/// explicitly on time should be part of the explicit derivative.
+///
+/// With `dt_variables_tag = db::add_tag_prefix<Tags::dt, variables_tag>`:
+///
+/// Uses:
+/// - ConstGlobalCache: OptionTags::TimeStepper
+/// - DataBox:
+///   - variables_tag
+///   - Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>
+///   - Tags::HistoryImplicitSources<dt_variables_tag>
+///   - Tags::TimeStep
+///   - Items in system::implicit_sources::argument_tags
+///
+/// DataBox changes:
+/// - Adds: nothing
+/// - Removes: nothing
+/// - Modifies:
+///   - variables_tag
+///   - Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>
+///   - Tags::HistoryImplicitSources<dt_variables_tag>
+struct UpdateUImex {
+  using const_global_cache_tags = tmpl::list<OptionTags::TimeStepper>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    using system = typename Metavariables::system;
+    using variables_tag = typename system::variables_tag;
+    using dt_variables_tag = db::add_tag_prefix<Tags::dt, variables_tag>;
+    using history_tag =
+        Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>;
+    using implicit_history_tag = Tags::HistoryImplicitSources<dt_variables_tag>;
+    using implicit_sources = typename system::implicit_sources;
+
+    const auto* const time_stepper =
+        dynamic_cast<const TimeSteppers::ImexRungeKutta3*>(
+            &Parallel::get<OptionTags::TimeStepper>(cache));
+    if (time_stepper == nullptr) {
+      ERROR("Implicit sources require the ImexRungeKutta3 time stepper.");
+    }
+
+    db::mutate_apply<
+        tmpl::list<variables_tag, history_tag, implicit_history_tag>,
+        tmpl::push_front<typename implicit_sources::argument_tags,
+                         Tags::TimeStep>>(
+        [time_stepper](
+            const gsl::not_null<db::item_type<variables_tag>*> vars,
+            const gsl::not_null<db::item_type<history_tag>*> history,
+            const gsl::not_null<db::item_type<implicit_history_tag>*>
+                implicit_history,
+            const db::item_type<Tags::TimeStep>& time_step,
+            const auto&... source_args) noexcept {
+          time_stepper->update_u(
+              vars, history, implicit_history, time_step,
+              [&source_args...](
+                  const gsl::not_null<db::item_type<variables_tag>*> u,
+                  const gsl::not_null<db::item_type<dt_variables_tag>*>
+                      source,
+                  const Time& /*stage_time*/,
+                  const double implicit_weight) noexcept {
+                implicit_sources::apply(u, source, implicit_weight,
+                                        source_args...);
+              });
+        },
+        make_not_null(&box));
+
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+}  // namespace Actions
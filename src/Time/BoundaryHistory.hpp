@@ -3,18 +3,16 @@
 
 #pragma once
 
-#include <algorithm>
 #include <boost/iterator/transform_iterator.hpp>
 #include <cstddef>
-#include <deque>
 #include <map>
 #include <pup.h>
 #include <pup_stl.h>  // IWYU pragma: keep
 #include <tuple>
 #include <utility>
 
-#include "ErrorHandling/Assert.hpp"
 #include "Parallel/PupStlCpp11.hpp"  // IWYU pragma: keep
+#include "Time/HistoryBuffer.hpp"
 #include "Time/Time.hpp"  // IWYU pragma: keep
 #include "Time/TimeId.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -24,6 +22,9 @@ namespace TimeSteppers {
 
 /// \ingroup TimeSteppersGroup
 /// History data used by a TimeStepper for boundary integration.
+///
+/// The entries of each side are stored in a HistoryBuffer, and the
+/// cached couplings are labeled by the indices of their entries.
 /// \tparam LocalVars local variables passed to the boundary coupling
 /// \tparam RemoteVars remote variables passed to the boundary coupling
 /// \tparam CouplingResult result of the coupling function
@@ -32,14 +33,11 @@ class BoundaryHistory {
   template <typename Vars>
   using IteratorType = boost::transform_iterator<
     const Time& (*)(const std::tuple<Time, Vars>&),
-    typename std::deque<std::tuple<Time, Vars>>::const_iterator>;
+    typename HistoryBuffer<std::tuple<Time, Vars>>::const_iterator>;
  public:
   using local_iterator = IteratorType<LocalVars>;
   using remote_iterator = IteratorType<RemoteVars>;
 
-  // No copying because of the pointers in the cache.  Moving is fine
-  // because we also move the container being pointed into and maps
-  // guarantee that this doesn't invalidate pointers.
   BoundaryHistory() = default;
   BoundaryHistory(const BoundaryHistory&) = delete;
   BoundaryHistory(BoundaryHistory&&) = default;
@@ -50,10 +48,10 @@ class BoundaryHistory {
   /// Add a new value to the end of the history of the indicated side.
   //@{
   void local_insert(const TimeId& time_id, LocalVars vars) noexcept {
-    local_data_.emplace_back(time_id.time(), std::move(vars));
+    insert(local_data_.push_back(), time_id, std::move(vars));
   }
   void remote_insert(const TimeId& time_id, RemoteVars vars) noexcept {
-    remote_data_.emplace_back(time_id.time(), std::move(vars));
+    insert(remote_data_.push_back(), time_id, std::move(vars));
   }
   //@}
 
@@ -61,10 +59,10 @@ class BoundaryHistory {
   /// side.  This is often convenient for setting initial data.
   //@{
   void local_insert_initial(const TimeId& time_id, LocalVars vars) noexcept {
-    local_data_.emplace_front(time_id.time(), std::move(vars));
+    insert(local_data_.push_front(), time_id, std::move(vars));
   }
   void remote_insert_initial(const TimeId& time_id, RemoteVars vars) noexcept {
-    remote_data_.emplace_front(time_id.time(), std::move(vars));
+    insert(remote_data_.push_front(), time_id, std::move(vars));
   }
   //@}
 
@@ -74,10 +72,10 @@ class BoundaryHistory {
   /// internally by the time steppers.
   //@{
   void local_mark_unneeded(const local_iterator& first_needed) noexcept {
-    mark_unneeded<0>(make_not_null(&local_data_), first_needed);
+    mark_unneeded<0>(make_not_null(&local_data_), first_needed.base());
   }
   void remote_mark_unneeded(const remote_iterator& first_needed) noexcept {
-    mark_unneeded<1>(make_not_null(&remote_data_), first_needed);
+    mark_unneeded<1>(make_not_null(&remote_data_), first_needed.base());
   }
   //@}
 
@@ -114,34 +112,43 @@ class BoundaryHistory {
   void pup(PUP::er& p) noexcept;  // NOLINT
 
  private:
-  template <size_t Side, typename DataType, typename Iterator>
-  void mark_unneeded(gsl::not_null<DataType*> data,
-                     const Iterator& first_needed) noexcept;
-
-  std::deque<std::tuple<Time, LocalVars>> local_data_;
-  std::deque<std::tuple<Time, RemoteVars>> remote_data_;
-  // We use pointers instead of iterators because deque invalidates
-  // iterators when elements are inserted or removed at the ends, but
-  // not pointers.
-  std::map<std::pair<const Time*, const Time*>, CouplingResult> coupling_cache_;
+  template <typename Vars>
+  static void insert(std::tuple<Time, Vars>& entry, const TimeId& time_id,
+                     Vars vars) noexcept {
+    std::get<0>(entry) = time_id.time();
+    std::get<1>(entry) = std::move(vars);
+  }
+
+  template <size_t Side, typename Vars>
+  void mark_unneeded(
+      gsl::not_null<HistoryBuffer<std::tuple<Time, Vars>>*> data,
+      const typename HistoryBuffer<std::tuple<Time, Vars>>::const_iterator&
+          first_needed) noexcept;
+
+  HistoryBuffer<std::tuple<Time, LocalVars>> local_data_;
+  HistoryBuffer<std::tuple<Time, RemoteVars>> remote_data_;
+  // Keyed by the indices of the local and remote entries in their
+  // buffers, which do not change while the entries are needed.
+  std::map<std::pair<std::ptrdiff_t, std::ptrdiff_t>, CouplingResult>
+      coupling_cache_;
 };
 
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
-template <size_t Side, typename DataType, typename Iterator>
+template <size_t Side, typename Vars>
 void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::mark_unneeded(
-    gsl::not_null<DataType*> data, const Iterator& first_needed) noexcept {
-  for (auto it = data->begin(); it != first_needed.base(); ++it) {
-    // Clean out cache entries referring to the entry we are removing.
-    for (auto cache_entry = coupling_cache_.begin();
-         cache_entry != coupling_cache_.end();) {
-      if (std::get<Side>(cache_entry->first) == &std::get<0>(*it)) {
-        cache_entry = coupling_cache_.erase(cache_entry);
-      } else {
-        ++cache_entry;
-      }
+    const gsl::not_null<HistoryBuffer<std::tuple<Time, Vars>>*> data,
+    const typename HistoryBuffer<std::tuple<Time, Vars>>::const_iterator&
+        first_needed) noexcept {
+  // Clean out cache entries referring to the entries we are removing.
+  for (auto cache_entry = coupling_cache_.begin();
+       cache_entry != coupling_cache_.end();) {
+    if (std::get<Side>(cache_entry->first) < first_needed.index()) {
+      cache_entry = coupling_cache_.erase(cache_entry);
+    } else {
+      ++cache_entry;
     }
   }
-  data->erase(data->begin(), first_needed.base());
+  data->pop_front(first_needed);
 }
 
 template <typename LocalVars, typename RemoteVars, typename CouplingResult>
@@ -150,8 +157,9 @@ const CouplingResult&
 BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::coupling(
     Coupling&& c, const local_iterator& local,
     const remote_iterator& remote) noexcept {
-  const auto insert_result = coupling_cache_.insert(
-      std::make_pair(std::make_pair(&*local, &*remote), CouplingResult{}));
+  const auto insert_result = coupling_cache_.insert(std::make_pair(
+      std::make_pair(local.base().index(), remote.base().index()),
+      CouplingResult{}));
   CouplingResult& inserted_value = insert_result.first->second;
   const bool is_new_value = insert_result.second;
   if (is_new_value) {
@@ -167,52 +175,6 @@ void BoundaryHistory<LocalVars, RemoteVars, CouplingResult>::pup(
     PUP::er& p) noexcept {
   p | local_data_;
   p | remote_data_;
-
-  const size_t cache_size = PUP_stl_container_size(p, coupling_cache_);
-  if (p.isUnpacking()) {
-    for (size_t entry_num = 0; entry_num < cache_size; ++entry_num) {
-      size_t local_index, remote_index;
-      CouplingResult cache_value;
-      p | local_index;
-      p | remote_index;
-      p | cache_value;
-      const auto cache_key =
-          std::make_pair(&std::get<0>(local_data_[local_index]),
-                         &std::get<0>(remote_data_[remote_index]));
-      coupling_cache_.insert(std::make_pair(cache_key, cache_value));
-    }
-  } else {
-    for (auto& cache_entry : coupling_cache_) {
-      // clang-tidy: modernize-use-auto - Ensuring the correct type is
-      // important here to prevent undefined behavior in charm.  I
-      // want to be explicit.
-      size_t local_index = static_cast<size_t>(  // NOLINT
-          std::find_if(
-              local_data_.begin(), local_data_.end(),
-              [goal = cache_entry.first.first](const auto& entry) noexcept {
-                return &std::get<0>(entry) == goal;
-              }) -
-          local_data_.begin());
-      ASSERT(local_index < local_data_.size(),
-             "Failed to find local history entry for cache entry");
-
-      // clang-tidy: modernize-use-auto - Ensuring the correct type is
-      // important here to prevent undefined behavior in charm.  I
-      // want to be explicit.
-      size_t remote_index = static_cast<size_t>(  // NOLINT
-          std::find_if(
-              remote_data_.begin(), remote_data_.end(),
-              [goal = cache_entry.first.second](const auto& entry) noexcept {
-                return &std::get<0>(entry) == goal;
-              }) -
-          remote_data_.begin());
-      ASSERT(remote_index < remote_data_.size(),
-             "Failed to find remote history entry for cache entry");
-
-      p | local_index;
-      p | remote_index;
-      p | cache_entry.second;
-    }
-  }
+  p | coupling_cache_;
 }
 }  // namespace TimeSteppers
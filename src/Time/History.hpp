@@ -3,13 +3,14 @@
 
 #pragma once
 
-#include <deque>
+#include <cstddef>
 #include <iterator>
 #include <pup.h>
 #include <tuple>
 #include <utility>
 
 #include "Parallel/PupStlCpp11.hpp"
+#include "Time/HistoryBuffer.hpp"
 #include "Time/Time.hpp"
 
 namespace TimeSteppers {
@@ -19,6 +20,9 @@ class HistoryIterator;
 
 /// \ingroup TimeSteppersGroup
 /// History data used by a TimeStepper.
+///
+/// The entries are stored in a HistoryBuffer, so after the first few
+/// steps inserting an entry reuses the memory of an unneeded one.
 /// \tparam Vars type of variables being integrated
 /// \tparam DerivVars type of derivative variables
 template <typename Vars, typename DerivVars>
@@ -45,6 +49,15 @@ class History {
   /// remain unchanged but does not care about `deriv`.
   void insert(Time time, const Vars& value, DerivVars&& deriv) noexcept;
 
+  /// Add a new set of values to the end of the history without
+  /// copying the variables.  The value of the new entry is either
+  /// default constructed or left over from a previously inserted
+  /// entry, and may be set by the time stepper.  This is used for
+  /// time steppers that do not read the values they are passed (see
+  /// TimeStepper::uses_history_values), so that the history does not
+  /// hold a copy of the variables for every entry.
+  void insert_without_value(Time time, DerivVars&& deriv) noexcept;
+
   /// Add a new set of values to the front of the history.  This is
   /// often convenient for setting initial data.
   void insert_initial(Time time, Vars value, DerivVars deriv) noexcept;
@@ -54,21 +67,40 @@ class History {
   /// necessary, as it is handled internally by the time steppers.
   void mark_unneeded(const const_iterator& first_needed) noexcept;
 
+  /// The number of entries inserted with `insert` since all entries
+  /// were last marked as unneeded.  Time steppers that keep only the
+  /// most recent entry between substeps use this to find the substep.
+  size_type inserts_since_emptied() const noexcept {
+    return inserts_since_emptied_;
+  }
+
+  /// Mutable access to the value and the derivative of a needed
+  /// entry.  Low-storage time steppers use the entries as registers
+  /// holding the data carried from one substep to the next.
+  //@{
+  Vars& mutable_value(const const_iterator& entry) noexcept {
+    return std::get<1>(data_.mutable_entry(entry.base_));
+  }
+  DerivVars& mutable_derivative(const const_iterator& entry) noexcept {
+    return std::get<2>(data_.mutable_entry(entry.base_));
+  }
+  //@}
+
   /// These iterators directly return the Time of the past values.
   /// The other data can be accessed through the iterators using
   /// HistoryIterator::value() and HistoryIterator::derivative().
   //@{
-  const_iterator begin() const noexcept {
-    return data_.begin() + static_cast<ssize_t>(first_needed_entry_);
-  }
+  const_iterator begin() const noexcept { return data_.begin(); }
   const_iterator end() const noexcept { return data_.end(); }
   const_iterator cbegin() const noexcept { return begin(); }
   const_iterator cend() const noexcept { return end(); }
   //@}
 
-  size_type size() const noexcept { return capacity() - first_needed_entry_; }
-  size_type capacity() const noexcept { return data_.size(); }
-  void shrink_to_fit() noexcept;
+  size_type size() const noexcept { return data_.size(); }
+  /// The number of needed entries plus the number of unneeded entries
+  /// kept for reuse.
+  size_type capacity() const noexcept { return data_.capacity(); }
+  void shrink_to_fit() noexcept { data_.shrink_to_fit(); }
 
   /// These return the past times.  The other data can be accessed
   /// through HistoryIterator methods.
@@ -78,21 +110,19 @@ class History {
   }
 
   const_reference front() const noexcept { return *begin(); }
-  const_reference back() const noexcept { return std::get<0>(data_.back()); }
+  const_reference back() const noexcept { return *(end() - 1); }
   //@}
 
   // clang-tidy: google-runtime-references
   void pup(PUP::er& p) noexcept {  // NOLINT
-    // Don't send cached allocations.  This object is probably going
-    // to be thrown away after serialization, so we take the easy
-    // route of just throwing them away.
-    shrink_to_fit();
+    // Only the needed entries are sent.
     p | data_;
+    p | inserts_since_emptied_;
   }
 
  private:
-  std::deque<std::tuple<Time, Vars, DerivVars>> data_;
-  size_t first_needed_entry_{0};
+  HistoryBuffer<std::tuple<Time, Vars, DerivVars>> data_;
+  size_t inserts_since_emptied_{0};
 };
 
 /// \ingroup TimeSteppersGroup
@@ -100,8 +130,8 @@ class History {
 /// details.
 template <typename Vars, typename DerivVars>
 class HistoryIterator {
-  using Base =
-      typename std::deque<std::tuple<Time, Vars, DerivVars>>::const_iterator;
+  using Base = typename HistoryBuffer<
+      std::tuple<Time, Vars, DerivVars>>::const_iterator;
 
  public:
   using iterator_category =
@@ -168,43 +198,45 @@ class HistoryIterator {
 template <typename Vars, typename DerivVars>
 void History<Vars, DerivVars>::insert(Time time, const Vars& value,
                                       DerivVars&& deriv) noexcept {
-  if (first_needed_entry_ == 0) {
-    // clang-tidy: move of trivially-copyable type
-    data_.emplace_back(std::move(time), value, deriv);  // NOLINT
-  } else {
-    // Move an unneeded entry into the arguments so the caller can
+  insert_without_value(std::move(time), std::move(deriv));
+  mutable_value(end() - 1) = value;
+}
+
+template <typename Vars, typename DerivVars>
+void History<Vars, DerivVars>::insert_without_value(
+    Time time, DerivVars&& deriv) noexcept {
+  ++inserts_since_emptied_;
+  const bool reuse_entry = data_.size() < data_.capacity();
+  auto& entry = data_.push_back();
+  // clang-tidy: move of trivially-copyable type
+  std::get<0>(entry) = std::move(time);  // NOLINT
+  if (reuse_entry) {
+    // Move the unneeded entry into the arguments so the caller can
     // reuse any resources the entry contained.
     using std::swap;
-    auto& old_entry = data_.front();
-    // clang-tidy: move of trivially-copyable type
-    std::get<0>(old_entry) = std::move(time);  // NOLINT
-    std::get<1>(old_entry) = value;
-    swap(std::get<2>(old_entry), deriv);
-    data_.push_back(std::move(old_entry));
-    data_.pop_front();
-    --first_needed_entry_;
+    swap(std::get<2>(entry), deriv);
+  } else {
+    std::get<2>(entry) = deriv;
   }
 }
 
 template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::insert_initial(Time time, Vars value,
                                                      DerivVars deriv) noexcept {
+  auto& entry = data_.push_front();
   // clang-tidy: move of trivially-copyable type
-  data_.emplace_front(std::move(time), // NOLINT
-                      std::move(value), std::move(deriv));
+  std::get<0>(entry) = std::move(time);  // NOLINT
+  std::get<1>(entry) = std::move(value);
+  std::get<2>(entry) = std::move(deriv);
 }
 
 template <typename Vars, typename DerivVars>
 inline void History<Vars, DerivVars>::mark_unneeded(
     const const_iterator& first_needed) noexcept {
-  first_needed_entry_ = static_cast<size_t>(first_needed.base_ - data_.begin());
-}
-
-template <typename Vars, typename DerivVars>
-inline void History<Vars, DerivVars>::shrink_to_fit() noexcept {
-  data_.erase(data_.begin(),
-              data_.begin() + static_cast<ssize_t>(first_needed_entry_));
-  first_needed_entry_ = 0;
+  data_.pop_front(first_needed.base_);
+  if (data_.size() == 0) {
+    inserts_since_emptied_ = 0;
+  }
 }
 
 template <typename Vars, typename DerivVars>
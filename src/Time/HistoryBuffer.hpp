@@ -0,0 +1,271 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <pup.h>
+#include <utility>
+#include <vector>
+
+#include "ErrorHandling/Assert.hpp"
+#include "Parallel/PupStlCpp11.hpp"  // IWYU pragma: keep
+
+namespace TimeSteppers {
+
+template <typename Entry>
+class HistoryBufferIterator;
+
+/// \ingroup TimeSteppersGroup
+/// Ring buffer holding the entries of a History or BoundaryHistory.
+///
+/// Entries are added at either end and removed from the front.  The
+/// slots of removed entries are kept and handed out again by later
+/// insertions, so once the buffer has grown to the number of entries a
+/// time stepper needs, inserting an entry reuses the memory of an old
+/// one instead of allocating.  Every entry is labeled by an index that
+/// is fixed when it is inserted, so iterators and indices remain valid
+/// when the buffer grows.
+/// \tparam Entry type of the entries
+template <typename Entry>
+class HistoryBuffer {
+ public:
+  using value_type = Entry;
+  using const_iterator = HistoryBufferIterator<Entry>;
+  using difference_type = std::ptrdiff_t;
+  using size_type = size_t;
+
+  HistoryBuffer() = default;
+  HistoryBuffer(const HistoryBuffer&) = delete;
+  HistoryBuffer(HistoryBuffer&&) = default;
+  HistoryBuffer& operator=(const HistoryBuffer&) = delete;
+  HistoryBuffer& operator=(HistoryBuffer&&) = default;
+  ~HistoryBuffer() = default;
+
+  /// Add an entry at the end or the front of the buffer and return
+  /// it.  The returned entry holds the data of a removed entry if one
+  /// is available, and is default constructed otherwise.
+  //@{
+  Entry& push_back() noexcept;
+  Entry& push_front() noexcept;
+  //@}
+
+  /// Remove all entries before `first_kept`.
+  void pop_front(const const_iterator& first_kept) noexcept;
+
+  /// Free the slots of removed entries.
+  void shrink_to_fit() noexcept;
+
+  const_iterator begin() const noexcept { return {this, first_index_}; }
+  const_iterator end() const noexcept {
+    return {this, first_index_ + static_cast<difference_type>(size_)};
+  }
+
+  /// The number of entries.
+  size_type size() const noexcept { return size_; }
+  /// The number of entries plus the number of slots of removed entries.
+  size_type capacity() const noexcept { return data_.size(); }
+
+  /// The entry with the given index.
+  //@{
+  const Entry& entry(const difference_type index) const noexcept {
+    return data_[slot(index)];
+  }
+  Entry& mutable_entry(const const_iterator& it) noexcept {
+    ASSERT(it.buffer_ == this, "Iterator into a different buffer");
+    return data_[slot(it.index_)];
+  }
+  //@}
+
+  // clang-tidy: google-runtime-references
+  void pup(PUP::er& p) noexcept;  // NOLINT
+
+ private:
+  size_t slot(difference_type index) const noexcept;
+
+  std::vector<Entry> data_;
+  // Slot holding the first entry
+  size_t start_{0};
+  size_t size_{0};
+  // Index of the first entry
+  difference_type first_index_{0};
+};
+
+/// \ingroup TimeSteppersGroup
+/// Iterator over the entries of a HistoryBuffer.
+template <typename Entry>
+class HistoryBufferIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = Entry;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type*;
+  using reference = const value_type&;
+
+  HistoryBufferIterator() = default;
+
+  reference operator*() const noexcept { return buffer_->entry(index_); }
+  pointer operator->() const noexcept { return &**this; }
+  reference operator[](difference_type n) const noexcept {
+    return buffer_->entry(index_ + n);
+  }
+  HistoryBufferIterator& operator++() noexcept { ++index_; return *this; }
+  // clang-tidy: return const... Really? What?
+  HistoryBufferIterator operator++(int) noexcept {  // NOLINT
+    return {buffer_, index_++};
+  }
+  HistoryBufferIterator& operator--() noexcept { --index_; return *this; }
+  // clang-tidy: return const... Really? What?
+  HistoryBufferIterator operator--(int) noexcept {  // NOLINT
+    return {buffer_, index_--};
+  }
+  HistoryBufferIterator& operator+=(difference_type n) noexcept {
+    index_ += n;
+    return *this;
+  }
+  HistoryBufferIterator& operator-=(difference_type n) noexcept {
+    index_ -= n;
+    return *this;
+  }
+
+  /// The index of the entry, which does not change while the entry is
+  /// in the buffer.
+  difference_type index() const noexcept { return index_; }
+
+ private:
+  friend class HistoryBuffer<Entry>;
+
+  friend difference_type operator-(const HistoryBufferIterator& a,
+                                   const HistoryBufferIterator& b) noexcept {
+    return a.index_ - b.index_;
+  }
+
+#define FORWARD_HISTORY_BUFFER_ITERATOR_OP(op)                       \
+  friend bool operator op(const HistoryBufferIterator& a,            \
+                          const HistoryBufferIterator& b) noexcept { \
+    return a.index_ op b.index_;                                     \
+  }
+  FORWARD_HISTORY_BUFFER_ITERATOR_OP(==)
+  FORWARD_HISTORY_BUFFER_ITERATOR_OP(!=)
+  FORWARD_HISTORY_BUFFER_ITERATOR_OP(<)
+  FORWARD_HISTORY_BUFFER_ITERATOR_OP(>)
+  FORWARD_HISTORY_BUFFER_ITERATOR_OP(<=)
+  FORWARD_HISTORY_BUFFER_ITERATOR_OP(>=)
+#undef FORWARD_HISTORY_BUFFER_ITERATOR_OP
+
+  HistoryBufferIterator(const HistoryBuffer<Entry>* buffer,
+                        difference_type index) noexcept
+      : buffer_(buffer), index_(index) {}
+
+  const HistoryBuffer<Entry>* buffer_{nullptr};
+  difference_type index_{0};
+};
+
+// ================================================================
+
+template <typename Entry>
+Entry& HistoryBuffer<Entry>::push_back() noexcept {
+  if (size_ == data_.size()) {
+    // The slot after the last entry is the one holding the first
+    // entry, so the new slot goes before it.
+    data_.emplace(data_.begin() + static_cast<difference_type>(start_));
+    start_ = (start_ + 1) % data_.size();
+  }
+  ++size_;
+  return data_[slot(first_index_ + static_cast<difference_type>(size_) - 1)];
+}
+
+template <typename Entry>
+Entry& HistoryBuffer<Entry>::push_front() noexcept {
+  if (size_ == data_.size()) {
+    data_.emplace(data_.begin() + static_cast<difference_type>(start_));
+  } else {
+    start_ = (start_ == 0 ? data_.size() : start_) - 1;
+  }
+  ++size_;
+  --first_index_;
+  return data_[start_];
+}
+
+template <typename Entry>
+void HistoryBuffer<Entry>::pop_front(
+    const const_iterator& first_kept) noexcept {
+  ASSERT(first_kept.buffer_ == this, "Iterator into a different buffer");
+  ASSERT(first_kept >= begin() and first_kept <= end(),
+         "Iterator out of range: " << first_kept.index_ << " not in ["
+         << first_index_ << ", " << end().index_ << "]");
+  const auto removed = static_cast<size_t>(first_kept.index_ - first_index_);
+  if (removed == 0) {
+    return;
+  }
+  start_ = slot(first_kept.index_ - 1) + 1;
+  if (start_ == data_.size()) {
+    start_ = 0;
+  }
+  size_ -= removed;
+  first_index_ = first_kept.index_;
+}
+
+template <typename Entry>
+void HistoryBuffer<Entry>::shrink_to_fit() noexcept {
+  std::rotate(data_.begin(),
+              data_.begin() + static_cast<difference_type>(start_),
+              data_.end());
+  data_.erase(data_.begin() + static_cast<difference_type>(size_),
+              data_.end());
+  data_.shrink_to_fit();
+  start_ = 0;
+}
+
+template <typename Entry>
+void HistoryBuffer<Entry>::pup(PUP::er& p) noexcept {  // NOLINT
+  // Only the entries are sent, not the slots of removed entries.
+  p | first_index_;
+  p | size_;
+  if (p.isUnpacking()) {
+    data_.clear();
+    data_.resize(size_);
+    start_ = 0;
+  }
+  for (difference_type index = first_index_;
+       index < first_index_ + static_cast<difference_type>(size_); ++index) {
+    p | data_[slot(index)];
+  }
+}
+
+template <typename Entry>
+inline size_t HistoryBuffer<Entry>::slot(const difference_type index) const
+    noexcept {
+  ASSERT(index >= first_index_ and
+             index < first_index_ + static_cast<difference_type>(size_),
+         "Index out of range: " << index << " not in [" << first_index_
+         << ", " << first_index_ + static_cast<difference_type>(size_)
+         << ")");
+  const size_t offset = start_ + static_cast<size_t>(index - first_index_);
+  return offset < data_.size() ? offset : offset - data_.size();
+}
+
+template <typename Entry>
+inline HistoryBufferIterator<Entry> operator+(
+    HistoryBufferIterator<Entry> it,
+    typename HistoryBufferIterator<Entry>::difference_type n) noexcept {
+  it += n;
+  return it;
+}
+
+template <typename Entry>
+inline HistoryBufferIterator<Entry> operator+(
+    typename HistoryBufferIterator<Entry>::difference_type n,
+    HistoryBufferIterator<Entry> it) noexcept {
+  return std::move(it) + n;
+}
+
+template <typename Entry>
+inline HistoryBufferIterator<Entry> operator-(
+    HistoryBufferIterator<Entry> it,
+    typename HistoryBufferIterator<Entry>::difference_type n) noexcept {
+  return std::move(it) + (-n);
+}
+}  // namespace TimeSteppers
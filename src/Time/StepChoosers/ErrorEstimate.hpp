@@ -0,0 +1,219 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <pup.h>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "ErrorHandling/Assert.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Time/History.hpp"
+#include "Time/StepChoosers/StepChooser.hpp"  // IWYU pragma: keep
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+template <typename TagsList>
+class Variables;
+/// \endcond
+
+namespace StepChoosers {
+namespace ErrorEstimate_detail {
+// The largest ratio of |error| to the tolerance at any point.
+inline double scaled_error(const double error, const double value,
+                           const double absolute_tolerance,
+                           const double relative_tolerance) noexcept {
+  return std::abs(error) /
+         (absolute_tolerance + relative_tolerance * std::abs(value));
+}
+
+template <typename ErrorTagsList, typename ValueTagsList>
+double scaled_error(const Variables<ErrorTagsList>& error,
+                    const Variables<ValueTagsList>& value,
+                    const double absolute_tolerance,
+                    const double relative_tolerance) noexcept {
+  ASSERT(error.size() == value.size(),
+         "Size mismatch: " << error.size() << " " << value.size());
+  double result = 0.0;
+  for (size_t i = 0; i < error.size(); ++i) {
+    result = std::max(
+        result, scaled_error(error.data()[i], value.data()[i],
+                             absolute_tolerance, relative_tolerance));
+  }
+  return result;
+}
+
+// The difference between the Adams-Bashforth steps of size `step` of
+// orders M and M - 1 taken from the last of the M entries of the history.
+template <typename Vars, typename DerivVars>
+void adams_bashforth_error(
+    const gsl::not_null<DerivVars*> error,
+    const TimeSteppers::History<Vars, DerivVars>& history,
+    const double step) noexcept {
+  const size_t order = history.size();
+  ASSERT(order >= 2, "Too little history to estimate the error: " << order);
+
+  // Divided differences of the derivatives, computed in place.
+  std::vector<DerivVars> differences;
+  differences.reserve(order);
+  for (auto it = history.begin(); it != history.end(); ++it) {
+    differences.push_back(it.derivative());
+  }
+  for (size_t level = 1; level < order; ++level) {
+    for (size_t j = order - 1; j >= level; --j) {
+      differences[j] -= differences[j - 1];
+      differences[j] *= 1.0 / (history[j].value() - history[j - level].value());
+    }
+  }
+
+  // Integrate the Newton basis polynomial over the step, with the
+  // polynomial expressed in the time since the last entry.
+  std::vector<double> polynomial(order, 0.0);
+  polynomial[0] = 1.0;
+  const double last_time = history.back().value();
+  for (size_t i = 1; i < order; ++i) {
+    const double offset = last_time - history[order - i].value();
+    for (size_t k = i; k > 0; --k) {
+      polynomial[k] = polynomial[k - 1] + offset * polynomial[k];
+    }
+    polynomial[0] *= offset;
+  }
+  double integral = 0.0;
+  double step_power = step;
+  for (size_t k = 0; k < order; ++k) {
+    integral += polynomial[k] * step_power / (k + 1);
+    step_power *= step;
+  }
+
+  *error = std::move(differences.back());
+  *error *= integral;
+}
+}  // namespace ErrorEstimate_detail
+
+/// \brief Suggests a step size based on an estimate of the local
+/// truncation error of the Adams-Bashforth step taken last.
+///
+/// The estimate is the difference between the Adams-Bashforth steps of
+/// orders \f$N\f$ and \f$N - 1\f$, for \f$N\f$ the order of the
+/// TimeStepper, which is recorded by Actions::RecordStepperError
+/// before the step while the history holds all \f$N\f$ derivatives
+/// used by it (see ErrorEstimate_detail::adams_bashforth_error).  This
+/// does not require any additional evaluations of the derivative.
+/// The estimate is compared with the tolerance \f$\epsilon_{abs} +
+/// \epsilon_{rel} |u|\f$ at each point, and the step is scaled by the
+/// largest ratio \f$r\f$ as \f$h_{new} = s |h| r^{-1/N}\f$ with the
+/// safety factor \f$s\f$, so each element takes the largest step its
+/// own accuracy allows.  The increase in the step should be limited by
+/// combining this with StepChoosers::Increase.  The DataBox must hold
+/// `Tags::StepperError<variables_tag, dt_variables_tag>`, which is
+/// added with a vanishing value by dg::Actions::InitializeElement when
+/// local time-stepping is enabled, so no restriction is imposed before
+/// the first estimate has been recorded.
+template <typename StepChooserRegistrars>
+class ErrorEstimate : public StepChooser<StepChooserRegistrars> {
+ public:
+  /// \cond
+  ErrorEstimate() = default;
+  explicit ErrorEstimate(CkMigrateMessage* /*unused*/) noexcept {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ErrorEstimate);  // NOLINT
+  /// \endcond
+
+  struct AbsoluteTolerance {
+    using type = double;
+    static constexpr OptionString help{"Target absolute error"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+
+  struct RelativeTolerance {
+    using type = double;
+    static constexpr OptionString help{"Target relative error"};
+    static type lower_bound() noexcept { return 0.0; }
+  };
+
+  struct SafetyFactor {
+    using type = double;
+    static constexpr OptionString help{"Multiplier for computed step"};
+    static type default_value() noexcept { return 0.9; }
+    static type lower_bound() noexcept { return 0.0; }
+    static type upper_bound() noexcept { return 1.0; }
+  };
+
+  static constexpr OptionString help{
+      "Suggests a step size based on an estimate of the local truncation "
+      "error."};
+  using options =
+      tmpl::list<AbsoluteTolerance, RelativeTolerance, SafetyFactor>;
+
+  ErrorEstimate(const double absolute_tolerance,
+                const double relative_tolerance,
+                const double safety_factor) noexcept
+      : absolute_tolerance_(absolute_tolerance),
+        relative_tolerance_(relative_tolerance),
+        safety_factor_(safety_factor) {}
+
+  using argument_tags = tmpl::list<Tags::TimeStep, Tags::DataBox>;
+
+  template <typename Metavariables, typename DbTags>
+  double operator()(
+      const TimeDelta& current_step, const db::DataBox<DbTags>& box,
+      const Parallel::ConstGlobalCache<Metavariables>& cache) const noexcept {
+    using variables_tag = typename Metavariables::system::variables_tag;
+    using error_tag =
+        Tags::StepperError<variables_tag,
+                           db::add_tag_prefix<Tags::dt, variables_tag>>;
+    static_assert(tmpl::list_contains_v<DbTags, error_tag>,
+                  "The error estimate must be added to the DataBox during "
+                  "initialization and recorded by "
+                  "Actions::RecordStepperError.");
+    const double error_ratio = ErrorEstimate_detail::scaled_error(
+        db::get<error_tag>(box), db::get<variables_tag>(box),
+        absolute_tolerance_, relative_tolerance_);
+    if (error_ratio == 0.0) {
+      return std::numeric_limits<double>::infinity();
+    }
+    const size_t order =
+        Parallel::get<OptionTags::TimeStepper>(cache).number_of_past_steps() +
+        1;
+    return safety_factor_ * std::abs(current_step.value()) *
+           std::pow(error_ratio, -1.0 / static_cast<double>(order));
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) noexcept override {
+    p | absolute_tolerance_;
+    p | relative_tolerance_;
+    p | safety_factor_;
+  }
+
+ private:
+  double absolute_tolerance_ = std::numeric_limits<double>::signaling_NaN();
+  double relative_tolerance_ = std::numeric_limits<double>::signaling_NaN();
+  double safety_factor_ = std::numeric_limits<double>::signaling_NaN();
+};
+
+namespace Register {
+struct ErrorEstimate {
+  template <typename StepChooserRegistrars>
+  using f = StepChoosers::ErrorEstimate<StepChooserRegistrars>;
+};
+}  // namespace Register
+
+/// \cond
+template <typename StepChooserRegistrars>
+PUP::able::PUP_ID ErrorEstimate<StepChooserRegistrars>::my_PUP_ID =
+    0;  // NOLINT
+/// \endcond
+}  // namespace StepChoosers
@@ -15,6 +15,7 @@
 #include "Options/Options.hpp"
 #include "Time/BoundaryHistory.hpp"
 #include "Time/History.hpp"
+#include "Time/HistoryBuffer.hpp"
 #include "Time/StepChoosers/StepChooser.hpp"  // IWYU pragma: keep
 #include "Time/StepControllers/StepController.hpp"  // IWYU pragma: keep
 #include "Time/Time.hpp"
@@ -72,6 +73,38 @@ struct HistoryEvolvedVariables : db::PrefixTag, db::SimpleTag {
   using type = TimeSteppers::History<db::item_type<Tag>, db::item_type<DtTag>>;
 };
 
+/// \ingroup DataBoxTags
+/// \ingroup TimeGroup
+/// \brief Prefix for the implicit sources kept between the substeps of
+/// an IMEX TimeStepper
+///
+/// \tparam DtTag tag for the time derivative of the variables
+template <typename DtTag>
+struct HistoryImplicitSources : db::PrefixTag, db::SimpleTag {
+  static std::string name() noexcept { return "HistoryImplicitSources"; }
+  using tag = DtTag;
+  using type = TimeSteppers::HistoryBuffer<db::item_type<DtTag>>;
+};
+
+/// \ingroup DataBoxTags
+/// \ingroup TimeGroup
+/// \brief Prefix for the estimate of the local truncation error of the
+/// step taken last by the TimeStepper
+///
+/// The estimate is stored with the type of the time derivative it is
+/// computed from.
+///
+/// \see Actions::RecordStepperError
+///
+/// \tparam Tag tag for the variables
+/// \tparam DtTag tag for the time derivative of the variables
+template <typename Tag, typename DtTag>
+struct StepperError : db::PrefixTag, db::SimpleTag {
+  static std::string name() noexcept { return "StepperError"; }
+  using tag = Tag;
+  using type = db::item_type<DtTag>;
+};
+
 /// \ingroup DataBoxTagsGroup
 /// \ingroup TimeGroup
 /// Tag for TimeStepper boundary history
@@ -94,6 +127,17 @@ struct FinalTime {
   static constexpr OptionString help{"The final time"};
 };
 
+/// \ingroup OptionTagsGroup
+/// \ingroup TimeGroup
+/// \brief The number of slabs between load balancing phases
+struct LoadBalancingInterval {
+  using type = size_t;
+  static constexpr OptionString help{
+      "The number of slabs between load balancing phases, or 0 to never "
+      "balance the load"};
+  static type default_value() noexcept { return 0; }
+};
+
 /// \ingroup OptionTagsGroup
 /// \ingroup TimeGroup
 /// \brief The ::TimeStepper
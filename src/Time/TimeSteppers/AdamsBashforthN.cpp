@@ -4,11 +4,29 @@
 #include "Time/TimeSteppers/AdamsBashforthN.hpp"
 
 #include <algorithm>
+#include <array>
+#include <map>
 
 #include "Time/TimeId.hpp"
 
 namespace TimeSteppers {
 
+namespace {
+struct CoefficientCache {
+  std::map<std::array<Rational, AdamsBashforthN::maximum_order>,
+           AdamsBashforthN::Coefficients>
+      coefficients;
+  size_t hits = 0;
+  size_t misses = 0;
+};
+
+CoefficientCache& coefficient_cache() noexcept {
+  // Each thread has its own cache so that no locking is needed.
+  thread_local CoefficientCache cache{};
+  return cache;
+}
+}  // namespace
+
 AdamsBashforthN::AdamsBashforthN(size_t target_order, bool self_start,
                                  const OptionContext& context)
     : target_order_(target_order), is_self_starting_(self_start) {
@@ -31,6 +49,10 @@ bool AdamsBashforthN::is_self_starting() const noexcept {
   return is_self_starting_;
 }
 
+bool AdamsBashforthN::uses_history_values() const noexcept {
+  return false;
+}
+
 double AdamsBashforthN::stable_step() const noexcept {
   if (target_order_ == 1) {
     return 1.;
@@ -39,11 +61,11 @@ double AdamsBashforthN::stable_step() const noexcept {
   // This is the condition that the characteristic polynomial of the
   // recurrence relation defined by the method has the correct sign at
   // -1.  It is not clear whether this is actually sufficient.
-  const auto& coefficients = constant_coefficients(target_order_);
+  const auto coefficients = constant_coefficients(target_order_);
   double invstep = 0.;
   double sign = 1.;
-  for (const auto coef : coefficients) {
-    invstep += sign * coef;
+  for (size_t i = 0; i < target_order_; ++i) {
+    invstep += sign * gsl::at(coefficients, i);
     sign = -sign;
   }
   return 1. / invstep;
@@ -57,23 +79,57 @@ TimeId AdamsBashforthN::next_time_id(
           current_id.time() + time_step};
 }
 
-std::vector<double> AdamsBashforthN::get_coefficients_impl(
-    const std::vector<double>& steps) noexcept {
-  const size_t order = steps.size();
+AdamsBashforthN::CoefficientCacheStatistics
+AdamsBashforthN::coefficient_cache_statistics() noexcept {
+  const auto& cache = coefficient_cache();
+  return {cache.hits, cache.misses, cache.coefficients.size()};
+}
+
+void AdamsBashforthN::clear_coefficient_cache() noexcept {
+  coefficient_cache() = CoefficientCache{};
+}
+
+AdamsBashforthN::Coefficients AdamsBashforthN::cached_coefficients(
+    const std::array<Rational, maximum_order>& steps,
+    const size_t order) noexcept {
+  ASSERT(order >= 1 and order <= maximum_order, "Bad order" << order);
+  ASSERT(std::all_of(steps.begin() + static_cast<ssize_t>(order), steps.end(),
+                     [](const Rational& s) noexcept { return s == 0; }),
+         "Unused steps must be zero so they do not affect the lookup");
+  auto& cache = coefficient_cache();
+  const auto entry = cache.coefficients.find(steps);
+  if (entry != cache.coefficients.end()) {
+    ++cache.hits;
+    return entry->second;
+  }
+  ++cache.misses;
+  std::array<double, maximum_order> inexact_steps{};
+  for (size_t i = 0; i < order; ++i) {
+    gsl::at(inexact_steps, i) = gsl::at(steps, i).value();
+  }
+  return cache.coefficients
+      .emplace(steps, get_coefficients_impl(inexact_steps, order))
+      .first->second;
+}
+
+AdamsBashforthN::Coefficients AdamsBashforthN::get_coefficients_impl(
+    const std::array<double, maximum_order>& steps,
+    const size_t order) noexcept {
   ASSERT(order >= 1 and order <= maximum_order, "Bad order" << order);
-  if (std::all_of(steps.begin(), steps.end(),
+  if (std::all_of(steps.begin(), steps.begin() + static_cast<ssize_t>(order),
                   [=](const double& s) { return s == 1.; })) {
     return constant_coefficients(order);
   }
 
-  return variable_coefficients(steps);
+  return variable_coefficients(steps, order);
 }
 
-std::vector<double> AdamsBashforthN::variable_coefficients(
-    const std::vector<double>& steps) noexcept {
-  const size_t order = steps.size();  // "k" in below equations
+AdamsBashforthN::Coefficients AdamsBashforthN::variable_coefficients(
+    const std::array<double, maximum_order>& steps,
+    const size_t order) noexcept {
+  // order is "k" in below equations
 
-  // The `steps` vector contains the relative step sizes:
+  // The `steps` array contains the relative step sizes:
   //   steps = {dt_{n-k+1}/dt_n, ..., dt_n/dt_n}
   // Our goal is to calculate, for each j, the coefficient given by
   //   \int_0^1 dt ell_j(t; 1, (dt_n + dt_{n-1})/dt_n, ...,
@@ -82,23 +138,22 @@ std::vector<double> AdamsBashforthN::variable_coefficients(
 
   // Calculate coefficients of the numerators of the Lagrange interpolating
   // polynomial, in the standard form.
-  std::vector<std::vector<double>> polynomials(order,
-                                               std::vector<double>(order, 0.));
+  std::array<std::array<double, maximum_order>, maximum_order> polynomials{};
   for (auto& poly : polynomials) {
     poly[0] = 1.;
   }
   {
     double step_sum = 0.;
     for (size_t m = 0; m < order; ++m) {
-      const double step = steps[order - m - 1];
+      const double step = gsl::at(steps, order - m - 1);
       step_sum += step;
       for (size_t j = 0; j < order; ++j) {
         if (m == j) {
           continue;
         }
-        auto& poly = polynomials[j];
+        auto& poly = gsl::at(polynomials, j);
         for (size_t i = m + (m > j ? 0 : 1); i > 0; --i) {
-          poly[i] = poly[i - 1] - step_sum * poly[i];
+          gsl::at(poly, i) = gsl::at(poly, i - 1) - step_sum * gsl::at(poly, i);
         }
         poly[0] *= -step_sum;
       }
@@ -106,61 +161,59 @@ std::vector<double> AdamsBashforthN::variable_coefficients(
   }
 
   // Calculate the denominators of the Lagrange interpolating polynomials.
-  std::vector<double> denominators;
-  denominators.reserve(order);
+  std::array<double, maximum_order> denominators{};
   for (size_t j = 0; j < order; ++j) {
     double denom = 1.;
     double step_sum = 0.;
     for (size_t m = 0; m < j; ++m) {
-      const double step = steps[order - j + m - 1];
+      const double step = gsl::at(steps, order - j + m - 1);
       step_sum += step;
       denom *= step_sum;
     }
     step_sum = 0.;
     for (size_t m = 0; m < order - j - 1; ++m) {
-      const double step = steps[order - j - m - 2];
+      const double step = gsl::at(steps, order - j - m - 2);
       step_sum += step;
       denom *= step_sum;
     }
-    denominators.push_back(denom);
+    gsl::at(denominators, j) = denom;
   }
 
   // At this point, the Lagrange interpolating polynomials are given by:
   //   ell_j(t; ...) = +/- sum_m t^m polynomials[j][m] / denominators[j]
 
   // Integrate, term by term.
-  std::vector<double> result;
-  result.reserve(order);
+  Coefficients result{};
   double overall_sign = order % 2 == 0 ? -1. : 1.;
   for (size_t j = 0; j < order; ++j) {
-    const auto& poly = polynomials[j];
+    const auto& poly = gsl::at(polynomials, j);
     double integral = 0.;
     for (size_t i = 0; i < order; ++i) {
-      integral += poly[i] / (i + 1);
+      integral += gsl::at(poly, i) / (i + 1);
     }
-    result.push_back(overall_sign * integral / denominators[j]);
+    gsl::at(result, j) = overall_sign * integral / gsl::at(denominators, j);
     overall_sign = -overall_sign;
   }
   return result;
 }
 
-std::vector<double> AdamsBashforthN::constant_coefficients(
+AdamsBashforthN::Coefficients AdamsBashforthN::constant_coefficients(
     const size_t order) noexcept {
   switch (order) {
-    case 1: return {1.};
-    case 2: return {1.5, -0.5};
-    case 3: return {23.0 / 12.0, -4.0 / 3.0, 5.0 / 12.0};
-    case 4: return {55.0 / 24.0, -59.0 / 24.0, 37.0 / 24.0, -3.0 / 8.0};
-    case 5: return {1901.0 / 720.0, -1387.0 / 360.0, 109.0 / 30.0,
-          -637.0 / 360.0, 251.0 / 720.0};
-    case 6: return {4277.0 / 1440.0, -2641.0 / 480.0, 4991.0 / 720.0,
-          -3649.0 / 720.0, 959.0 / 480.0, -95.0 / 288.0};
-    case 7: return {198721.0 / 60480.0, -18637.0 / 2520.0, 235183.0 / 20160.0,
-          -10754.0 / 945.0, 135713.0 / 20160.0, -5603.0 / 2520.0,
-          19087.0 / 60480.0};
-    case 8: return {16083.0 / 4480.0, -1152169.0 / 120960.0, 242653.0 / 13440.0,
-          -296053.0 / 13440.0, 2102243.0 / 120960.0, -115747.0 / 13440.0,
-          32863.0 / 13440.0, -5257.0 / 17280.0};
+    case 1: return {{1.}};
+    case 2: return {{1.5, -0.5}};
+    case 3: return {{23.0 / 12.0, -4.0 / 3.0, 5.0 / 12.0}};
+    case 4: return {{55.0 / 24.0, -59.0 / 24.0, 37.0 / 24.0, -3.0 / 8.0}};
+    case 5: return {{1901.0 / 720.0, -1387.0 / 360.0, 109.0 / 30.0,
+          -637.0 / 360.0, 251.0 / 720.0}};
+    case 6: return {{4277.0 / 1440.0, -2641.0 / 480.0, 4991.0 / 720.0,
+          -3649.0 / 720.0, 959.0 / 480.0, -95.0 / 288.0}};
+    case 7: return {{198721.0 / 60480.0, -18637.0 / 2520.0,
+          235183.0 / 20160.0, -10754.0 / 945.0, 135713.0 / 20160.0,
+          -5603.0 / 2520.0, 19087.0 / 60480.0}};
+    case 8: return {{16083.0 / 4480.0, -1152169.0 / 120960.0,
+          242653.0 / 13440.0, -296053.0 / 13440.0, 2102243.0 / 120960.0,
+          -115747.0 / 13440.0, 32863.0 / 13440.0, -5257.0 / 17280.0}};
     default:
       ERROR("Bad order: " << order);
   }
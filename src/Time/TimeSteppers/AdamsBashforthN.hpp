@@ -7,6 +7,7 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <boost/iterator/transform_iterator.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -29,6 +30,7 @@
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Rational.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -47,10 +49,41 @@ namespace TimeSteppers {
 /// \ingroup TimeSteppersGroup
 ///
 /// An Nth Adams-Bashforth time stepper.
+///
+/// The coefficients for a sequence of step sizes are cached.  The
+/// cache is keyed by the sizes of the steps relative to the step being
+/// taken, which recur across elements and mortars when using local
+/// time-stepping.  Each thread has its own cache.
 class AdamsBashforthN : public TimeStepper::Inherit {
  public:
   static constexpr const size_t maximum_order = 8;
 
+  /// The coefficients of a step, of which the first `order` are used.
+  using Coefficients = std::array<double, maximum_order>;
+
+  /// Usage of the coefficient cache of a thread
+  struct CoefficientCacheStatistics {
+    size_t hits{0};
+    size_t misses{0};
+    size_t size{0};
+
+    /// The fraction of lookups that found their coefficients
+    double hit_rate() const noexcept {
+      const size_t lookups = hits + misses;
+      return lookups == 0 ? 0.
+                          : static_cast<double>(hits) /
+                                static_cast<double>(lookups);
+    }
+  };
+
+  /// The usage of the coefficient cache of the calling thread since it
+  /// was last cleared
+  static CoefficientCacheStatistics coefficient_cache_statistics() noexcept;
+
+  /// Remove all entries from the coefficient cache of the calling
+  /// thread and reset its statistics
+  static void clear_coefficient_cache() noexcept;
+
   struct TargetOrder {
     using type = size_t;
     static constexpr OptionString help = {
@@ -216,6 +249,8 @@ class AdamsBashforthN : public TimeStepper::Inherit {
 
   bool is_self_starting() const noexcept override;
 
+  bool uses_history_values() const noexcept override;
+
   double stable_step() const noexcept override;
 
   TimeId next_time_id(const TimeId& current_id,
@@ -240,17 +275,25 @@ class AdamsBashforthN : public TimeStepper::Inherit {
   /// Get coefficients for a time step.  Arguments are an iterator
   /// pair to past times, oldest to newest, and the time step to take.
   template <typename Iterator>
-  static std::vector<double> get_coefficients(const Iterator& times_begin,
-                                              const Iterator& times_end,
-                                              const TimeDelta& step) noexcept;
+  static Coefficients get_coefficients(const Iterator& times_begin,
+                                       const Iterator& times_end,
+                                       const TimeDelta& step) noexcept;
 
-  static std::vector<double> get_coefficients_impl(
-      const std::vector<double>& steps) noexcept;
+  /// Get coefficients for the steps of the given relative sizes,
+  /// oldest to newest.  Only the first `order` entries are used.
+  //@{
+  static Coefficients cached_coefficients(
+      const std::array<Rational, maximum_order>& steps,
+      size_t order) noexcept;
 
-  static std::vector<double> variable_coefficients(
-      const std::vector<double>& steps) noexcept;
+  static Coefficients get_coefficients_impl(
+      const std::array<double, maximum_order>& steps, size_t order) noexcept;
+  //@}
 
-  static std::vector<double> constant_coefficients(size_t order) noexcept;
+  static Coefficients variable_coefficients(
+      const std::array<double, maximum_order>& steps, size_t order) noexcept;
+
+  static Coefficients constant_coefficients(size_t order) noexcept;
 
   /// Comparator for ordering by "simulation time"
   class SimulationLess {
@@ -386,11 +429,9 @@ AdamsBashforthN::compute_boundary_delta(
 
     auto local_it = history->local_begin();
     auto remote_it = history->remote_begin();
-    for (auto coefficients_it = coefficients.rbegin();
-         coefficients_it != coefficients.rend();
-         ++coefficients_it, ++local_it, ++remote_it) {
-      accumulated_change +=
-          *coefficients_it * history->coupling(coupling, local_it, remote_it);
+    for (size_t i = 0; i < order; ++i, ++local_it, ++remote_it) {
+      accumulated_change += gsl::at(coefficients, order - 1 - i) *
+                            history->coupling(coupling, local_it, remote_it);
     }
     accumulated_change *= time_step.value();
 
@@ -599,19 +640,34 @@ bool AdamsBashforthN::can_change_step_size(
 }
 
 template <typename Iterator>
-std::vector<double> AdamsBashforthN::get_coefficients(
+AdamsBashforthN::Coefficients AdamsBashforthN::get_coefficients(
     const Iterator& times_begin, const Iterator& times_end,
     const TimeDelta& step) noexcept {
-  std::vector<double> steps;
-  // This may be slightly more space than we need, but we can't get
-  // the exact amount without iterating through the iterators, which
-  // is not necessarily cheap depending on the iterator type.
-  steps.reserve(maximum_order);
-  for (auto t = times_begin; std::next(t) != times_end; ++t) {
-    steps.push_back((*std::next(t) - *t) / step);
+  // The relative step sizes are exact, and so can be used to look up
+  // the coefficients in the cache, if all the steps are in slabs of
+  // the same size.  Otherwise they are only known to roundoff.
+  std::array<Rational, maximum_order> exact_steps{};
+  std::array<double, maximum_order> steps{};
+  bool steps_are_exact = true;
+  size_t order = 0;
+  for (auto t = times_begin; std::next(t) != times_end; ++t, ++order) {
+    ASSERT(order < maximum_order - 1, "Too many past times");
+    const TimeDelta this_step = *std::next(t) - *t;
+    if (steps_are_exact and
+        (this_step.slab() == step.slab() or
+         this_step.slab().duration().value() ==
+             step.slab().duration().value())) {
+      gsl::at(exact_steps, order) = this_step.fraction() / step.fraction();
+    } else {
+      steps_are_exact = false;
+    }
+    gsl::at(steps, order) = this_step / step;
   }
-  steps.push_back(1.);
-  return get_coefficients_impl(steps);
+  gsl::at(exact_steps, order) = 1;
+  gsl::at(steps, order) = 1.;
+  ++order;
+  return steps_are_exact ? cached_coefficients(exact_steps, order)
+                         : get_coefficients_impl(steps, order);
 }
 
 }  // namespace TimeSteppers
@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/ImexRungeKutta3.hpp"
+
+#include "ErrorHandling/Error.hpp"
+#include "Time/TimeId.hpp"
+
+namespace TimeSteppers {
+
+constexpr std::array<std::array<double, ImexRungeKutta3::stages_>,
+                     ImexRungeKutta3::stages_>
+    ImexRungeKutta3::explicit_increments_;
+constexpr std::array<std::array<double, ImexRungeKutta3::stages_>,
+                     ImexRungeKutta3::stages_>
+    ImexRungeKutta3::implicit_increments_;
+
+uint64_t ImexRungeKutta3::number_of_substeps() const noexcept {
+  return stages_;
+}
+
+size_t ImexRungeKutta3::number_of_past_steps() const noexcept {
+  return 0;
+}
+
+bool ImexRungeKutta3::is_self_starting() const noexcept {
+  return true;
+}
+
+bool ImexRungeKutta3::uses_history_values() const noexcept {
+  return false;
+}
+
+double ImexRungeKutta3::stable_step() const noexcept {
+  // This is the condition for  y' = -k y  to go to zero using the
+  // explicit part of the method, which has the stability polynomial
+  // 1 + z + z^2/2 + z^3/6 - 7 z^4/288.  The implicit part is
+  // unconditionally stable.
+  return 1.0715796932868247;
+}
+
+TimeId ImexRungeKutta3::next_time_id(const TimeId& current_id,
+                                     const TimeDelta& time_step) const
+    noexcept {
+  const auto substep = static_cast<size_t>(current_id.substep());
+  ASSERT(current_id.time() ==
+             current_id.step_time() +
+                 (substep == 0 ? 0 * time_step
+                               : stage_offset(time_step, substep - 1)),
+         "Wrong substep time");
+  if (substep == stages_ - 1) {
+    return {current_id.time_runs_forward(), current_id.slab_number(),
+            current_id.step_time() + time_step};
+  }
+  return {current_id.time_runs_forward(), current_id.slab_number(),
+          current_id.step_time(), current_id.substep() + 1,
+          current_id.step_time() + stage_offset(time_step, substep)};
+}
+
+TimeDelta ImexRungeKutta3::stage_offset(const TimeDelta& time_step,
+                                        const size_t substep) noexcept {
+  switch (substep) {
+    case 0:
+      return time_step / 2;
+    case 1:
+      return 2 * time_step / 3;
+    case 2:
+      return time_step / 2;
+    case 3:
+      return time_step;
+    default:
+      ERROR("Bad substep value in ImexRungeKutta3: " << substep);
+  }
+}
+
+}  // namespace TimeSteppers
+
+/// \cond
+PUP::able::PUP_ID TimeSteppers::ImexRungeKutta3::my_PUP_ID =  // NOLINT
+    0;
+/// \endcond
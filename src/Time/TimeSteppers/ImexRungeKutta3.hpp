@@ -0,0 +1,293 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class ImexRungeKutta3.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <pup.h>
+#include <type_traits>
+
+#include "ErrorHandling/Assert.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Time/HistoryBuffer.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"  // IWYU pragma: keep
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+struct TimeId;
+namespace TimeSteppers {
+template <typename LocalVars, typename RemoteVars, typename CouplingResult>
+class BoundaryHistory;
+template <typename Vars, typename DerivVars>
+class History;
+}  // namespace TimeSteppers
+/// \endcond
+
+namespace TimeSteppers {
+
+/// \ingroup TimeSteppersGroup
+///
+/// The third-order implicit-explicit (IMEX) Runge-Kutta time-stepper
+/// ARS(4,4,3) of Ascher, Ruuth, and Spiteri.
+///
+/// The time derivative is split as \f$du/dt = F(u, t) + S(u, t)\f$,
+/// where \f$F\f$ is treated explicitly and \f$S\f$ is a stiff source
+/// treated implicitly.  Each stage solves
+/// \f{align*}
+/// U_i = u^n + \Delta t \sum_{j<i} a_{ij} F(U_j)
+///   + \Delta t \sum_{j \le i} \tilde{a}_{ij} S(U_j)
+/// \f}
+/// and the method is stiffly accurate, so \f$u^{n+1}\f$ is the last
+/// stage.  The implicit part is L-stable and has \f$\tilde{a}_{ii} =
+/// 1/2\f$, so the size of the step is limited only by the explicit
+/// part.  The stability estimate returned by `stable_step()` is that
+/// of the explicit part, so StepChoosers::Cfl chooses steps based on
+/// the characteristic speeds independent of the stiffness of \f$S\f$.
+/// The substep times are \f$c = (0, 1/2, 2/3, 1/2)\f$.
+///
+/// The implicit part is only included by the `update_u` overload taking
+/// an `implicit_solver`.  Without it, or when used through the
+/// TimeStepper interface, the explicit part of the method is used for
+/// the entire derivative.  The boundary deltas are only those of the
+/// explicit part.
+///
+/// Major reference: U. M. Ascher, S. J. Ruuth, and R. J. Spiteri,
+/// Appl. Numer. Math. 25, 151 (1997)
+class ImexRungeKutta3 : public TimeStepper::Inherit {
+ public:
+  using options = tmpl::list<>;
+  static constexpr OptionString help = {
+      "A third-order implicit-explicit Runge-Kutta time-stepper treating "
+      "stiff sources implicitly."};
+
+  ImexRungeKutta3() = default;
+  ImexRungeKutta3(const ImexRungeKutta3&) noexcept = default;
+  ImexRungeKutta3& operator=(const ImexRungeKutta3&) noexcept = default;
+  ImexRungeKutta3(ImexRungeKutta3&&) noexcept = default;
+  ImexRungeKutta3& operator=(ImexRungeKutta3&&) noexcept = default;
+  ~ImexRungeKutta3() noexcept override = default;
+
+  template <typename Vars, typename DerivVars>
+  void update_u(gsl::not_null<Vars*> u,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                const TimeDelta& time_step) const noexcept;
+
+  /// \brief Add the change for the current substep to u, including the
+  /// implicit source.
+  ///
+  /// The derivatives in `history` must not include the implicit
+  /// source.  The implicit sources of the previous substeps of the
+  /// step are kept in `implicit_sources`.  The `implicit_solver` is
+  /// called as
+  /// \code
+  /// implicit_solver(u, source, stage_time, implicit_weight)
+  /// \endcode
+  /// with `gsl::not_null<Vars*> u`, `gsl::not_null<DerivVars*> source`,
+  /// `const Time& stage_time`, and `double implicit_weight`.  It must
+  /// replace `*u` by the solution \f$U\f$ of \f$U = u + w S(U, t)\f$,
+  /// where \f$w\f$ is the `implicit_weight` and \f$t\f$ is the
+  /// `stage_time`, and set `*source` to \f$S(U, t)\f$.  On entry,
+  /// `*source` holds a previously computed source or a copy of a
+  /// derivative, so it has the correct size.  Sources depending only
+  /// on the local values of the variables can be solved for point by
+  /// point, using RootFinder::newton_raphson if the source is
+  /// nonlinear.
+  template <typename Vars, typename DerivVars, typename ImplicitSolver>
+  void update_u(gsl::not_null<Vars*> u,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                gsl::not_null<HistoryBuffer<DerivVars>*> implicit_sources,
+                const TimeDelta& time_step,
+                const ImplicitSolver& implicit_solver) const noexcept;
+
+  template <typename LocalVars, typename RemoteVars, typename Coupling>
+  std::result_of_t<const Coupling&(LocalVars, RemoteVars)>
+  compute_boundary_delta(
+      const Coupling& coupling,
+      gsl::not_null<BoundaryHistory<
+          LocalVars, RemoteVars,
+          std::result_of_t<const Coupling&(LocalVars, RemoteVars)>>*>
+          history,
+      const TimeDelta& time_step) const noexcept;
+
+  uint64_t number_of_substeps() const noexcept override;
+
+  size_t number_of_past_steps() const noexcept override;
+
+  bool is_self_starting() const noexcept override;
+
+  bool uses_history_values() const noexcept override;
+
+  double stable_step() const noexcept override;
+
+  TimeId next_time_id(const TimeId& current_id,
+                      const TimeDelta& time_step) const noexcept override;
+
+  template <typename Vars, typename DerivVars>
+  bool can_change_step_size(const TimeId& /*time_id*/,
+                            const TimeSteppers::History<Vars, DerivVars>&
+                                /*history*/) const noexcept {
+    // This integrator does not support local time-stepping.
+    return false;
+  }
+
+  WRAPPED_PUPable_decl_template(ImexRungeKutta3);  // NOLINT
+
+  explicit ImexRungeKutta3(CkMigrateMessage* /*unused*/) noexcept {}
+
+  // clang-tidy: do not pass by non-const reference
+  void pup(PUP::er& p) noexcept override {  // NOLINT
+    TimeStepper::Inherit::pup(p);
+  }
+
+ private:
+  static constexpr size_t stages_ = 4;
+
+  template <typename Vars, typename DerivVars>
+  static void add_explicit_increment(
+      gsl::not_null<Vars*> u, const History<Vars, DerivVars>& history,
+      const TimeDelta& time_step, size_t substep) noexcept;
+
+  /// The time of the stage computed by the substep, relative to the
+  /// start of the step.
+  static TimeDelta stage_offset(const TimeDelta& time_step,
+                                size_t substep) noexcept;
+
+  // The coefficients are the differences between consecutive rows of
+  // the Butcher tableaus, because each substep adds its change to u.
+  // Row i is used by substep i and column j multiplies the derivative
+  // or implicit source from substep j.
+  static constexpr std::array<std::array<double, stages_>, stages_>
+      explicit_increments_{{{{1.0 / 2.0, 0.0, 0.0, 0.0}},
+                            {{1.0 / 9.0, 1.0 / 18.0, 0.0, 0.0}},
+                            {{2.0 / 9.0, -8.0 / 9.0, 1.0 / 2.0, 0.0}},
+                            {{-7.0 / 12.0, 31.0 / 12.0, 1.0 / 4.0,
+                              -7.0 / 4.0}}}};
+  static constexpr std::array<std::array<double, stages_>, stages_>
+      implicit_increments_{{{{0.0, 0.0, 0.0, 0.0}},
+                            {{-1.0 / 3.0, 0.0, 0.0, 0.0}},
+                            {{-2.0 / 3.0, 0.0, 0.0, 0.0}},
+                            {{2.0, -2.0, 0.0, 0.0}}}};
+  static constexpr double implicit_diagonal_ = 0.5;
+};
+
+inline bool constexpr operator==(const ImexRungeKutta3& /*lhs*/,
+                                 const ImexRungeKutta3& /*rhs*/) noexcept {
+  return true;
+}
+
+inline bool constexpr operator!=(const ImexRungeKutta3& /*lhs*/,
+                                 const ImexRungeKutta3& /*rhs*/) noexcept {
+  return false;
+}
+
+template <typename Vars, typename DerivVars>
+void ImexRungeKutta3::update_u(
+    const gsl::not_null<Vars*> u,
+    const gsl::not_null<History<Vars, DerivVars>*> history,
+    const TimeDelta& time_step) const noexcept {
+  const size_t substep = history->size() - 1;
+  ASSERT(substep < number_of_substeps(),
+         "Bad substep value in ImexRungeKutta3: " << substep);
+  add_explicit_increment(u, *history, time_step, substep);
+
+  // Clean up old history
+  if (history->size() == number_of_substeps()) {
+    history->mark_unneeded(history->end());
+  }
+}
+
+template <typename Vars, typename DerivVars, typename ImplicitSolver>
+void ImexRungeKutta3::update_u(
+    const gsl::not_null<Vars*> u,
+    const gsl::not_null<History<Vars, DerivVars>*> history,
+    const gsl::not_null<HistoryBuffer<DerivVars>*> implicit_sources,
+    const TimeDelta& time_step,
+    const ImplicitSolver& implicit_solver) const noexcept {
+  const size_t substep = history->size() - 1;
+  ASSERT(substep < number_of_substeps(),
+         "Bad substep value in ImexRungeKutta3: " << substep);
+  ASSERT(implicit_sources->size() == substep,
+         "Expected " << substep << " implicit sources, not "
+         << implicit_sources->size());
+  add_explicit_increment(u, *history, time_step, substep);
+  auto source = implicit_sources->begin();
+  for (size_t j = 0; j < substep; ++j, ++source) {
+    const double coefficient =
+        gsl::at(gsl::at(implicit_increments_, substep), j);
+    if (coefficient != 0.0) {
+      *u += (coefficient * time_step.value()) * *source;
+    }
+  }
+
+  const bool reuse_source = implicit_sources->size() <
+                            implicit_sources->capacity();
+  auto& new_source = implicit_sources->push_back();
+  if (not reuse_source) {
+    // Give the new source the size of the derivatives.
+    new_source = (history->end() - 1).derivative();
+  }
+  implicit_solver(u, make_not_null(&new_source),
+                  history->front() + stage_offset(time_step, substep),
+                  implicit_diagonal_ * time_step.value());
+
+  // Clean up old history
+  if (history->size() == number_of_substeps()) {
+    history->mark_unneeded(history->end());
+    implicit_sources->pop_front(implicit_sources->end());
+  }
+}
+
+template <typename LocalVars, typename RemoteVars, typename Coupling>
+std::result_of_t<const Coupling&(LocalVars, RemoteVars)>
+ImexRungeKutta3::compute_boundary_delta(
+    const Coupling& coupling,
+    const gsl::not_null<BoundaryHistory<
+        LocalVars, RemoteVars,
+        std::result_of_t<const Coupling&(LocalVars, RemoteVars)>>*>
+        history,
+    const TimeDelta& time_step) const noexcept {
+  ASSERT(history->local_size() == history->remote_size(),
+         "Inconsistent history sizes for global time step method");
+  const size_t substep = history->local_size() - 1;
+  ASSERT(substep < number_of_substeps(),
+         "Bad substep value in ImexRungeKutta3: " << substep);
+  const auto& coefficients = gsl::at(explicit_increments_, substep);
+
+  auto local = history->local_begin();
+  auto remote = history->remote_begin();
+  std::result_of_t<const Coupling&(LocalVars, RemoteVars)> delta =
+      (coefficients[0] * time_step.value()) *
+      history->coupling(coupling, local, remote);
+  for (size_t j = 1; j <= substep; ++j) {
+    delta += (gsl::at(coefficients, j) * time_step.value()) *
+             history->coupling(coupling, ++local, ++remote);
+  }
+
+  // Clean up old history
+  if (history->local_size() == number_of_substeps()) {
+    history->local_mark_unneeded(history->local_end());
+    history->remote_mark_unneeded(history->remote_end());
+  }
+
+  return delta;
+}
+
+template <typename Vars, typename DerivVars>
+void ImexRungeKutta3::add_explicit_increment(
+    const gsl::not_null<Vars*> u, const History<Vars, DerivVars>& history,
+    const TimeDelta& time_step, const size_t substep) noexcept {
+  const auto& coefficients = gsl::at(explicit_increments_, substep);
+  auto entry = history.begin();
+  for (size_t j = 0; j <= substep; ++j, ++entry) {
+    *u += (gsl::at(coefficients, j) * time_step.value()) * entry.derivative();
+  }
+}
+}  // namespace TimeSteppers
@@ -0,0 +1,69 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/LowStorageRungeKutta3.hpp"
+
+#include <cmath>
+
+#include "ErrorHandling/Error.hpp"
+#include "Time/TimeId.hpp"
+
+namespace TimeSteppers {
+
+constexpr std::array<double, 3> LowStorageRungeKutta3::a_;
+constexpr std::array<double, 3> LowStorageRungeKutta3::b_;
+
+uint64_t LowStorageRungeKutta3::number_of_substeps() const noexcept {
+  return 3;
+}
+
+size_t LowStorageRungeKutta3::number_of_past_steps() const noexcept {
+  return 0;
+}
+
+bool LowStorageRungeKutta3::is_self_starting() const noexcept {
+  return true;
+}
+
+bool LowStorageRungeKutta3::uses_history_values() const noexcept {
+  return false;
+}
+
+double LowStorageRungeKutta3::stable_step() const noexcept {
+  // All three-stage third-order methods have the same stability
+  // polynomial, so this is the same as for RungeKutta3.
+  return 0.5 * (1. + cbrt(4. + sqrt(17.)) - 1. / cbrt(4. + sqrt(17.)));
+}
+
+TimeId LowStorageRungeKutta3::next_time_id(const TimeId& current_id,
+                                           const TimeDelta& time_step) const
+    noexcept {
+  switch (current_id.substep()) {
+    case 0:
+      ASSERT(current_id.time() == current_id.step_time(), "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time(), 1,
+              current_id.step_time() + time_step / 3};
+    case 1:
+      ASSERT(current_id.time() == current_id.step_time() + time_step / 3,
+             "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time(), 2,
+              current_id.step_time() + 3 * time_step / 4};
+    case 2:
+      ASSERT(current_id.time() == current_id.step_time() + 3 * time_step / 4,
+             "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time() + time_step};
+    default:
+      ERROR("Bad substep value in LowStorageRungeKutta3: "
+            << current_id.substep());
+  }
+}
+
+}  // namespace TimeSteppers
+
+/// \cond
+PUP::able::PUP_ID TimeSteppers::LowStorageRungeKutta3::my_PUP_ID =  // NOLINT
+    0;
+/// \endcond
@@ -0,0 +1,200 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class LowStorageRungeKutta3.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <pup.h>
+#include <type_traits>
+
+#include "ErrorHandling/Assert.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"  // IWYU pragma: keep
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+struct TimeId;
+namespace TimeSteppers {
+template <typename LocalVars, typename RemoteVars, typename CouplingResult>
+class BoundaryHistory;
+template <typename Vars, typename DerivVars>
+class History;
+}  // namespace TimeSteppers
+/// \endcond
+
+namespace TimeSteppers {
+
+/// \ingroup TimeSteppersGroup
+///
+/// Williamson's third-order Runge-Kutta time-stepper, using the
+/// recurrence of its 2N-storage scheme.
+///
+/// Each substep \f$j\f$ updates a register \f$\Delta u\f$ and the
+/// variables as
+/// \f{align*}
+/// \Delta u_j &= A_j \Delta u_{j-1} + \Delta t\,F(u_{j-1}, t + c_j \Delta t),
+/// &
+/// u_j &= u_{j-1} + B_j \Delta u_j
+/// \f}
+/// with \f$A = (0, -5/9, -153/128)\f$, \f$B = (1/3, 15/16, 8/15)\f$, and
+/// \f$c = (0, 1/3, 3/4)\f$.  The register is kept in the derivative of
+/// the most recent History entry, so the History holds one entry between
+/// substeps and two during an update, instead of the three kept by
+/// RungeKutta3.  This method does not read the values of the History
+/// (see uses_history_values), so the variables are not copied into it,
+/// and besides the variables and their time derivative the only storage
+/// is the single register \f$\Delta u\f$.  The schemes of Carpenter and
+/// Kennedy are not provided because their substep times are not
+/// rational fractions of the step.
+///
+/// Major reference: J. H. Williamson, J. Comput. Phys. 35, 48 (1980)
+class LowStorageRungeKutta3 : public TimeStepper::Inherit {
+ public:
+  using options = tmpl::list<>;
+  static constexpr OptionString help = {
+      "A third-order Runge-Kutta time-stepper keeping two history entries."};
+
+  LowStorageRungeKutta3() = default;
+  LowStorageRungeKutta3(const LowStorageRungeKutta3&) noexcept = default;
+  LowStorageRungeKutta3& operator=(const LowStorageRungeKutta3&) noexcept =
+      default;
+  LowStorageRungeKutta3(LowStorageRungeKutta3&&) noexcept = default;
+  LowStorageRungeKutta3& operator=(LowStorageRungeKutta3&&) noexcept =
+      default;
+  ~LowStorageRungeKutta3() noexcept override = default;
+
+  template <typename Vars, typename DerivVars>
+  void update_u(gsl::not_null<Vars*> u,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                const TimeDelta& time_step) const noexcept;
+
+  template <typename LocalVars, typename RemoteVars, typename Coupling>
+  std::result_of_t<const Coupling&(LocalVars, RemoteVars)>
+  compute_boundary_delta(
+      const Coupling& coupling,
+      gsl::not_null<BoundaryHistory<
+          LocalVars, RemoteVars,
+          std::result_of_t<const Coupling&(LocalVars, RemoteVars)>>*>
+          history,
+      const TimeDelta& time_step) const noexcept;
+
+  uint64_t number_of_substeps() const noexcept override;
+
+  size_t number_of_past_steps() const noexcept override;
+
+  bool is_self_starting() const noexcept override;
+
+  bool uses_history_values() const noexcept override;
+
+  double stable_step() const noexcept override;
+
+  TimeId next_time_id(const TimeId& current_id,
+                      const TimeDelta& time_step) const noexcept override;
+
+  template <typename Vars, typename DerivVars>
+  bool can_change_step_size(const TimeId& /*time_id*/,
+                            const TimeSteppers::History<Vars, DerivVars>&
+                                /*history*/) const noexcept {
+    // This integrator does not support local time-stepping.
+    return false;
+  }
+
+  WRAPPED_PUPable_decl_template(LowStorageRungeKutta3);  // NOLINT
+
+  explicit LowStorageRungeKutta3(CkMigrateMessage* /*unused*/) noexcept {}
+
+  // clang-tidy: do not pass by non-const reference
+  void pup(PUP::er& p) noexcept override {  // NOLINT
+    TimeStepper::Inherit::pup(p);
+  }
+
+ private:
+  static constexpr std::array<double, 3> a_{{0.0, -5.0 / 9.0,
+                                             -153.0 / 128.0}};
+  static constexpr std::array<double, 3> b_{{1.0 / 3.0, 15.0 / 16.0,
+                                             8.0 / 15.0}};
+};
+
+inline bool constexpr operator==(
+    const LowStorageRungeKutta3& /*lhs*/,
+    const LowStorageRungeKutta3& /*rhs*/) noexcept {
+  return true;
+}
+
+inline bool constexpr operator!=(
+    const LowStorageRungeKutta3& /*lhs*/,
+    const LowStorageRungeKutta3& /*rhs*/) noexcept {
+  return false;
+}
+
+template <typename Vars, typename DerivVars>
+void LowStorageRungeKutta3::update_u(
+    const gsl::not_null<Vars*> u,
+    const gsl::not_null<History<Vars, DerivVars>*> history,
+    const TimeDelta& time_step) const noexcept {
+  const size_t substep = history->inserts_since_emptied() - 1;
+  ASSERT(substep < number_of_substeps(),
+         "Bad substep value in LowStorageRungeKutta3: " << substep);
+  ASSERT(history->size() == (substep == 0 ? 1 : 2),
+         "The history must hold the register and the current substep");
+
+  // On entry the derivative of the current substep holds F(u_{j-1}) and
+  // is replaced by the register Delta u_j.
+  auto& delta_u = history->mutable_derivative(history->end() - 1);
+  delta_u *= time_step.value();
+  if (substep > 0) {
+    delta_u += gsl::at(a_, substep) * (history->end() - 2).derivative();
+  }
+  *u += gsl::at(b_, substep) * delta_u;
+
+  // Clean up old history
+  history->mark_unneeded(substep == number_of_substeps() - 1
+                             ? history->end()
+                             : history->end() - 1);
+}
+
+template <typename LocalVars, typename RemoteVars, typename Coupling>
+std::result_of_t<const Coupling&(LocalVars, RemoteVars)>
+LowStorageRungeKutta3::compute_boundary_delta(
+    const Coupling& coupling,
+    const gsl::not_null<BoundaryHistory<
+        LocalVars, RemoteVars,
+        std::result_of_t<const Coupling&(LocalVars, RemoteVars)>>*>
+        history,
+    const TimeDelta& time_step) const noexcept {
+  ASSERT(history->local_size() == history->remote_size(),
+         "Inconsistent history sizes for global time step method");
+  const size_t substep = history->local_size() - 1;
+  ASSERT(substep < number_of_substeps(),
+         "Bad substep value in LowStorageRungeKutta3: " << substep);
+
+  // The boundary terms are accumulated like the volume register, but
+  // from the couplings of all substeps of the step, which are cached.
+  auto local = history->local_begin();
+  auto remote = history->remote_begin();
+  std::result_of_t<const Coupling&(LocalVars, RemoteVars)> delta_u =
+      time_step.value() * history->coupling(coupling, local, remote);
+  for (size_t i = 1; i <= substep; ++i) {
+    delta_u *= gsl::at(a_, i);
+    delta_u += time_step.value() * history->coupling(coupling, ++local,
+                                                     ++remote);
+  }
+
+  // Clean up old history
+  if (substep == number_of_substeps() - 1) {
+    history->local_mark_unneeded(history->local_end());
+    history->remote_mark_unneeded(history->remote_end());
+  }
+
+  delta_u *= gsl::at(b_, substep);
+  return delta_u;
+}
+}  // namespace TimeSteppers
@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Time/TimeSteppers/LowStorageRungeKutta4.hpp"
+
+#include <cmath>
+
+#include "ErrorHandling/Error.hpp"
+#include "Time/TimeId.hpp"
+
+namespace TimeSteppers {
+
+constexpr std::array<double, 3> LowStorageRungeKutta4::a_;
+constexpr std::array<double, 4> LowStorageRungeKutta4::b_;
+
+uint64_t LowStorageRungeKutta4::number_of_substeps() const noexcept {
+  return 4;
+}
+
+size_t LowStorageRungeKutta4::number_of_past_steps() const noexcept {
+  return 0;
+}
+
+bool LowStorageRungeKutta4::is_self_starting() const noexcept {
+  return true;
+}
+
+bool LowStorageRungeKutta4::uses_history_values() const noexcept {
+  return false;
+}
+
+double LowStorageRungeKutta4::stable_step() const noexcept {
+  // This is the condition for  y' = -k y  to go to zero, which is the
+  // real root of  x^3 - 4 x^2 + 12 x - 24 = 0  halved.
+  const double root = sqrt(37584.);
+  return (4. + cbrt(172. + root) - cbrt(root - 172.)) / 6.;
+}
+
+TimeId LowStorageRungeKutta4::next_time_id(const TimeId& current_id,
+                                           const TimeDelta& time_step) const
+    noexcept {
+  switch (current_id.substep()) {
+    case 0:
+      ASSERT(current_id.time() == current_id.step_time(), "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time(), 1,
+              current_id.step_time() + time_step / 2};
+    case 1:
+      ASSERT(current_id.time() == current_id.step_time() + time_step / 2,
+             "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time(), 2,
+              current_id.step_time() + time_step / 2};
+    case 2:
+      ASSERT(current_id.time() == current_id.step_time() + time_step / 2,
+             "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time(), 3, current_id.step_time() + time_step};
+    case 3:
+      ASSERT(current_id.time() == current_id.step_time() + time_step,
+             "Wrong substep time");
+      return {current_id.time_runs_forward(), current_id.slab_number(),
+              current_id.step_time() + time_step};
+    default:
+      ERROR("Bad substep value in LowStorageRungeKutta4: "
+            << current_id.substep());
+  }
+}
+
+}  // namespace TimeSteppers
+
+/// \cond
+PUP::able::PUP_ID TimeSteppers::LowStorageRungeKutta4::my_PUP_ID =  // NOLINT
+    0;
+/// \endcond
@@ -0,0 +1,224 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class LowStorageRungeKutta4.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <pup.h>
+#include <type_traits>
+#include <utility>
+
+#include "ErrorHandling/Assert.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/CharmPupable.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"  // IWYU pragma: keep
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+struct TimeId;
+namespace TimeSteppers {
+template <typename LocalVars, typename RemoteVars, typename CouplingResult>
+class BoundaryHistory;
+template <typename Vars, typename DerivVars>
+class History;
+}  // namespace TimeSteppers
+/// \endcond
+
+namespace TimeSteppers {
+
+/// \ingroup TimeSteppersGroup
+///
+/// The classical fourth-order Runge-Kutta time-stepper in three-register
+/// form.
+///
+/// Each stage of the classical method depends only on the variables at
+/// the start of the step \f$u^n\f$ and the previous stage, so the method
+/// needs only the registers \f$u^n\f$ and
+/// \f$\Delta u_j = \Delta t \sum_{i \le j} b_i F_i\f$ besides the
+/// variables:
+/// \f{align*}
+/// u_{j+1} &= u^n + a_j \Delta t\,F_j, &
+/// u^{n+1} &= u^n + \Delta u_3
+/// \f}
+/// with \f$a = (1/2, 1/2, 1)\f$ and \f$b = (1/6, 1/3, 1/3, 1/6)\f$.  The
+/// registers are kept in the value and the derivative of the most recent
+/// History entry, so the History holds one entry between substeps and two
+/// during an update, instead of one per substep.  The variables are not
+/// copied into the History (see uses_history_values), and the method
+/// stores \f$u^n\f$ itself on the first substep, so besides the
+/// variables and their time derivative the only storage is the two
+/// registers.  A fourth-order 2N-storage method needs five stages whose
+/// substep times are not rational fractions of the step.
+class LowStorageRungeKutta4 : public TimeStepper::Inherit {
+ public:
+  using options = tmpl::list<>;
+  static constexpr OptionString help = {
+      "The classical fourth-order Runge-Kutta time-stepper keeping two "
+      "history entries."};
+
+  LowStorageRungeKutta4() = default;
+  LowStorageRungeKutta4(const LowStorageRungeKutta4&) noexcept = default;
+  LowStorageRungeKutta4& operator=(const LowStorageRungeKutta4&) noexcept =
+      default;
+  LowStorageRungeKutta4(LowStorageRungeKutta4&&) noexcept = default;
+  LowStorageRungeKutta4& operator=(LowStorageRungeKutta4&&) noexcept =
+      default;
+  ~LowStorageRungeKutta4() noexcept override = default;
+
+  template <typename Vars, typename DerivVars>
+  void update_u(gsl::not_null<Vars*> u,
+                gsl::not_null<History<Vars, DerivVars>*> history,
+                const TimeDelta& time_step) const noexcept;
+
+  template <typename LocalVars, typename RemoteVars, typename Coupling>
+  std::result_of_t<const Coupling&(LocalVars, RemoteVars)>
+  compute_boundary_delta(
+      const Coupling& coupling,
+      gsl::not_null<BoundaryHistory<
+          LocalVars, RemoteVars,
+          std::result_of_t<const Coupling&(LocalVars, RemoteVars)>>*>
+          history,
+      const TimeDelta& time_step) const noexcept;
+
+  uint64_t number_of_substeps() const noexcept override;
+
+  size_t number_of_past_steps() const noexcept override;
+
+  bool is_self_starting() const noexcept override;
+
+  bool uses_history_values() const noexcept override;
+
+  double stable_step() const noexcept override;
+
+  TimeId next_time_id(const TimeId& current_id,
+                      const TimeDelta& time_step) const noexcept override;
+
+  template <typename Vars, typename DerivVars>
+  bool can_change_step_size(const TimeId& /*time_id*/,
+                            const TimeSteppers::History<Vars, DerivVars>&
+                                /*history*/) const noexcept {
+    // This integrator does not support local time-stepping.
+    return false;
+  }
+
+  WRAPPED_PUPable_decl_template(LowStorageRungeKutta4);  // NOLINT
+
+  explicit LowStorageRungeKutta4(CkMigrateMessage* /*unused*/) noexcept {}
+
+  // clang-tidy: do not pass by non-const reference
+  void pup(PUP::er& p) noexcept override {  // NOLINT
+    TimeStepper::Inherit::pup(p);
+  }
+
+ private:
+  static constexpr std::array<double, 3> a_{{0.5, 0.5, 1.0}};
+  static constexpr std::array<double, 4> b_{{1.0 / 6.0, 1.0 / 3.0,
+                                             1.0 / 3.0, 1.0 / 6.0}};
+};
+
+inline bool constexpr operator==(
+    const LowStorageRungeKutta4& /*lhs*/,
+    const LowStorageRungeKutta4& /*rhs*/) noexcept {
+  return true;
+}
+
+inline bool constexpr operator!=(
+    const LowStorageRungeKutta4& /*lhs*/,
+    const LowStorageRungeKutta4& /*rhs*/) noexcept {
+  return false;
+}
+
+template <typename Vars, typename DerivVars>
+void LowStorageRungeKutta4::update_u(
+    const gsl::not_null<Vars*> u,
+    const gsl::not_null<History<Vars, DerivVars>*> history,
+    const TimeDelta& time_step) const noexcept {
+  const size_t substep = history->inserts_since_emptied() - 1;
+  ASSERT(substep < number_of_substeps(),
+         "Bad substep value in LowStorageRungeKutta4: " << substep);
+  ASSERT(history->size() == (substep == 0 ? 1 : 2),
+         "The history must hold the registers and the current substep");
+
+  const auto current = history->end() - 1;
+  // On entry the derivative of the current entry is F_j.  The
+  // variables are not copied into the history (see
+  // uses_history_values), so on the first substep they are stored as
+  // u^n in the value of the current entry.  On later substeps the
+  // previous entry holds the registers u^n and Delta u_{j-1}.
+  if (substep == 0) {
+    history->mutable_value(current) = *u;
+  } else if (substep < number_of_substeps() - 1) {
+    // The previous entry is not needed after this substep.
+    using std::swap;
+    swap(history->mutable_value(current),
+         history->mutable_value(current - 1));
+  }
+  const double dt = time_step.value();
+  if (substep < number_of_substeps() - 1) {
+    *u = current.value() + gsl::at(a_, substep) * dt * current.derivative();
+  }
+
+  auto& delta_u = history->mutable_derivative(current);
+  delta_u *= gsl::at(b_, substep) * dt;
+  if (substep > 0) {
+    delta_u += (current - 1).derivative();
+  }
+
+  // Clean up old history
+  if (substep == number_of_substeps() - 1) {
+    // u^n is left in the previous entry, whose memory is reused for
+    // u^n by the first substep of the next step.
+    *u = (current - 1).value() + delta_u;
+    history->mark_unneeded(history->end());
+  } else {
+    history->mark_unneeded(current);
+  }
+}
+
+template <typename LocalVars, typename RemoteVars, typename Coupling>
+std::result_of_t<const Coupling&(LocalVars, RemoteVars)>
+LowStorageRungeKutta4::compute_boundary_delta(
+    const Coupling& coupling,
+    const gsl::not_null<BoundaryHistory<
+        LocalVars, RemoteVars,
+        std::result_of_t<const Coupling&(LocalVars, RemoteVars)>>*>
+        history,
+    const TimeDelta& time_step) const noexcept {
+  ASSERT(history->local_size() == history->remote_size(),
+         "Inconsistent history sizes for global time step method");
+  const size_t substep = history->local_size() - 1;
+  ASSERT(substep < number_of_substeps(),
+         "Bad substep value in LowStorageRungeKutta4: " << substep);
+
+  // The intermediate stages start again from u^n, discarding the
+  // boundary terms of the earlier stages, which are added back with
+  // their weights at the end of the step.
+  if (substep < number_of_substeps() - 1) {
+    return gsl::at(a_, substep) * time_step.value() *
+           history->coupling(coupling, history->local_end() - 1,
+                             history->remote_end() - 1);
+  }
+  auto local = history->local_begin();
+  auto remote = history->remote_begin();
+  std::result_of_t<const Coupling&(LocalVars, RemoteVars)> delta_u =
+      gsl::at(b_, 0) * history->coupling(coupling, local, remote);
+  for (size_t i = 1; i <= substep; ++i) {
+    delta_u += gsl::at(b_, i) * history->coupling(coupling, ++local,
+                                                  ++remote);
+  }
+  delta_u *= time_step.value();
+
+  // Clean up old history
+  history->local_mark_unneeded(history->local_end());
+  history->remote_mark_unneeded(history->remote_end());
+
+  return delta_u;
+}
+}  // namespace TimeSteppers
@@ -21,6 +21,10 @@ bool RungeKutta3::is_self_starting() const noexcept {
   return true;
 }
 
+bool RungeKutta3::uses_history_values() const noexcept {
+  return true;
+}
+
 double RungeKutta3::stable_step() const noexcept {
   // This is the condition for  y' = -k y  to go to zero.
   return 0.5 * (1. + cbrt(4. + sqrt(17.)) - 1. / cbrt(4. + sqrt(17.)));
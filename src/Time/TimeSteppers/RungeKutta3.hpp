@@ -71,6 +71,8 @@ class RungeKutta3 : public TimeStepper::Inherit {
 
   bool is_self_starting() const noexcept override;
 
+  bool uses_history_values() const noexcept override;
+
   double stable_step() const noexcept override;
 
   TimeId next_time_id(const TimeId& current_id,
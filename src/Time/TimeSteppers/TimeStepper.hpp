@@ -32,6 +32,9 @@ class History;
 /// Holds classes that take time steps.
 namespace TimeSteppers {
 class AdamsBashforthN;  // IWYU pragma: keep
+class ImexRungeKutta3;  // IWYU pragma: keep
+class LowStorageRungeKutta3;  // IWYU pragma: keep
+class LowStorageRungeKutta4;  // IWYU pragma: keep
 class RungeKutta3;  // IWYU pragma: keep
 }  // namespace TimeSteppers
 
@@ -50,7 +53,11 @@ class TimeStepper : public PUP::able {
       TimeStepper_detail::FakeVirtualInherit_compute_boundary_delta<
           TimeStepper_detail::FakeVirtualInherit_update_u<TimeStepper>>>;
   using creatable_classes =
-      tmpl::list<TimeSteppers::AdamsBashforthN, TimeSteppers::RungeKutta3>;
+      tmpl::list<TimeSteppers::AdamsBashforthN,
+                 TimeSteppers::ImexRungeKutta3,
+                 TimeSteppers::LowStorageRungeKutta3,
+                 TimeSteppers::LowStorageRungeKutta4,
+                 TimeSteppers::RungeKutta3>;
 
   WRAPPED_PUPable_abstract(TimeStepper);  // NOLINT
 
@@ -103,6 +110,11 @@ class TimeStepper : public PUP::able {
   /// Whether or not the method is self-starting
   virtual bool is_self_starting() const noexcept = 0;
 
+  /// Whether `update_u` reads the values of the history entries, so
+  /// that the variables must be copied into the history with
+  /// History::insert rather than History::insert_without_value.
+  virtual bool uses_history_values() const noexcept = 0;
+
   /// Rough estimate of the maximum step size this method can take
   /// stably as a multiple of the step for Euler's method.
   virtual double stable_step() const noexcept = 0;
@@ -126,4 +138,7 @@ class TimeStepper : public PUP::able {
 };
 
 #include "Time/TimeSteppers/AdamsBashforthN.hpp"  // IWYU pragma: keep
+#include "Time/TimeSteppers/ImexRungeKutta3.hpp"  // IWYU pragma: keep
+#include "Time/TimeSteppers/LowStorageRungeKutta3.hpp"  // IWYU pragma: keep
+#include "Time/TimeSteppers/LowStorageRungeKutta4.hpp"  // IWYU pragma: keep
 #include "Time/TimeSteppers/RungeKutta3.hpp"  // IWYU pragma: keep
@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines class AlignedAllocator
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief The alignment in bytes of the storage owned by `DataVector` and
+ * `Variables`.
+ *
+ * \details This is the size of a cache line on the architectures we run on and
+ * a multiple of the width of every SIMD register up to AVX-512, so vectorized
+ * loops over the data never have to split a load across cache lines.
+ */
+constexpr size_t spectre_storage_alignment = 64;
+
+namespace AlignedAllocator_detail {
+inline size_t& allocation_counter() noexcept {
+  static thread_local size_t counter = 0;
+  return counter;
+}
+}  // namespace AlignedAllocator_detail
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief The number of heap allocations made by `AlignedAllocator` on the
+ * calling thread.
+ *
+ * \details This counts every allocation of storage owned by a `DataVector` or
+ * `Variables`, so comparing the value before and after a call shows whether
+ * the call allocated any memory for them, e.g. to check that a kernel is
+ * allocation-free once its buffers are warmed up.
+ */
+inline size_t number_of_aligned_allocations() noexcept {
+  return AlignedAllocator_detail::allocation_counter();
+}
+
+/*!
+ * \ingroup UtilitiesGroup
+ * \brief An allocator that returns memory aligned to `Alignment` bytes.
+ *
+ * \details Satisfies the C++ Allocator requirements so it can be used with
+ * standard containers, e.g. `std::vector<double, AlignedAllocator<double>>`.
+ * All instances are interchangeable, i.e. memory allocated by one instance can
+ * be deallocated by any other.
+ *
+ * \tparam T the type of objects to allocate
+ * \tparam Alignment the alignment in bytes, must be a power of two and a
+ * multiple of `sizeof(void*)`
+ */
+template <typename T, size_t Alignment = spectre_storage_alignment>
+class AlignedAllocator {
+  static_assert(Alignment >= alignof(T),
+                "The requested alignment is smaller than that of the type.");
+  static_assert((Alignment & (Alignment - 1)) == 0,
+                "The alignment must be a power of two.");
+  static_assert(Alignment % sizeof(void*) == 0,
+                "The alignment must be a multiple of sizeof(void*).");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  static constexpr size_t alignment = Alignment;
+
+  AlignedAllocator() noexcept = default;
+  template <typename U>
+  // clang-tidy: mark explicit (allocators must be implicitly convertible)
+  AlignedAllocator(  // NOLINT
+      const AlignedAllocator<U, Alignment>& /*rhs*/) noexcept {}
+
+  T* allocate(const size_t n) {
+    if (n == 0) {
+      return nullptr;
+    }
+    if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+      throw std::bad_alloc{};
+    }
+    void* result = nullptr;
+    if (posix_memalign(&result, Alignment, n * sizeof(T)) != 0) {
+      throw std::bad_alloc{};
+    }
+    ++AlignedAllocator_detail::allocation_counter();
+    return static_cast<T*>(result);
+  }
+
+  void deallocate(T* const p, const size_t /*n*/) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    free(p);
+  }
+};
+
+/// \cond
+template <typename T, typename U, size_t Alignment>
+constexpr bool operator==(const AlignedAllocator<T, Alignment>& /*lhs*/,
+                          const AlignedAllocator<U, Alignment>& /*rhs*/) {
+  return true;
+}
+
+template <typename T, typename U, size_t Alignment>
+constexpr bool operator!=(const AlignedAllocator<T, Alignment>& lhs,
+                          const AlignedAllocator<U, Alignment>& rhs) {
+  return not(lhs == rhs);
+}
+/// \endcond
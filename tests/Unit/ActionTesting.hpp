@@ -56,6 +56,29 @@ namespace detail {
 ACTION_TESTING_CHECK_MOCK_ACTION_LIST(simple_actions);
 ACTION_TESTING_CHECK_MOCK_ACTION_LIST(threaded_actions);
 #undef ACTION_TESTING_CHECK_MOCK_ACTION_LIST
+
+// Inserts received data like Parallel::AlgorithmImpl::receive_data_impl
+template <typename InboxTag, typename Data,
+          Requires<not Parallel::Algorithm_detail::
+                       is_insert_into_inbox_callable_v<
+                           InboxTag, gsl::not_null<typename InboxTag::type*>,
+                           const typename InboxTag::temporal_id&, Data>> =
+              nullptr>
+void insert_into_inbox(const gsl::not_null<typename InboxTag::type*> inbox,
+                       const typename InboxTag::temporal_id& id,
+                       Data&& data) noexcept {
+  (*inbox)[id].emplace(std::forward<Data>(data));
+}
+
+template <typename InboxTag, typename Data,
+          Requires<Parallel::Algorithm_detail::is_insert_into_inbox_callable_v<
+              InboxTag, gsl::not_null<typename InboxTag::type*>,
+              const typename InboxTag::temporal_id&, Data>> = nullptr>
+void insert_into_inbox(const gsl::not_null<typename InboxTag::type*> inbox,
+                       const typename InboxTag::temporal_id& id,
+                       Data&& data) noexcept {
+  InboxTag::insert_into_inbox(inbox, id, std::forward<Data>(data));
+}
 }  // namespace detail
 
 // MockDistributedObject mocks the AlgorithmImpl class.
@@ -205,6 +228,25 @@ class MockDistributedObject {
   void set_terminate(bool t) { terminate_ = t; }
   bool get_terminate() { return terminate_; }
 
+  // Mocks data handed over through `ckLocal()`, which is moved straight into
+  // the inbox
+  template <typename InboxTag, typename Data>
+  void receive_data(const typename InboxTag::temporal_id& id, Data&& data,
+                    const bool enable_if_disabled = false) {
+    (void)enable_if_disabled;
+    detail::insert_into_inbox<InboxTag>(
+        make_not_null(&tuples::get<InboxTag>(*inboxes_)), id,
+        std::forward<Data>(data));
+  }
+
+  // Mocks the empty reductions of array elements, which are only counted
+  void contribute(const CkCallback& /*callback*/) noexcept {
+    ++number_of_contributions_;
+  }
+  size_t number_of_contributions() const noexcept {
+    return number_of_contributions_;
+  }
+
   template <typename BoxType>
   BoxType& get_databox() noexcept {
     return boost::get<BoxType>(box_);
@@ -285,7 +327,9 @@ class MockDistributedObject {
           Action, typename Component::initial_databox>(                       \
           box_, *inboxes_, *const_global_cache_,                              \
           cpp17::as_const(array_index_), actions_list{},                      \
-          std::add_pointer_t<Component>{nullptr});                            \
+          std::add_pointer_t<Component>{nullptr} BOOST_PP_COMMA_IF(           \
+              BOOST_PP_NOT(USE_SIMPLE_ACTION))                                \
+              BOOST_PP_IF(USE_SIMPLE_ACTION, , make_not_null(&node_lock_)));  \
       performing_action_ = false;                                             \
     } else {                                                                  \
       NAME##_queue_.push_back(                                                \
@@ -314,7 +358,7 @@ class MockDistributedObject {
               BOOST_PP_IF(USE_SIMPLE_ACTION, , make_not_null(&node_lock_)));  \
       performing_action_ = false;                                             \
     } else {                                                                  \
-      simple_action_queue_.push_back(                                         \
+      NAME##_queue_.push_back(                                                \
           std::make_unique<BOOST_PP_IF(USE_SIMPLE_ACTION, InvokeSimpleAction, \
                                        InvokeThreadedAction) < new_action>>   \
           (this));                                                            \
@@ -345,6 +389,14 @@ class MockDistributedObject {
     threaded_action_queue_.pop_front();
   }
 
+  bool is_simple_action_queue_empty() const noexcept {
+    return simple_action_queue_.empty();
+  }
+
+  bool is_threaded_action_queue_empty() const noexcept {
+    return threaded_action_queue_.empty();
+  }
+
  private:
   template <typename Action, typename... Args, size_t... Is>
   void forward_tuple_to_simple_action(
@@ -369,6 +421,7 @@ class MockDistributedObject {
   }
 
   bool terminate_{false};
+  size_t number_of_contributions_{0};
   make_boost_variant_over<
       tmpl::push_front<databox_types, db::DataBox<tmpl::list<>>>>
       box_ = db::DataBox<tmpl::list<>>{};
@@ -566,7 +619,8 @@ class MockArrayElementProxy {
     // Might be useful in the future, not needed now but required by the
     // interface to be compliant with the Algorithm invocations.
     (void)enable_if_disabled;
-    tuples::get<InboxTag>(inbox_)[id].emplace(data);
+    detail::insert_into_inbox<InboxTag>(
+        make_not_null(&tuples::get<InboxTag>(inbox_)), id, data);
   }
 
   template <typename Action, typename... Args>
@@ -803,6 +857,30 @@ class MockRuntimeSystem {
   }
   // @}
 
+  // @{
+  /// Invoke the threaded action `Action` on the `Component` labeled by
+  /// `array_index` immediately.
+  template <typename Component, typename Action, typename Arg0,
+            typename... Args>
+  void threaded_action(const typename Component::array_index& array_index,
+                       Arg0&& arg0, Args&&... args) noexcept {
+    algorithms<Component>()
+        .at(array_index)
+        .template threaded_action<Action>(
+            std::make_tuple(std::forward<Arg0>(arg0),
+                            std::forward<Args>(args)...),
+            true);
+  }
+
+  template <typename Component, typename Action>
+  void threaded_action(
+      const typename Component::array_index& array_index) noexcept {
+    algorithms<Component>()
+        .at(array_index)
+        .template threaded_action<Action>(true);
+  }
+  // @}
+
   /// Invoke the next queued simple action on the `Component` labeled by
   /// `array_index`.
   template <typename Component>
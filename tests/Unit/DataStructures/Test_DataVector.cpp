@@ -7,11 +7,13 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <numeric>
 
 #include "DataStructures/DataVector.hpp"
 #include "ErrorHandling/Error.hpp"
+#include "Utilities/AlignedAllocator.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/Gsl.hpp"
@@ -57,6 +59,14 @@ SPECTRE_TEST_CASE("Unit.DataStructures.DataVector", "[DataStructures][Unit]") {
   CHECK(t_move_assignment.is_owning());
   DataVector t_move_constructor = std::move(t_move_assignment);
   CHECK(t_move_constructor.is_owning());
+
+  // Owned data is aligned so Blaze can use aligned SIMD instructions
+  for (const auto& owning_vector : {a, b, t2, t_move_constructor}) {
+    CHECK(reinterpret_cast<std::uintptr_t>(owning_vector.data()) %
+              spectre_storage_alignment ==
+          0);
+    CHECK(owning_vector.isAligned());
+  }
 }
 
 SPECTRE_TEST_CASE("Unit.Serialization.DataVector",
@@ -0,0 +1,88 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/TempBuffer.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/AlignedAllocator.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+bool is_aligned(const double* const pointer) noexcept {
+  return reinterpret_cast<std::uintptr_t>(pointer) %
+             spectre_storage_alignment ==
+         0;
+}
+
+// Sum of the squares of the components of `vector`, computed with
+// temporaries the way a physics kernel would.
+DataVector norm_squared(const tnsr::I<DataVector, 3>& vector) noexcept {
+  /// [temp_buffer_example]
+  TempBuffer<tmpl::list<::Tags::TempTensor<0, tnsr::I<DataVector, 3>>,
+                        ::Tags::TempTensor<1, Scalar<DataVector>>>>
+      buffer(vector.begin()->size(), 0.);
+  auto& squares = get<::Tags::TempTensor<0, tnsr::I<DataVector, 3>>>(buffer);
+  auto& sum = get(get<::Tags::TempTensor<1, Scalar<DataVector>>>(buffer));
+  /// [temp_buffer_example]
+  for (size_t i = 0; i < 3; ++i) {
+    squares.get(i) = square(vector.get(i));
+    sum += squares.get(i);
+  }
+  return sum;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.TempBuffer",
+                  "[DataStructures][Unit]") {
+  using scalar_tag = ::Tags::TempTensor<0, Scalar<DataVector>>;
+  using vector_tag = ::Tags::TempTensor<1, tnsr::i<DataVector, 2>>;
+  using Buffer = TempBuffer<tmpl::list<scalar_tag, vector_tag>>;
+  static_assert(Buffer::number_of_independent_components == 3,
+                "Wrong number of independent components");
+  CHECK(scalar_tag::name() == "TempTensor0");
+
+  auto& arena = TempBuffer_detail::thread_local_arena();
+  const size_t size_in_use = arena.size_in_use();
+  {
+    Buffer buffer(5, 2.);
+    CHECK(buffer.number_of_grid_points() == 5);
+    auto& scalar = get<scalar_tag>(buffer);
+    auto& vector = get<vector_tag>(buffer);
+    CHECK(get(scalar) == DataVector(5, 2.));
+    CHECK(get<0>(vector) == DataVector(5, 2.));
+    CHECK(get<1>(vector) == DataVector(5, 2.));
+    CHECK_FALSE(get(scalar).is_owning());
+    CHECK(is_aligned(get(scalar).data()));
+    // The components are contiguous
+    CHECK(get<0>(vector).data() == get(scalar).data() + 5);
+    CHECK(get<1>(vector).data() == get(scalar).data() + 10);
+    get<1>(vector) = 3.;
+    CHECK(get<0>(vector) == DataVector(5, 2.));
+    CHECK(arena.size_in_use() > size_in_use);
+
+    Buffer inner(7, 1.);
+    CHECK(is_aligned(get(get<scalar_tag>(inner)).data()));
+    CHECK(get<1>(get<vector_tag>(inner)) == DataVector(7, 1.));
+    CHECK(get<1>(vector) == DataVector(5, 3.));
+  }
+  CHECK(arena.size_in_use() == size_in_use);
+
+  const tnsr::I<DataVector, 3> vector{{{DataVector{1., 2.}, DataVector{2., 3.},
+                                        DataVector{2., 4.}}}};
+  const DataVector expected{9., 29.};
+  CHECK(norm_squared(vector) == expected);
+  // Once the arena has grown to the size needed, the temporaries no longer
+  // allocate. The only allocation is for the returned DataVector.
+  const size_t allocations = number_of_aligned_allocations();
+  CHECK(norm_squared(vector) == expected);
+  CHECK(number_of_aligned_allocations() == allocations + 1);
+  CHECK(arena.size_in_use() == size_in_use);
+  CHECK(arena.capacity() >= 4 * 2);
+}
@@ -7,6 +7,7 @@
 #include <boost/range/combine.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -20,6 +21,7 @@
 #include "DataStructures/VariablesHelpers.hpp"
 #include "ErrorHandling/Error.hpp"
 #include "Parallel/PupStlCpp11.hpp"
+#include "Utilities/AlignedAllocator.hpp"
 #include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Literals.hpp"
@@ -168,6 +170,13 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Variables", "[DataStructures][Unit]") {
                                  VariablesTestTags_detail::scalar,
                                  VariablesTestTags_detail::scalar2>>::name() ==
       "Variables(vector,scalar,scalar2)");
+
+  // The contiguous storage is aligned
+  Variables<tmpl::list<VariablesTestTags_detail::vector>> v_aligned(7, 1.0);
+  CHECK(reinterpret_cast<std::uintptr_t>(v_aligned.data()) %
+            spectre_storage_alignment ==
+        0);
+  CHECK(v_aligned.get_variable_data().isAligned());
 }
 
 // [[OutputRegex, Must copy into same size]]
@@ -10,12 +10,14 @@
 #include <limits>
 #include <random>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockBoundingVolumeHierarchy.hpp"
 #include "Domain/BlockId.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
 #include "Domain/Domain.hpp"
@@ -26,6 +28,7 @@
 #include "Domain/ElementLogicalCoordinates.hpp"
 #include "Domain/ElementMap.hpp"
 #include "Domain/InitialElementIds.hpp"
+#include "Domain/SegmentId.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/StdHelpers.hpp"
@@ -221,6 +224,10 @@ void fuzzy_test_block_and_element_logical_coordinates_unrefined(
   const auto block_logical_result =
       block_logical_coordinates(domain, frame_coords);
   test_serialization(block_logical_result);
+  CHECK(block_logical_coordinates(
+            domain, frame_coords,
+            BlockBoundingVolumeHierarchy<Dim, TargetFrame>(domain)) ==
+        block_logical_result);
 
   for (size_t s = 0; s < n_pts; ++s) {
     CHECK(block_logical_result[s].id.get_index() == block_ids[s]);
@@ -319,6 +326,11 @@ void test_block_and_element_logical_coordinates(
     CHECK_ITERABLE_APPROX(block_logical_result[s].data,
                           expected_logical_coords[s]);
   }
+  // Points on shared boundaries must still go to the smallest block_id
+  CHECK(block_logical_coordinates(
+            domain, frame_coords,
+            BlockBoundingVolumeHierarchy<Dim, TargetFrame>(domain)) ==
+        block_logical_result);
 
   test_serialization(block_logical_result);
 
@@ -501,17 +513,62 @@ void test_block_and_element_logical_coordinates3() noexcept {
       domain, x_frame, expected_block_ids, expected_x_logical, element_ids,
       expected_id_indices, expected_offset, expected_elem_log);
 }
+
+// Elements of different refinement levels in one block, listed out of order
+// and with some points on shared element boundaries.
+void test_element_logical_coordinates_mixed_refinement() noexcept {
+  const std::vector<ElementId<2>> element_ids{
+      ElementId<2>(0, {{SegmentId(2, 3), SegmentId(1, 1)}}),
+      ElementId<2>(0, {{SegmentId(2, 2), SegmentId(1, 1)}}),
+      ElementId<2>(0, {{SegmentId(1, 1), SegmentId(1, 0)}}),
+      ElementId<2>(0, {{SegmentId(1, 0), SegmentId(0, 0)}})};
+  const std::vector<std::pair<size_t, std::array<double, 2>>> points{
+      {0, {{-0.5, 0.5}}}, {0, {{0.0, 0.0}}},   {0, {{0.5, -0.5}}},
+      {1, {{0.3, 0.3}}},  {0, {{0.25, 0.5}}},  {0, {{0.75, 0.5}}},
+      {0, {{0.25, 0.75}}}};
+  std::vector<IdPair<domain::BlockId, tnsr::I<double, 2, Frame::Logical>>>
+      block_logical_coords{};
+  for (const auto& point : points) {
+    block_logical_coords.push_back(
+        make_id_pair(domain::BlockId(point.first),
+                     tnsr::I<double, 2, Frame::Logical>(point.second)));
+  }
+
+  const auto result =
+      element_logical_coordinates(element_ids, block_logical_coords);
+  // The point in block 1 is in none of the elements
+  CHECK(result.size() == 4);
+  const auto check_element = [&result, &element_ids ](
+      const size_t index, const std::vector<size_t>& expected_offsets,
+      const std::array<DataVector, 2>& expected_coords) noexcept {
+    const auto& holder = result.at(element_ids[index]);
+    CHECK(holder.offsets == expected_offsets);
+    CHECK_ITERABLE_APPROX(
+        holder.element_logical_coords,
+        (tnsr::I<DataVector, 2, Frame::Logical>(expected_coords)));
+  };
+  check_element(0, {5}, {{DataVector{0.0}, DataVector{0.0}}});
+  // The point at the origin is in elements 1, 2 and 3, and is assigned to
+  // the first of them
+  check_element(1, {1, 4, 6},
+                {{DataVector{-1.0, 0.0, 0.0}, DataVector{-1.0, 0.0, 0.5}}});
+  check_element(2, {2}, {{DataVector{0.0}, DataVector{0.0}}});
+  check_element(3, {0}, {{DataVector{0.0}, DataVector{0.5}}});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.BlockAndElementLogicalCoords",
                   "[Domain][Unit]") {
   test_block_and_element_logical_coordinates1<Frame::Grid>();
   test_block_and_element_logical_coordinates3<Frame::Grid>();
+  test_element_logical_coordinates_mixed_refinement();
   fuzzy_test_block_and_element_logical_coordinates3<Frame::Grid>(20);
   fuzzy_test_block_and_element_logical_coordinates2<Frame::Grid>(20);
   fuzzy_test_block_and_element_logical_coordinates1<Frame::Grid>(20);
   fuzzy_test_block_and_element_logical_coordinates1<Frame::Grid>(0);
   fuzzy_test_block_and_element_logical_coordinates_shell<Frame::Grid>(20);
+  // Enough points per block that the bounding volume hierarchy is used
+  fuzzy_test_block_and_element_logical_coordinates_shell<Frame::Grid>(100);
 }
 
 // [[OutputRegex, Found points that are not in any block.:
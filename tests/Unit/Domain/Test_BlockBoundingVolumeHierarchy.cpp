@@ -0,0 +1,132 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/BlockBoundingVolumeHierarchy.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainCreators/Shell.hpp"
+#include "Domain/DomainCreators/Sphere.hpp"
+#include "Domain/DomainHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+
+// IWYU pragma: no_forward_declare Tensor
+
+namespace {
+// Every point mapped from a block has that block among its candidates, and
+// the candidates of all points at once agree with those of each point.
+template <size_t Dim>
+void test_candidates_contain_block(const Domain<Dim, Frame::Inertial>& domain,
+                                   const size_t number_of_points) noexcept {
+  const BlockBoundingVolumeHierarchy<Dim, Frame::Inertial> hierarchy(domain);
+  CHECK(hierarchy.number_of_blocks() == domain.blocks().size());
+
+  std::mt19937 generator;
+  std::uniform_int_distribution<size_t> block_distribution(
+      0, domain.blocks().size() - 1);
+  std::uniform_real_distribution<double> logical_distribution(-1.0, 1.0);
+  std::vector<size_t> block_ids(number_of_points);
+  tnsr::I<DataVector, Dim, Frame::Inertial> x(number_of_points);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    block_ids[s] = block_distribution(generator);
+    tnsr::I<double, Dim, Frame::Logical> logical_point{};
+    for (size_t d = 0; d < Dim; ++d) {
+      logical_point.get(d) = logical_distribution(generator);
+    }
+    const auto point =
+        domain.blocks()[block_ids[s]].coordinate_map()(logical_point);
+    for (size_t d = 0; d < Dim; ++d) {
+      x.get(d)[s] = point.get(d);
+    }
+  }
+
+  std::vector<size_t> offsets{};
+  std::vector<size_t> candidates{};
+  hierarchy.candidate_blocks(make_not_null(&offsets),
+                             make_not_null(&candidates), x);
+  REQUIRE(offsets.size() == number_of_points + 1);
+  CHECK(offsets.back() == candidates.size());
+  std::vector<size_t> point_candidates{};
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const std::vector<size_t> batch_candidates(
+        candidates.begin() + static_cast<std::ptrdiff_t>(offsets[s]),
+        candidates.begin() + static_cast<std::ptrdiff_t>(offsets[s + 1]));
+    tnsr::I<double, Dim, Frame::Inertial> point{};
+    for (size_t d = 0; d < Dim; ++d) {
+      point.get(d) = x.get(d)[s];
+    }
+    hierarchy.candidate_blocks(make_not_null(&point_candidates), point);
+    CHECK(batch_candidates == point_candidates);
+    CHECK(std::is_sorted(point_candidates.begin(), point_candidates.end()));
+    CHECK(std::binary_search(point_candidates.begin(), point_candidates.end(),
+                             block_ids[s]));
+    // The hierarchy prunes blocks on the other side of the domain
+    CHECK(point_candidates.size() < domain.blocks().size());
+  }
+}
+
+void test_rectilinear() noexcept {
+  const Domain<3, Frame::Inertial> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<3>{2, 2, 2},
+          std::array<std::vector<double>, 3>{
+              {{0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}, {0.0, 0.5, 1.0}}},
+          {Index<3>{}}),
+      corners_for_rectilinear_domains(Index<3>{2, 2, 2}));
+  const BlockBoundingVolumeHierarchy<3, Frame::Inertial> hierarchy(domain,
+                                                                    2, 0.1);
+  // Block 7 spans [0.5, 1]^3, padded by a tenth of its size
+  for (size_t d = 0; d < 3; ++d) {
+    CHECK(gsl::at(hierarchy.lower_corner(7), d) == approx(0.45));
+    CHECK(gsl::at(hierarchy.upper_corner(7), d) == approx(1.05));
+  }
+
+  std::vector<size_t> candidates{};
+  const auto candidates_of = [&hierarchy, &candidates ](
+      const std::array<double, 3>& point) noexcept {
+    hierarchy.candidate_blocks(
+        make_not_null(&candidates),
+        tnsr::I<double, 3, Frame::Inertial>{point});
+    return candidates;
+  };
+  CHECK(candidates_of({{0.1, 0.1, 0.1}}) == std::vector<size_t>{0});
+  CHECK(candidates_of({{0.9, 0.1, 0.9}}) == std::vector<size_t>{5});
+  CHECK(candidates_of({{0.5, 0.5, 0.5}}) ==
+        std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7});
+  CHECK(candidates_of({{0.5, 0.1, 0.1}}) == std::vector<size_t>{0, 1});
+  CHECK(candidates_of({{2.0, 0.1, 0.1}}).empty());
+
+  // A point outside the root box has no candidates in the batched lookup
+  std::vector<size_t> offsets{};
+  hierarchy.candidate_blocks(
+      make_not_null(&offsets), make_not_null(&candidates),
+      tnsr::I<DataVector, 3, Frame::Inertial>{{{DataVector{0.1, 2.0},
+                                                DataVector{0.1, 0.1},
+                                                DataVector{0.1, 0.1}}}});
+  CHECK(offsets == std::vector<size_t>{0, 1, 1});
+  CHECK(candidates == std::vector<size_t>{0});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.BlockBoundingVolumeHierarchy",
+                  "[Domain][Unit]") {
+  test_rectilinear();
+  test_candidates_contain_block(
+      DomainCreators::Shell<Frame::Inertial>(1.5, 2.5, 2, {{4, 4}}, true)
+          .create_domain(),
+      200);
+  test_candidates_contain_block(
+      DomainCreators::Sphere<Frame::Inertial>(1.0, 3.0, 1, {{4, 4}}, true)
+          .create_domain(),
+      200);
+}
@@ -0,0 +1,132 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructures/Index.hpp"
+#include "Domain/Block.hpp"  // IWYU pragma: keep
+#include "Domain/BlockNeighbor.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/DomainCreators/Shell.hpp"
+#include "Domain/DomainHelpers.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/SegmentId.hpp"
+
+namespace {
+Domain<1, Frame::Inertial> two_intervals() noexcept {
+  return Domain<1, Frame::Inertial>(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<1>{2}, std::array<std::vector<double>, 1>{{{0.0, 0.5, 1.0}}},
+          {Index<1>{}}),
+      corners_for_rectilinear_domains(Index<1>{2}));
+}
+
+void test_contiguous_chunks() noexcept {
+  const BlockZCurveProcDistribution<1> distribution(
+      4, two_intervals(), {{{2}}, {{2}}}, {{{3}}, {{3}}});
+  const auto& element_ids = distribution.ordered_element_ids();
+  REQUIRE(element_ids.size() == 8);
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    CHECK(element_ids[i].block_id() == i / 4);
+    CHECK(element_ids[i].segment_ids()[0] == SegmentId(2, i % 4));
+    CHECK(distribution.get_proc_for_element(element_ids[i]) == i / 2);
+  }
+}
+
+void test_weighted_by_grid_points() noexcept {
+  // The second block has three times the grid points of the first
+  const auto domain = two_intervals();
+  const std::vector<std::array<size_t, 1>> refinement_levels{{{0}}, {{0}}};
+  const std::vector<std::array<size_t, 1>> extents{{{2}}, {{6}}};
+  const BlockZCurveProcDistribution<1> two_procs(2, domain, refinement_levels,
+                                                 extents);
+  CHECK(two_procs.get_proc_for_element(ElementId<1>(0)) == 0);
+  CHECK(two_procs.get_proc_for_element(ElementId<1>(1)) == 1);
+  const BlockZCurveProcDistribution<1> four_procs(4, domain, refinement_levels,
+                                                  extents);
+  CHECK(four_procs.get_proc_for_element(ElementId<1>(0)) == 0);
+  CHECK(four_procs.get_proc_for_element(ElementId<1>(1)) == 2);
+  // More processors than elements leaves some processors without any
+  const BlockZCurveProcDistribution<1> many_procs(100, domain,
+                                                  refinement_levels, extents);
+  CHECK(many_procs.get_proc_for_element(ElementId<1>(0)) == 12);
+  CHECK(many_procs.get_proc_for_element(ElementId<1>(1)) == 62);
+}
+
+void test_z_curve_in_block() noexcept {
+  const Domain<2, Frame::Inertial> domain(
+      maps_for_rectilinear_domains<Frame::Inertial>(
+          Index<2>{1, 1},
+          std::array<std::vector<double>, 2>{{{0.0, 1.0}, {0.0, 1.0}}},
+          {Index<2>{}}),
+      corners_for_rectilinear_domains(Index<2>{1, 1}));
+  // The finer refinement in the first dimension fills the last bit of the
+  // curve index
+  const BlockZCurveProcDistribution<2> distribution(1, domain, {{{2, 1}}},
+                                                    {{{4, 4}}});
+  const std::vector<std::array<size_t, 2>> expected_indices{
+      {{0, 0}}, {{1, 0}}, {{0, 1}}, {{1, 1}},
+      {{2, 0}}, {{3, 0}}, {{2, 1}}, {{3, 1}}};
+  const auto& element_ids = distribution.ordered_element_ids();
+  REQUIRE(element_ids.size() == expected_indices.size());
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    CHECK(element_ids[i].segment_ids()[0].index() == expected_indices[i][0]);
+    CHECK(element_ids[i].segment_ids()[1].index() == expected_indices[i][1]);
+    CHECK(distribution.get_proc_for_element(element_ids[i]) == 0);
+  }
+}
+
+void test_shell() noexcept {
+  const DomainCreators::Shell<Frame::Inertial> shell(1.5, 2.5, 1, {{4, 4}},
+                                                     true);
+  const auto domain = shell.create_domain();
+  const size_t number_of_procs = 8;
+  const BlockZCurveProcDistribution<3> distribution(
+      number_of_procs, domain, shell.initial_refinement_levels(),
+      shell.initial_extents());
+  const auto& element_ids = distribution.ordered_element_ids();
+  REQUIRE(element_ids.size() == 6 * 8);
+
+  // Each block is visited once, after one of its neighbors
+  std::unordered_set<size_t> visited_blocks{};
+  for (size_t i = 0; i < element_ids.size(); i += 8) {
+    const size_t block_id = element_ids[i].block_id();
+    CHECK(visited_blocks.count(block_id) == 0);
+    if (not visited_blocks.empty()) {
+      const auto& neighbors = domain.blocks()[block_id].neighbors();
+      CHECK(std::any_of(neighbors.begin(), neighbors.end(),
+                        [&visited_blocks](const auto& neighbor) noexcept {
+                          return visited_blocks.count(neighbor.second.id()) ==
+                                 1;
+                        }));
+    }
+    visited_blocks.insert(block_id);
+  }
+
+  // The processors are filled in order along the curve, with the same
+  // number of elements on each
+  std::vector<size_t> elements_on_proc(number_of_procs, 0);
+  size_t previous_proc = 0;
+  for (const auto& element_id : element_ids) {
+    const size_t proc = distribution.get_proc_for_element(element_id);
+    CHECK(proc >= previous_proc);
+    previous_proc = proc;
+    ++elements_on_proc[proc];
+  }
+  CHECK(elements_on_proc == std::vector<size_t>(number_of_procs, 6));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
+  test_contiguous_chunks();
+  test_weighted_by_grid_points();
+  test_z_curve_in_block();
+  test_shell();
+}
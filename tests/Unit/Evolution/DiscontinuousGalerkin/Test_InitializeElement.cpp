@@ -308,12 +308,17 @@ void test_initialize_element(
             box)
             .size() == mesh.number_of_grid_points());
 
+  using stepper_error_tag = Tags::StepperError<
+      typename system::variables_tag,
+      db::add_tag_prefix<Tags::dt, typename system::variables_tag>>;
   if (Metavariables::local_time_stepping) {
     CHECK(box_contains<typename dg::FluxCommunicationTypes<
               Metavariables>::local_time_stepping_mortar_data_tag>(box));
+    CHECK(box_contains<stepper_error_tag>(box));
   } else {
     CHECK(box_contains<typename dg::FluxCommunicationTypes<
               Metavariables>::simple_mortar_data_tag>(box));
+    CHECK_FALSE(box_contains<stepper_error_tag>(box));
   }
   CHECK(db::get<Tags::VariablesBoundaryData>(box).size() ==
         element.number_of_neighbors());
@@ -10,6 +10,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
+#include "Utilities/AlignedAllocator.hpp"
 #include "Utilities/Gsl.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
@@ -192,4 +193,16 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.DuDt",
   CHECK(dt_phi.get(2, 2, 3)[1] == approx(1422.401000428901625));
   CHECK(dt_phi.get(2, 3, 3)[0] == approx(1116.070338196526109));
   CHECK(dt_phi.get(2, 3, 3)[1] == approx(-42638.998279054998420));
+
+  // Once the thread-local arena holding the temporaries has grown, evaluating
+  // the equations does not allocate.
+  const size_t allocations = number_of_aligned_allocations();
+  GeneralizedHarmonic::ComputeDuDt<dim>::apply(
+      make_not_null(&dt_psi), make_not_null(&dt_pi), make_not_null(&dt_phi),
+      psi, pi, phi, d_psi, d_pi, d_phi, gamma0, gamma1, gamma2, gauge_function,
+      spacetime_deriv_gauge_function, lapse, shift, upper_spatial_metric,
+      upper_psi, trace_christoffel_first_kind, christoffel_first_kind,
+      christoffel_second_kind, normal_vector, normal_one_form);
+  CHECK(number_of_aligned_allocations() == allocations);
+  CHECK(dt_psi.get(0, 0)[0] == approx(-488.874963261792004));
 }
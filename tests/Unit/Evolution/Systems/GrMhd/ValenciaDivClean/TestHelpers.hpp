@@ -0,0 +1,61 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions useful for testing primitive recovery schemes
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+
+namespace TestHelpers {
+namespace ValenciaDivClean {
+/// The inputs of the primitive recovery schemes in flat space
+struct PrimitiveRecoveryInputs {
+  DataVector total_energy_density;
+  DataVector momentum_density_squared;
+  DataVector momentum_density_dot_magnetic_field;
+  DataVector magnetic_field_squared;
+  DataVector rest_mass_density_times_lorentz_factor;
+};
+
+/// The inputs of the primitive recovery schemes in flat space for a fluid
+/// with the given primitives
+inline PrimitiveRecoveryInputs make_primitive_recovery_inputs(
+    const DataVector& rest_mass_density, const DataVector& pressure,
+    const DataVector& specific_internal_energy,
+    const std::array<DataVector, 3>& spatial_velocity,
+    const std::array<DataVector, 3>& magnetic_field) noexcept {
+  DataVector v_squared(rest_mass_density.size(), 0.0);
+  DataVector b_squared(rest_mass_density.size(), 0.0);
+  DataVector b_dot_v(rest_mass_density.size(), 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    v_squared += square(spatial_velocity[i]);
+    b_squared += square(magnetic_field[i]);
+    b_dot_v += magnetic_field[i] * spatial_velocity[i];
+  }
+  const DataVector lorentz_factor = 1.0 / sqrt(1.0 - v_squared);
+  const DataVector rho_h_w_squared =
+      (rest_mass_density * (1.0 + specific_internal_energy) + pressure) *
+      square(lorentz_factor);
+  DataVector momentum_density_squared(rest_mass_density.size(), 0.0);
+  DataVector momentum_density_dot_magnetic_field(rest_mass_density.size(),
+                                                 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    const DataVector momentum_density =
+        (rho_h_w_squared + b_squared) * spatial_velocity[i] -
+        b_dot_v * magnetic_field[i];
+    momentum_density_squared += square(momentum_density);
+    momentum_density_dot_magnetic_field += momentum_density * magnetic_field[i];
+  }
+  return {rho_h_w_squared + b_squared - pressure -
+              0.5 * (square(b_dot_v) + b_squared / square(lorentz_factor)),
+          momentum_density_squared, momentum_density_dot_magnetic_field,
+          b_squared, rest_mass_density * lorentz_factor};
+}
+}  // namespace ValenciaDivClean
+}  // namespace TestHelpers
@@ -0,0 +1,177 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FallbackChain.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "tests/Unit/Evolution/Systems/GrMhd/ValenciaDivClean/TestHelpers.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+// IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
+
+namespace {
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::FallbackChain;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+    PrimitiveRecoveryBatchData;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::Scheme;
+
+template <size_t ThermodynamicDim>
+void test_chain(
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const DataVector& rest_mass_density, const DataVector& pressure,
+    const DataVector& specific_internal_energy,
+    const double atmosphere_pressure) noexcept {
+  const std::array<DataVector, 3> spatial_velocity{
+      {DataVector{0.1, -0.3, 0.0, 0.5, 0.7},
+       DataVector{0.2, 0.1, 0.0, -0.2, 0.1},
+       DataVector{-0.4, 0.2, 0.0, 0.1, 0.05}}};
+  const std::array<DataVector, 3> magnetic_field{
+      {DataVector{1.e-3, 0.0, 2.e-2, 1.e-4, 3.e-3},
+       DataVector{0.0, 0.0, -1.e-2, 2.e-4, 1.e-3},
+       DataVector{2.e-3, 0.0, 5.e-3, 0.0, -2.e-3}}};
+  const auto inputs =
+      TestHelpers::ValenciaDivClean::make_primitive_recovery_inputs(
+          rest_mass_density, pressure, specific_internal_energy,
+          spatial_velocity, magnetic_field);
+  const auto apply_chain = [&equation_of_state, &inputs ](
+      const gsl::not_null<PrimitiveRecoveryBatchData*> result,
+      const gsl::not_null<std::vector<size_t>*> scheme_used,
+      const FallbackChain& chain,
+      const DataVector& rest_mass_density_times_lorentz_factor) noexcept {
+    chain.apply(result, scheme_used, inputs.total_energy_density,
+                inputs.momentum_density_squared,
+                inputs.momentum_density_dot_magnetic_field,
+                inputs.magnetic_field_squared,
+                rest_mass_density_times_lorentz_factor, equation_of_state);
+  };
+
+  PrimitiveRecoveryBatchData newman_hamlin{};
+  NewmanHamlin::apply<ThermodynamicDim>(
+      make_not_null(&newman_hamlin), inputs.total_energy_density,
+      inputs.momentum_density_squared,
+      inputs.momentum_density_dot_magnetic_field,
+      inputs.magnetic_field_squared,
+      inputs.rest_mass_density_times_lorentz_factor, equation_of_state);
+  REQUIRE(newman_hamlin.number_of_failures() == 0);
+
+  const FallbackChain chain{
+      {Scheme::NewmanHamlin, Scheme::PalenzuelaEtAl, Scheme::Atmosphere},
+      1.e-10};
+  PrimitiveRecoveryBatchData result{};
+  std::vector<size_t> scheme_used{};
+
+  // Where the first scheme succeeds the others are never tried
+  apply_chain(make_not_null(&result), make_not_null(&scheme_used), chain,
+              inputs.rest_mass_density_times_lorentz_factor);
+  CHECK(result.number_of_failures() == 0);
+  CHECK(scheme_used == std::vector<size_t>(rest_mass_density.size(), 0));
+  CHECK(result.iterations == newman_hamlin.iterations);
+  CHECK(result.pressure == newman_hamlin.pressure);
+  CHECK(result.rho_h_w_squared == newman_hamlin.rho_h_w_squared);
+
+  // A negative density makes both schemes fail at a point, which is reset to
+  // the atmosphere without affecting the other points
+  DataVector rest_mass_density_times_lorentz_factor =
+      inputs.rest_mass_density_times_lorentz_factor;
+  rest_mass_density_times_lorentz_factor[2] *= -1.0;
+  apply_chain(make_not_null(&result), make_not_null(&scheme_used), chain,
+              rest_mass_density_times_lorentz_factor);
+  CHECK(result.number_of_failures() == 0);
+  CHECK(scheme_used == std::vector<size_t>{0, 0, 2, 0, 0});
+  CHECK(get(result.rest_mass_density)[2] == 1.e-10);
+  CHECK(get(result.lorentz_factor)[2] == 1.0);
+  CHECK(get(result.pressure)[2] == approx(atmosphere_pressure));
+  CHECK(result.iterations[2] == 0);
+  for (const size_t s : std::array<size_t, 4>{{0, 1, 3, 4}}) {
+    CHECK(get(result.pressure)[s] == get(newman_hamlin.pressure)[s]);
+    CHECK(result.iterations[s] == newman_hamlin.iterations[s]);
+  }
+
+  // Without the atmosphere the point is flagged as failed
+  const FallbackChain chain_without_atmosphere{
+      {Scheme::NewmanHamlin, Scheme::PalenzuelaEtAl}, 1.e-10};
+  apply_chain(make_not_null(&result), make_not_null(&scheme_used),
+              chain_without_atmosphere, rest_mass_density_times_lorentz_factor);
+  CHECK(result.number_of_failures() == 1);
+  CHECK(result.failed[2]);
+  CHECK(scheme_used == std::vector<size_t>{0, 0, 2, 0, 0});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.FallbackChain",
+                  "[Unit][GrMhd]") {
+  const DataVector rest_mass_density{1.e-5, 3.e-5, 1.e-4, 5.e-4, 1.e-3};
+
+  const EquationsOfState::PolytropicFluid<true> polytropic_fluid(100.0, 2.0);
+  const DataVector polytropic_pressure = 100.0 * square(rest_mass_density);
+  test_chain(polytropic_fluid, rest_mass_density, polytropic_pressure,
+             polytropic_pressure / rest_mass_density, 100.0 * square(1.e-10));
+
+  const EquationsOfState::IdealFluid<true> ideal_fluid(4.0 / 3.0);
+  const DataVector specific_internal_energy{3.e-3, 1.e-2, 5.e-2, 0.1, 0.15};
+  test_chain(ideal_fluid, rest_mass_density,
+             rest_mass_density * specific_internal_energy / 3.0,
+             specific_internal_energy, 0.0);
+}
+
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.FallbackChain.Options",
+                  "[Unit][GrMhd]") {
+  const auto chain = test_creation<FallbackChain>(
+      "  Schemes: [NewmanHamlin, PalenzuelaEtAl, Atmosphere]\n"
+      "  AtmosphereDensity: 1.e-12");
+  CHECK(chain.schemes() == std::vector<Scheme>{Scheme::NewmanHamlin,
+                                               Scheme::PalenzuelaEtAl,
+                                               Scheme::Atmosphere});
+  CHECK(chain.atmosphere_density() == 1.e-12);
+  CHECK(chain == FallbackChain({Scheme::NewmanHamlin, Scheme::PalenzuelaEtAl,
+                                Scheme::Atmosphere},
+                               1.e-12));
+  CHECK(chain != FallbackChain({Scheme::NewmanHamlin, Scheme::Atmosphere},
+                               1.e-12));
+  CHECK(test_creation<FallbackChain>("  Schemes: [PalenzuelaEtAl]")
+            .atmosphere_density() == 1.e-15);
+  test_serialization(chain);
+
+  CHECK(get_output(Scheme::NewmanHamlin) == "NewmanHamlin");
+  CHECK(get_output(Scheme::PalenzuelaEtAl) == "PalenzuelaEtAl");
+  CHECK(get_output(Scheme::Atmosphere) == "Atmosphere");
+}
+
+// [[OutputRegex, Failed to convert "Bisection" to Scheme]]
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.FallbackChain.BadScheme",
+                  "[Unit][GrMhd]") {
+  ERROR_TEST();
+  test_creation<FallbackChain>("  Schemes: [NewmanHamlin, Bisection]");
+}
+
+// [[OutputRegex, Atmosphere never fails, so it must be the last entry]]
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.FallbackChain.AtmosphereLast",
+                  "[Unit][GrMhd]") {
+  ERROR_TEST();
+  test_creation<FallbackChain>("  Schemes: [Atmosphere, NewmanHamlin]");
+}
+
+// [[OutputRegex, The atmosphere density must be positive]]
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.FallbackChain.AtmosphereDensity",
+                  "[Unit][GrMhd]") {
+  ERROR_TEST();
+  test_creation<FallbackChain>(
+      "  Schemes: [NewmanHamlin, Atmosphere]\n"
+      "  AtmosphereDensity: 0.0");
+}
@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <boost/optional.hpp>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "tests/Unit/Evolution/Systems/GrMhd/ValenciaDivClean/TestHelpers.hpp"
+
+// IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
+
+namespace {
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+    PrimitiveRecoveryBatchData;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+    PrimitiveRecoveryData;
+
+template <size_t ThermodynamicDim>
+void test_batch(const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+                    equation_of_state,
+                const DataVector& rest_mass_density,
+                const DataVector& pressure,
+                const DataVector& specific_internal_energy) noexcept {
+  const std::array<DataVector, 3> spatial_velocity{
+      {DataVector{0.1, -0.3, 0.0, 0.5, 0.7},
+       DataVector{0.2, 0.1, 0.0, -0.2, 0.1},
+       DataVector{-0.4, 0.2, 0.0, 0.1, 0.05}}};
+  const std::array<DataVector, 3> magnetic_field{
+      {DataVector{1.e-3, 0.0, 2.e-2, 1.e-4, 3.e-3},
+       DataVector{0.0, 0.0, -1.e-2, 2.e-4, 1.e-3},
+       DataVector{2.e-3, 0.0, 5.e-3, 0.0, -2.e-3}}};
+  const auto inputs =
+      TestHelpers::ValenciaDivClean::make_primitive_recovery_inputs(
+          rest_mass_density, pressure, specific_internal_energy,
+          spatial_velocity, magnetic_field);
+
+  PrimitiveRecoveryBatchData batch{};
+  NewmanHamlin::apply<ThermodynamicDim>(
+      make_not_null(&batch), inputs.total_energy_density,
+      inputs.momentum_density_squared,
+      inputs.momentum_density_dot_magnetic_field,
+      inputs.magnetic_field_squared,
+      inputs.rest_mass_density_times_lorentz_factor, equation_of_state);
+  CHECK(batch.number_of_failures() == 0);
+  CHECK(batch.max_iterations() > 0);
+  CHECK(batch.max_iterations() <= 50);
+  CHECK(batch.total_iterations() >= batch.max_iterations());
+
+  Approx larger_approx =
+      Approx::custom().epsilon(std::numeric_limits<double>::epsilon() * 1.e7);
+  CHECK_ITERABLE_CUSTOM_APPROX(get(batch.rest_mass_density), rest_mass_density,
+                               larger_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(get(batch.pressure), pressure, larger_approx);
+
+  // The batch agrees with the reference scalar version at every point
+  for (size_t s = 0; s < rest_mass_density.size(); ++s) {
+    const boost::optional<PrimitiveRecoveryData> scalar =
+        NewmanHamlin::apply<ThermodynamicDim>(
+            inputs.total_energy_density[s], inputs.momentum_density_squared[s],
+            inputs.momentum_density_dot_magnetic_field[s],
+            inputs.magnetic_field_squared[s],
+            inputs.rest_mass_density_times_lorentz_factor[s],
+            equation_of_state);
+    REQUIRE(static_cast<bool>(scalar));
+    CHECK(get(batch.rest_mass_density)[s] ==
+          approx(scalar.get().rest_mass_density));
+    CHECK(get(batch.lorentz_factor)[s] == approx(scalar.get().lorentz_factor));
+    CHECK(get(batch.pressure)[s] == approx(scalar.get().pressure));
+    CHECK(get(batch.rho_h_w_squared)[s] ==
+          approx(scalar.get().rho_h_w_squared));
+  }
+
+  // A point with unphysical input is flagged rather than aborting, and does
+  // not affect the other points
+  DataVector momentum_density_dot_magnetic_field =
+      inputs.momentum_density_dot_magnetic_field;
+  momentum_density_dot_magnetic_field[2] =
+      2.0 * sqrt(inputs.momentum_density_squared[2] *
+                 inputs.magnetic_field_squared[2]) +
+      1.0;
+  PrimitiveRecoveryBatchData batch_with_failure{};
+  NewmanHamlin::apply<ThermodynamicDim>(
+      make_not_null(&batch_with_failure), inputs.total_energy_density,
+      inputs.momentum_density_squared, momentum_density_dot_magnetic_field,
+      inputs.magnetic_field_squared,
+      inputs.rest_mass_density_times_lorentz_factor, equation_of_state);
+  CHECK(batch_with_failure.number_of_failures() == 1);
+  CHECK(batch_with_failure.failed[2]);
+  CHECK(batch_with_failure.iterations[2] == 0);
+  for (const size_t s : std::array<size_t, 4>{{0, 1, 3, 4}}) {
+    CHECK_FALSE(batch_with_failure.failed[s]);
+    CHECK(get(batch_with_failure.pressure)[s] == get(batch.pressure)[s]);
+    CHECK(batch_with_failure.iterations[s] == batch.iterations[s]);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.NewmanHamlin",
+                  "[Unit][GrMhd]") {
+  const DataVector rest_mass_density{1.e-5, 3.e-5, 1.e-4, 5.e-4, 1.e-3};
+
+  const EquationsOfState::PolytropicFluid<true> polytropic_fluid(100.0, 2.0);
+  const DataVector polytropic_pressure = 100.0 * square(rest_mass_density);
+  test_batch(polytropic_fluid, rest_mass_density, polytropic_pressure,
+             polytropic_pressure / rest_mass_density);
+
+  const EquationsOfState::IdealFluid<true> ideal_fluid(4.0 / 3.0);
+  const DataVector specific_internal_energy{3.e-3, 1.e-2, 5.e-2, 0.1, 0.15};
+  test_batch(ideal_fluid, rest_mass_density,
+             rest_mass_density * specific_internal_energy / 3.0,
+             specific_internal_energy);
+}
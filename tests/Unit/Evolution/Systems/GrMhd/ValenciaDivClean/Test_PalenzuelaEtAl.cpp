@@ -0,0 +1,127 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <limits>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "tests/Unit/Evolution/Systems/GrMhd/ValenciaDivClean/TestHelpers.hpp"
+
+// IWYU pragma: no_forward_declare EquationsOfState::EquationOfState
+
+namespace {
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+    PrimitiveRecoveryBatchData;
+using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
+    PrimitiveRecoveryData;
+
+template <size_t ThermodynamicDim>
+void test_recovery(
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const DataVector& rest_mass_density, const DataVector& pressure,
+    const DataVector& specific_internal_energy) noexcept {
+  const std::array<DataVector, 3> spatial_velocity{
+      {DataVector{0.1, -0.3, 0.0, 0.5, 0.9},
+       DataVector{0.2, 0.1, 0.0, -0.2, 0.3},
+       DataVector{-0.4, 0.2, 0.0, 0.1, 0.2}}};
+  const std::array<DataVector, 3> magnetic_field{
+      {DataVector{1.e-3, 0.0, 2.e-2, 1.e-4, 3.e-2},
+       DataVector{0.0, 0.0, -1.e-2, 2.e-4, 1.e-2},
+       DataVector{2.e-3, 0.0, 5.e-3, 0.0, -2.e-2}}};
+  const auto inputs =
+      TestHelpers::ValenciaDivClean::make_primitive_recovery_inputs(
+          rest_mass_density, pressure, specific_internal_energy,
+          spatial_velocity, magnetic_field);
+
+  PrimitiveRecoveryBatchData batch{};
+  PalenzuelaEtAl::apply<ThermodynamicDim>(
+      make_not_null(&batch), inputs.total_energy_density,
+      inputs.momentum_density_squared,
+      inputs.momentum_density_dot_magnetic_field,
+      inputs.magnetic_field_squared,
+      inputs.rest_mass_density_times_lorentz_factor, equation_of_state);
+  CHECK(batch.number_of_failures() == 0);
+  CHECK(batch.max_iterations() > 0);
+
+  Approx larger_approx =
+      Approx::custom().epsilon(std::numeric_limits<double>::epsilon() * 1.e7);
+  CHECK_ITERABLE_CUSTOM_APPROX(get(batch.rest_mass_density), rest_mass_density,
+                               larger_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(get(batch.pressure), pressure, larger_approx);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      get(batch.lorentz_factor),
+      DataVector(1.0 / sqrt(1.0 - square(spatial_velocity[0]) -
+                            square(spatial_velocity[1]) -
+                            square(spatial_velocity[2]))),
+      larger_approx);
+
+  for (size_t s = 0; s < rest_mass_density.size(); ++s) {
+    const boost::optional<PrimitiveRecoveryData> scalar =
+        PalenzuelaEtAl::apply<ThermodynamicDim>(
+            inputs.total_energy_density[s], inputs.momentum_density_squared[s],
+            inputs.momentum_density_dot_magnetic_field[s],
+            inputs.magnetic_field_squared[s],
+            inputs.rest_mass_density_times_lorentz_factor[s],
+            equation_of_state);
+    REQUIRE(static_cast<bool>(scalar));
+    CHECK(get(batch.rest_mass_density)[s] == scalar.get().rest_mass_density);
+    CHECK(get(batch.lorentz_factor)[s] == scalar.get().lorentz_factor);
+    CHECK(get(batch.pressure)[s] == scalar.get().pressure);
+    CHECK(get(batch.rho_h_w_squared)[s] == scalar.get().rho_h_w_squared);
+  }
+
+  // An energy density below the rest mass density leaves no bracket for the
+  // root, which is flagged without affecting the other points
+  DataVector total_energy_density = inputs.total_energy_density;
+  total_energy_density[2] =
+      0.5 * inputs.rest_mass_density_times_lorentz_factor[2];
+  CHECK_FALSE(static_cast<bool>(PalenzuelaEtAl::apply<ThermodynamicDim>(
+      total_energy_density[2], inputs.momentum_density_squared[2],
+      inputs.momentum_density_dot_magnetic_field[2],
+      inputs.magnetic_field_squared[2],
+      inputs.rest_mass_density_times_lorentz_factor[2], equation_of_state)));
+  PrimitiveRecoveryBatchData batch_with_failure{};
+  PalenzuelaEtAl::apply<ThermodynamicDim>(
+      make_not_null(&batch_with_failure), total_energy_density,
+      inputs.momentum_density_squared,
+      inputs.momentum_density_dot_magnetic_field,
+      inputs.magnetic_field_squared,
+      inputs.rest_mass_density_times_lorentz_factor, equation_of_state);
+  CHECK(batch_with_failure.number_of_failures() == 1);
+  CHECK(batch_with_failure.failed[2]);
+  CHECK(batch_with_failure.iterations[2] == 0);
+  for (const size_t s : std::array<size_t, 4>{{0, 1, 3, 4}}) {
+    CHECK_FALSE(batch_with_failure.failed[s]);
+    CHECK(get(batch_with_failure.pressure)[s] == get(batch.pressure)[s]);
+    CHECK(batch_with_failure.iterations[s] == batch.iterations[s]);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PalenzuelaEtAl",
+                  "[Unit][GrMhd]") {
+  const DataVector rest_mass_density{1.e-5, 3.e-5, 1.e-4, 5.e-4, 1.e-3};
+
+  const EquationsOfState::PolytropicFluid<true> polytropic_fluid(100.0, 2.0);
+  const DataVector polytropic_pressure = 100.0 * square(rest_mass_density);
+  test_recovery(polytropic_fluid, rest_mass_density, polytropic_pressure,
+                polytropic_pressure / rest_mass_density);
+
+  const EquationsOfState::IdealFluid<true> ideal_fluid(4.0 / 3.0);
+  const DataVector specific_internal_energy{3.e-3, 1.e-2, 5.e-2, 0.1, 0.15};
+  test_recovery(ideal_fluid, rest_mass_density,
+                rest_mass_density * specific_internal_energy / 3.0,
+                specific_internal_energy);
+}
@@ -8,11 +8,13 @@
 #include <limits>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/FallbackChain.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 #include "PointwiseFunctions/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/ConstantExpressions.hpp"
@@ -29,6 +31,7 @@ namespace grmhd {
 namespace ValenciaDivClean {
 namespace PrimitiveRecoverySchemes {
 class NewmanHamlin;
+class PalenzuelaEtAl;
 }  // namespace PrimitiveRecoverySchemes
 }  // namespace ValenciaDivClean
 }  // namespace grmhd
@@ -137,12 +140,15 @@ Scalar<DataVector> specific_enthalpy(
                             get(pressure) / get(rest_mass_density)};
 }
 
-template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
+// `recover_primitives` is called with the arguments of
+// PrimitiveFromConservative<PrimitiveRecoveryScheme, ThermodynamicDim>::apply
+template <size_t ThermodynamicDim, typename RecoverPrimitives>
 void test_primitive_from_conservative(
     const gsl::not_null<std::mt19937*> generator,
     const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
         equation_of_state,
-    const DataVector& used_for_size) noexcept {
+    const DataVector& used_for_size,
+    const RecoverPrimitives& recover_primitives) noexcept {
   // generate random primitives with interesting astrophysical values
   const auto expected_rest_mass_density =
       random_density(generator, used_for_size);
@@ -215,19 +221,14 @@ void test_primitive_from_conservative(
   Scalar<DataVector> lorentz_factor(number_of_points);
   Scalar<DataVector> pressure(number_of_points);
   Scalar<DataVector> specific_enthalpy(number_of_points);
-  grmhd::ValenciaDivClean::PrimitiveFromConservative<
-      PrimitiveRecoveryScheme,
-      ThermodynamicDim>::apply(make_not_null(&rest_mass_density),
-                               make_not_null(&specific_internal_energy),
-                               make_not_null(&spatial_velocity),
-                               make_not_null(&magnetic_field),
-                               make_not_null(&divergence_cleaning_field),
-                               make_not_null(&lorentz_factor),
-                               make_not_null(&pressure),
-                               make_not_null(&specific_enthalpy), tilde_d,
-                               tilde_tau, tilde_s, tilde_b, tilde_phi,
-                               spatial_metric, inv_spatial_metric,
-                               sqrt_det_spatial_metric, equation_of_state);
+  recover_primitives(
+      make_not_null(&rest_mass_density),
+      make_not_null(&specific_internal_energy),
+      make_not_null(&spatial_velocity), make_not_null(&magnetic_field),
+      make_not_null(&divergence_cleaning_field), make_not_null(&lorentz_factor),
+      make_not_null(&pressure), make_not_null(&specific_enthalpy), tilde_d,
+      tilde_tau, tilde_s, tilde_b, tilde_phi, spatial_metric,
+      inv_spatial_metric, sqrt_det_spatial_metric, equation_of_state);
 
   Approx larger_approx =
       Approx::custom().epsilon(std::numeric_limits<double>::epsilon() * 1.e7);
@@ -247,6 +248,55 @@ void test_primitive_from_conservative(
   CHECK_ITERABLE_CUSTOM_APPROX(expected_divergence_cleaning_field,
                                divergence_cleaning_field, larger_approx);
 }
+
+template <typename PrimitiveRecoveryScheme, size_t ThermodynamicDim>
+void test_primitive_from_conservative(
+    const gsl::not_null<std::mt19937*> generator,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const DataVector& used_for_size) noexcept {
+  test_primitive_from_conservative(
+      generator, equation_of_state, used_for_size,
+      [](const auto&... args) noexcept {
+        grmhd::ValenciaDivClean::PrimitiveFromConservative<
+            PrimitiveRecoveryScheme, ThermodynamicDim>::apply(args...);
+      });
+}
+
+// Recovers the primitives through `fallback_chain`, which must succeed at all
+// points, and checks how many points each entry of the chain recovered.
+template <size_t ThermodynamicDim>
+void test_primitive_from_conservative(
+    const gsl::not_null<std::mt19937*> generator,
+    const EquationsOfState::EquationOfState<true, ThermodynamicDim>&
+        equation_of_state,
+    const DataVector& used_for_size,
+    const grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::FallbackChain&
+        fallback_chain,
+    const std::vector<size_t>& expected_number_of_points_recovered) noexcept {
+  std::vector<size_t> number_of_points_recovered_by_scheme{};
+  test_primitive_from_conservative(
+      generator, equation_of_state, used_for_size,
+      [&fallback_chain, &number_of_points_recovered_by_scheme ](
+          const auto rest_mass_density, const auto specific_internal_energy,
+          const auto spatial_velocity, const auto magnetic_field,
+          const auto divergence_cleaning_field, const auto lorentz_factor,
+          const auto pressure, const auto specific_enthalpy,
+          const auto&... args) noexcept {
+        grmhd::ValenciaDivClean::PrimitiveFromConservative<
+            grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::FallbackChain,
+            ThermodynamicDim>::apply(rest_mass_density,
+                                     specific_internal_energy,
+                                     spatial_velocity, magnetic_field,
+                                     divergence_cleaning_field, lorentz_factor,
+                                     pressure, specific_enthalpy,
+                                     make_not_null(
+                                         &number_of_points_recovered_by_scheme),
+                                     args..., fallback_chain);
+      });
+  CHECK(number_of_points_recovered_by_scheme ==
+        expected_number_of_points_recovered);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -265,4 +315,28 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
   test_primitive_from_conservative<
       grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin, 2>(
       &generator, ideal_fluid, dv);
+  test_primitive_from_conservative<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl, 1>(
+      &generator, polytropic_fluid, dv);
+  test_primitive_from_conservative<
+      grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl, 2>(
+      &generator, ideal_fluid, dv);
+
+  using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::FallbackChain;
+  using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::Scheme;
+  // The fallback is not needed where NewmanHamlin succeeds...
+  const FallbackChain newman_hamlin_first(
+      {Scheme::NewmanHamlin, Scheme::PalenzuelaEtAl}, 1.e-15);
+  test_primitive_from_conservative(&generator, polytropic_fluid, dv,
+                                   newman_hamlin_first, {5, 0});
+  test_primitive_from_conservative(&generator, ideal_fluid, dv,
+                                   newman_hamlin_first, {5, 0});
+  // ...so PalenzuelaEtAl is tested as the first entry, with the atmosphere as
+  // its fallback.
+  const FallbackChain palenzuela_first(
+      {Scheme::PalenzuelaEtAl, Scheme::Atmosphere}, 1.e-15);
+  test_primitive_from_conservative(&generator, polytropic_fluid, dv,
+                                   palenzuela_first, {5, 0});
+  test_primitive_from_conservative(&generator, ideal_fluid, dv,
+                                   palenzuela_first, {5, 0});
 }
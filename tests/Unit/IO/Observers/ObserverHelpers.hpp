@@ -31,7 +31,10 @@ struct observer_component {
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = size_t;
   using const_global_cache_tag_list =
-      tmpl::list<observers::OptionTags::VolumeFileName>;
+      tmpl::list<observers::OptionTags::VolumeFileName,
+                 observers::OptionTags::SingleVolumeFile,
+                 observers::OptionTags::VolumeWriteQueueCapacity,
+                 observers::OptionTags::VolumeOutputSettings>;
   using action_list = tmpl::list<>;
   using component_being_mocked = observers::Observer<Metavariables>;
   using simple_tags = observers::Actions::Initialize::simple_tags;
@@ -66,8 +66,10 @@ void check_observer_registration() {
                  ActionTesting::MockDistributedObject<element_comp>{});
   }
 
+  MockRuntimeSystem::CacheTuple cache_data{};
+  tuples::get<observers::OptionTags::VolumeWriteQueueCapacity>(cache_data) = 2;
   ActionTesting::MockRuntimeSystem<Metavariables> runner{
-      {}, std::move(dist_objects)};
+      cache_data, std::move(dist_objects)};
 
   runner.simple_action<obs_component, observers::Actions::Initialize>(0);
   runner.simple_action<obs_writer, observers::Actions::InitializeWriter>(0);
@@ -93,6 +95,23 @@ void check_observer_registration() {
     runner.invoke_queued_simple_action<obs_component>(0);
   }
 
+  // The observer registers with the writer of the node once it has a sender
+  // of volume data
+  constexpr bool has_volume_data =
+      TypeOfObservation != observers::TypeOfObservation::Reduction;
+  const auto& writer_box =
+      runner.template algorithms<obs_writer>()
+          .at(0)
+          .template get_databox<typename obs_writer::initial_databox>();
+  if (has_volume_data) {
+    runner.invoke_queued_simple_action<obs_writer>(0);
+  }
+  CHECK(runner.template algorithms<obs_writer>()
+            .at(0)
+            .is_simple_action_queue_empty());
+  CHECK(db::get<observers::Tags::VolumeObserversRegistered>(writer_box) ==
+        (has_volume_data ? 1 : 0));
+
   // Test registration occurred as expected
   CHECK(db::get<observers::Tags::NumberOfEvents>(observer_box).empty());
   CHECK(db::get<observers::Tags::ReductionArrayComponentIds>(observer_box)
@@ -120,6 +139,26 @@ void check_observer_registration() {
                 Parallel::ArrayIndex<ElementIndex<2>>(ElementIndex<2>(id)))) ==
         (TypeOfObservation == observers::TypeOfObservation::Reduction ? 0 : 1));
   }
+
+  // Deregister the elements, e.g. after they were migrated to another
+  // processor
+  for (const auto& id : element_ids) {
+    runner.simple_action<obs_component,
+                         observers::Actions::DeregisterSenderWithSelf>(
+        0, 0,
+        observers::ArrayComponentId(
+            std::add_pointer_t<element_comp>{nullptr},
+            Parallel::ArrayIndex<ElementIndex<2>>(ElementIndex<2>(id))),
+        TypeOfObservation);
+  }
+  CHECK(db::get<observers::Tags::ReductionArrayComponentIds>(observer_box)
+            .empty());
+  CHECK(
+      db::get<observers::Tags::VolumeArrayComponentIds>(observer_box).empty());
+  if (has_volume_data) {
+    runner.invoke_queued_simple_action<obs_writer>(0);
+  }
+  CHECK(db::get<observers::Tags::VolumeObserversRegistered>(writer_box) == 0);
 }
 
 SPECTRE_TEST_CASE("Unit.IO.Observers.RegisterElements", "[Unit][Observers]") {
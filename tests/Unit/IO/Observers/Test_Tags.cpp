@@ -15,6 +15,11 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   CHECK(VolumeArrayComponentIds::name() == "VolumeArrayComponentIds");
   CHECK(TensorData::name() == "TensorData");
   CHECK(VolumeObserversContributed::name() == "VolumeObserversContributed");
+  CHECK(VolumeObserversRegistered::name() == "VolumeObserversRegistered");
+  CHECK(VolumeLayouts::name() == "VolumeLayouts");
+  CHECK(VolumeLayoutsContributed::name() == "VolumeLayoutsContributed");
+  CHECK(SharedVolumeFileQueue::name() == "SharedVolumeFileQueue");
+  CHECK(VolumeWriteQueue::name() == "VolumeWriteQueue");
   CHECK(VolumeFileLock::name() == "VolumeFileLock");
   CHECK(ReductionFileLock::name() == "ReductionFileLock");
 }
@@ -3,15 +3,20 @@
 
 #include "tests/Unit/TestingFramework.hpp"
 
+#include <atomic>
 #include <boost/iterator/transform_iterator.hpp>
+#include <chrono>
 #include <cstddef>
 #include <functional>
+#include <future>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
@@ -22,6 +27,7 @@
 #include "IO/H5/VolumeData.hpp"
 #include "IO/Observer/Actions.hpp"  // IWYU pragma: keep
 #include "IO/Observer/ArrayComponentId.hpp"
+#include "IO/Observer/FlushVolumeWrites.hpp"
 #include "IO/Observer/Initialize.hpp"  // IWYU pragma: keep
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"  // IWYU pragma: keep
@@ -40,7 +46,8 @@
 // NOLINTNEXTLINE(google-build-using-namespace)
 using namespace TestObservers_detail;
 
-SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
+namespace {
+void test_volume_observer(const bool single_volume_file) {
   using TupleOfMockDistributedObjects =
       typename ActionTesting::MockRuntimeSystem<
           Metavariables>::TupleOfMockDistributedObjects;
@@ -76,10 +83,14 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
                  ActionTesting::MockDistributedObject<element_comp>{});
   }
 
-  tuples::TaggedTuple<observers::OptionTags::VolumeFileName> cache_data{};
+  MockRuntimeSystem::CacheTuple cache_data{};
   const auto& output_file_prefix =
       tuples::get<observers::OptionTags::VolumeFileName>(cache_data) =
           "./Unit.IO.Observers.VolumeObserver";
+  tuples::get<observers::OptionTags::SingleVolumeFile>(cache_data) =
+      single_volume_file;
+  tuples::get<observers::OptionTags::VolumeWriteQueueCapacity>(cache_data) =
+      2;
   ActionTesting::MockRuntimeSystem<Metavariables> runner{
       cache_data, std::move(dist_objects)};
 
@@ -96,8 +107,15 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
     // observer component by the RegisterWithObservers action.
     runner.invoke_queued_simple_action<obs_component>(0);
   }
+  // The observer registered its first volume data sender with the writer
+  runner.invoke_queued_simple_action<obs_writer>(0);
+  CHECK(db::get<observers::Tags::VolumeObserversRegistered>(
+            runner.algorithms<obs_writer>()
+                .at(0)
+                .get_databox<obs_writer::initial_databox>()) == 1);
 
-  const std::string h5_file_name = output_file_prefix + "0.h5";
+  const std::string h5_file_name =
+      output_file_prefix + (single_volume_file ? ".h5" : "0.h5");
   if (file_system::check_if_file_exists(h5_file_name)) {
     file_system::rm(h5_file_name, true);
   }
@@ -150,6 +168,41 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
   // observer component by the RegisterWithObservers action.
   runner.invoke_queued_simple_action<obs_writer>(0);
   runner.invoke_queued_threaded_action<obs_writer>(0);
+  if (single_volume_file) {
+    // Create the datasets from the layout of the only node, write the data of
+    // the node and release the shared file.
+    for (size_t i = 0; i < 3; ++i) {
+      runner.invoke_queued_threaded_action<obs_writer>(0);
+    }
+    const auto& writer_box =
+        runner.algorithms<obs_writer>()
+            .at(0)
+            .get_databox<obs_writer::initial_databox>();
+    CHECK(db::get<observers::Tags::VolumeLayouts>(writer_box).empty());
+    CHECK(db::get<observers::Tags::VolumeLayoutsContributed>(writer_box)
+              .empty());
+    CHECK(db::get<observers::Tags::SharedVolumeFileQueue>(writer_box).empty());
+    CHECK(db::get<observers::Tags::TensorData>(writer_box).empty());
+  }
+  CHECK(runner.algorithms<obs_writer>()
+            .at(0)
+            .is_threaded_action_queue_empty());
+  // Wait for the I/O thread to write the file, as in the Exit phase
+  runner.threaded_action<obs_writer,
+                         observers::ThreadedActions::FlushVolumeWrites>(0);
+  const auto& write_queue = db::get<observers::Tags::VolumeWriteQueue>(
+      runner.algorithms<obs_writer>()
+          .at(0)
+          .get_databox<obs_writer::initial_databox>());
+  CHECK(write_queue->size() == 0);
+  if (single_volume_file) {
+    CHECK(write_queue->number_of_writes() == 0);
+  } else {
+    // Five elements with six tensor components of four points each
+    CHECK(write_queue->number_of_writes() == 1);
+    CHECK(write_queue->bytes_written() == 5 * 6 * 4 * sizeof(double));
+    CHECK(write_queue->max_size() == 1);
+  }
 
   // Check that the H5 file was written correctly.
   h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
@@ -157,6 +210,7 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
 
   const auto temporal_id = observers::ObservationId(TimeId(3)).hash();
   CHECK(volume_file.list_observation_ids() == std::vector<size_t>{temporal_id});
+  CHECK(volume_file.get_format_version(temporal_id) == 2);
   const auto grids = volume_file.list_grids(temporal_id);
   const std::vector<std::string> expected_grids(
       boost::make_transform_iterator(element_ids.begin(),
@@ -204,3 +258,133 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
     file_system::rm(h5_file_name, true);
   }
 }
+
+// A node without volume data sends an empty layout when asked for it, so
+// that the layout of the observation is completed, and no data is written if
+// no node has any.
+void test_empty_volume_layout() {
+  using TupleOfMockDistributedObjects =
+      typename ActionTesting::MockRuntimeSystem<
+          Metavariables>::TupleOfMockDistributedObjects;
+  using obs_writer = observer_writer_component<Metavariables>;
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+  using WriterMockDistributedObjectsTag =
+      typename MockRuntimeSystem::template MockDistributedObjectsTag<
+          obs_writer>;
+  TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<WriterMockDistributedObjectsTag>(dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<obs_writer>{});
+  MockRuntimeSystem::CacheTuple cache_data{};
+  const auto& output_file_prefix =
+      tuples::get<observers::OptionTags::VolumeFileName>(cache_data) =
+          "./Unit.IO.Observers.VolumeObserver.EmptyLayout";
+  tuples::get<observers::OptionTags::SingleVolumeFile>(cache_data) = true;
+  tuples::get<observers::OptionTags::VolumeWriteQueueCapacity>(cache_data) =
+      2;
+  MockRuntimeSystem runner{cache_data, std::move(dist_objects)};
+  runner.simple_action<obs_writer, observers::Actions::InitializeWriter>(0);
+  const auto& writer_box = runner.algorithms<obs_writer>()
+                               .at(0)
+                               .get_databox<obs_writer::initial_databox>();
+  const std::string h5_file_name = output_file_prefix + ".h5";
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+
+  // A node with volume data sends its layout once its data is complete
+  runner.simple_action<obs_writer,
+                       observers::Actions::RegisterVolumeObserverWithWriter>(
+      0);
+  CHECK(db::get<observers::Tags::VolumeObserversRegistered>(writer_box) == 1);
+  runner.threaded_action<
+      obs_writer, observers::ThreadedActions::ContributeEmptyVolumeLayout>(
+      0, observers::ObservationId(TimeId(3)));
+  CHECK(runner.algorithms<obs_writer>()
+            .at(0)
+            .is_threaded_action_queue_empty());
+
+  runner.simple_action<obs_writer,
+                       observers::Actions::DeregisterVolumeObserverWithWriter>(
+      0);
+  CHECK(db::get<observers::Tags::VolumeObserversRegistered>(writer_box) == 0);
+  runner.threaded_action<
+      obs_writer, observers::ThreadedActions::ContributeEmptyVolumeLayout>(
+      0, observers::ObservationId(TimeId(3)));
+  // Collect the empty layout and release the shared file without writing
+  for (size_t i = 0; i < 2; ++i) {
+    runner.invoke_queued_threaded_action<obs_writer>(0);
+  }
+  CHECK(runner.algorithms<obs_writer>()
+            .at(0)
+            .is_threaded_action_queue_empty());
+  CHECK(db::get<observers::Tags::VolumeLayouts>(writer_box).empty());
+  CHECK(db::get<observers::Tags::VolumeLayoutsContributed>(writer_box).empty());
+  CHECK(db::get<observers::Tags::SharedVolumeFileQueue>(writer_box).empty());
+  CHECK_FALSE(file_system::check_if_file_exists(h5_file_name));
+}
+
+// The program exits in the Exit phase while the I/O thread may still be
+// writing, so the writer has to wait for all queued writes.
+void test_flush_at_exit() {
+  using TupleOfMockDistributedObjects =
+      typename ActionTesting::MockRuntimeSystem<
+          Metavariables>::TupleOfMockDistributedObjects;
+  using obs_writer = observer_writer_component<Metavariables>;
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+  using WriterMockDistributedObjectsTag =
+      typename MockRuntimeSystem::template MockDistributedObjectsTag<
+          obs_writer>;
+  TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<WriterMockDistributedObjectsTag>(dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<obs_writer>{});
+  MockRuntimeSystem::CacheTuple cache_data{};
+  tuples::get<observers::OptionTags::VolumeFileName>(cache_data) =
+      "./Unit.IO.Observers.VolumeObserver.FlushAtExit";
+  tuples::get<observers::OptionTags::SingleVolumeFile>(cache_data) = false;
+  tuples::get<observers::OptionTags::VolumeWriteQueueCapacity>(cache_data) =
+      3;
+  MockRuntimeSystem runner{cache_data, std::move(dist_objects)};
+  runner.simple_action<obs_writer, observers::Actions::InitializeWriter>(0);
+
+  const auto& write_queue = db::get<observers::Tags::VolumeWriteQueue>(
+      runner.algorithms<obs_writer>()
+          .at(0)
+          .get_databox<obs_writer::initial_databox>());
+  // The disk is busy with the first write until it is released below, so all
+  // writes are still queued when the Exit phase starts.
+  std::promise<void> disk_ready{};
+  auto disk_ready_future = disk_ready.get_future().share();
+  std::atomic<size_t> number_of_writes{0};
+  write_queue->push(
+      [disk_ready_future, &number_of_writes]() noexcept {
+        disk_ready_future.wait();
+        ++number_of_writes;
+      },
+      16);
+  for (size_t i = 0; i < 2; ++i) {
+    write_queue->push([&number_of_writes]() noexcept { ++number_of_writes; },
+                      8);
+  }
+  CHECK(number_of_writes == 0);
+
+  std::thread disk([&disk_ready]() noexcept {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    disk_ready.set_value();
+  });
+  runner.threaded_action<obs_writer,
+                         observers::ThreadedActions::FlushVolumeWrites>(0);
+  CHECK(number_of_writes == 3);
+  CHECK(write_queue->size() == 0);
+  CHECK(write_queue->number_of_writes() == 3);
+  CHECK(write_queue->bytes_written() == 32);
+  CHECK(write_queue->max_size() == 3);
+  disk.join();
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeObserver", "[Unit][Observers]") {
+  test_volume_observer(false);
+  test_volume_observer(true);
+  test_empty_volume_layout();
+  test_flush_at_exit();
+}
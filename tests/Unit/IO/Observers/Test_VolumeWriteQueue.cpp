@@ -0,0 +1,98 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "IO/Observer/VolumeWriteQueue.hpp"
+#include "Parallel/PupStlCpp11.hpp"  // IWYU pragma: keep
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+void test_order_and_metrics() noexcept {
+  observers::VolumeWriteQueue queue{};
+  CHECK(queue.capacity() == 2);
+  CHECK(queue.size() == 0);
+  CHECK(queue.bandwidth() == 0.0);
+
+  std::vector<size_t> written{};
+  for (size_t i = 0; i < 5; ++i) {
+    queue.push(
+        [&written, i]() noexcept {
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          written.push_back(i);
+        },
+        100 * (i + 1));
+  }
+  queue.flush();
+  CHECK(written == std::vector<size_t>{0, 1, 2, 3, 4});
+  CHECK(queue.size() == 0);
+  CHECK(queue.max_size() <= 2);
+  CHECK(queue.number_of_writes() == 5);
+  CHECK(queue.bytes_written() == 1500);
+  CHECK(queue.write_time() > 0.0);
+  CHECK(queue.bandwidth() == approx(1500.0 / queue.write_time()));
+
+  const auto deserialized = serialize_and_deserialize(
+      std::make_unique<observers::VolumeWriteQueue>(3));
+  CHECK(deserialized->capacity() == 3);
+  CHECK(deserialized->number_of_writes() == 0);
+}
+
+void test_back_pressure() noexcept {
+  observers::VolumeWriteQueue queue{1};
+  std::promise<void> disk_ready{};
+  auto disk_ready_future = disk_ready.get_future().share();
+  std::atomic<size_t> number_of_writes{0};
+  queue.push(
+      [disk_ready_future, &number_of_writes]() noexcept {
+        disk_ready_future.wait();
+        ++number_of_writes;
+      },
+      8);
+
+  // The queue is full, so the next observation waits for the slow write
+  std::atomic<bool> pushed{false};
+  std::thread observer([&number_of_writes, &pushed, &queue]() noexcept {
+    queue.push([&number_of_writes]() noexcept { ++number_of_writes; }, 8);
+    pushed = true;
+  });
+  while (queue.number_of_blocked_pushes() == 0) {
+    std::this_thread::yield();
+  }
+  CHECK_FALSE(pushed);
+  CHECK(queue.size() == 1);
+
+  disk_ready.set_value();
+  observer.join();
+  CHECK(pushed);
+  queue.flush();
+  CHECK(number_of_writes == 2);
+  CHECK(queue.max_size() == 1);
+  CHECK(queue.number_of_blocked_pushes() == 1);
+}
+
+void test_destructor_finishes_writes() noexcept {
+  std::vector<size_t> written{};
+  {
+    observers::VolumeWriteQueue queue{3};
+    for (size_t i = 0; i < 3; ++i) {
+      queue.push([&written, i]() noexcept { written.push_back(i); }, 0);
+    }
+  }
+  CHECK(written == std::vector<size_t>{0, 1, 2});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.VolumeWriteQueue", "[Unit][Observers]") {
+  test_order_and_metrics();
+  test_back_pressure();
+  test_destructor_finishes_writes();
+}
@@ -0,0 +1,123 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/OutputSettings.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+void test_tensor_output_settings() noexcept {
+  const h5::TensorOutputSettings lossless{};
+  CHECK(lossless.deflate_level() == 0);
+  CHECK_FALSE(lossless.shuffle());
+  CHECK_FALSE(lossless.single_precision());
+  CHECK(lossless.mantissa_bits() == 52);
+  CHECK_FALSE(lossless.rounds_mantissa());
+  CHECK_FALSE(lossless.uses_filters());
+
+  const h5::TensorOutputSettings compressed{6, true, false, 52};
+  CHECK(compressed.uses_filters());
+  CHECK_FALSE(compressed.rounds_mantissa());
+  CHECK(h5::TensorOutputSettings{0, true, false, 52}.uses_filters());
+
+  // Single precision keeps at most the 23 bits of a float mantissa
+  const h5::TensorOutputSettings single_precision{0, false, true, 52};
+  CHECK(single_precision.mantissa_bits() == 23);
+  CHECK_FALSE(single_precision.rounds_mantissa());
+  CHECK(single_precision == h5::TensorOutputSettings{0, false, true, 23});
+  const h5::TensorOutputSettings rounded{0, false, true, 12};
+  CHECK(rounded.mantissa_bits() == 12);
+  CHECK(rounded.rounds_mantissa());
+  CHECK(h5::TensorOutputSettings{0, false, false, 30}.rounds_mantissa());
+
+  CHECK(lossless != compressed);
+  CHECK(rounded != single_precision);
+  CHECK(serialize_and_deserialize(rounded) == rounded);
+  CHECK(get_output(compressed) ==
+        "(DeflateLevel: 6, Shuffle: true, SinglePrecision: false, "
+        "MantissaBits: 52)");
+
+  CHECK(test_creation<h5::TensorOutputSettings>("  DeflateLevel: 6\n"
+                                                "  Shuffle: true") ==
+        compressed);
+  CHECK(test_creation<h5::TensorOutputSettings>("  SinglePrecision: true\n"
+                                                "  MantissaBits: 12") ==
+        rounded);
+}
+
+void test_volume_output_settings() noexcept {
+  const h5::TensorOutputSettings compressed{6, true, false, 52};
+  const h5::TensorOutputSettings single_precision{0, false, true, 23};
+  const h5::TensorOutputSettings rounded{1, true, true, 12};
+  const h5::VolumeOutputSettings settings{
+      compressed, {{"T", single_precision}, {"T_x", rounded}}};
+  CHECK(settings("S") == compressed);
+  CHECK(settings("T") == single_precision);
+  CHECK(settings("T_y") == single_precision);
+  CHECK(settings("T_x") == rounded);
+  CHECK(settings("U_x") == compressed);
+  CHECK(settings("SpatialMetric_xy") == compressed);
+
+  CHECK(h5::VolumeOutputSettings{}("T_x") == h5::TensorOutputSettings{});
+  CHECK(settings != h5::VolumeOutputSettings{});
+  CHECK(serialize_and_deserialize(settings) == settings);
+
+  CHECK(test_creation<h5::VolumeOutputSettings>(
+            "  Default:\n"
+            "    DeflateLevel: 6\n"
+            "    Shuffle: true\n"
+            "  Tensors:\n"
+            "    T:\n"
+            "      SinglePrecision: true\n"
+            "    T_x:\n"
+            "      DeflateLevel: 1\n"
+            "      Shuffle: true\n"
+            "      SinglePrecision: true\n"
+            "      MantissaBits: 12") == settings);
+}
+
+void test_round_mantissa() noexcept {
+  const double infinity = std::numeric_limits<double>::infinity();
+  DataVector data{1.0 + std::pow(2.0, -20),
+                  -(1.0 + std::pow(2.0, -20)),
+                  1.0 + std::pow(2.0, -10) + std::pow(2.0, -12),
+                  1.0 + std::pow(2.0, -11),
+                  2.0 - std::pow(2.0, -30),
+                  0.0,
+                  infinity,
+                  std::numeric_limits<double>::signaling_NaN()};
+  h5::round_mantissa(make_not_null(&data), 10);
+  CHECK(data[0] == 1.0);
+  CHECK(data[1] == -1.0);
+  CHECK(data[2] == 1.0 + std::pow(2.0, -10));
+  // Values halfway between two representable values are rounded up in
+  // magnitude
+  CHECK(data[3] == 1.0 + std::pow(2.0, -10));
+  // Rounding up carries into the exponent
+  CHECK(data[4] == 2.0);
+  CHECK(data[5] == 0.0);
+  CHECK(data[6] == infinity);
+  CHECK(std::isnan(data[7]));
+
+  // Keeping all bits of the mantissa leaves the values unchanged
+  const DataVector unchanged{1.0 + std::pow(2.0, -52), 0.1};
+  DataVector kept = unchanged;
+  h5::round_mantissa(make_not_null(&kept), 52);
+  CHECK(kept == unchanged);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.OutputSettings", "[Unit][IO][H5]") {
+  test_tensor_output_settings();
+  test_volume_output_settings();
+  test_round_mantissa();
+}
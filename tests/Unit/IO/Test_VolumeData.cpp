@@ -6,16 +6,20 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TensorData.hpp"
 #include "ErrorHandling/Error.hpp"
+#include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/File.hpp"
+#include "IO/H5/OutputSettings.hpp"
 #include "IO/H5/VolumeData.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
 
 SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   const std::string h5_file_name("Unit.IO.H5.VolumeData.h5");
@@ -126,6 +130,342 @@ SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData", "[Unit][IO][H5]") {
   }
 }
 
+namespace {
+ExtentsAndTensorVolumeData make_grid_data(const std::string& grid,
+                                          const std::vector<size_t>& extents,
+                                          const double factor) noexcept {
+  const size_t number_of_points = extents[0] * extents[1];
+  DataVector s(number_of_points);
+  DataVector t_x(number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    s[i] = factor * static_cast<double>(i + 1);
+    t_x[i] = -factor * static_cast<double>(i + 1);
+  }
+  return ExtentsAndTensorVolumeData(
+      extents, {TensorComponent{grid + "/S", std::move(s)},
+                TensorComponent{grid + "/T_x", std::move(t_x)}});
+}
+
+std::vector<long> expected_connectivity(
+    const std::vector<std::vector<size_t>>& all_extents) noexcept {
+  std::vector<long> connectivity{};
+  size_t offset = 0;
+  for (const auto& extents : all_extents) {
+    for (const auto& cell : vis::detail::compute_cells(extents)) {
+      for (const auto& bounding_index : cell.bounding_indices) {
+        connectivity.push_back(static_cast<long>(offset + bounding_index));
+      }
+    }
+    offset += extents[0] * extents[1];
+  }
+  return connectivity;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.Contiguous", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.Contiguous.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> grids{"[[2,3,4]]", "[[7,3,8]]"};
+  const std::vector<std::vector<size_t>> extents{{2, 3}, {3, 2}};
+  const size_t contiguous_id = 100;
+  const size_t per_grid_id = 200;
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    auto& volume_file =
+        my_file.insert<h5::VolumeData>("/element_data", version_number);
+    volume_file.write_volume_data(
+        contiguous_id, 1.5,
+        {make_grid_data(grids[0], extents[0], 1.),
+         make_grid_data(grids[1], extents[1], 2.)});
+    // Observations in the per-grid format can be written to the same file
+    volume_file.insert_tensor_data(per_grid_id, 2.5,
+                                   make_grid_data(grids[0], extents[0], 3.));
+  }
+
+  h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+  const auto& volume_file =
+      my_file.get<h5::VolumeData>("/element_data", version_number);
+  CHECK(volume_file.get_format_version(contiguous_id) == 2);
+  CHECK(volume_file.get_format_version(per_grid_id) == 1);
+  CHECK(volume_file.get_observation_value(contiguous_id) == 1.5);
+  CHECK(volume_file.list_grids(contiguous_id) == grids);
+  CHECK(volume_file.get_offsets(contiguous_id) == std::vector<size_t>{0, 6});
+  CHECK(volume_file.get_connectivity(contiguous_id) ==
+        expected_connectivity(extents));
+  CHECK(volume_file.get_tensor_component(contiguous_id, "S") ==
+        DataVector{1., 2., 3., 4., 5., 6., 2., 4., 6., 8., 10., 12.});
+  for (size_t i = 0; i < grids.size(); ++i) {
+    const auto expected =
+        make_grid_data(grids[i], extents[i], static_cast<double>(i + 1));
+    CHECK(volume_file.get_extents(contiguous_id, grids[i]) == extents[i]);
+    CHECK(volume_file.list_tensor_components(contiguous_id, grids[i]) ==
+          std::vector<std::string>{"S", "T_x"});
+    CHECK(volume_file.get_tensor_component(contiguous_id, grids[i], "S") ==
+          expected.tensor_components[0].data);
+    CHECK(volume_file.get_tensor_component(contiguous_id, grids[i], "T_x") ==
+          expected.tensor_components[1].data);
+  }
+  CHECK(volume_file.list_grids(per_grid_id) ==
+        std::vector<std::string>{grids[0]});
+  CHECK(volume_file.get_tensor_component(per_grid_id, grids[0], "S") ==
+        make_grid_data(grids[0], extents[0], 3.).tensor_components[0].data);
+  // Reading the first observation again after the second
+  CHECK(volume_file.get_extents(contiguous_id, grids[1]) == extents[1]);
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ContiguousCreateThenWrite",
+                  "[Unit][IO][H5]") {
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.ContiguousCreateThenWrite.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> grids{"A", "B", "C"};
+  const std::vector<std::vector<size_t>> extents{{2, 2}, {3, 2}, {2, 3}};
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    auto& volume_file =
+        my_file.insert<h5::VolumeData>("/element_data", version_number);
+    // The layout of all grids is known first, as on the first writer of a
+    // shared file, and the data is written by two writers
+    std::vector<std::pair<std::vector<size_t>, std::vector<std::string>>>
+        layout{};
+    for (size_t i = 0; i < grids.size(); ++i) {
+      layout.emplace_back(extents[i], std::vector<std::string>{
+                                          grids[i] + "/S", grids[i] + "/T_x"});
+    }
+    volume_file.create_contiguous_datasets(7, 0.5, layout);
+    auto last_grid = make_grid_data(grids[2], extents[2], 3.);
+    // The order of the components does not matter
+    std::swap(last_grid.tensor_components[0], last_grid.tensor_components[1]);
+    volume_file.write_contiguous_data(
+        7, 4, {make_grid_data(grids[1], extents[1], 2.), last_grid});
+    volume_file.write_contiguous_data(
+        7, 0, {make_grid_data(grids[0], extents[0], 1.)});
+  }
+  h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+  const auto& volume_file =
+      my_file.get<h5::VolumeData>("/element_data", version_number);
+  CHECK(volume_file.get_offsets(7) == std::vector<size_t>{0, 4, 10});
+  CHECK(volume_file.get_connectivity(7) == expected_connectivity(extents));
+  for (size_t i = 0; i < grids.size(); ++i) {
+    const auto expected =
+        make_grid_data(grids[i], extents[i], static_cast<double>(i + 1));
+    CHECK(volume_file.get_tensor_component(7, grids[i], "S") ==
+          expected.tensor_components[0].data);
+    CHECK(volume_file.get_tensor_component(7, grids[i], "T_x") ==
+          expected.tensor_components[1].data);
+  }
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ContiguousMerge", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.ContiguousMerge.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> grids{"A", "B", "C"};
+  const std::vector<std::vector<size_t>> extents{{2, 2}, {3, 2}, {2, 3}};
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    auto& volume_file =
+        my_file.insert<h5::VolumeData>("/element_data", version_number);
+    volume_file.write_volume_data(3, 1.5,
+                                  {make_grid_data(grids[0], extents[0], 1.)});
+    // Writing the observation again merges the grids, with the new grids
+    // first
+    volume_file.write_volume_data(3, 2.5,
+                                  {make_grid_data(grids[1], extents[1], 2.),
+                                   make_grid_data(grids[2], extents[2], 3.)});
+  }
+  h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+  const auto& volume_file =
+      my_file.get<h5::VolumeData>("/element_data", version_number);
+  CHECK(volume_file.list_observation_ids() == std::vector<size_t>{3});
+  CHECK(volume_file.get_observation_value(3) == 1.5);
+  CHECK(volume_file.list_grids(3) ==
+        std::vector<std::string>{grids[1], grids[2], grids[0]});
+  CHECK(volume_file.get_offsets(3) == std::vector<size_t>{0, 6, 12});
+  CHECK(volume_file.get_connectivity(3) ==
+        expected_connectivity({extents[1], extents[2], extents[0]}));
+  for (size_t i = 0; i < grids.size(); ++i) {
+    const auto expected =
+        make_grid_data(grids[i], extents[i], static_cast<double>(i + 1));
+    CHECK(volume_file.get_extents(3, grids[i]) == extents[i]);
+    CHECK(volume_file.get_tensor_component(3, grids[i], "S") ==
+          expected.tensor_components[0].data);
+    CHECK(volume_file.get_tensor_component(3, grids[i], "T_x") ==
+          expected.tensor_components[1].data);
+  }
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.OutputSettings", "[Unit][IO][H5]") {
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.OutputSettings.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const std::vector<std::string> grids{"A", "B"};
+  const std::vector<std::vector<size_t>> extents{{4, 5}, {5, 3}};
+  const h5::TensorOutputSettings lossless{4, true, false, 52};
+  const h5::TensorOutputSettings lossy{1, true, true, 10};
+  const h5::TensorOutputSettings single_precision{0, false, true, 23};
+  {
+    h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+    auto& volume_file =
+        my_file.insert<h5::VolumeData>("/element_data", version_number);
+    volume_file.write_volume_data(
+        0, 0.5,
+        {make_grid_data(grids[0], extents[0], 0.1),
+         make_grid_data(grids[1], extents[1], 0.2)},
+        h5::VolumeOutputSettings{lossless, {{"T", lossy}}});
+    volume_file.write_volume_data(
+        1, 1.5, {make_grid_data(grids[0], extents[0], 0.1)},
+        h5::VolumeOutputSettings{single_precision, {}});
+  }
+
+  h5::H5File<h5::AccessType::ReadOnly> my_file(h5_file_name);
+  const auto& volume_file =
+      my_file.get<h5::VolumeData>("/element_data", version_number);
+  CHECK(volume_file.get_output_settings(0, "S") == lossless);
+  CHECK(volume_file.get_output_settings(0, "T_x") == lossy);
+  CHECK(volume_file.get_output_settings(1, "S") == single_precision);
+  for (size_t i = 0; i < grids.size(); ++i) {
+    auto expected = make_grid_data(grids[i], extents[i],
+                                   0.1 * static_cast<double>(i + 1));
+    // Lossless compression reproduces the values, and the lossy settings
+    // round the values to a mantissa that a float holds exactly
+    CHECK(volume_file.get_tensor_component(0, grids[i], "S") ==
+          expected.tensor_components[0].data);
+    h5::round_mantissa(make_not_null(&expected.tensor_components[1].data),
+                       10);
+    CHECK(volume_file.get_tensor_component(0, grids[i], "T_x") ==
+          expected.tensor_components[1].data);
+  }
+  const auto expected = make_grid_data(grids[0], extents[0], 0.1);
+  Approx float_approx = Approx::custom().epsilon(1.0e-7).scale(1.0);
+  CHECK_ITERABLE_CUSTOM_APPROX(
+      volume_file.get_tensor_component(1, grids[0], "S"),
+      expected.tensor_components[0].data, float_approx);
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
+// [[OutputRegex, The dataset 'S' holds 2 points but the data to write has 3
+// points at offset 0.]]
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.WriteWrongSize", "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string h5_file_name("Unit.IO.H5.VolumeData.WriteWrongSize.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+  auto& volume_file =
+      my_file.insert<h5::VolumeData>("/element_data", version_number);
+  volume_file.create_contiguous_datasets(
+      100, 10.0, {{{2}, std::vector<std::string>{"A/S"}}});
+  volume_file.write_contiguous_data(
+      100, 0, {ExtentsAndTensorVolumeData(
+                  {3}, {TensorComponent{"A/S", {1.0, 2.0, 3.0}}})});
+}
+
+// [[OutputRegex, All grids in the observation 'ObservationId100' must have the
+// same dimension and tensor components, but the grid 'B' differs from 'A'.]]
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ContiguousDifferentComponents",
+                  "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.ContiguousDifferentComponents.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+  auto& volume_file =
+      my_file.insert<h5::VolumeData>("/element_data", version_number);
+  volume_file.write_volume_data(
+      100, 10.0,
+      {ExtentsAndTensorVolumeData({2}, {TensorComponent{"A/S", {1.0, 2.0}}}),
+       ExtentsAndTensorVolumeData({2}, {TensorComponent{"B/T", {1.0, 2.0}}})});
+}
+
+// [[OutputRegex, Trying to write the grid 'A' which already exists in HDF5
+// file in group 'element_data.vol/ObservationId100'.]]
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ContiguousWriteTwice",
+                  "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.ContiguousWriteTwice.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+  auto& volume_file =
+      my_file.insert<h5::VolumeData>("/element_data", version_number);
+  const std::vector<ExtentsAndTensorVolumeData> grids{
+      ExtentsAndTensorVolumeData({2}, {TensorComponent{"A/S", {1.0, 2.0}}})};
+  volume_file.write_volume_data(100, 10.0, grids);
+  volume_file.write_volume_data(100, 10.0, grids);
+}
+
+// [[OutputRegex, Cannot merge grids into the observation 'ObservationId100' in
+// HDF5 file in group 'element_data.vol', which is not in the contiguous
+// format.]]
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ContiguousMergeIntoPerGrid",
+                  "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.ContiguousMergeIntoPerGrid.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+  auto& volume_file =
+      my_file.insert<h5::VolumeData>("/element_data", version_number);
+  volume_file.insert_tensor_data(
+      100, 10.0,
+      ExtentsAndTensorVolumeData({2}, {TensorComponent{"A/S", {1.0, 2.0}}}));
+  volume_file.write_volume_data(
+      100, 10.0,
+      {ExtentsAndTensorVolumeData({2}, {TensorComponent{"B/S", {1.0, 2.0}}})});
+}
+
+// [[OutputRegex, Could not find the grid 'B' at observation id 100]]
+SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ContiguousMissingGrid",
+                  "[Unit][IO][H5]") {
+  ERROR_TEST();
+  const std::string h5_file_name(
+      "Unit.IO.H5.VolumeData.ContiguousMissingGrid.h5");
+  const uint32_t version_number = 4;
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  h5::H5File<h5::AccessType::ReadWrite> my_file(h5_file_name);
+  auto& volume_file =
+      my_file.insert<h5::VolumeData>("/element_data", version_number);
+  volume_file.write_volume_data(
+      100, 10.0,
+      {ExtentsAndTensorVolumeData({2}, {TensorComponent{"A/S", {1.0, 2.0}}})});
+  volume_file.get_extents(100, "B");
+}
+
 // [[OutputRegex, The expected format of the tensor component names is
 // 'GROUP_NAME/COMPONENT_NAME' but could not find a '/' in]]
 [[noreturn]] SPECTRE_TEST_CASE("Unit.IO.H5.VolumeData.ComponentFormat0",
@@ -0,0 +1,243 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Direction.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/ElementIndex.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/AggregateFluxes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/FluxCommunication.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+
+namespace {
+struct TemporalId : db::SimpleTag {
+  static std::string name() noexcept { return "TemporalId"; }
+  using type = int;
+};
+
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = Scalar<DataVector>;
+};
+
+struct NumericalFluxTag {
+  struct type {
+    using package_tags = tmpl::list<Var>;
+  };
+};
+
+struct System {
+  static constexpr const size_t volume_dim = 1;
+  using variables_tag = Tags::Variables<tmpl::list<Var>>;
+};
+
+template <typename Metavariables>
+struct element_component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementIndex<1>;
+  using const_global_cache_tag_list = tmpl::list<>;
+  using action_list =
+      tmpl::list<dg::Actions::ReceiveDataForFluxes<Metavariables>>;
+  using initial_databox = db::DataBox<tmpl::list<>>;
+};
+
+template <typename Metavariables>
+struct aggregator_component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = size_t;
+  using const_global_cache_tag_list =
+      tmpl::list<OptionTags::AggregateFluxMessages,
+                 OptionTags::FluxMessageStatisticsInterval>;
+  using action_list = tmpl::list<>;
+  using simple_tags = typename dg::Actions::InitializeFluxAggregator<
+      Metavariables>::simple_tags;
+  using initial_databox = db::compute_databox_type<simple_tags>;
+};
+
+struct Metavariables {
+  using system = System;
+  using temporal_id = TemporalId;
+  using normal_dot_numerical_flux = NumericalFluxTag;
+  using component_list = tmpl::list<element_component<Metavariables>,
+                                    aggregator_component<Metavariables>>;
+  using const_global_cache_tag_list = tmpl::list<>;
+};
+
+using flux_comm_types = dg::FluxCommunicationTypes<Metavariables>;
+using fluxes_tag = flux_comm_types::FluxesTag;
+using element_comp = element_component<Metavariables>;
+using aggregator_comp = aggregator_component<Metavariables>;
+using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+
+flux_comm_types::PackagedData packaged_data(const double value) noexcept {
+  flux_comm_types::PackagedData result(2, value);
+  return result;
+}
+
+void test_receive_aggregated_fluxes() noexcept {
+  const ElementId<1> sender_id(0, {{{2, 1}}});
+  const ElementId<1> lower_id(0, {{{2, 0}}});
+  const ElementId<1> upper_id(0, {{{2, 2}}});
+  const ElementId<1> other_id(0, {{{2, 3}}});
+
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  for (const auto& id : {lower_id, upper_id, other_id}) {
+    tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<element_comp>>(
+        dist_objects)
+        .emplace(ElementIndex<1>(id),
+                 ActionTesting::MockDistributedObject<element_comp>{});
+  }
+  tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<aggregator_comp>>(
+      dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<aggregator_comp>{});
+  MockRuntimeSystem runner{{true, size_t{0}}, std::move(dist_objects)};
+  runner.simple_action<aggregator_comp,
+                       dg::Actions::InitializeFluxAggregator<Metavariables>>(
+      0);
+
+  flux_comm_types::AggregatedFluxes fluxes{};
+  fluxes.emplace_back(
+      lower_id, std::make_pair(std::make_pair(Direction<1>::upper_xi(),
+                                              sender_id),
+                               std::make_pair(4, packaged_data(1.))));
+  fluxes.emplace_back(
+      upper_id, std::make_pair(std::make_pair(Direction<1>::lower_xi(),
+                                              sender_id),
+                               std::make_pair(5, packaged_data(2.))));
+  runner.algorithms<aggregator_comp>()
+      .at(0)
+      .threaded_action<dg::ThreadedActions::ReceiveAggregatedFluxes<
+          element_comp>>(std::make_tuple(3, std::move(fluxes)), true);
+
+  CHECK(runner.nonempty_inboxes<element_comp, fluxes_tag>() ==
+        std::unordered_set<ElementIndex<1>>{lower_id, upper_id});
+  const auto check_inbox = [&runner, &sender_id](
+      const ElementId<1>& id, const Direction<1>& direction,
+      const int next_temporal_id, const double value) noexcept {
+    const auto& inbox =
+        tuples::get<fluxes_tag>(runner.inboxes<element_comp>().at(id));
+    REQUIRE(inbox.size() == 1);
+    REQUIRE(inbox.count(3, {direction, sender_id}) == 1);
+    const auto& data = inbox.at(3, {direction, sender_id});
+    CHECK(data.first == next_temporal_id);
+    CHECK(data.second == packaged_data(value));
+  };
+  check_inbox(lower_id, Direction<1>::upper_xi(), 4, 1.);
+  check_inbox(upper_id, Direction<1>::lower_xi(), 5, 2.);
+}
+
+void test_record_flux_messages() noexcept {
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<aggregator_comp>>(
+      dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<aggregator_comp>{});
+  MockRuntimeSystem runner{{false, size_t{2}}, std::move(dist_objects)};
+  runner.simple_action<aggregator_comp,
+                       dg::Actions::InitializeFluxAggregator<Metavariables>>(
+      0);
+
+  runner.simple_action<aggregator_comp, dg::Actions::RecordFluxMessages>(
+      0, 0, size_t{1}, size_t{2});
+  runner.simple_action<aggregator_comp, dg::Actions::RecordFluxMessages>(
+      0, 0, size_t{2}, size_t{2});
+  runner.simple_action<aggregator_comp, dg::Actions::RecordFluxMessages>(
+      0, 1, size_t{1}, size_t{2});
+
+  const auto& statistics =
+      db::get<Tags::FluxMessageStatistics<int>>(
+          runner.algorithms<aggregator_comp>()
+              .at(0)
+              .get_databox<typename aggregator_comp::initial_databox>());
+  CHECK(statistics.number_of_messages() == 4);
+  CHECK(statistics.number_of_mortars() == 6);
+  CHECK(statistics.number_of_steps() == 2);
+}
+
+// With both options enabled the receivers of an aggregated message record
+// their own messages on the aggregator that delivered it, so the delivery
+// must not hold the node lock.
+void test_aggregation_with_statistics() noexcept {
+  const ElementId<1> sender_id(0, {{{2, 1}}});
+  const ElementId<1> lower_id(0, {{{2, 0}}});
+  const ElementId<1> upper_id(0, {{{2, 2}}});
+
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  for (const auto& id : {lower_id, upper_id}) {
+    tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<element_comp>>(
+        dist_objects)
+        .emplace(ElementIndex<1>(id),
+                 ActionTesting::MockDistributedObject<element_comp>{});
+  }
+  tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<aggregator_comp>>(
+      dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<aggregator_comp>{});
+  MockRuntimeSystem runner{{true, size_t{1}}, std::move(dist_objects)};
+  runner.simple_action<aggregator_comp,
+                       dg::Actions::InitializeFluxAggregator<Metavariables>>(
+      0);
+  auto& aggregator = runner.algorithms<aggregator_comp>().at(0);
+
+  // The sender records its aggregated message after sending it.
+  flux_comm_types::AggregatedFluxes fluxes{};
+  fluxes.emplace_back(
+      lower_id, std::make_pair(std::make_pair(Direction<1>::upper_xi(),
+                                              sender_id),
+                               std::make_pair(4, packaged_data(1.))));
+  fluxes.emplace_back(
+      upper_id, std::make_pair(std::make_pair(Direction<1>::lower_xi(),
+                                              sender_id),
+                               std::make_pair(4, packaged_data(2.))));
+  aggregator.threaded_action<
+      dg::ThreadedActions::ReceiveAggregatedFluxes<element_comp>>(
+      std::make_tuple(3, std::move(fluxes)));
+  aggregator.simple_action<dg::Actions::RecordFluxMessages>(
+      std::make_tuple(3, size_t{1}, size_t{2}));
+
+  runner.invoke_queued_threaded_action<aggregator_comp>(0);
+  CHECK(runner.nonempty_inboxes<element_comp, fluxes_tag>() ==
+        std::unordered_set<ElementIndex<1>>{lower_id, upper_id});
+
+  // The receivers continue and record their own messages on the same
+  // aggregator while the delivery may still be running.
+  for (size_t i = 0; i < 2; ++i) {
+    aggregator.simple_action<dg::Actions::RecordFluxMessages>(
+        std::make_tuple(4, size_t{1}, size_t{1}));
+  }
+  for (size_t i = 0; i < 3; ++i) {
+    runner.invoke_queued_simple_action<aggregator_comp>(0);
+  }
+
+  const auto& statistics = db::get<Tags::FluxMessageStatistics<int>>(
+      aggregator.get_databox<typename aggregator_comp::initial_databox>());
+  CHECK(statistics.number_of_messages() == 3);
+  CHECK(statistics.number_of_mortars() == 4);
+  CHECK(statistics.number_of_steps() == 2);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.Actions.AggregateFluxes",
+                  "[Unit][NumericalAlgorithms][Actions]") {
+  test_receive_aggregated_fluxes();
+  test_record_flux_messages();
+  test_aggregation_with_statistics();
+}
@@ -416,9 +416,7 @@ SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.Actions.FluxCommunication",
           tuples::get<fluxes_tag<flux_comm_types<2>>>(inboxes.at(id));
       CHECK(flux_inbox.size() == 1);
       CHECK(flux_inbox.count(0) == 1);
-      const auto& flux_inbox_at_time = flux_inbox.at(0);
-      CHECK(flux_inbox_at_time.size() == 1);
-      CHECK(flux_inbox_at_time.count({direction, self_id}) == 1);
+      CHECK(flux_inbox.count(0, {direction, self_id}) == 1);
     };
     check_sent_data(west_id, Direction<2>::lower_eta());
     check_sent_data(east_id, Direction<2>::lower_xi());
@@ -717,7 +715,7 @@ SPECTRE_TEST_CASE(
         runner.inboxes<my_component>().at(neighbor_id));
 
     const auto& received_flux =
-        inbox.at(0).at({Direction<3>::upper_xi(), self_id}).second;
+        inbox.at(0, {Direction<3>::upper_xi(), self_id}).second;
     CHECK_ITERABLE_APPROX(
         get<Var>(received_flux),
         get<Var>(packaged_data(flux(get<1>(rotated_mortar_coords),
@@ -863,7 +861,7 @@ SPECTRE_TEST_CASE(
           runner.inboxes<my_component>().at(neighbor_id));
 
       const auto& received_flux =
-          inbox.at(0).at({Direction<2>::lower_xi(), self_id}).second;
+          inbox.at(0, {Direction<2>::lower_xi(), self_id}).second;
       // The interface has an inverting orientation.
       CHECK_ITERABLE_APPROX(
           get<Var>(received_flux),
@@ -0,0 +1,237 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+// IWYU pragma: no_include <unordered_map>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Direction.hpp"
+#include "Domain/ElementId.hpp"
+#include "Domain/ElementIndex.hpp"  // IWYU pragma: keep
+#include "Domain/Mesh.hpp"
+#include "Domain/Tags.hpp"  // IWYU pragma: keep
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Actions/ReceiveAndApplyBoundaryFluxes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxCommunicationTypes.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/SimpleBoundaryData.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+
+/// \cond
+// IWYU pragma: no_forward_declare db::DataBox
+// IWYU pragma: no_forward_declare Tensor
+// IWYU pragma: no_forward_declare Variables
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace {
+struct TemporalId : db::SimpleTag {
+  static std::string name() noexcept { return "TemporalId"; }
+  using type = int;
+};
+
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = Scalar<DataVector>;
+};
+
+class NumericalFlux {
+ public:
+  using package_tags = tmpl::list<Var>;
+
+  void operator()(const gsl::not_null<Scalar<DataVector>*> numerical_flux_var,
+                  const Scalar<DataVector>& var_local,
+                  const Scalar<DataVector>& var_remote) const {
+    get(*numerical_flux_var) = 10. * get(var_local) + 1000. * get(var_remote);
+  }
+
+  // clang-tidy: do not use references
+  void pup(PUP::er& /*p*/) noexcept {}  // NOLINT
+};
+
+struct NumericalFluxTag {
+  using type = NumericalFlux;
+};
+
+struct System {
+  static constexpr const size_t volume_dim = 2;
+  using variables_tag = Tags::Variables<tmpl::list<Var>>;
+};
+
+using mortar_next_temporal_ids_tag = Tags::Mortars<Tags::Next<TemporalId>, 2>;
+using mortar_meshes_tag = Tags::Mortars<Tags::Mesh<1>, 2>;
+using mortar_sizes_tag = Tags::Mortars<Tags::MortarSize<1>, 2>;
+using dt_variables_tag = Tags::dt<Tags::Variables<tmpl::list<Tags::dt<Var>>>>;
+
+template <typename Metavariables>
+using simple_tags = db::AddSimpleTags<
+    Tags::Next<TemporalId>, Tags::Mesh<2>, mortar_next_temporal_ids_tag,
+    mortar_meshes_tag, mortar_sizes_tag, dt_variables_tag,
+    typename dg::FluxCommunicationTypes<Metavariables>::simple_mortar_data_tag>;
+
+struct ActionAfterReceive {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    return std::forward_as_tuple(std::move(box));
+  }
+};
+
+template <typename Metavariables>
+struct component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementIndex<2>;
+  using const_global_cache_tag_list = tmpl::list<NumericalFluxTag>;
+  using action_list =
+      tmpl::list<dg::Actions::ReceiveAndApplyBoundaryFluxes<Metavariables>,
+                 ActionAfterReceive>;
+  using initial_databox =
+      db::compute_databox_type<simple_tags<Metavariables>>;
+};
+
+struct Metavariables {
+  using system = System;
+  using component_list = tmpl::list<component<Metavariables>>;
+  using temporal_id = TemporalId;
+  static constexpr bool local_time_stepping = false;
+  using const_global_cache_tag_list = tmpl::list<>;
+
+  using normal_dot_numerical_flux = NumericalFluxTag;
+};
+
+using flux_comm_types = dg::FluxCommunicationTypes<Metavariables>;
+using mortar_data_tag = flux_comm_types::simple_mortar_data_tag;
+using fluxes_tag = flux_comm_types::FluxesTag;
+using my_component = component<Metavariables>;
+using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DG.Actions.ReceiveAndApplyBoundaryFluxes",
+                  "[Unit][NumericalAlgorithms][Actions]") {
+  using LocalData = flux_comm_types::LocalData;
+  using PackagedData = flux_comm_types::PackagedData;
+
+  const Mesh<2> mesh{3, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const ElementId<2> id(0);
+  const auto xi_mortar = std::make_pair(Direction<2>::upper_xi(),
+                                        ElementId<2>(1));
+  const auto eta_mortar = std::make_pair(Direction<2>::lower_eta(),
+                                         ElementId<2>(2));
+
+  const auto make_local_data = [](
+      const Scalar<DataVector>& local_var, const Scalar<DataVector>& local_flux,
+      const Scalar<DataVector>& local_magnitude_face_normal) noexcept {
+    dg::SimpleBoundaryData<int, LocalData, PackagedData> data;
+    LocalData local_data{};
+    local_data.mortar_data.initialize(3);
+    get<Tags::NormalDotFlux<Var>>(local_data.mortar_data) = local_flux;
+    get<Var>(local_data.mortar_data) = local_var;
+    local_data.magnitude_of_face_normal = local_magnitude_face_normal;
+    data.local_insert(0, std::move(local_data));
+    return data;
+  };
+  const auto make_remote_data = [](
+      const Scalar<DataVector>& remote_var) noexcept {
+    PackagedData remote_data(3);
+    get<Var>(remote_data) = remote_var;
+    return remote_data;
+  };
+
+  const Variables<tmpl::list<Tags::dt<Var>>> initial_dt(
+      mesh.number_of_grid_points(), 5.);
+
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockRuntimeSystem::MockDistributedObjectsTag<my_component>>(
+      dist_objects)
+      .emplace(
+          id,
+          db::create<simple_tags<Metavariables>>(
+              1, mesh,
+              db::item_type<mortar_next_temporal_ids_tag>{{xi_mortar, 0},
+                                                          {eta_mortar, 0}},
+              db::item_type<mortar_meshes_tag>{
+                  {xi_mortar, mesh.slice_away(0)},
+                  {eta_mortar, mesh.slice_away(1)}},
+              db::item_type<mortar_sizes_tag>{
+                  {xi_mortar, {{Spectral::MortarSize::Full}}},
+                  {eta_mortar, {{Spectral::MortarSize::Full}}}},
+              initial_dt,
+              db::item_type<mortar_data_tag>{
+                  {xi_mortar,
+                   make_local_data(Scalar<DataVector>{{{{1., 2., 3.}}}},
+                                   Scalar<DataVector>{{{{-1., -3., -5.}}}},
+                                   Scalar<DataVector>{{{{2., 2., 2.}}}})},
+                  {eta_mortar,
+                   make_local_data(Scalar<DataVector>{{{{4., 5., 6.}}}},
+                                   Scalar<DataVector>{{{{-2., -4., -6.}}}},
+                                   Scalar<DataVector>{{{{3., 3., 3.}}}})}}));
+  MockRuntimeSystem runner{{NumericalFlux{}}, std::move(dist_objects)};
+  const auto get_dt = [&runner, &id]() noexcept {
+    return get(db::get<Tags::dt<Var>>(
+        runner.algorithms<my_component>()
+            .at(id)
+            .get_databox<my_component::initial_databox>()));
+  };
+  auto& inbox = tuples::get<fluxes_tag>(runner.inboxes<my_component>()[id]);
+
+  CHECK_FALSE(runner.is_ready<my_component>(id));
+  inbox.insert(0, xi_mortar, 1,
+               make_remote_data(Scalar<DataVector>{{{{7., 8., 9.}}}}));
+  CHECK(runner.is_ready<my_component>(id));
+
+  // Only the flux on the mortar that received data is lifted, and the action
+  // repeats to wait for the other mortar.
+  runner.next_action<my_component>(id);
+  // F* - F = 10 * local_var + 1000 * remote_var - local_flux
+  const DataVector xi_flux = {0., 0., 7011.,
+                              0., 0., 8023.,
+                              0., 0., 9035.};
+  const DataVector eta_flux = {10042., 11054., 12066.,
+                               0., 0., 0.,
+                               0., 0., 0.};
+  // These factors are -3[based on extents] * magnitude_of_normal
+  CHECK_ITERABLE_APPROX(get_dt(),
+                        get(get<Tags::dt<Var>>(initial_dt)) - 6. * xi_flux);
+  CHECK(runner.algorithms<my_component>().at(id).get_next_action_index() == 0);
+  CHECK(inbox.empty());
+  CHECK_FALSE(runner.is_ready<my_component>(id));
+
+  inbox.insert(0, eta_mortar, 1,
+               make_remote_data(Scalar<DataVector>{{{{10., 11., 12.}}}}));
+  CHECK(runner.is_ready<my_component>(id));
+  runner.next_action<my_component>(id);
+  CHECK_ITERABLE_APPROX(get_dt(), get(get<Tags::dt<Var>>(initial_dt)) -
+                                      6. * xi_flux - 9. * eta_flux);
+  CHECK(runner.algorithms<my_component>().at(id).get_next_action_index() ==
+        1);
+  CHECK(db::get<mortar_next_temporal_ids_tag>(
+            runner.algorithms<my_component>()
+                .at(id)
+                .get_databox<my_component::initial_databox>()) ==
+        db::item_type<mortar_next_temporal_ids_tag>{{xi_mortar, 1},
+                                                    {eta_mortar, 1}});
+}
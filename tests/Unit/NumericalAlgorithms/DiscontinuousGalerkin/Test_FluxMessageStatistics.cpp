@@ -0,0 +1,38 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include "NumericalAlgorithms/DiscontinuousGalerkin/FluxMessageStatistics.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.FluxMessageStatistics",
+                  "[Unit][NumericalAlgorithms]") {
+  dg::FluxMessageStatistics<int> statistics{};
+  CHECK(statistics.number_of_messages() == 0);
+  CHECK(statistics.number_of_mortars() == 0);
+  CHECK(statistics.number_of_steps() == 0);
+  CHECK(statistics.mean_step_wall_time() == 0.);
+
+  CHECK(statistics.record(0, 2, 5, 10.));
+  CHECK_FALSE(statistics.record(0, 1, 3, 11.));
+  CHECK(statistics.number_of_messages() == 3);
+  CHECK(statistics.number_of_mortars() == 8);
+  CHECK(statistics.number_of_steps() == 1);
+  CHECK(statistics.mean_step_wall_time() == 0.);
+
+  CHECK(statistics.record(2, 1, 4, 12.));
+  // Reports from elements that are behind do not start a step
+  CHECK_FALSE(statistics.record(1, 1, 4, 13.));
+  CHECK(statistics.record(3, 2, 4, 16.));
+  CHECK(statistics.number_of_messages() == 7);
+  CHECK(statistics.number_of_mortars() == 20);
+  CHECK(statistics.number_of_steps() == 3);
+  CHECK(statistics.mean_step_wall_time() == approx(3.));
+
+  const auto deserialized = serialize_and_deserialize(statistics);
+  CHECK(deserialized.number_of_messages() == 7);
+  CHECK(deserialized.number_of_mortars() == 20);
+  CHECK(deserialized.number_of_steps() == 3);
+  CHECK(deserialized.mean_step_wall_time() == approx(3.));
+}
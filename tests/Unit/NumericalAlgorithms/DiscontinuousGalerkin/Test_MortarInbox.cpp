@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Domain/Direction.hpp"
+#include "Domain/ElementId.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/MortarInbox.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+using Inbox = dg::MortarInbox<1, int, double>;
+using MortarId = Inbox::MortarId;
+using MortarNextTemporalIds =
+    std::unordered_map<MortarId, int, boost::hash<MortarId>>;
+
+const MortarId lower_mortar{Direction<1>::lower_xi(), ElementId<1>(0)};
+const MortarId upper_mortar{Direction<1>::upper_xi(), ElementId<1>(1)};
+
+void test_global_time_stepping() noexcept {
+  Inbox inbox{};
+  CHECK(inbox.empty());
+  MortarNextTemporalIds mortar_next_temporal_ids{{lower_mortar, 0},
+                                                 {upper_mortar, 0}};
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 1));
+
+  inbox.insert(0, lower_mortar, 1, 1.);
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 1));
+  // Data for the next step arriving early does not complete this one
+  inbox.insert(1, lower_mortar, 2, 3.);
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 1));
+  inbox.insert(0, upper_mortar, 1, 2.);
+  CHECK(inbox.is_ready(mortar_next_temporal_ids, 1));
+  CHECK(inbox.size() == 3);
+  CHECK(inbox.count(0) == 2);
+  CHECK(inbox.count(1, lower_mortar) == 1);
+  CHECK(inbox.count(1, upper_mortar) == 0);
+  CHECK(inbox.at(0, upper_mortar) == std::make_pair(1, 2.));
+
+  std::vector<std::pair<MortarId, double>> extracted{};
+  inbox.extract_before(
+      1, [&extracted, &mortar_next_temporal_ids](
+             const int temporal_id, const MortarId& mortar_id,
+             const int next_temporal_id, const double data) noexcept {
+        CHECK(temporal_id == 0);
+        CHECK(next_temporal_id == 1);
+        mortar_next_temporal_ids.at(mortar_id) = next_temporal_id;
+        extracted.emplace_back(mortar_id, data);
+      });
+  CHECK(extracted == std::vector<std::pair<MortarId, double>>{
+                         {lower_mortar, 1.}, {upper_mortar, 2.}});
+  CHECK(inbox.size() == 1);
+  CHECK(inbox.count(1) == 1);
+
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 2));
+  inbox.insert(1, upper_mortar, 2, 4.);
+  CHECK(inbox.is_ready(mortar_next_temporal_ids, 2));
+
+  const auto deserialized = serialize_and_deserialize(inbox);
+  CHECK(deserialized.size() == 2);
+  CHECK(deserialized.at(1, lower_mortar) == std::make_pair(2, 3.));
+  CHECK(deserialized.is_ready(mortar_next_temporal_ids, 2));
+
+  inbox.clear();
+  CHECK(inbox.empty());
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 2));
+}
+
+void test_local_time_stepping() noexcept {
+  Inbox inbox{};
+  // The lower neighbor takes steps of 1 and the upper neighbor one step of 4
+  const MortarNextTemporalIds mortar_next_temporal_ids{{lower_mortar, 0},
+                                                       {upper_mortar, 0}};
+  inbox.insert(0, upper_mortar, 4, 5.);
+  inbox.insert(0, lower_mortar, 1, 1.);
+  // Out of order arrival
+  inbox.insert(2, lower_mortar, 3, 3.);
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 3));
+  inbox.insert(1, lower_mortar, 2, 2.);
+  CHECK(inbox.is_ready(mortar_next_temporal_ids, 3));
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 4));
+  inbox.insert(3, lower_mortar, 4, 4.);
+  CHECK(inbox.is_ready(mortar_next_temporal_ids, 4));
+
+  std::vector<std::pair<int, double>> lower_extracted{};
+  inbox.extract_before(
+      3, [&lower_extracted](const int temporal_id, const MortarId& mortar_id,
+                            const int /*next_temporal_id*/,
+                            const double data) noexcept {
+        if (mortar_id == lower_mortar) {
+          lower_extracted.emplace_back(temporal_id, data);
+        }
+      });
+  CHECK(lower_extracted ==
+        std::vector<std::pair<int, double>>{{0, 1.}, {1, 2.}, {2, 3.}});
+  CHECK(inbox.size() == 1);
+  CHECK(inbox.count(3, lower_mortar) == 1);
+}
+
+void test_mortar_without_data() noexcept {
+  Inbox inbox{};
+  // The upper neighbor has already sent all data needed for this step
+  const MortarNextTemporalIds mortar_next_temporal_ids{{lower_mortar, 0},
+                                                       {upper_mortar, 2}};
+  CHECK_FALSE(inbox.is_ready(mortar_next_temporal_ids, 1));
+  inbox.insert(0, lower_mortar, 1, 1.);
+  CHECK(inbox.is_ready(mortar_next_temporal_ids, 1));
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DiscontinuousGalerkin.MortarInbox",
+                  "[Unit][NumericalAlgorithms]") {
+  test_global_time_stepping();
+  test_local_time_stepping();
+  test_mortar_without_data();
+}
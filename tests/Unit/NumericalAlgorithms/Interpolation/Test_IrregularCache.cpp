@@ -0,0 +1,87 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Mesh.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularCache.hpp"
+#include "NumericalAlgorithms/Interpolation/IrregularInterpolant.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+
+// IWYU pragma: no_forward_declare Tensor
+
+namespace {
+tnsr::I<DataVector, 2, Frame::Logical> target_points(
+    const double offset) noexcept {
+  return tnsr::I<DataVector, 2, Frame::Logical>{
+      {{DataVector{-0.5 + offset, 0.1, 0.7},
+        DataVector{0.3, -0.2 + offset, 0.9}}}};
+}
+
+void test_cache(const intrp::InterpolationMatrixStorage storage) noexcept {
+  const Mesh<2> mesh{4, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const Mesh<2> other_mesh{5, Spectral::Basis::Legendre,
+                           Spectral::Quadrature::GaussLobatto};
+  const intrp::Irregular<2> interpolant(mesh, target_points(0.0), storage);
+  const size_t entry_size_in_bytes =
+      interpolant.size_in_bytes() + 2 * 3 * sizeof(double);
+
+  // Room for two interpolants on `mesh`
+  intrp::IrregularCache<2> cache(2 * entry_size_in_bytes, storage);
+  CHECK(cache.maximum_size_in_bytes() == 2 * entry_size_in_bytes);
+  CHECK(cache(mesh, target_points(0.0)) == interpolant);
+  CHECK(cache.size() == 1);
+  CHECK(cache.size_in_bytes() == entry_size_in_bytes);
+  CHECK(cache.hits() == 0);
+  CHECK(cache.misses() == 1);
+
+  CHECK(cache(mesh, target_points(0.0)) == interpolant);
+  CHECK(cache.size() == 1);
+  CHECK(cache.hits() == 1);
+  CHECK(cache.misses() == 1);
+
+  CHECK(cache(mesh, target_points(0.1)) ==
+        intrp::Irregular<2>(mesh, target_points(0.1), storage));
+  CHECK(cache.size() == 2);
+  CHECK(cache.size_in_bytes() == 2 * entry_size_in_bytes);
+  CHECK(cache.misses() == 2);
+
+  // Using the first entry makes the second the least recently used, which is
+  // evicted to make room for a third
+  CHECK(cache(mesh, target_points(0.0)) == interpolant);
+  CHECK(cache.hits() == 2);
+  CHECK(cache(mesh, target_points(0.2)) ==
+        intrp::Irregular<2>(mesh, target_points(0.2), storage));
+  CHECK(cache.size() == 2);
+  CHECK(cache.misses() == 3);
+  CHECK(cache(mesh, target_points(0.0)) == interpolant);
+  CHECK(cache.hits() == 3);
+  CHECK(cache(mesh, target_points(0.1)) ==
+        intrp::Irregular<2>(mesh, target_points(0.1), storage));
+  CHECK(cache.misses() == 4);
+
+  // The same points on a different mesh need a different interpolant.  It
+  // is larger than those on `mesh`, so both of them are evicted.
+  CHECK(cache(other_mesh, target_points(0.0)) ==
+        intrp::Irregular<2>(other_mesh, target_points(0.0), storage));
+  CHECK(cache.misses() == 5);
+  CHECK(cache.size() == 1);
+
+  cache.clear();
+  CHECK(cache.size() == 0);
+  CHECK(cache.size_in_bytes() == 0);
+  CHECK(cache(mesh, target_points(0.0)) == interpolant);
+  CHECK(cache.misses() == 6);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Numerical.Interpolation.IrregularCache",
+                  "[Unit][NumericalAlgorithms]") {
+  test_cache(intrp::InterpolationMatrixStorage::Dense);
+  test_cache(intrp::InterpolationMatrixStorage::TensorProduct);
+}
@@ -27,6 +27,7 @@
 #include "PointwiseFunctions/MathFunctions/MathFunction.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/MathFunctions/PowX.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/MathFunctions/TensorProduct.hpp"
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
@@ -143,6 +144,23 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) noexcept {
   // Set up interpolator. Need do this only once.
   const intrp::Irregular<Dim> irregular_interpolant(mesh, target_x);
   test_serialization(irregular_interpolant);
+  const intrp::Irregular<Dim> tensor_product_interpolant(
+      mesh, target_x, intrp::InterpolationMatrixStorage::TensorProduct);
+  test_serialization(tensor_product_interpolant);
+  CHECK(tensor_product_interpolant.storage() ==
+        intrp::InterpolationMatrixStorage::TensorProduct);
+  CHECK(tensor_product_interpolant != irregular_interpolant);
+  CHECK(tensor_product_interpolant.number_of_target_points() ==
+        number_of_points);
+  CHECK(irregular_interpolant.number_of_target_points() == number_of_points);
+  CHECK(irregular_interpolant.size_in_bytes() ==
+        number_of_points * mesh.number_of_grid_points() * sizeof(double));
+  size_t tensor_product_entries = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    tensor_product_entries += number_of_points * mesh.extents(d);
+  }
+  CHECK(tensor_product_interpolant.size_in_bytes() ==
+        tensor_product_entries * sizeof(double));
 
   // ... but we construct another interpolator to test operator!=
   {
@@ -189,9 +207,16 @@ void test_interpolate_to_points(const Mesh<Dim>& mesh) noexcept {
     const Variables<tags> dest_vars =
         irregular_interpolant.interpolate(src_vars);
 
-    tmpl::for_each<tags>([&dest_vars, &expected_dest_vars ](auto tag) noexcept {
+    const Variables<tags> tensor_product_dest_vars =
+        tensor_product_interpolant.interpolate(src_vars);
+
+    tmpl::for_each<tags>([
+      &dest_vars, &tensor_product_dest_vars, &expected_dest_vars
+    ](auto tag) noexcept {
       using Tag = tmpl::type_from<decltype(tag)>;
       CHECK_ITERABLE_APPROX(get<Tag>(dest_vars), get<Tag>(expected_dest_vars));
+      CHECK_ITERABLE_APPROX(get<Tag>(tensor_product_dest_vars),
+                            get<Tag>(expected_dest_vars));
     });
   }
 }
@@ -220,6 +245,14 @@ SPECTRE_TEST_CASE("Unit.Numerical.Interpolation.IrregularInterpolant",
   }
 }
 
+SPECTRE_TEST_CASE(
+    "Unit.Numerical.Interpolation.IrregularInterpolant.StorageOutput",
+    "[Unit][NumericalAlgorithms]") {
+  CHECK(get_output(intrp::InterpolationMatrixStorage::Dense) == "Dense");
+  CHECK(get_output(intrp::InterpolationMatrixStorage::TensorProduct) ==
+        "TensorProduct");
+}
+
 SPECTRE_TEST_CASE("Unit.Numerical.Interpolation.IrregularInterpolant.Meshes",
                   "[Unit][NumericalAlgorithms]") {
   const size_t start_points = 4;
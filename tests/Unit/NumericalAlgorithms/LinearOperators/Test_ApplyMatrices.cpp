@@ -139,6 +139,32 @@ void test_interpolation() noexcept {
     }
   }
 }
+
+// Matrices larger than the maximum number of spectral points are not
+// handled by the size-specialized kernels.
+void test_large_matrices() noexcept {
+  const Mesh<2> source_mesh{{{3, 4}}, basis, quadrature};
+  const size_t number_of_target_points =
+      Spectral::maximum_number_of_points<basis> + 3;
+  DataVector target_points(number_of_target_points);
+  for (size_t i = 0; i < number_of_target_points; ++i) {
+    target_points[i] = -1.0 + 2.0 * i / (number_of_target_points - 1.0);
+  }
+  const std::array<Matrix, 2> matrices{
+      {Spectral::interpolation_matrix(source_mesh.slice_through(0),
+                                      target_points),
+       Spectral::interpolation_matrix(source_mesh.slice_through(1),
+                                      target_points)}};
+  const Index<2> powers{{{2, 3}}};
+  const auto result = apply_matrices(
+      matrices, polynomial_data(source_mesh, powers), source_mesh.extents());
+  for (size_t j = 0; j < number_of_target_points; ++j) {
+    for (size_t i = 0; i < number_of_target_points; ++i) {
+      CHECK(get(get<ScalarTag>(result))[i + number_of_target_points * j] ==
+            approx(square(target_points[i]) * cube(target_points[j])));
+    }
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.ApplyMatrices",
@@ -146,6 +172,7 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.ApplyMatrices",
   test_interpolation<1>();
   test_interpolation<2>();
   test_interpolation<3>();
+  test_large_matrices();
 
   // Can't use test_interpolation for 0 because Tensor errors on
   // Dim=0.
@@ -3,6 +3,7 @@
 
 #include "tests/Unit/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
@@ -23,6 +24,7 @@
 #include "Domain/CoordinateMaps/Affine.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/CoordinateMaps/Rotation.hpp"
 #include "Domain/LogicalCoordinates.hpp"
 #include "Domain/Mesh.hpp"
 #include "Domain/Tags.hpp"
@@ -198,6 +200,17 @@ void test_logical_partial_derivatives_3d(const Mesh<3>& mesh) {
   }
 
   const auto du = logical_partial_derivatives<GradientTags>(u, mesh);
+  // Default-constructed to test that the buffers are resized.
+  std::array<Variables<GradientTags>, 3> du_not_null{};
+  logical_partial_derivatives<GradientTags>(make_not_null(&du_not_null), u,
+                                            mesh);
+  const size_t derivative_size =
+      Variables<GradientTags>::number_of_independent_components *
+      number_of_grid_points;
+  DataVector du_buffer(3 * derivative_size);
+  logical_partial_derivatives(
+      make_not_null(du_buffer.data()), u.data(),
+      Variables<GradientTags>::number_of_independent_components, mesh);
 
   for (size_t n = 0;
        n < Variables<GradientTags>::number_of_independent_components; ++n) {
@@ -224,6 +237,17 @@ void test_logical_partial_derivatives_3d(const Mesh<3>& mesh) {
       CHECK(du[2].data()[ii.collapsed_index() +         // NOLINT
                          n * number_of_grid_points] ==  // NOLINT
             approx(expected_dzeta));
+
+      const size_t index = ii.collapsed_index() + n * number_of_grid_points;
+      const std::array<double, 3> expected_derivatives{
+          {expected_dxi, expected_deta, expected_dzeta}};
+      for (size_t d = 0; d < 3; ++d) {
+        // clang-tidy: pointer arithmetic
+        CHECK(gsl::at(du_not_null, d).data()[index] ==  // NOLINT
+              approx(gsl::at(expected_derivatives, d)));
+        CHECK(du_buffer[index + d * derivative_size] ==
+              approx(gsl::at(expected_derivatives, d)));
+      }
     }
   }
 }
@@ -327,6 +351,11 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
   Variables<db::wrap_tags_in<Tags::deriv, GradientTags, tmpl::size_t<3>,
                              Frame::Grid>>
       expected_du(number_of_grid_points);
+  // Reused across evaluations, and initially sized incorrectly to test that
+  // the output is resized.
+  Variables<db::wrap_tags_in<Tags::deriv, GradientTags, tmpl::size_t<3>,
+                             Frame::Grid>>
+      du_not_null(1);
   for (size_t a = 0; a < mesh.extents(0) / 2; ++a) {
     for (size_t b = 0; b < mesh.extents(1) / 2; ++b) {
       for (size_t c = 0; c < mesh.extents(2) / 2; ++c) {
@@ -350,6 +379,14 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
           CHECK(du.data()[n] ==                                   // NOLINT
                 approx(expected_du.data()[n]).epsilon(1.e-11));
         }
+
+        partial_derivatives<GradientTags>(make_not_null(&du_not_null), u, mesh,
+                                          inverse_jacobian);
+        for (size_t n = 0; n < du_not_null.size(); ++n) {
+          // clang-tidy: pointer arithmetic
+          CHECK(du_not_null.data()[n] ==  // NOLINT
+                approx(expected_du.data()[n]).epsilon(1.e-11));  // NOLINT
+        }
       }
     }
   }
@@ -433,7 +470,8 @@ struct SomePrefix : db::PrefixTag, db::SimpleTag {
 
 template <size_t Dim, typename T>
 void test_partial_derivatives_compute_item(
-    const std::array<size_t, Dim> extents_array, const T& map) noexcept {
+    const std::array<size_t, Dim> extents_array, const T& map,
+    const std::array<size_t, Dim>& array_to_functions) noexcept {
   using vars_tags = tmpl::list<Var1<Dim>, Var2>;
   using map_tag = MapTag<std::decay_t<decltype(map)>>;
   using inv_jac_tag =
@@ -446,8 +484,6 @@ void test_partial_derivatives_compute_item(
       Tags::ComputeDeriv<prefixed_variables_tag, inv_jac_tag,
                          tmpl::list<SomePrefix<Var1<Dim>>>>;
 
-  const std::array<size_t, Dim> array_to_functions{extents_array -
-                                                   make_array<Dim>(size_t{1})};
   const Mesh<Dim> mesh{extents_array, Spectral::Basis::Legendre,
                        Spectral::Quadrature::GaussLobatto};
   const size_t num_grid_points = mesh.number_of_grid_points();
@@ -498,6 +534,13 @@ void test_partial_derivatives_compute_item(
       get<Tags::deriv<Var1<Dim>, tmpl::size_t<Dim>, Frame::Grid>>(expected_du);
   CHECK_ITERABLE_APPROX(du_prefixed, expected_du_prefixed);
 }
+
+template <size_t Dim, typename T>
+void test_partial_derivatives_compute_item(
+    const std::array<size_t, Dim> extents_array, const T& map) noexcept {
+  test_partial_derivatives_compute_item(
+      extents_array, map, extents_array - make_array<Dim>(size_t{1}));
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs.ComputeItems",
@@ -518,6 +561,17 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs.ComputeItems",
           std::array<size_t, 2>{{a + 1, b + 1}},
           make_coordinate_map<Frame::Logical, Frame::Grid>(Affine2d{
               Affine{-1.0, 1.0, -0.3, 0.7}, Affine{-1.0, 1.0, 0.3, 0.55}}));
+      // The inverse Jacobian of a rotated grid is not diagonal.  The
+      // rotation mixes the powers of the coordinates, so the total degree
+      // of the polynomial must be resolved in every direction.
+      test_partial_derivatives_compute_item(
+          std::array<size_t, 2>{{a + 1, b + 1}},
+          make_coordinate_map<Frame::Logical, Frame::Grid>(
+              Affine2d{Affine{-1.0, 1.0, -0.3, 0.7},
+                       Affine{-1.0, 1.0, 0.3, 0.55}},
+              CoordinateMaps::Rotation<2>{0.7}),
+          std::array<size_t, 2>{{std::min(a, b) / 2,
+                                 std::min(a, b) - std::min(a, b) / 2}});
       for (size_t c = 1; a < max_extents[0] / 2 and b < max_extents[1] / 2 and
                          c < max_extents[2];
            ++c) {
@@ -526,6 +580,14 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.PartialDerivs.ComputeItems",
             make_coordinate_map<Frame::Logical, Frame::Grid>(Affine3d{
                 Affine{-1.0, 1.0, -0.3, 0.7}, Affine{-1.0, 1.0, 0.3, 0.55},
                 Affine{-1.0, 1.0, 2.3, 2.8}}));
+        test_partial_derivatives_compute_item(
+            std::array<size_t, 3>{{a + 1, b + 1, c + 1}},
+            make_coordinate_map<Frame::Logical, Frame::Grid>(
+                Affine3d{Affine{-1.0, 1.0, -0.3, 0.7},
+                         Affine{-1.0, 1.0, 0.3, 0.55},
+                         Affine{-1.0, 1.0, 2.3, 2.8}},
+                CoordinateMaps::Rotation<3>{0.7, 2.3, -0.4}),
+            std::array<size_t, 3>{{std::min({a, b, c}), 0, 0}});
       }
     }
   }
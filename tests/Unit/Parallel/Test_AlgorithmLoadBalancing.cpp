@@ -0,0 +1,312 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+// Need CATCH_CONFIG_RUNNER to avoid linking errors with Catch2
+#define CATCH_CONFIG_RUNNER
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <pup.h>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "AlgorithmArray.hpp"
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "ErrorHandling/Error.hpp"
+#include "ErrorHandling/FloatingPointExceptions.hpp"
+#include "Options/Options.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/InitializationFunctions.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/LoadBalancing.hpp"
+#include "Parallel/Main.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Requires.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace db {
+template <typename TagsList>
+class DataBox;
+}  // namespace db
+
+static constexpr int number_of_elements = 4;
+// The elements pause for load balancing after this many steps
+static constexpr int pause_step = 3;
+static constexpr int final_step = 6;
+
+struct Step : db::SimpleTag {
+  static std::string name() noexcept { return "Step"; }
+  using type = int;
+};
+
+struct Received : db::SimpleTag {
+  static std::string name() noexcept { return "Received"; }
+  using type = int;
+};
+
+// Filled by each element at the pause and only read once the algorithm is
+// resumed, so the data has to survive the serialization of the inboxes.
+struct ValueFromSelf {
+  using temporal_id = int;
+  using type = std::unordered_map<temporal_id, std::unordered_multiset<int>>;
+};
+
+int value_for_element(const int array_index) noexcept {
+  return 10 * array_index + 1;
+}
+
+struct IncrementStep {
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    Parallel::ConstGlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index, const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    db::mutate<Step>(make_not_null(&box),
+                     [](const gsl::not_null<int*> step) { ++*step; });
+    const bool pause = db::get<Step>(box) == pause_step;
+    if (pause) {
+      Parallel::request_load_balancing<ParallelComponent>(cache, array_index);
+      Parallel::receive_data<ValueFromSelf>(
+          Parallel::get_parallel_component<ParallelComponent>(
+              cache)[array_index],
+          pause_step, value_for_element(array_index));
+    }
+    return std::tuple<db::DataBox<DbTags>&&, bool>(std::move(box), pause);
+  }
+};
+
+struct ReceiveValue {
+  using inbox_tags = tmpl::list<ValueFromSelf>;
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static auto apply(db::DataBox<DbTags>& box,
+                    tuples::TaggedTuple<InboxTags...>& inboxes,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    auto& inbox = tuples::get<ValueFromSelf>(inboxes);
+    if (db::get<Step>(box) == pause_step) {
+      const int value = *inbox.at(pause_step).begin();
+      inbox.erase(pause_step);
+      db::mutate<Received>(
+          make_not_null(&box),
+          [value](const gsl::not_null<int*> received) { *received = value; });
+    }
+    return std::tuple<db::DataBox<DbTags>&&, bool>(
+        std::move(box), db::get<Step>(box) == final_step);
+  }
+
+  template <typename DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex>
+  static bool is_ready(
+      const db::DataBox<DbTags>& box,
+      const tuples::TaggedTuple<InboxTags...>& inboxes,
+      const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/) noexcept {
+    return db::get<Step>(box) != pause_step or
+           tuples::get<ValueFromSelf>(inboxes).count(pause_step) == 1;
+  }
+};
+
+struct Initialize {
+  template <typename... InboxTags, typename Metavariables, typename ArrayIndex,
+            typename ActionList, typename ParallelComponent>
+  static auto apply(const db::DataBox<tmpl::list<>>& /*box*/,
+                    tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    return std::make_tuple(db::create<tmpl::list<Step, Received>>(0, 0));
+  }
+};
+
+// Overwrites the state of the element between serializing and deserializing
+// it, so that only the serialized state can make the check pass.
+struct ScrambleState {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl2::flat_any_v<cpp17::is_same_v<Step, DbTags>...>> =
+                nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    tuples::TaggedTuple<InboxTags...>& inboxes,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    db::mutate<Step, Received>(
+        make_not_null(&box),
+        [](const gsl::not_null<int*> step,
+           const gsl::not_null<int*> received) {
+          *step = -1;
+          *received = -1;
+        });
+    tuples::get<ValueFromSelf>(inboxes).clear();
+  }
+};
+
+struct CheckState {
+  template <typename... DbTags, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent,
+            Requires<tmpl2::flat_any_v<cpp17::is_same_v<Step, DbTags>...>> =
+                nullptr>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& box,
+                    const tuples::TaggedTuple<InboxTags...>& inboxes,
+                    const Parallel::ConstGlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& array_index, const ActionList /*meta*/,
+                    const ParallelComponent* const /*meta*/) noexcept {
+    SPECTRE_PARALLEL_REQUIRE(db::get<Step>(box) == final_step);
+    SPECTRE_PARALLEL_REQUIRE(db::get<Received>(box) ==
+                             value_for_element(array_index));
+    SPECTRE_PARALLEL_REQUIRE(tuples::get<ValueFromSelf>(inboxes).empty());
+  }
+};
+
+template <class Metavariables>
+struct ArrayComponent {
+  using chare_type = Parallel::Algorithms::Array;
+  using metavariables = Metavariables;
+  using action_list = tmpl::list<IncrementStep, ReceiveValue>;
+  using array_index = int;
+  using initial_databox = db::compute_databox_type<tmpl::list<Step, Received>>;
+  using const_global_cache_tag_list = tmpl::list<>;
+  using options = tmpl::list<>;
+
+  static void initialize(
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    auto& array_proxy =
+        Parallel::get_parallel_component<ArrayComponent>(local_cache);
+
+    for (int i = 0, which_proc = 0,
+             number_of_procs = Parallel::number_of_procs();
+         i < number_of_elements; ++i) {
+      array_proxy[i].insert(global_cache, which_proc);
+      which_proc = which_proc + 1 == number_of_procs ? 0 : which_proc + 1;
+    }
+    array_proxy.doneInserting();
+    Parallel::simple_action<Initialize>(array_proxy);
+  }
+
+  static void execute_next_phase(
+      const typename Metavariables::Phase next_phase,
+      Parallel::CProxy_ConstGlobalCache<Metavariables>& global_cache) {
+    Metavariables::executed_phases().push_back(next_phase);
+    auto& local_cache = *(global_cache.ckLocalBranch());
+    auto& array_proxy =
+        Parallel::get_parallel_component<ArrayComponent>(local_cache);
+    if (next_phase == Metavariables::Phase::Evolve) {
+      array_proxy.perform_algorithm(true);
+    } else if (next_phase == Metavariables::Phase::LoadBalancing) {
+      serialize_and_deserialize_local_elements(array_proxy);
+      array_proxy.at_sync();
+    } else if (next_phase == Metavariables::Phase::Check) {
+      // Main only consults the Metavariables for the phases that were not
+      // inserted for load balancing.
+      SPECTRE_PARALLEL_REQUIRE(
+          Metavariables::executed_phases() ==
+          (std::vector<typename Metavariables::Phase>{
+              Metavariables::Phase::Evolve,
+              Metavariables::Phase::LoadBalancing,
+              Metavariables::Phase::Evolve, Metavariables::Phase::Check}));
+      SPECTRE_PARALLEL_REQUIRE(
+          Metavariables::determined_phases() ==
+          (std::vector<typename Metavariables::Phase>{
+              Metavariables::Phase::Initialization,
+              Metavariables::Phase::Evolve}));
+      Parallel::simple_action<CheckState>(array_proxy);
+    }
+  }
+
+ private:
+  // Pack each element on this processor the way Charm++ does when migrating
+  // it, and unpack it into the same element after overwriting its state.
+  template <typename Proxy>
+  static void serialize_and_deserialize_local_elements(
+      Proxy& array_proxy) noexcept {
+    for (int i = 0; i < number_of_elements; ++i) {
+      auto* const element = array_proxy[i].ckLocal();
+      if (element == nullptr) {
+        continue;
+      }
+      PUP::sizer sizer;
+      element->AlgorithmImpl::pup(sizer);
+      std::vector<char> data(sizer.size());
+      PUP::toMem writer(data.data());
+      element->AlgorithmImpl::pup(writer);
+
+      element->template simple_action<ScrambleState>();
+
+      PUP::fromMem reader(data.data());
+      element->AlgorithmImpl::pup(reader);
+    }
+  }
+};
+
+struct TestMetavariables {
+  using component_list = tmpl::list<ArrayComponent<TestMetavariables>>;
+  using const_global_cache_tag_list = tmpl::list<>;
+
+  static constexpr OptionString help =
+      "An executable for testing the load balancing of array Algorithms. The "
+      "elements request a LoadBalancing phase in the middle of a phase, are "
+      "serialized and deserialized, and resume the interrupted phase.";
+  static constexpr bool ignore_unrecognized_command_line_options = false;
+
+  enum class Phase { Initialization, Evolve, LoadBalancing, Check, Exit };
+
+  static Phase determine_next_phase(
+      const Phase& current_phase,
+      const Parallel::CProxy_ConstGlobalCache<
+          TestMetavariables>& /*cache_proxy*/) noexcept {
+    determined_phases().push_back(current_phase);
+    switch (current_phase) {
+      case Phase::Initialization:
+        return Phase::Evolve;
+      case Phase::Evolve:
+        return Phase::Check;
+      case Phase::Check:
+        return Phase::Exit;
+      default:
+        ERROR("Unexpected phase; the LoadBalancing phase and the interrupted "
+              "phase after it should be chosen by Parallel::Main.");
+    }
+
+    return Phase::Exit;
+  }
+
+  // The phases executed by the parallel component and the phases passed to
+  // determine_next_phase, both on the processor of Parallel::Main
+  static std::vector<Phase>& executed_phases() noexcept {
+    static std::vector<Phase> phases{};
+    return phases;
+  }
+  static std::vector<Phase>& determined_phases() noexcept {
+    static std::vector<Phase> phases{};
+    return phases;
+  }
+};
+
+static const std::vector<void (*)()> charm_init_node_funcs{
+    &setup_error_handling};
+static const std::vector<void (*)()> charm_init_proc_funcs{
+    &enable_floating_point_exceptions};
+
+using charmxx_main_component = Parallel::Main<TestMetavariables>;
+
+#include "Parallel/CharmMain.cpp"
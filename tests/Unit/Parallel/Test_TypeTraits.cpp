@@ -26,6 +26,9 @@ class PupableClass {
 
 class NonpupableClass {};
 
+enum class PhasesWithLoadBalancing { Initialization, LoadBalancing, Exit };
+enum class PhasesWithoutLoadBalancing { Initialization, Exit };
+
 struct MV {};
 
 struct SingletonParallelComponent {};
@@ -104,3 +107,11 @@ static_assert(Parallel::is_pupable_v<PupableClass>,
 static_assert(not Parallel::is_pupable<NonpupableClass>::value,
               "Failed testing type trait is_pupable");
 /// [is_pupable_example]
+
+static_assert(Parallel::has_load_balancing_phase<PhasesWithLoadBalancing>::value,
+              "Failed testing type trait has_load_balancing_phase");
+static_assert(Parallel::has_load_balancing_phase_v<PhasesWithLoadBalancing>,
+              "Failed testing type trait has_load_balancing_phase");
+static_assert(
+    not Parallel::has_load_balancing_phase<PhasesWithoutLoadBalancing>::value,
+    "Failed testing type trait has_load_balancing_phase");
@@ -0,0 +1,90 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+// IWYU pragma: no_include <unordered_map>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Time/Actions/PauseForLoadBalancing.hpp"  // IWYU pragma: keep
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"  // IWYU pragma: keep
+#include "Time/Time.hpp"
+#include "Time/TimeId.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+
+namespace {
+struct Metavariables;
+struct component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tag_list =
+      tmpl::list<OptionTags::LoadBalancingInterval>;
+  using action_list = tmpl::list<Actions::PauseForLoadBalancing>;
+  using simple_tags = db::AddSimpleTags<Tags::TimeId>;
+  using initial_databox = db::compute_databox_type<simple_tags>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<component>;
+  using const_global_cache_tag_list = tmpl::list<>;
+};
+
+void check_pauses(const size_t interval) noexcept {
+  const Slab slab(3., 6.);
+  const Time mid_slab = slab.start() + slab.duration() / 2;
+
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+  using MockDistributedObjectsTag =
+      MockRuntimeSystem::MockDistributedObjectsTag<component>;
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockDistributedObjectsTag>(dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<component>{
+                      db::create<typename component::simple_tags>(TimeId{})});
+  MockRuntimeSystem runner{{interval}, std::move(dist_objects)};
+  auto& algorithm = runner.algorithms<component>().at(0);
+  auto& box = algorithm.get_databox<typename component::initial_databox>();
+
+  struct Test {
+    TimeId time_id{};
+    bool expected_pause{};
+  };
+  const std::array<Test, 7> tests{
+      {{TimeId(true, -2, slab.start()), false},
+       {TimeId(true, 0, slab.start()), false},
+       {TimeId(true, 2, slab.start()), interval == 2},
+       {TimeId(true, 4, slab.start()), interval == 2},
+       {TimeId(true, 4, mid_slab), false},
+       {TimeId(true, 4, slab.start(), 1, mid_slab), false},
+       {TimeId(false, 4, slab.end()), interval == 2}}};
+
+  size_t expected_contributions = 0;
+  for (const auto& test : tests) {
+    db::mutate<Tags::TimeId>(make_not_null(&box),
+                             [&test](const gsl::not_null<TimeId*> time_id) {
+                               *time_id = test.time_id;
+                             });
+    algorithm.set_terminate(false);
+    runner.next_action<component>(0);
+    CHECK(algorithm.get_terminate() == test.expected_pause);
+    if (test.expected_pause) {
+      ++expected_contributions;
+    }
+    CHECK(algorithm.number_of_contributions() == expected_contributions);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.Actions.PauseForLoadBalancing",
+                  "[Unit][Time][Actions]") {
+  check_pauses(2);
+  check_pauses(0);
+}
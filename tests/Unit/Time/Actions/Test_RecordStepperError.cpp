@@ -0,0 +1,145 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <string>
+#include <utility>
+// IWYU pragma: no_include <unordered_map>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "Parallel/GotoAction.hpp"  // IWYU pragma: keep
+#include "Time/Actions/RecordStepperError.hpp"  // IWYU pragma: keep
+// IWYU pragma: no_include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+
+namespace {
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = double;
+};
+
+struct System {
+  using variables_tag = Var;
+};
+
+using variables_tag = Var;
+using dt_variables_tag = Tags::dt<Var>;
+using history_tag =
+    Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>;
+using error_tag = Tags::StepperError<variables_tag, dt_variables_tag>;
+
+struct Loop;
+
+struct Metavariables;
+struct component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tag_list = tmpl::list<>;
+  // The action is run in a loop, as in the evolution, which requires
+  // the type of the DataBox to be the same on every iteration.
+  using action_list =
+      tmpl::list<Actions::Label<Loop>, Actions::RecordStepperError,
+                 Actions::Goto<Loop>>;
+  using simple_tags = db::AddSimpleTags<Tags::TimeStep, variables_tag,
+                                        history_tag, error_tag>;
+  using initial_databox = db::compute_databox_type<simple_tags>;
+};
+
+struct Metavariables {
+  using system = System;
+  using component_list = tmpl::list<component>;
+  using const_global_cache_tag_list = tmpl::list<>;
+};
+
+using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+
+MockRuntimeSystem make_runner(const TimeDelta& step,
+                              history_tag::type history) noexcept {
+  using MockDistributedObjectsTag =
+      MockRuntimeSystem::MockDistributedObjectsTag<component>;
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockDistributedObjectsTag>(dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<component>{
+                      db::create<typename component::simple_tags>(
+                          step, 1., std::move(history), 0.)});
+  return MockRuntimeSystem{{}, std::move(dist_objects)};
+}
+
+component::initial_databox& get_box(
+    const gsl::not_null<MockRuntimeSystem*> runner) noexcept {
+  return runner->algorithms<component>()
+      .at(0)
+      .get_databox<component::initial_databox>();
+}
+
+// Runs one more iteration of the loop, starting from the Goto.
+void run_loop(const gsl::not_null<MockRuntimeSystem*> runner) noexcept {
+  runner->next_action<component>(0);
+  CHECK(runner->get_next_action_index<component>(0) == 0);
+  runner->next_action<component>(0);
+  CHECK(runner->get_next_action_index<component>(0) == 1);
+  runner->next_action<component>(0);
+  CHECK(runner->get_next_action_index<component>(0) == 2);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.Actions.RecordStepperError",
+                  "[Unit][Time][Actions]") {
+  const Slab slab(0., 1.);
+  const TimeDelta step = slab.duration() / 4;
+
+  {
+    // The derivatives 1, 2 and 4 at times 0, 1/4 and 1/2 give the
+    // second divided difference 8, and the difference between the
+    // third- and second-order steps of 1/4 from 1/2 is 8 times the
+    // integral of (t - 1/2) (t - 1/4) from 1/2 to 3/4, which is 5/384.
+    history_tag::type history{};
+    history.insert(slab.start(), 0., 1.);
+    history.insert(slab.start() + step, 0., 2.);
+    history.insert(slab.start() + 2 * step, 0., 4.);
+    auto runner = make_runner(step, std::move(history));
+
+    runner.next_action<component>(0);
+    runner.next_action<component>(0);
+    CHECK(db::get<error_tag>(get_box(make_not_null(&runner))) ==
+          approx(5. / 48.));
+
+    // Later iterations of the loop update the estimate.  Halving the
+    // step gives the integral 1/384.
+    db::mutate<Tags::TimeStep>(
+        make_not_null(&get_box(make_not_null(&runner))),
+        [&slab](const gsl::not_null<TimeDelta*> time_step) noexcept {
+          *time_step = slab.duration() / 8;
+        });
+    run_loop(make_not_null(&runner));
+    CHECK(db::get<error_tag>(get_box(make_not_null(&runner))) ==
+          approx(1. / 48.));
+    run_loop(make_not_null(&runner));
+    CHECK(db::get<error_tag>(get_box(make_not_null(&runner))) ==
+          approx(1. / 48.));
+  }
+
+  {
+    // Too little history to estimate the error, so the initial value
+    // is kept.
+    history_tag::type history{};
+    history.insert(slab.start(), 0., 1.);
+    auto runner = make_runner(step, std::move(history));
+
+    runner.next_action<component>(0);
+    runner.next_action<component>(0);
+    CHECK(db::get<error_tag>(get_box(make_not_null(&runner))) == 0.);
+    run_loop(make_not_null(&runner));
+    CHECK(db::get<error_tag>(get_box(make_not_null(&runner))) == 0.);
+  }
+}
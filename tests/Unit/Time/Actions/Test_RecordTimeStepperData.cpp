@@ -3,6 +3,7 @@
 
 #include "tests/Unit/TestingFramework.hpp"
 
+#include <memory>
 #include <string>
 #include <utility>
 // IWYU pragma: no_include <unordered_map>
@@ -16,6 +17,9 @@
 #include "Time/Tags.hpp"
 #include "Time/Time.hpp"
 #include "Time/TimeId.hpp"
+#include "Time/TimeSteppers/LowStorageRungeKutta3.hpp"
+#include "Time/TimeSteppers/RungeKutta3.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 #include "tests/Unit/ActionTesting.hpp"
@@ -40,7 +44,7 @@ struct component {
   using metavariables = Metavariables;
   using chare_type = ActionTesting::MockArrayChare;
   using array_index = int;
-  using const_global_cache_tag_list = tmpl::list<>;
+  using const_global_cache_tag_list = tmpl::list<OptionTags::TimeStepper>;
   using action_list = tmpl::list<Actions::RecordTimeStepperData>;
   using simple_tags = db::AddSimpleTags<Tags::TimeId, variables_tag,
                                         dt_variables_tag, history_tag>;
@@ -54,11 +58,9 @@ struct Metavariables {
   using component_list = tmpl::list<component>;
   using const_global_cache_tag_list = tmpl::list<>;
 };
-}  // namespace
-
-SPECTRE_TEST_CASE("Unit.Time.Actions.RecordTimeStepperData",
-                  "[Unit][Time][Actions]") {
 
+void check_record(std::unique_ptr<TimeStepper> time_stepper) noexcept {
+  const bool uses_history_values = time_stepper->uses_history_values();
   const Slab slab(1., 3.);
   const TimeId time_id(true, 8, slab.start());
 
@@ -74,7 +76,8 @@ SPECTRE_TEST_CASE("Unit.Time.Actions.RecordTimeStepperData",
                       db::create<typename component::simple_tags,
                                  typename component::compute_tags>(
                           time_id, 4., 5., std::move(history))});
-  MockRuntimeSystem runner{{}, std::move(dist_objects)};
+  MockRuntimeSystem runner{{std::move(time_stepper)},
+                           std::move(dist_objects)};
 
   runner.next_action<component>(0);
   const auto& box = runner.algorithms<component>()
@@ -87,6 +90,14 @@ SPECTRE_TEST_CASE("Unit.Time.Actions.RecordTimeStepperData",
   CHECK(new_history.begin().value() == 2.);
   CHECK(new_history.begin().derivative() == 3.);
   CHECK(*(new_history.begin() + 1) == slab.start());
-  CHECK((new_history.begin() + 1).value() == 4.);
+  // The variables are only copied if the time stepper reads them
+  CHECK((new_history.begin() + 1).value() == (uses_history_values ? 4. : 0.));
   CHECK((new_history.begin() + 1).derivative() == 5.);
 }
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.Actions.RecordTimeStepperData",
+                  "[Unit][Time][Actions]") {
+  check_record(std::make_unique<TimeSteppers::RungeKutta3>());
+  check_record(std::make_unique<TimeSteppers::LowStorageRungeKutta3>());
+}
@@ -0,0 +1,153 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+// IWYU pragma: no_include <unordered_map>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "Time/Actions/UpdateUImex.hpp"  // IWYU pragma: keep
+#include "Time/History.hpp"
+#include "Time/HistoryBuffer.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/ImexRungeKutta3.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+#include "tests/Unit/ActionTesting.hpp"
+
+namespace {
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = double;
+};
+
+struct RelaxationRate : db::SimpleTag {
+  static std::string name() noexcept { return "RelaxationRate"; }
+  using type = double;
+};
+
+// The source -k u
+struct Relaxation {
+  using argument_tags = tmpl::list<RelaxationRate>;
+  static void apply(const gsl::not_null<double*> vars,
+                    const gsl::not_null<double*> source,
+                    const double implicit_weight,
+                    const double relaxation_rate) noexcept {
+    *vars /= 1.0 + implicit_weight * relaxation_rate;
+    *source = -relaxation_rate * *vars;
+  }
+};
+
+struct System {
+  using variables_tag = Var;
+  using implicit_sources = Relaxation;
+};
+
+using variables_tag = Var;
+using dt_variables_tag = Tags::dt<Var>;
+using history_tag =
+    Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>;
+using implicit_history_tag = Tags::HistoryImplicitSources<dt_variables_tag>;
+
+struct Metavariables;
+struct component {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using const_global_cache_tag_list = tmpl::list<OptionTags::TimeStepper>;
+  using action_list = tmpl::list<Actions::UpdateUImex>;
+  using simple_tags =
+      db::AddSimpleTags<Tags::TimeStep, variables_tag, history_tag,
+                        implicit_history_tag, RelaxationRate>;
+  using initial_databox = db::compute_databox_type<simple_tags>;
+};
+
+struct Metavariables {
+  using system = System;
+  using component_list = tmpl::list<component>;
+  using const_global_cache_tag_list = tmpl::list<>;
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.Actions.UpdateUImex", "[Unit][Time][Actions]") {
+  const Slab slab(1., 3.);
+  const TimeDelta time_step = slab.duration() / 2;
+  const double relaxation_rate = 1.0e6;
+
+  const auto rhs = [](const double t) { return 2. * t; };
+
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<Metavariables>;
+  using MockDistributedObjectsTag =
+      MockRuntimeSystem::MockDistributedObjectsTag<component>;
+  MockRuntimeSystem::TupleOfMockDistributedObjects dist_objects{};
+  tuples::get<MockDistributedObjectsTag>(dist_objects)
+      .emplace(0, ActionTesting::MockDistributedObject<component>{
+                      db::create<typename component::simple_tags>(
+                          time_step, 1., history_tag::type{},
+                          implicit_history_tag::type{}, relaxation_rate)});
+  MockRuntimeSystem runner{{std::make_unique<TimeSteppers::ImexRungeKutta3>()},
+                           std::move(dist_objects)};
+
+  // Integrate the same system directly with the time stepper.
+  const TimeSteppers::ImexRungeKutta3 stepper{};
+  double expected_value = 1.;
+  history_tag::type expected_history{};
+  implicit_history_tag::type expected_implicit_history{};
+
+  const std::array<Time, 4> substep_times{
+      {slab.start(), slab.start() + time_step / 2,
+       slab.start() + 2 * time_step / 3, slab.start() + time_step / 2}};
+
+  for (size_t substep = 0; substep < 4; ++substep) {
+    const Time& time = gsl::at(substep_times, substep);
+    auto& before_box = runner.algorithms<component>()
+                           .at(0)
+                           .get_databox<typename component::initial_databox>();
+    db::mutate<history_tag>(
+        make_not_null(&before_box),
+        [&rhs, &time](const gsl::not_null<db::item_type<history_tag>*> history,
+                      const double& vars) noexcept {
+          history->insert(time, vars, rhs(time.value()));
+        },
+        db::get<variables_tag>(before_box));
+
+    runner.next_action<component>(0);
+    auto& box = runner.algorithms<component>()
+                    .at(0)
+                    .get_databox<typename component::initial_databox>();
+
+    expected_history.insert(time, expected_value, rhs(time.value()));
+    stepper.update_u(
+        make_not_null(&expected_value), make_not_null(&expected_history),
+        make_not_null(&expected_implicit_history), time_step,
+        [&relaxation_rate](const gsl::not_null<double*> u,
+                           const gsl::not_null<double*> source,
+                           const Time& /*stage_time*/,
+                           const double implicit_weight) noexcept {
+          Relaxation::apply(u, source, implicit_weight, relaxation_rate);
+        });
+
+    CHECK(db::get<variables_tag>(box) == approx(expected_value));
+    CHECK(db::get<implicit_history_tag>(box).size() ==
+          expected_implicit_history.size());
+  }
+  CHECK(db::get<history_tag>(runner.algorithms<component>()
+                                 .at(0)
+                                 .get_databox<
+                                     typename component::initial_databox>())
+            .size() == 0);
+  // The stiff relaxation has removed the initial value in a single
+  // step, leaving only a response of order 1 / k to the forcing.
+  CHECK(std::abs(expected_value) < 10. / relaxation_rate);
+}
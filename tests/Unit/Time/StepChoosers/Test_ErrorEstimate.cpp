@@ -0,0 +1,242 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>  // IWYU pragma: keep
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+// IWYU pragma: no_include <pup.h>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/DataBoxTag.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Parallel/ConstGlobalCache.hpp"
+// IWYU pragma: no_include "Parallel/PupStlCpp11.hpp"
+#include "Parallel/RegisterDerivedClassesWithCharm.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/StepChoosers/ErrorEstimate.hpp"
+#include "Time/StepChoosers/StepChooser.hpp"
+#include "Time/Tags.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeSteppers/AdamsBashforthN.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+using registrars = tmpl::list<StepChoosers::Register::ErrorEstimate>;
+using ErrorEstimate = StepChoosers::ErrorEstimate<registrars>;
+
+struct Var : db::SimpleTag {
+  static std::string name() noexcept { return "Var"; }
+  using type = double;
+};
+
+using history_tag = Tags::HistoryEvolvedVariables<Var, Tags::dt<Var>>;
+using error_tag = Tags::StepperError<Var, Tags::dt<Var>>;
+
+struct Metavariables {
+  using component_list = tmpl::list<>;
+  using const_global_cache_tag_list = tmpl::list<OptionTags::TimeStepper>;
+  struct system {
+    using variables_tag = Var;
+  };
+};
+
+template <typename Box>
+double check_suggestion(const ErrorEstimate& chooser, const TimeDelta& step,
+                        const size_t stepper_order, const Box& box) noexcept {
+  const Parallel::ConstGlobalCache<Metavariables> cache{
+      {std::make_unique<TimeSteppers::AdamsBashforthN>(stepper_order)}};
+  const std::unique_ptr<StepChooser<registrars>> chooser_base =
+      std::make_unique<ErrorEstimate>(chooser);
+
+  const double result = chooser(step, box, cache);
+  CHECK(chooser_base->desired_step(box, cache) == result);
+  CHECK(serialize_and_deserialize(chooser)(step, box, cache) == result);
+  CHECK(serialize_and_deserialize(chooser_base)->desired_step(box, cache) ==
+        result);
+  return result;
+}
+
+double get_suggestion(const ErrorEstimate& chooser, const TimeDelta& step,
+                      const size_t stepper_order, const double value,
+                      const double error) noexcept {
+  return check_suggestion(
+      chooser, step, stepper_order,
+      db::create<db::AddSimpleTags<Tags::TimeStep, Var, error_tag>>(
+          step, value, error));
+}
+
+// Takes the step from the last point of the history the way the
+// action list does: the derivative is recorded, the error estimate is
+// recorded before the update, and the step is chosen after the update.
+double take_step(const gsl::not_null<double*> u,
+                 const gsl::not_null<db::item_type<history_tag>*> history,
+                 const size_t stepper_order, const TimeDelta& step,
+                 const Time& time, double derivative) noexcept {
+  history->insert(time, *u, std::move(derivative));
+  double error = std::numeric_limits<double>::signaling_NaN();
+  StepChoosers::ErrorEstimate_detail::adams_bashforth_error(
+      make_not_null(&error), *history, step.value());
+  TimeSteppers::AdamsBashforthN(stepper_order).update_u(u, history, step);
+  return error;
+}
+
+void test_adams_bashforth() noexcept {
+  const auto deriv = [](const double t) noexcept { return t * t; };
+  const auto exact = [](const double t) noexcept { return cube(t) / 3.; };
+  for (const auto& sign : {1, -1}) {
+    CAPTURE(sign);
+    const Slab slab(0., 1.);
+    const TimeDelta step = sign * slab.duration() / 4;
+    const Time start = sign == 1 ? slab.start() : slab.end();
+    const double t0 = start.value();
+    const double t1 = (start + step).value();
+    const double t2 = (start + 2 * step).value();
+    const double h = step.value();
+
+    const auto make_history = [&deriv, &exact, &start, &step](
+        const size_t size) noexcept {
+      db::item_type<history_tag> history;
+      for (size_t i = 0; i < size; ++i) {
+        const Time time = start + static_cast<int>(i) * step;
+        history.insert(time, exact(time.value()), deriv(time.value()));
+      }
+      return history;
+    };
+
+    // Third order: the derivative is quadratic, so the step is exact
+    // and the estimate is its difference from the second-order step.
+    {
+      auto history = make_history(2);
+      double u = exact(t2);
+      const double error =
+          take_step(make_not_null(&u), make_not_null(&history), 3, step,
+                    start + 2 * step, deriv(t2));
+      CHECK(history.size() == 2);
+      CHECK(u == approx(exact(t2 + h)));
+
+      const double second_order =
+          deriv(t2) * h + 0.5 * square(h) * (deriv(t2) - deriv(t1)) / (t2 - t1);
+      const double expected_error = std::abs(exact(t2 + h) - exact(t2) -
+                                             second_order);
+      CHECK(std::abs(error) == approx(expected_error));
+
+      const double expected_step =
+          0.9 * 0.25 * std::pow(expected_error / 1.0e-3, -1. / 3.);
+      CHECK(get_suggestion(ErrorEstimate{1.0e-3, 0., 0.9}, step, 3, 5.,
+                           error) == approx(expected_step));
+      CHECK(get_suggestion(ErrorEstimate{0., 1.0e-3, 0.9}, step, 3, -1.,
+                           error) == approx(expected_step));
+      CHECK(get_suggestion(ErrorEstimate{1.0e-3, 1.0e-3, 0.9}, step, 3, 1.,
+                           error) ==
+            approx(expected_step * std::pow(2., 1. / 3.)));
+    }
+
+    // Second order: the estimate is the difference from the Euler step.
+    {
+      auto history = make_history(1);
+      double u = exact(t1);
+      const double error =
+          take_step(make_not_null(&u), make_not_null(&history), 2, step,
+                    start + step, deriv(t1));
+      CHECK(history.size() == 1);
+      const double expected_error =
+          0.5 * square(h) * (deriv(t1) - deriv(t0)) / (t1 - t0);
+      CHECK(std::abs(error) == approx(std::abs(expected_error)));
+      CHECK(get_suggestion(ErrorEstimate{1.0e-3, 0., 0.9}, step, 2, 1.,
+                           error) ==
+            approx(0.9 * 0.25 *
+                   std::pow(std::abs(expected_error) / 1.0e-3, -0.5)));
+    }
+
+    // No step has been taken yet, so the estimate has its initial value
+    CHECK(get_suggestion(ErrorEstimate{1.0e-3, 0., 0.9}, step, 3, 1., 0.) ==
+          std::numeric_limits<double>::infinity());
+  }
+
+  // A constant derivative is integrated exactly.
+  const Slab slab(0., 1.);
+  const TimeDelta step = slab.duration() / 4;
+  db::item_type<history_tag> history;
+  history.insert(slab.start(), 0., 2.);
+  double u = 0.5;
+  const double error = take_step(make_not_null(&u), make_not_null(&history), 2,
+                                 step, slab.start() + step, 2.);
+  CHECK(u == approx(1.));
+  CHECK(get_suggestion(ErrorEstimate{1.0e-3, 0., 0.9}, step, 2, u, error) ==
+        std::numeric_limits<double>::infinity());
+}
+
+struct Error1 : db::SimpleTag {
+  static std::string name() noexcept { return "Error1"; }
+  using type = Scalar<DataVector>;
+};
+
+struct Error2 : db::SimpleTag {
+  static std::string name() noexcept { return "Error2"; }
+  using type = Scalar<DataVector>;
+};
+
+struct Value1 : db::SimpleTag {
+  static std::string name() noexcept { return "Value1"; }
+  using type = Scalar<DataVector>;
+};
+
+struct Value2 : db::SimpleTag {
+  static std::string name() noexcept { return "Value2"; }
+  using type = Scalar<DataVector>;
+};
+
+void test_scaled_error_variables() noexcept {
+  Variables<tmpl::list<Error1, Error2>> error(2);
+  get(get<Error1>(error)) = DataVector{1.0e-4, -3.0e-4};
+  get(get<Error2>(error)) = DataVector{-2.0e-4, 0.0};
+  Variables<tmpl::list<Value1, Value2>> value(2);
+  get(get<Value1>(value)) = DataVector{1.0, -6.0};
+  get(get<Value2>(value)) = DataVector{-10.0, 5.0};
+
+  // The largest ratio of the error to the tolerance is at the second
+  // point of the first variable...
+  CHECK(StepChoosers::ErrorEstimate_detail::scaled_error(error, value, 1.0e-4,
+                                                         0.0) ==
+        approx(3.0));
+  // ...unless the tolerance grows with the value.
+  CHECK(StepChoosers::ErrorEstimate_detail::scaled_error(error, value, 0.0,
+                                                         1.0e-4) ==
+        approx(1.0));
+  CHECK(StepChoosers::ErrorEstimate_detail::scaled_error(error, value, 1.0e-4,
+                                                         1.0e-4) ==
+        approx(0.5));
+  get(get<Error1>(error)) = 0.0;
+  get(get<Error2>(error)) = 0.0;
+  CHECK(StepChoosers::ErrorEstimate_detail::scaled_error(error, value, 1.0e-4,
+                                                         1.0e-4) == 0.0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.StepChoosers.ErrorEstimate", "[Unit][Time]") {
+  Parallel::register_derived_classes_with_charm<StepChooser<registrars>>();
+
+  test_adams_bashforth();
+  test_scaled_error_variables();
+
+  test_factory_creation<StepChooser<registrars>>(
+      "  ErrorEstimate:\n"
+      "    AbsoluteTolerance: 1.0e-6\n"
+      "    RelativeTolerance: 1.0e-4\n"
+      "    SafetyFactor: 0.8");
+}
@@ -165,6 +165,60 @@ SPECTRE_TEST_CASE("Unit.Time.History", "[Unit][Time]") {
   check_iterator(copy.begin() + 1);
 }
 
+SPECTRE_TEST_CASE("Unit.Time.History.Registers", "[Unit][Time]") {
+  HistoryType history;
+  CHECK(history.inserts_since_emptied() == 0);
+  history.insert_initial(make_time(-1.), -1., get_output(-1));
+  CHECK(history.inserts_since_emptied() == 0);
+  history.insert(make_time(0.), 0., get_output(0));
+  history.insert(make_time(1.), 1., get_output(1));
+  CHECK(history.inserts_since_emptied() == 2);
+
+  history.mark_unneeded(history.end() - 1);
+  CHECK(history.inserts_since_emptied() == 2);
+  history.mutable_value(history.begin()) = 5.;
+  history.mutable_derivative(history.begin()) = "register";
+  CHECK(history.begin().value() == 5.);
+  CHECK(history.begin().derivative() == "register");
+
+  history.insert(make_time(2.), 2., get_output(2));
+  CHECK(history.inserts_since_emptied() == 3);
+  CHECK(history.size() == 2);
+  CHECK(history.begin().value() == 5.);
+  CHECK((history.end() - 1).value() == 2.);
+  CHECK(serialize_and_deserialize(history).inserts_since_emptied() == 3);
+
+  history.mark_unneeded(history.end());
+  CHECK(history.inserts_since_emptied() == 0);
+  history.insert(make_time(3.), 3., get_output(3));
+  CHECK(history.inserts_since_emptied() == 1);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.History.InsertWithoutValue", "[Unit][Time]") {
+  HistoryType history;
+  history.insert_without_value(make_time(0.), get_output(0));
+  CHECK(history.inserts_since_emptied() == 1);
+  CHECK(*history.begin() == make_time(0.));
+  CHECK(history.begin().value() == 0.);
+  CHECK(history.begin().derivative() == get_output(0));
+  history.mutable_value(history.begin()) = 7.;
+
+  // The value of a reused entry is left over
+  history.mark_unneeded(history.end());
+  {
+    auto tmp = get_output(1);
+    history.insert_without_value(make_time(1.), std::move(tmp));
+    // clang-tidy: misc-use-after-move
+    CHECK(tmp == get_output(0));  // NOLINT
+  }
+  CHECK(history.inserts_since_emptied() == 1);
+  CHECK(history.size() == 1);
+  CHECK(history.capacity() == 1);
+  CHECK(*history.begin() == make_time(1.));
+  CHECK(history.begin().value() == 7.);
+  CHECK(history.begin().derivative() == get_output(1));
+}
+
 namespace {
 using BoundaryHistoryType =
     TimeSteppers::BoundaryHistory<std::string, std::vector<int>, double>;
@@ -0,0 +1,98 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Time/HistoryBuffer.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+
+namespace {
+using BufferType = TimeSteppers::HistoryBuffer<std::string>;
+
+void check_entries(const BufferType& buffer,
+                   const std::vector<int>& expected) noexcept {
+  CHECK(buffer.size() == expected.size());
+  auto it = buffer.begin();
+  for (const int entry : expected) {
+    CHECK(*it == get_output(entry));
+    CHECK(it->size() == get_output(entry).size());
+    CHECK(buffer.entry(it.index()) == get_output(entry));
+    ++it;
+  }
+  CHECK(it == buffer.end());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.HistoryBuffer", "[Unit][Time]") {
+  BufferType buffer;
+  CHECK(buffer.size() == 0);
+  CHECK(buffer.capacity() == 0);
+  CHECK(buffer.begin() == buffer.end());
+
+  buffer.push_back() = get_output(1);
+  buffer.push_front() = get_output(0);
+  buffer.push_back() = get_output(2);
+  check_entries(buffer, {0, 1, 2});
+  CHECK(buffer.capacity() == 3);
+  CHECK(buffer.begin().index() == -1);
+  CHECK(buffer.begin()[2] == get_output(2));
+  check_cmp(buffer.begin(), buffer.begin() + 1);
+  CHECK(buffer.end() - buffer.begin() == 3);
+
+  const auto second = buffer.begin() + 1;
+  buffer.pop_front(buffer.begin());
+  check_entries(buffer, {0, 1, 2});
+  buffer.pop_front(second);
+  check_entries(buffer, {1, 2});
+  CHECK(buffer.capacity() == 3);
+  CHECK(*second == get_output(1));
+
+  // The slots of removed entries are reused, wrapping around the end
+  // of the buffer.
+  for (int entry = 3; entry < 10; ++entry) {
+    auto& new_entry = buffer.push_back();
+    CHECK(new_entry == get_output(entry - 3));
+    new_entry = get_output(entry);
+    buffer.pop_front(buffer.begin() + 1);
+    check_entries(buffer, {entry - 1, entry});
+    CHECK(buffer.capacity() == 3);
+  }
+  buffer.mutable_entry(buffer.end() - 1) = get_output(-9);
+  check_entries(buffer, {8, -9});
+
+  // Growing the buffer keeps the indices of the entries.
+  const auto first_index = buffer.begin().index();
+  buffer.push_back() = get_output(10);
+  buffer.push_back() = get_output(11);
+  CHECK(buffer.capacity() == 4);
+  CHECK(buffer.begin().index() == first_index);
+  check_entries(buffer, {8, -9, 10, 11});
+  buffer.push_front() = get_output(7);
+  CHECK(buffer.capacity() == 5);
+  check_entries(buffer, {7, 8, -9, 10, 11});
+
+  buffer.pop_front(buffer.begin() + 2);
+  const auto copy = serialize_and_deserialize(buffer);
+  check_entries(copy, {-9, 10, 11});
+  CHECK(copy.capacity() == 3);
+  CHECK(copy.begin().index() == buffer.begin().index());
+
+  buffer.shrink_to_fit();
+  CHECK(buffer.capacity() == 3);
+  CHECK(buffer.begin().index() == copy.begin().index());
+  check_entries(buffer, {-9, 10, 11});
+  buffer.push_front() = get_output(8);
+  check_entries(buffer, {8, -9, 10, 11});
+
+  buffer.pop_front(buffer.end());
+  CHECK(buffer.size() == 0);
+  CHECK(buffer.capacity() == 4);
+  CHECK(buffer.begin() == buffer.end());
+  buffer.push_back() = get_output(12);
+  check_entries(buffer, {12});
+}
@@ -31,6 +31,7 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsBashforthN", "[Unit][Time]") {
     INFO(order);
     const TimeSteppers::AdamsBashforthN stepper(order, false);
     TimeStepperTestUtils::check_multistep_properties(stepper);
+    CHECK_FALSE(stepper.uses_history_values());
     const double epsilon = std::max(std::pow(1e-3, order), 1e-14);
     TimeStepperTestUtils::integrate_test(stepper, order - 1, 1., epsilon);
   }
@@ -433,6 +434,68 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsBashforthN.Serialization",
   CHECK(ab != ab2);
 }
 
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsBashforthN.CoefficientCache",
+                  "[Unit][Time]") {
+  using Stats = TimeSteppers::AdamsBashforthN::CoefficientCacheStatistics;
+  const auto check_statistics = [](const size_t hits, const size_t misses,
+                                   const size_t size) noexcept {
+    const Stats stats =
+        TimeSteppers::AdamsBashforthN::coefficient_cache_statistics();
+    CHECK(stats.hits == hits);
+    CHECK(stats.misses == misses);
+    CHECK(stats.size == size);
+  };
+
+  // Second-order step with a previous step half as long as the step
+  // being taken, which gives the coefficients (2, -1).
+  const TimeSteppers::AdamsBashforthN ab2(2);
+  const auto take_step = [&ab2](const Time& first, const Time& second,
+                                const TimeDelta& step) noexcept {
+    TimeSteppers::History<double, double> history{};
+    history.insert(first, 0., 1.);
+    history.insert(second, 0., 3.);
+    double y = 0.;
+    ab2.update_u(make_not_null(&y), make_not_null(&history), step);
+    return y;
+  };
+
+  TimeSteppers::AdamsBashforthN::clear_coefficient_cache();
+  check_statistics(0, 0, 0);
+  CHECK(Stats{}.hit_rate() == 0.);
+
+  const Slab slab(0., 1.);
+  CHECK(take_step(slab.start(), slab.start() + slab.duration() / 4,
+                  slab.duration() / 2) == approx(2.5));
+  check_statistics(0, 1, 1);
+  CHECK(take_step(slab.start() + slab.duration() / 4,
+                  slab.start() + slab.duration() / 2,
+                  slab.duration() / 2) == approx(2.5));
+  check_statistics(1, 1, 1);
+
+  // The same relative step sizes in other slabs
+  const Slab next_slab = slab.advance();
+  CHECK(take_step(next_slab.start(),
+                  next_slab.start() + next_slab.duration() / 4,
+                  next_slab.duration() / 2) == approx(2.5));
+  check_statistics(2, 1, 1);
+  const Slab long_slab(0., 2.);
+  CHECK(take_step(long_slab.start(),
+                  long_slab.start() + long_slab.duration() / 4,
+                  long_slab.duration() / 2) == approx(5.));
+  check_statistics(3, 1, 1);
+  CHECK(TimeSteppers::AdamsBashforthN::coefficient_cache_statistics()
+            .hit_rate() == approx(0.75));
+
+  // Steps in slabs of different sizes are not cached.
+  const Slab short_slab = Slab::with_duration_to_end(0., 0.5);
+  CHECK(take_step(short_slab.start(), slab.start(), slab.duration()) ==
+        approx(5.));
+  check_statistics(3, 1, 1);
+
+  TimeSteppers::AdamsBashforthN::clear_coefficient_cache();
+  check_statistics(0, 0, 0);
+}
+
 SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsBashforthN.Reversal",
                   "[Unit][Time]") {
   const TimeSteppers::AdamsBashforthN ab3(3);
@@ -0,0 +1,220 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "NumericalAlgorithms/RootFinding/NewtonRaphson.hpp"
+#include "Parallel/PupStlCpp11.hpp"
+#include "Time/History.hpp"
+#include "Time/HistoryBuffer.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeId.hpp"
+#include "Time/TimeSteppers/ImexRungeKutta3.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+#include "tests/Unit/Time/TimeSteppers/TimeStepperTestUtils.hpp"
+
+namespace {
+// Integrates du/dt = explicit_rhs(t, u) + S(u, t), where the implicit
+// source S is handled by implicit_solver.
+template <typename ExplicitRhs, typename ImplicitSolver>
+double imex_integrate(const double initial_value, const Slab& slab,
+                      const uint64_t num_steps,
+                      const ExplicitRhs& explicit_rhs,
+                      const ImplicitSolver& implicit_solver) noexcept {
+  const TimeSteppers::ImexRungeKutta3 stepper{};
+  const TimeDelta step_size = slab.duration() / num_steps;
+  TimeId time_id(true, 0, slab.start());
+  double y = initial_value;
+  TimeSteppers::History<double, double> history;
+  TimeSteppers::HistoryBuffer<double> implicit_sources;
+  for (uint64_t i = 0; i < num_steps; ++i) {
+    for (uint64_t substep = 0; substep < stepper.number_of_substeps();
+         ++substep) {
+      CHECK(time_id.substep() == substep);
+      history.insert(time_id.time(), y,
+                     explicit_rhs(time_id.time().value(), y));
+      stepper.update_u(make_not_null(&y), make_not_null(&history),
+                       make_not_null(&implicit_sources), step_size,
+                       implicit_solver);
+      time_id = stepper.next_time_id(time_id, step_size);
+    }
+    CHECK(history.size() == 0);
+    CHECK(implicit_sources.size() == 0);
+    CHECK(implicit_sources.capacity() == stepper.number_of_substeps());
+  }
+  CHECK(time_id.time() == slab.end());
+  return y;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3", "[Unit][Time]") {
+  const TimeSteppers::ImexRungeKutta3 stepper{};
+  TimeStepperTestUtils::check_substep_properties(stepper);
+  TimeStepperTestUtils::integrate_test(stepper, 0, 1., 1e-9);
+  CHECK_FALSE(stepper.uses_history_values());
+
+  const Slab slab(0., 1.);
+  const TimeId time_id(true, 0, slab.start());
+  TimeSteppers::History<double, double> history;
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+  history.insert(slab.start(), 0., 0.);
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Variable",
+                  "[Unit][Time]") {
+  const TimeSteppers::ImexRungeKutta3 stepper{};
+  TimeStepperTestUtils::integrate_variable_test(stepper, 0, 1e-9);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Backwards",
+                  "[Unit][Time]") {
+  const TimeSteppers::ImexRungeKutta3 stepper{};
+  TimeStepperTestUtils::integrate_test(stepper, 0, -1., 1e-9);
+
+  const Slab slab(0., 1.);
+  const TimeId time_id(false, 0, slab.end());
+  TimeSteppers::History<double, double> history;
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+  history.insert(slab.start(), 0., 0.);
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Stability",
+                  "[Unit][Time]") {
+  TimeStepperTestUtils::stability_test(TimeSteppers::ImexRungeKutta3{});
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Factory",
+                  "[Unit][Time]") {
+  test_factory_creation<TimeStepper>("  ImexRungeKutta3");
+  // Catch requires us to have at least one CHECK in each test
+  // The Unit.Time.TimeSteppers.ImexRungeKutta3.Factory does not need to
+  // check anything
+  CHECK(true);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Boundary.Equal",
+                  "[Unit][Time]") {
+  TimeStepperTestUtils::equal_rate_boundary(TimeSteppers::ImexRungeKutta3{},
+                                            0, 1e-9, true);
+}
+
+SPECTRE_TEST_CASE(
+    "Unit.Time.TimeSteppers.ImexRungeKutta3.Boundary.Equal.Backwards",
+    "[Unit][Time]") {
+  TimeStepperTestUtils::equal_rate_boundary(TimeSteppers::ImexRungeKutta3{},
+                                            0, 1e-9, false);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Serialization",
+                  "[Unit][Time]") {
+  TimeSteppers::ImexRungeKutta3 imex{};
+  test_serialization(imex);
+  test_serialization_via_base<TimeStepper, TimeSteppers::ImexRungeKutta3>();
+  // test operator !=
+  CHECK_FALSE(imex != imex);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Implicit",
+                  "[Unit][Time]") {
+  // du/dt = -sin(t) - k (u - cos(t)), with solution u = cos(t).  The
+  // second term is treated implicitly.
+  const auto explicit_rhs = [](const double t, const double /*u*/) noexcept {
+    return -sin(t);
+  };
+  const auto make_solver = [](const double k) noexcept {
+    return [k](const gsl::not_null<double*> u,
+               const gsl::not_null<double*> source, const Time& time,
+               const double implicit_weight) noexcept {
+      *u = (*u + implicit_weight * k * cos(time.value())) /
+           (1.0 + implicit_weight * k);
+      *source = -k * (*u - cos(time.value()));
+    };
+  };
+  const Slab slab(0., 1.);
+
+  // Without stiffness the method is third order.
+  const double error_coarse =
+      imex_integrate(1., slab, 20, explicit_rhs, make_solver(1.0)) - cos(1.);
+  const double error_fine =
+      imex_integrate(1., slab, 40, explicit_rhs, make_solver(1.0)) - cos(1.);
+  CHECK(std::abs(error_fine) < 1e-6);
+  CHECK(std::abs(error_coarse / error_fine) > 6.);
+
+  // A step size far above the explicit stability limit of 2/k remains
+  // stable and accurate for a stiff source.
+  CHECK(imex_integrate(1., slab, 10, explicit_rhs, make_solver(1.0e8)) ==
+        approx(cos(1.)).epsilon(1e-8));
+  CHECK(imex_integrate(2., slab, 10, explicit_rhs, make_solver(1.0e8)) ==
+        approx(cos(1.)).epsilon(1e-8));
+
+  // Without an implicit source the result agrees with the explicit
+  // update.
+  const auto no_source = [](const gsl::not_null<double*> /*u*/,
+                            const gsl::not_null<double*> source,
+                            const Time& /*time*/,
+                            const double /*implicit_weight*/) noexcept {
+    *source = 0.0;
+  };
+  const auto explicit_only = [](const double /*t*/, const double u) noexcept {
+    return -u;
+  };
+  const TimeSteppers::ImexRungeKutta3 stepper{};
+  Time time = slab.start();
+  double y = 1.;
+  TimeSteppers::History<double, double> history;
+  for (size_t i = 0; i < 10; ++i) {
+    TimeStepperTestUtils::take_step(
+        &time, &y, &history, stepper,
+        [](const double v) noexcept { return -v; }, slab.duration() / 10);
+  }
+  CHECK(time == slab.end());
+  CHECK(imex_integrate(1., slab, 10, explicit_only, no_source) == approx(y));
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.ImexRungeKutta3.Nonlinear",
+                  "[Unit][Time]") {
+  // du/dt = -k (u^3 - 1) treated implicitly, solved with Newton-Raphson.
+  const auto explicit_rhs = [](const double /*t*/,
+                                const double /*u*/) noexcept { return 0.0; };
+  const auto make_solver = [](const double k) noexcept {
+    return [k](const gsl::not_null<double*> u,
+               const gsl::not_null<double*> source, const Time& /*time*/,
+               const double implicit_weight) noexcept {
+      const double explicit_value = *u;
+      const auto residual = [&explicit_value, &implicit_weight,
+                             &k](const double v) noexcept {
+        return std::make_pair(
+            v + implicit_weight * k * (cube(v) - 1.0) - explicit_value,
+            1.0 + 3.0 * implicit_weight * k * square(v));
+      };
+      *u = RootFinder::newton_raphson(residual, explicit_value, 0.0,
+                                      std::max(explicit_value, 1.0), 14);
+      *source = -k * (cube(*u) - 1.0);
+    };
+  };
+  const Slab slab(0., 1.);
+
+  // Compare to a finer integration.
+  const double reference =
+      imex_integrate(2., slab, 400, explicit_rhs, make_solver(1.0));
+  CHECK(imex_integrate(2., slab, 50, explicit_rhs, make_solver(1.0)) ==
+        approx(reference).epsilon(1e-5));
+
+  // A stiff source relaxes to the equilibrium without restricting the
+  // step.
+  CHECK(imex_integrate(2., slab, 4, explicit_rhs, make_solver(1.0e6)) ==
+        approx(1.0));
+}
@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "Parallel/PupStlCpp11.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeId.hpp"
+#include "Time/TimeSteppers/LowStorageRungeKutta3.hpp"
+#include "Time/TimeSteppers/TimeStepper.hpp"
+#include "tests/Unit/TestCreation.hpp"
+#include "tests/Unit/TestHelpers.hpp"
+#include "tests/Unit/Time/TimeSteppers/TimeStepperTestUtils.hpp"
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3",
+                  "[Unit][Time]") {
+  const TimeSteppers::LowStorageRungeKutta3 stepper{};
+  TimeStepperTestUtils::check_substep_properties(stepper);
+  TimeStepperTestUtils::integrate_test(stepper, 0, 1., 1e-9);
+  CHECK_FALSE(stepper.uses_history_values());
+
+  const Slab slab(0., 1.);
+  const TimeId time_id(true, 0, slab.start());
+  TimeSteppers::History<double, double> history;
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+  history.insert(slab.start(), 0., 0.);
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3.Variable",
+                  "[Unit][Time]") {
+  const TimeSteppers::LowStorageRungeKutta3 stepper{};
+  TimeStepperTestUtils::integrate_variable_test(stepper, 0, 1e-9);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3.Backwards",
+                  "[Unit][Time]") {
+  const TimeSteppers::LowStorageRungeKutta3 stepper{};
+  TimeStepperTestUtils::integrate_test(stepper, 0, -1., 1e-9);
+
+  const Slab slab(0., 1.);
+  const TimeId time_id(false, 0, slab.end());
+  TimeSteppers::History<double, double> history;
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+  history.insert(slab.start(), 0., 0.);
+  CHECK_FALSE(stepper.can_change_step_size(time_id, history));
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3.Storage",
+                  "[Unit][Time]") {
+  // Only the registers are kept between substeps.
+  const TimeSteppers::LowStorageRungeKutta3 stepper{};
+  const Slab slab(0., 1.);
+  const TimeDelta step_size = slab.duration() / 4;
+  Time time = slab.start();
+  double y = 1.;
+  TimeSteppers::History<double, double> history;
+  for (size_t i = 0; i < 4; ++i) {
+    TimeStepperTestUtils::take_step(&time, &y, &history, stepper,
+                                    [](const double v) { return -v; },
+                                    step_size);
+    CHECK(history.size() == 0);
+    CHECK(history.capacity() <= 2);
+    CHECK(history.inserts_since_emptied() == 0);
+  }
+  // The history allocates only the register and the derivative of the
+  // current substep
+  TimeStepperTestUtils::check_history_allocations(stepper, 2);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3.Stability",
+                  "[Unit][Time]") {
+  TimeStepperTestUtils::stability_test(TimeSteppers::LowStorageRungeKutta3{});
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3.Factory",
+                  "[Unit][Time]") {
+  test_factory_creation<TimeStepper>("  LowStorageRungeKutta3");
+  // Catch requires us to have at least one CHECK in each test
+  // The Unit.Time.TimeSteppers.LowStorageRungeKutta3.Factory does not need to
+  // check anything
+  CHECK(true);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3.Boundary.Equal",
+                  "[Unit][Time]") {
+  TimeStepperTestUtils::equal_rate_boundary(
+      TimeSteppers::LowStorageRungeKutta3{}, 0, 1e-9, true);
+}
+
+SPECTRE_TEST_CASE(
+    "Unit.Time.TimeSteppers.LowStorageRungeKutta3.Boundary.Equal.Backwards",
+    "[Unit][Time]") {
+  TimeStepperTestUtils::equal_rate_boundary(
+      TimeSteppers::LowStorageRungeKutta3{}, 0, 1e-9, false);
+}
+
+SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.LowStorageRungeKutta3.Serialization",
+                  "[Unit][Time]") {
+  TimeSteppers::LowStorageRungeKutta3 lsrk3{};
+  test_serialization(lsrk3);
+  test_serialization_via_base<TimeStepper,
+                              TimeSteppers::LowStorageRungeKutta3>();
+  // test operator !=
+  CHECK_FALSE(lsrk3 != lsrk3);
+}
@@ -18,6 +18,9 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.RungeKutta3", "[Unit][Time]") {
   const TimeSteppers::RungeKutta3 stepper{};
   TimeStepperTestUtils::check_substep_properties(stepper);
   TimeStepperTestUtils::integrate_test(stepper, 0, 1., 1e-9);
+  CHECK(stepper.uses_history_values());
+  // The values and the derivatives of all substeps
+  TimeStepperTestUtils::check_history_allocations(stepper, 6);
 
   const Slab slab(0., 1.);
   const TimeId time_id(true, 0, slab.start());
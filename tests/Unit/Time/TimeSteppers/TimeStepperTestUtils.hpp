@@ -8,6 +8,8 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <utility>
 
 #include "ErrorHandling/Assert.hpp"
 #include "Time/BoundaryHistory.hpp"
@@ -20,6 +22,19 @@
 
 namespace TimeStepperTestUtils {
 
+/// Insert into the history like Actions::RecordTimeStepperData
+template <typename Stepper, typename Vars, typename DerivVars>
+void record(
+    const gsl::not_null<TimeSteppers::History<Vars, DerivVars>*> history,
+    const Stepper& stepper, const Time& time, const Vars& value,
+    DerivVars&& deriv) noexcept {
+  if (stepper.uses_history_values()) {
+    history->insert(time, value, std::move(deriv));
+  } else {
+    history->insert_without_value(time, std::move(deriv));
+  }
+}
+
 template <typename Stepper, typename F>
 void take_step(
     const gsl::not_null<Time*> time,
@@ -33,7 +48,7 @@ void take_step(
        substep < stepper.number_of_substeps();
        ++substep) {
     CHECK(time_id.substep() == substep);
-    history->insert(time_id.time(), *y, rhs(*y));
+    record(history, stepper, time_id.time(), *y, rhs(*y));
     stepper.update_u(y, history, step_size);
     time_id = stepper.next_time_id(time_id, step_size);
   }
@@ -245,7 +260,7 @@ void equal_rate_boundary(const Stepper& stepper,
     for (uint64_t substep = 0;
          substep < stepper.number_of_substeps();
          ++substep) {
-      volume_history.insert(time_id.time(), y, 0.);
+      record(make_not_null(&volume_history), stepper, time_id.time(), y, 0.);
       boundary_history.local_insert(time_id, unused_local_deriv);
       boundary_history.remote_insert(time_id, driver(time_id.time().value()));
 
@@ -265,4 +280,111 @@ void equal_rate_boundary(const Stepper& stepper,
   CHECK(boundary_history.remote_size() < 20);
 }
 
+/// A variable counting the instances that hold data, i.e., the
+/// registers allocated by a time stepper.  Like Variables, a default
+/// constructed instance holds no data, and assigning to an instance
+/// holding data does not allocate.
+class Register {
+ public:
+  Register() = default;
+  explicit Register(const double value) noexcept { allocate(value); }
+  Register(const Register& rhs) noexcept {
+    if (rhs.data_ != nullptr) {
+      allocate(*rhs.data_);
+    }
+  }
+  Register(Register&& rhs) noexcept = default;
+  Register& operator=(const Register& rhs) noexcept {
+    if (rhs.data_ == nullptr) {
+      release();
+    } else if (data_ == nullptr) {
+      allocate(*rhs.data_);
+    } else {
+      *data_ = *rhs.data_;
+    }
+    return *this;
+  }
+  Register& operator=(Register&& rhs) noexcept {
+    release();
+    data_ = std::move(rhs.data_);
+    return *this;
+  }
+  ~Register() noexcept { release(); }
+
+  double value() const noexcept { return *data_; }
+
+  Register& operator+=(const Register& rhs) noexcept {
+    *data_ += *rhs.data_;
+    return *this;
+  }
+  Register& operator*=(const double rhs) noexcept {
+    *data_ *= rhs;
+    return *this;
+  }
+  friend Register operator+(const Register& lhs,
+                            const Register& rhs) noexcept {
+    return Register(*lhs.data_ + *rhs.data_);
+  }
+  friend Register operator-(const Register& lhs,
+                            const Register& rhs) noexcept {
+    return Register(*lhs.data_ - *rhs.data_);
+  }
+  friend Register operator*(const double lhs, const Register& rhs) noexcept {
+    return Register(lhs * *rhs.data_);
+  }
+
+  /// The number of instances holding data
+  static size_t& allocated() noexcept {
+    static size_t allocated = 0;
+    return allocated;
+  }
+
+ private:
+  void allocate(const double value) noexcept {
+    data_ = std::make_unique<double>(value);
+    ++allocated();
+  }
+  void release() noexcept {
+    if (data_ != nullptr) {
+      data_.reset();
+      --allocated();
+    }
+  }
+
+  std::unique_ptr<double> data_{};
+};
+
+/// Check the number of variables allocated by the history of a time
+/// stepper filled like Actions::RecordTimeStepperData, including those
+/// of unneeded entries kept for reuse, after each step.
+template <typename Stepper>
+void check_history_allocations(const Stepper& stepper,
+                               const size_t expected) noexcept {
+  const Slab slab(0., 1.);
+  const TimeDelta step_size = slab.duration() / 4;
+  TimeId time_id(true, 0, slab.start());
+  const size_t initially_allocated = Register::allocated();
+  {
+    Register y(1.);
+    Register dt_y{};
+    TimeSteppers::History<Register, Register> history;
+    for (size_t step = 0; step < 3; ++step) {
+      for (uint64_t substep = 0; substep < stepper.number_of_substeps();
+           ++substep) {
+        dt_y = -1. * y;
+        record(make_not_null(&history), stepper, time_id.time(), y,
+               std::move(dt_y));
+        stepper.update_u(make_not_null(&y), make_not_null(&history),
+                         step_size);
+        time_id = stepper.next_time_id(time_id, step_size);
+        // The variables and the derivative are allocated besides the
+        // history
+        CHECK(Register::allocated() - initially_allocated <= 2 + expected);
+      }
+      CHECK(Register::allocated() - initially_allocated == 2 + expected);
+    }
+  }
+  CHECK(Register::allocated() == initially_allocated);
+}
+
 }  // namespace TimeStepperTestUtils
@@ -0,0 +1,50 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "tests/Unit/TestingFramework.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Utilities/AlignedAllocator.hpp"
+
+namespace {
+template <typename T>
+bool is_aligned(const T* const pointer, const size_t alignment) noexcept {
+  return reinterpret_cast<std::uintptr_t>(pointer) % alignment == 0;
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Utilities.AlignedAllocator", "[Utilities][Unit]") {
+  AlignedAllocator<double> allocator{};
+  CHECK(allocator.allocate(0) == nullptr);
+  for (size_t size = 1; size < 20; ++size) {
+    double* const p = allocator.allocate(size);
+    CHECK(is_aligned(p, spectre_storage_alignment));
+    allocator.deallocate(p, size);
+  }
+
+  AlignedAllocator<char, 128> char_allocator{};
+  char* const c = char_allocator.allocate(3);
+  CHECK(is_aligned(c, 128));
+  char_allocator.deallocate(c, 3);
+
+  const AlignedAllocator<int> int_allocator(allocator);
+  CHECK(int_allocator == AlignedAllocator<int>{});
+  CHECK_FALSE(int_allocator != AlignedAllocator<int>{});
+
+  std::vector<double, AlignedAllocator<double>> vector(5, 1.0);
+  CHECK(is_aligned(vector.data(), spectre_storage_alignment));
+  vector.resize(100, 2.0);
+  CHECK(is_aligned(vector.data(), spectre_storage_alignment));
+  CHECK(vector[4] == 1.0);
+  CHECK(vector[99] == 2.0);
+
+  const size_t allocations = number_of_aligned_allocations();
+  double* const p = allocator.allocate(4);
+  CHECK(number_of_aligned_allocations() == allocations + 1);
+  allocator.deallocate(p, 4);
+  CHECK(allocator.allocate(0) == nullptr);
+  CHECK(number_of_aligned_allocations() == allocations + 1);
+}